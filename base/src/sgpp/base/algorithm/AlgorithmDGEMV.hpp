@@ -155,6 +155,109 @@ class AlgorithmDGEMV {
       }
     }
   }
+
+  /**
+   * Performs the DGEMV Operation on the grid for several vectors at once (DGEMM), the affected
+   * basis functions of each data point are searched only once for all vectors
+   *
+   * @param storage GridStorage object that contains the grid's points information
+   * @param basis a reference to a class that implements a specific basis
+   * @param source the vectors (one row per data point, one column per vector)
+   * @param x the d-dimensional vector with data points (row-wise)
+   * @param result the results (one row per grid point, one column per vector)
+   */
+  void mult_transposed_matrix(GridStorage& storage, BASIS& basis, const DataMatrix& source,
+                              DataMatrix& x, DataMatrix& result) {
+    typedef std::vector<std::pair<size_t, double> > IndexValVector;
+
+    const size_t numVectors = source.getNcols();
+    result.resizeRowsCols(storage.getSize(), numVectors);
+    result.setAll(0.0);
+
+    #pragma omp parallel
+    {
+      size_t source_size = source.getNrows();
+      DataMatrix privateResult(result.getNrows(), numVectors, 0.0);
+      DataVector line(x.getNcols());
+      IndexValVector vec;
+      GetAffectedBasisFunctions<BASIS> ga(storage);
+
+      #pragma omp for schedule(static)
+
+      for (size_t i = 0; i < source_size; i++) {
+        vec.clear();
+
+        x.getRow(i, line);
+
+        ga(basis, line, vec);
+
+        const double* sourceRow = source.getPointer() + i * numVectors;
+
+        for (IndexValVector::iterator iter = vec.begin(); iter != vec.end(); iter++) {
+          double* resultRow = privateResult.getPointer() + iter->first * numVectors;
+
+          for (size_t k = 0; k < numVectors; k++) {
+            resultRow[k] += iter->second * sourceRow[k];
+          }
+        }
+      }
+
+      #pragma omp critical
+      {
+        result.add(privateResult);
+      }
+    }
+  }
+
+  /**
+   * Performs the DGEMV Operation on the grid having a transposed matrix for several vectors at
+   * once (DGEMM), the affected basis functions of each data point are searched only once for all
+   * vectors
+   *
+   * @param storage GridStorage object that contains the grid's points information
+   * @param basis a reference to a class that implements a specific basis
+   * @param source the coefficient vectors (one row per grid point, one column per vector)
+   * @param x the d-dimensional vector with data points (row-wise)
+   * @param result the results (one row per data point, one column per vector)
+   */
+  void mult_matrix(GridStorage& storage, BASIS& basis, const DataMatrix& source,
+                   DataMatrix& x, DataMatrix& result) {
+    typedef std::vector<std::pair<size_t, double> > IndexValVector;
+
+    const size_t numVectors = source.getNcols();
+    result.resizeRowsCols(x.getNrows(), numVectors);
+    result.setAll(0.0);
+
+    #pragma omp parallel
+    {
+      size_t result_size = result.getNrows();
+
+      DataVector line(x.getNcols());
+      IndexValVector vec;
+
+      GetAffectedBasisFunctions<BASIS> ga(storage);
+
+      #pragma omp for schedule (static)
+
+      for (size_t i = 0; i < result_size; i++) {
+        vec.clear();
+
+        x.getRow(i, line);
+
+        ga(basis, line, vec);
+
+        double* resultRow = result.getPointer() + i * numVectors;
+
+        for (IndexValVector::iterator iter = vec.begin(); iter != vec.end(); iter++) {
+          const double* sourceRow = source.getPointer() + iter->first * numVectors;
+
+          for (size_t k = 0; k < numVectors; k++) {
+            resultRow[k] += iter->second * sourceRow[k];
+          }
+        }
+      }
+    }
+  }
 };
 
 }  // namespace base
@@ -6,6 +6,7 @@
 #ifndef OPERATIONMATRIX_HPP
 #define OPERATIONMATRIX_HPP
 
+#include <sgpp/base/datatypes/DataMatrix.hpp>
 #include <sgpp/base/datatypes/DataVector.hpp>
 
 #include <sgpp/globaldef.hpp>
@@ -38,6 +39,28 @@ class OperationMatrix {
    * @param result DataVector into which the result of the Laplace operation is stored
    */
   virtual void mult(DataVector& alpha, DataVector& result) = 0;
+
+  /**
+   * Multiplication with several vectors at once, the vectors are the columns of alphas.
+   * The default implementation calls mult() for every column. Operators that can process
+   * several vectors in one pass (e.g. over a data set) should override this.
+   *
+   * @param alphas DataMatrix whose columns contain the ansatzfunctions' coefficients
+   * @param result DataMatrix into which the results are stored column by column
+   */
+  virtual void multMatrix(DataMatrix& alphas, DataMatrix& result) {
+    const size_t size = alphas.getNrows();
+    const size_t numVectors = alphas.getNcols();
+    DataVector alpha(size);
+    DataVector column(size);
+    result.resizeRowsCols(size, numVectors);
+
+    for (size_t k = 0; k < numVectors; k++) {
+      alphas.getColumn(k, alpha);
+      mult(alpha, column);
+      result.setColumn(k, column);
+    }
+  }
 };
 
 }  // namespace base
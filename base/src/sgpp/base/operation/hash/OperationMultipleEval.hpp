@@ -99,6 +99,52 @@ class OperationMultipleEval {
     throw sgpp::base::not_implemented_exception();
   }
 
+  /**
+   * Multiplication of @f$B^T@f$ with several vectors at once, e.g. the coefficient vectors of
+   * several models on the same grid (one per class, fold or weak learner).
+   *
+   * The default implementation applies mult() to every column. Implementations that stream the
+   * dataset override it to read each block of data points only once for all vectors.
+   *
+   * @param alphas matrix whose columns are the vectors to which @f$B@f$ is applied (one row per
+   * grid point)
+   * @param result the results of the matrix vector multiplications (one row per data point, one
+   * column per vector), resized if necessary
+   */
+  virtual void multMatrix(DataMatrix& alphas, DataMatrix& result) {
+    const size_t numVectors = alphas.getNcols();
+    DataVector alpha(alphas.getNrows());
+    DataVector resultColumn(dataset.getNrows());
+    result.resizeRowsCols(dataset.getNrows(), numVectors);
+
+    for (size_t k = 0; k < numVectors; k++) {
+      alphas.getColumn(k, alpha);
+      this->mult(alpha, resultColumn);
+      result.setColumn(k, resultColumn);
+    }
+  }
+
+  /**
+   * Multiplication of @f$B@f$ with several vectors at once, see multMatrix().
+   *
+   * @param sources matrix whose columns are the vectors to which @f$B^T@f$ is applied (one row per
+   * data point)
+   * @param result the results of the matrix vector multiplications (one row per grid point, one
+   * column per vector), resized if necessary
+   */
+  virtual void multTransposeMatrix(DataMatrix& sources, DataMatrix& result) {
+    const size_t numVectors = sources.getNcols();
+    DataVector source(sources.getNrows());
+    DataVector resultColumn(grid.getSize());
+    result.resizeRowsCols(grid.getSize(), numVectors);
+
+    for (size_t k = 0; k < numVectors; k++) {
+      sources.getColumn(k, source);
+      this->multTranspose(source, resultColumn);
+      result.setColumn(k, resultColumn);
+    }
+  }
+
   /**
    * Evaluate multiple datapoints with the specified grid
    *
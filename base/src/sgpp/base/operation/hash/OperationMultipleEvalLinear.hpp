@@ -35,6 +35,8 @@ class OperationMultipleEvalLinear : public OperationMultipleEval {
 
   void mult(DataVector& alpha, DataVector& result) override;
   void multTranspose(DataVector& source, DataVector& result) override;
+  void multMatrix(DataMatrix& alphas, DataMatrix& result) override;
+  void multTransposeMatrix(DataMatrix& sources, DataMatrix& result) override;
 
   double getDuration() override;
 
@@ -26,6 +26,21 @@ void OperationMultipleEvalLinearBoundary::multTranspose(DataVector& source, Data
   op.mult_transposed(storage, base, source, this->dataset, result);
 }
 
+void OperationMultipleEvalLinearBoundary::multMatrix(DataMatrix& alphas, DataMatrix& result) {
+  AlgorithmDGEMV<SLinearBoundaryBase> op;
+  LinearBoundaryBasis<unsigned int, unsigned int> base;
+
+  op.mult_matrix(storage, base, alphas, this->dataset, result);
+}
+
+void OperationMultipleEvalLinearBoundary::multTransposeMatrix(DataMatrix& sources,
+                                                              DataMatrix& result) {
+  AlgorithmDGEMV<SLinearBoundaryBase> op;
+  LinearBoundaryBasis<unsigned int, unsigned int> base;
+
+  op.mult_transposed_matrix(storage, base, sources, this->dataset, result);
+}
+
 double OperationMultipleEvalLinearBoundary::getDuration() { return 0.0; }
 
 }  // namespace base
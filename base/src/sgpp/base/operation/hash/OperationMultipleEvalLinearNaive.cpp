@@ -72,6 +72,91 @@ void OperationMultipleEvalLinearNaive::multTranspose(DataVector& alpha, DataVect
   }
 }
 
+void OperationMultipleEvalLinearNaive::multMatrix(DataMatrix& alphas, DataMatrix& result) {
+  const size_t n = storage.getSize();
+  const size_t d = storage.getDimension();
+  const size_t m = dataset.getNrows();
+  const size_t numVectors = alphas.getNcols();
+
+  result.resizeRowsCols(m, numVectors);
+  result.setAll(0.0);
+
+  pointsInUnitCube = dataset;
+  storage.getBoundingBox()->transformPointsToUnitCube(pointsInUnitCube);
+
+  for (size_t j = 0; j < m; j++) {
+    double* resultRow = result.getPointer() + j * numVectors;
+
+    for (size_t i = 0; i < n; i++) {
+      const GridPoint& gp = storage[i];
+      double curValue = 1.0;
+
+      for (size_t t = 0; t < d; t++) {
+        const double val1d = base.eval(gp.getLevel(t), gp.getIndex(t), pointsInUnitCube(j, t));
+
+        if (val1d == 0.0) {
+          curValue = 0.0;
+          break;
+        }
+
+        curValue *= val1d;
+      }
+
+      // the basis function is evaluated once for all vectors
+      if (curValue != 0.0) {
+        const double* alphaRow = alphas.getPointer() + i * numVectors;
+
+        for (size_t k = 0; k < numVectors; k++) {
+          resultRow[k] += alphaRow[k] * curValue;
+        }
+      }
+    }
+  }
+}
+
+void OperationMultipleEvalLinearNaive::multTransposeMatrix(DataMatrix& sources,
+                                                           DataMatrix& result) {
+  const size_t n = storage.getSize();
+  const size_t d = storage.getDimension();
+  const size_t m = dataset.getNrows();
+  const size_t numVectors = sources.getNcols();
+
+  result.resizeRowsCols(n, numVectors);
+  result.setAll(0.0);
+
+  pointsInUnitCube = dataset;
+  storage.getBoundingBox()->transformPointsToUnitCube(pointsInUnitCube);
+
+  for (size_t i = 0; i < n; i++) {
+    const GridPoint& gp = storage[i];
+    double* resultRow = result.getPointer() + i * numVectors;
+
+    for (size_t j = 0; j < m; j++) {
+      double curValue = 1.0;
+
+      for (size_t t = 0; t < d; t++) {
+        const double val1d = base.eval(gp.getLevel(t), gp.getIndex(t), pointsInUnitCube(j, t));
+
+        if (val1d == 0.0) {
+          curValue = 0.0;
+          break;
+        }
+
+        curValue *= val1d;
+      }
+
+      // the basis function is evaluated once for all vectors
+      if (curValue != 0.0) {
+        const double* sourceRow = sources.getPointer() + j * numVectors;
+
+        for (size_t k = 0; k < numVectors; k++) {
+          resultRow[k] += sourceRow[k] * curValue;
+        }
+      }
+    }
+  }
+}
+
 double OperationMultipleEvalLinearNaive::getDuration() { return 0.0; }
 
 }  // namespace base
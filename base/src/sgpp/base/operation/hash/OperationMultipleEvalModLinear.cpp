@@ -27,6 +27,20 @@ void OperationMultipleEvalModLinear::multTranspose(DataVector& source, DataVecto
   op.mult_transposed(storage, base, source, this->dataset, result);
 }
 
+void OperationMultipleEvalModLinear::multMatrix(DataMatrix& alphas, DataMatrix& result) {
+  AlgorithmDGEMV<SLinearModifiedBase> op;
+  LinearModifiedBasis<unsigned int, unsigned int> base;
+
+  op.mult_matrix(storage, base, alphas, this->dataset, result);
+}
+
+void OperationMultipleEvalModLinear::multTransposeMatrix(DataMatrix& sources, DataMatrix& result) {
+  AlgorithmDGEMV<SLinearModifiedBase> op;
+  LinearModifiedBasis<unsigned int, unsigned int> base;
+
+  op.mult_transposed_matrix(storage, base, sources, this->dataset, result);
+}
+
 double OperationMultipleEvalModLinear::getDuration() { return 0.0; }
 
 }  // namespace base
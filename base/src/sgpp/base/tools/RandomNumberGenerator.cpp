@@ -6,8 +6,13 @@
 #include <sgpp/base/tools/RandomNumberGenerator.hpp>
 #include <sgpp/globaldef.hpp>
 
+#include <cmath>
 #include <ctime>
 
+#ifndef M_PI
+#define M_PI 3.14159265358979323846
+#endif
+
 namespace sgpp {
 namespace base {
 
@@ -53,5 +58,103 @@ void RandomNumberGenerator::setSeed(RandomNumberGenerator::SeedType seed) {
   this->seed = seed;
   generator.seed(seed);
 }
+
+uint64_t RandomNumberGenerator::getStreamKey() {
+  // std::mt19937 generates 32-bit numbers
+  const uint64_t high = generator();
+  return (high << 32) | static_cast<uint64_t>(generator());
+}
+
+RandomNumberStream::RandomNumberStream(uint64_t key, uint64_t streamId) : position(2) {
+  this->key[0] = static_cast<uint32_t>(key);
+  this->key[1] = static_cast<uint32_t>(key >> 32);
+  counter[0] = 0;
+  counter[1] = 0;
+  counter[2] = static_cast<uint32_t>(streamId);
+  counter[3] = static_cast<uint32_t>(streamId >> 32);
+}
+
+void RandomNumberStream::generateBlock() {
+  const uint64_t M0 = 0xD2511F53;
+  const uint64_t M1 = 0xCD9E8D57;
+  uint32_t k0 = key[0];
+  uint32_t k1 = key[1];
+  uint32_t x0 = counter[0];
+  uint32_t x1 = counter[1];
+  uint32_t x2 = counter[2];
+  uint32_t x3 = counter[3];
+
+  for (int round = 0; round < 10; round++) {
+    const uint64_t p0 = M0 * x0;
+    const uint64_t p1 = M1 * x2;
+    x0 = static_cast<uint32_t>(p1 >> 32) ^ x1 ^ k0;
+    x1 = static_cast<uint32_t>(p1);
+    x2 = static_cast<uint32_t>(p0 >> 32) ^ x3 ^ k1;
+    x3 = static_cast<uint32_t>(p0);
+    // Weyl sequence of the round keys
+    k0 += 0x9E3779B9;
+    k1 += 0xBB67AE85;
+  }
+
+  block[0] = x0;
+  block[1] = x1;
+  block[2] = x2;
+  block[3] = x3;
+  position = 0;
+
+  if (++counter[0] == 0) {
+    ++counter[1];
+  }
+}
+
+RandomNumberStream::result_type RandomNumberStream::operator()() {
+  if (position == 2) {
+    generateBlock();
+  }
+
+  const uint64_t high = block[2 * position + 1];
+  const uint64_t result = (high << 32) | static_cast<uint64_t>(block[2 * position]);
+  position++;
+  return result;
+}
+
+void RandomNumberStream::discard(uint64_t n) {
+  // index of the next number and of the next block
+  const uint64_t nextBlock = (static_cast<uint64_t>(counter[1]) << 32) | counter[0];
+  const uint64_t next = 2 * nextBlock - (2 - position) + n;
+  counter[0] = static_cast<uint32_t>(next / 2);
+  counter[1] = static_cast<uint32_t>((next / 2) >> 32);
+  position = 2;
+
+  if (next % 2 == 1) {
+    generateBlock();
+    position = 1;
+  }
+}
+
+double RandomNumberStream::getUniformRN(double a, double b) {
+  // midpoints of 2^53 equally sized intervals, never 0 or 1
+  const double u = (static_cast<double>((*this)() >> 11) + 0.5) / 9007199254740992.0;
+  return a + (b - a) * u;
+}
+
+size_t RandomNumberStream::getUniformIndexRN(size_t size) {
+  // rejection of the incomplete last range avoids a bias towards small indices
+  const uint64_t range = static_cast<uint64_t>(size);
+  const uint64_t limit = UINT64_MAX - UINT64_MAX % range;
+  uint64_t x;
+
+  do {
+    x = (*this)();
+  } while (x >= limit);
+
+  return static_cast<size_t>(x % range);
+}
+
+double RandomNumberStream::getGaussianRN(double mean, double stdDev) {
+  const double u1 = getUniformRN();
+  const double u2 = getUniformRN();
+  return mean + stdDev * std::sqrt(-2.0 * std::log(u1)) * std::cos(2.0 * M_PI * u2);
+}
 }  // namespace base
 }  // namespace sgpp
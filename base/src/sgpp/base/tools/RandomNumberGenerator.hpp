@@ -8,6 +8,7 @@
 #include <sgpp/base/datatypes/DataVector.hpp>
 #include <sgpp/globaldef.hpp>
 
+#include <cstdint>
 #include <random>
 
 namespace sgpp {
@@ -89,6 +90,17 @@ class RandomNumberGenerator {
    */
   void setSeed(SeedType seed);
 
+  /**
+   * Draws a key for a family of independent RandomNumberStream objects.
+   * Parallel code should draw one key (serially) and create one stream per task
+   * (e.g., per sample) from the key and the index of the task.
+   * The results are then reproducible via setSeed() and do not depend on the
+   * number of threads or on the scheduling of the tasks.
+   *
+   * @return      stream key
+   */
+  uint64_t getStreamKey();
+
  protected:
   /// random number generator
   std::mt19937 generator;
@@ -111,5 +123,98 @@ class RandomNumberGenerator {
    */
   void operator=(const RandomNumberGenerator&) = delete;
 };
+
+/**
+ * Counter-based stream of pseudo-random numbers (Philox4x32-10, see
+ * Salmon et al., Parallel Random Numbers: As Easy as 1, 2, 3, SC 2011).
+ *
+ * The n-th number of a stream is computed directly from the key, the stream ID and n,
+ * so streams are cheap to create (no state has to be initialized) and
+ * streams with the same key and different IDs are statistically independent.
+ * This allows to create one stream per thread or per task in parallel code.
+ * The class satisfies the requirements of a uniform random bit generator, i.e.,
+ * it can be used with the distributions of &lt;random&gt;.
+ * However, the methods of this class should be preferred, as they return the same
+ * numbers on all platforms.
+ */
+class RandomNumberStream {
+ public:
+  /// type of the generated numbers
+  typedef uint64_t result_type;
+
+  /**
+   * Constructor.
+   *
+   * @param key       key of the family of streams
+   *                  (e.g., RandomNumberGenerator::getStreamKey())
+   * @param streamId  ID of the stream within the family
+   */
+  RandomNumberStream(uint64_t key, uint64_t streamId);
+
+  /**
+   * @return  smallest possible number
+   */
+  static constexpr result_type min() { return 0; }
+
+  /**
+   * @return  largest possible number
+   */
+  static constexpr result_type max() { return UINT64_MAX; }
+
+  /**
+   * @return  next number of the stream, uniformly distributed in \f$\{0, \dotsc, 2^{64} - 1\}\f$
+   */
+  result_type operator()();
+
+  /**
+   * Skips numbers of the stream.
+   *
+   * @param n   number of numbers to skip
+   */
+  void discard(uint64_t n);
+
+  /**
+   * Generate a uniform pseudo-random number (53 random bits).
+   *
+   * @param a lower bound
+   * @param b upper bound
+   * @return  uniform pseudo-random number in \f$(a, b)\f$, the bounds are never returned
+   */
+  double getUniformRN(double a = 0.0, double b = 1.0);
+
+  /**
+   * Generate a uniform pseudo-random array index.
+   *
+   * @param size  size of the array
+   * @return      discrete uniform pseudo-random number in
+   *              \f$\{0, \dotsc, \text{\texttt{size}} - 1\}\f$
+   */
+  size_t getUniformIndexRN(size_t size);
+
+  /**
+   * Generate a Gaussian pseudo-random number (Box-Muller transform).
+   *
+   * @param mean      mean of the Gaussian distribution
+   * @param stdDev    standard deviation of the Gaussian distribution
+   * @return          Gaussian pseudo-random number
+   */
+  double getGaussianRN(double mean = 0.0, double stdDev = 1.0);
+
+ protected:
+  /// key of the block cipher
+  uint32_t key[2];
+  /// counter of the next block (index of the block in the low words, stream ID in the high words)
+  uint32_t counter[4];
+  /// current block of four 32-bit numbers
+  uint32_t block[4];
+  /// number of 64-bit numbers of the current block that have been used (0, 1 or 2)
+  unsigned int position;
+
+  /**
+   * Computes the block of the current counter and increments the counter.
+   */
+  void generateBlock();
+};
+
 }  // namespace base
 }  // namespace sgpp
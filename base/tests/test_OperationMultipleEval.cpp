@@ -12,6 +12,8 @@
 // #include <sgpp/datadriven/DatadrivenOpFactory.hpp>
 #include <sgpp/base/operation/BaseOpFactory.hpp>
 
+#include <random>
+
 using sgpp::base::BoundingBox1D;
 using sgpp::base::DataMatrix;
 using sgpp::base::DataVector;
@@ -78,4 +80,71 @@ BOOST_AUTO_TEST_CASE(testOperationMultipleEval) {
   BOOST_CHECK_CLOSE(result[2], result_ref[2], 1e-7);
 }
 
+BOOST_AUTO_TEST_CASE(testOperationMultipleEvalMatrix) {
+  const size_t dim = 3;
+  const size_t numberDataPoints = 101;
+  const size_t numVectors = 5;
+  std::mt19937 generator(42);
+  std::uniform_real_distribution<double> distribution(0.0, 1.0);
+
+  DataMatrix dataset(numberDataPoints, dim);
+
+  for (size_t i = 0; i < dataset.getSize(); i++) {
+    dataset[i] = distribution(generator);
+  }
+
+  // Linear, ModLinear, LinearBoundary and the naive operation of Linear
+  for (int type = 0; type < 4; type++) {
+    std::unique_ptr<Grid> grid(type == 1   ? Grid::createModLinearGrid(dim)
+                               : type == 2 ? Grid::createLinearBoundaryGrid(dim)
+                                           : Grid::createLinearGrid(dim));
+    grid->getGenerator().regular(3);
+    const size_t N = grid->getSize();
+
+    DataMatrix alphas(N, numVectors);
+    DataMatrix sources(numberDataPoints, numVectors);
+
+    for (size_t i = 0; i < alphas.getSize(); i++) {
+      alphas[i] = distribution(generator) - 0.5;
+    }
+
+    for (size_t i = 0; i < sources.getSize(); i++) {
+      sources[i] = distribution(generator) - 0.5;
+    }
+
+    std::unique_ptr<OperationMultipleEval> op(
+        (type == 3) ? sgpp::op_factory::createOperationMultipleEvalNaive(*grid, dataset)
+                    : sgpp::op_factory::createOperationMultipleEval(*grid, dataset));
+
+    DataMatrix result;
+    DataMatrix resultTranspose;
+    op->multMatrix(alphas, result);
+    op->multTransposeMatrix(sources, resultTranspose);
+    BOOST_CHECK_EQUAL(result.getNrows(), numberDataPoints);
+    BOOST_CHECK_EQUAL(result.getNcols(), numVectors);
+    BOOST_CHECK_EQUAL(resultTranspose.getNrows(), N);
+    BOOST_CHECK_EQUAL(resultTranspose.getNcols(), numVectors);
+
+    // every column matches the evaluation of a single vector
+    for (size_t k = 0; k < numVectors; k++) {
+      DataVector alpha(N);
+      DataVector source(numberDataPoints);
+      DataVector result_ref(numberDataPoints);
+      DataVector resultTranspose_ref(N);
+      alphas.getColumn(k, alpha);
+      sources.getColumn(k, source);
+      op->mult(alpha, result_ref);
+      op->multTranspose(source, resultTranspose_ref);
+
+      for (size_t i = 0; i < numberDataPoints; i++) {
+        BOOST_CHECK_SMALL(result.get(i, k) - result_ref[i], 1e-12);
+      }
+
+      for (size_t j = 0; j < N; j++) {
+        BOOST_CHECK_SMALL(resultTranspose.get(j, k) - resultTranspose_ref[j], 1e-12);
+      }
+    }
+  }
+}
+
 BOOST_AUTO_TEST_SUITE_END()
@@ -15,6 +15,7 @@
 
 using sgpp::base::Printer;
 using sgpp::base::RandomNumberGenerator;
+using sgpp::base::RandomNumberStream;
 
 double calculateMean(std::vector<double>& x) {
   double mean = 0.0;
@@ -124,3 +125,84 @@ BOOST_AUTO_TEST_CASE(TestRandomNumberGenerator) {
     BOOST_CHECK_SMALL(calculateVariance(numbers) - (kDbl * kDbl - 1.0) / 12.0, 0.01 * kDbl * kDbl);
   }
 }
+
+BOOST_AUTO_TEST_CASE(TestRandomNumberStream) {
+  // Test sgpp::base::RandomNumberStream.
+  const size_t N = 20000;
+  std::vector<double> numbers(N);
+
+  // known answer of Philox4x32-10 (counter 0, key 0)
+  {
+    RandomNumberStream stream(0, 0);
+    BOOST_CHECK_EQUAL(stream(), 0xe169c58d6627e8d5ULL);
+    BOOST_CHECK_EQUAL(stream(), 0x9b00dbd8bc57ac4cULL);
+  }
+
+  // streams are reproducible, discard skips numbers, different IDs give different numbers
+  {
+    RandomNumberStream stream(42, 7);
+    RandomNumberStream sameStream(42, 7);
+    RandomNumberStream otherStream(42, 8);
+    std::vector<RandomNumberStream::result_type> values(11);
+
+    for (size_t i = 0; i < values.size(); i++) {
+      values[i] = stream();
+      BOOST_CHECK_EQUAL(values[i], sameStream());
+      BOOST_CHECK_NE(values[i], otherStream());
+    }
+
+    RandomNumberStream skippedStream(42, 7);
+    skippedStream.discard(3);
+    BOOST_CHECK_EQUAL(skippedStream(), values[3]);
+    skippedStream.discard(6);
+    BOOST_CHECK_EQUAL(skippedStream(), values[10]);
+  }
+
+  // stream keys depend on the seed of the generator
+  {
+    RandomNumberGenerator::getInstance().setSeed(42);
+    const uint64_t key = RandomNumberGenerator::getInstance().getStreamKey();
+    BOOST_CHECK_NE(RandomNumberGenerator::getInstance().getStreamKey(), key);
+    RandomNumberGenerator::getInstance().setSeed(42);
+    BOOST_CHECK_EQUAL(RandomNumberGenerator::getInstance().getStreamKey(), key);
+  }
+
+  // test continuous uniform random numbers, one stream per number
+  {
+    for (size_t i = 0; i < N; i++) {
+      RandomNumberStream stream(1, i);
+      numbers[i] = stream.getUniformRN();
+      BOOST_CHECK_GT(numbers[i], 0.0);
+      BOOST_CHECK_LT(numbers[i], 1.0);
+    }
+
+    BOOST_CHECK_SMALL(calculateMean(numbers) - 0.5, 1e-2);
+    BOOST_CHECK_SMALL(calculateVariance(numbers) - 1.0 / 12.0, 1e-3);
+  }
+
+  // test Gaussian random numbers
+  {
+    RandomNumberStream stream(2, 0);
+
+    for (size_t i = 0; i < N; i++) {
+      numbers[i] = stream.getGaussianRN(12.3, 2.6);
+    }
+
+    BOOST_CHECK_SMALL(calculateMean(numbers) - 12.3, 0.1 * 2.6);
+    BOOST_CHECK_SMALL(calculateVariance(numbers) - 2.6 * 2.6, 0.1 * 2.6 * 2.6);
+  }
+
+  // test discrete uniform random numbers
+  {
+    RandomNumberStream stream(3, 0);
+
+    for (size_t i = 0; i < N; i++) {
+      numbers[i] = static_cast<double>(stream.getUniformIndexRN(7));
+      BOOST_CHECK_GE(numbers[i], 0);
+      BOOST_CHECK_LE(numbers[i], 6);
+    }
+
+    BOOST_CHECK_SMALL(calculateMean(numbers) - 3.0, 0.07);
+    BOOST_CHECK_SMALL(calculateVariance(numbers) - 4.0, 0.28);
+  }
+}
@@ -571,5 +571,20 @@ datadriven::OperationCovariance* createOperationCovariance(base::Grid& grid) {
   return new datadriven::OperationCovariance(grid);
 }
 
+datadriven::OperationCreateGraph* createOperationCreateGraph(base::DataMatrix& dataset, size_t k) {
+  return new datadriven::OperationCreateGraph(dataset, k);
+}
+
+datadriven::OperationPruneGraph* createOperationPruneGraph(base::Grid& grid,
+                                                          base::DataVector& alpha,
+                                                          base::DataMatrix& dataset,
+                                                          double threshold, size_t k) {
+  return new datadriven::OperationPruneGraph(grid, alpha, dataset, threshold, k);
+}
+
+datadriven::OperationDensityClustering* createOperationDensityClustering(bool verbose) {
+  return new datadriven::OperationDensityClustering(verbose);
+}
+
 }  // namespace op_factory
 }  // namespace sgpp
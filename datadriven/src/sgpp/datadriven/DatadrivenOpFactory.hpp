@@ -19,6 +19,9 @@
 #include <sgpp/datadriven/operation/hash/simple/OperationRosenblattTransformation.hpp>
 #include <sgpp/datadriven/operation/hash/simple/OperationInverseRosenblattTransformation.hpp>
 #include <sgpp/datadriven/operation/hash/simple/OperationCovariance.hpp>
+#include <sgpp/datadriven/operation/hash/simple/OperationCreateGraph.hpp>
+#include <sgpp/datadriven/operation/hash/simple/OperationPruneGraph.hpp>
+#include <sgpp/datadriven/operation/hash/simple/OperationDensityClustering.hpp>
 #include <sgpp/base/operation/hash/OperationMultipleEval.hpp>
 #include <sgpp/datadriven/operation/hash/DatadrivenOperationCommon.hpp>
 
@@ -233,5 +236,40 @@ datadriven::OperationLimitFunctionValueRange* createOperationLimitFunctionValueR
  */
 datadriven::OperationCovariance* createOperationCovariance(base::Grid& grid);
 
+/**
+ * Factory method, returning an OperationCreateGraph (k nearest neighbor graph on the CPU).
+ * Note: object has to be freed after use.
+ *
+ * @param dataset the datapoints
+ * @param k number of neighbors of each datapoint
+ * @return Pointer to the new OperationCreateGraph object
+ */
+datadriven::OperationCreateGraph* createOperationCreateGraph(base::DataMatrix& dataset, size_t k);
+
+/**
+ * Factory method, returning an OperationPruneGraph (density based graph pruning on the CPU).
+ * Note: object has to be freed after use.
+ *
+ * @param grid the sparse grid of the density
+ * @param alpha coefficients of the density
+ * @param dataset the datapoints of the graph
+ * @param threshold density threshold
+ * @param k number of neighbors of each datapoint
+ * @return Pointer to the new OperationPruneGraph object
+ */
+datadriven::OperationPruneGraph* createOperationPruneGraph(base::Grid& grid,
+                                                          base::DataVector& alpha,
+                                                          base::DataMatrix& dataset,
+                                                          double threshold, size_t k);
+
+/**
+ * Factory method, returning an OperationDensityClustering (density based clustering on the CPU).
+ * Note: object has to be freed after use.
+ *
+ * @param verbose print the progress
+ * @return Pointer to the new OperationDensityClustering object
+ */
+datadriven::OperationDensityClustering* createOperationDensityClustering(bool verbose = false);
+
 }  // namespace op_factory
 }  // namespace sgpp
@@ -9,7 +9,9 @@
 
 #include <sgpp/globaldef.hpp>
 
+#include <functional>
 #include <string>
+#include <vector>
 
 namespace sgpp {
 namespace datadriven {
@@ -84,17 +86,49 @@ AlgorithmAdaBoostBase::AlgorithmAdaBoostBase(base::Grid& SparseGrid, base::GridT
 
 AlgorithmAdaBoostBase::~AlgorithmAdaBoostBase() {}
 
+base::OperationMultipleEval& AlgorithmAdaBoostBase::getTrainEval() {
+  if (!this->trainEval) {
+    this->trainEval.reset(op_factory::createOperationMultipleEval(*this->grid, *this->data));
+  }
+
+  return *this->trainEval;
+}
+
+void AlgorithmAdaBoostBase::resetEvaluations() { this->trainEval.reset(); }
+
+void AlgorithmAdaBoostBase::evalTestStacked(
+    base::OperationMultipleEval& testEval, std::vector<base::DataVector>& alphaLearners,
+    const std::function<void(size_t, base::DataVector&)>& addTestValues) {
+  if (alphaLearners.empty()) {
+    return;
+  }
+
+  // one column per weak learner
+  base::DataMatrix alphas(alphaLearners[0].getSize(), alphaLearners.size());
+
+  for (size_t k = 0; k < alphaLearners.size(); k++) {
+    alphas.setColumn(k, alphaLearners[k]);
+  }
+
+  base::DataMatrix values;
+  testEval.multMatrix(alphas, values);
+  base::DataVector value_test(values.getNrows());
+
+  for (size_t k = 0; k < alphaLearners.size(); k++) {
+    values.getColumn(k, value_test);
+    addTestValues(k, value_test);
+  }
+}
+
 void AlgorithmAdaBoostBase::doDiscreteAdaBoost(
     base::DataVector& hypoWeight, base::DataVector& weightError, base::DataMatrix& weights,
     base::DataMatrix& decision, base::DataMatrix& testData, base::DataMatrix& algorithmValueTrain,
     base::DataMatrix& algorithmValueTest) {
   base::DataVector weight(this->numData, 1.0 / static_cast<double>(this->numData));
-  std::unique_ptr<base::OperationEval> opEval(op_factory::createOperationEval(*this->grid));
+  resetEvaluations();
+  std::unique_ptr<base::OperationMultipleEval> testEval(
+      op_factory::createOperationMultipleEval(*this->grid, testData));
 
-  // to store certain train data point
-  base::DataVector p_train(this->dim);
-  // to store certain train data point
-  base::DataVector p_test(this->dim);
   // create vector to store the hypothesis of the training data according to
   // certain alpha vector(base learner)
   base::DataVector newclasses(this->numData);
@@ -103,6 +137,31 @@ void AlgorithmAdaBoostBase::doDiscreteAdaBoost(
   base::DataVector identity(this->numData);
 
   base::DataVector tmpweight(this->numData);
+  // to store the prediction training values
+  base::DataVector value_train(this->numData);
+  // to store the prediction testing values
+  base::DataVector value_test(testData.getNrows());
+  // without refinement, all weak learners share the grid and are evaluated at the testing data
+  // in one pass after the boosting
+  std::vector<base::DataVector> alphaLearners;
+  auto addTestValues = [&](size_t count, base::DataVector& value_test) {
+    const double hypoweight = hypoWeight.get(count);
+
+    for (size_t i = 0; i < testData.getNrows(); i++) {
+      double value_test_i = value_test.get(i);
+
+      // when there is only one baselearner actually, we do as following,
+      // just use normal classify to get the value
+      if (this->numBaseLearners == 1)
+        algorithmValueTest.set(i, count, value_test_i);
+      else if (count == 0)
+        algorithmValueTest.set(i, count, hypoweight * hValue(value_test_i));
+      // each column is the sum value of baselearner respect to the column index
+      else
+        algorithmValueTest.set(
+            i, count, algorithmValueTest.get(i, count - 1) + hypoweight * hValue(value_test_i));
+    }
+  };
 
   for (size_t count = 0; count < this->numBaseLearners; count++) {
     (this->actualBaseLearners)++;
@@ -137,20 +196,17 @@ void AlgorithmAdaBoostBase::doDiscreteAdaBoost(
 
     if (this->refinement) {
       doRefinement(alpha_train, weight, count + 1);
-      opEval.reset(op_factory::createOperationEval(*this->grid));
+      testEval.reset(op_factory::createOperationMultipleEval(*this->grid, testData));
       alpha_learn.resizeZero(alpha_train.getSize());
     }
 
     // set the alpha for testing data(copy of alpha for training data)
     alpha_learn.copyFrom(alpha_train);
 
-#pragma omp parallel for schedule(static)
+    getTrainEval().mult(alpha_train, value_train);
 
     for (size_t i = 0; i < this->numData; i++) {
-      base::DataVector p_train_private(this->dim);
-      this->data->getRow(i, p_train_private);
-      double value_train = opEval->eval(alpha_train, p_train_private);
-      newclasses.set(i, hValue(value_train));
+      newclasses.set(i, hValue(value_train.get(i)));
     }
 
     for (size_t i = 0; i < this->numData; i++) {
@@ -168,24 +224,42 @@ void AlgorithmAdaBoostBase::doDiscreteAdaBoost(
 
     // find the optimal lambda to minimize the weighted error
     if (this->lambSteps > 0 && count > 0) {
-      double cur_lambda;
       double weighterror;
       double minWeightError = weightError.get(count);
+      // the weak learners of the different lambdas are independent and trained concurrently
+      // on the shared evaluation operation
+      std::vector<base::DataVector> alpha_search(this->lambSteps,
+                                                 base::DataVector(alpha_train.getSize(), 0.0));
+      base::OperationMultipleEval& sharedTrainEval = getTrainEval();
+
+#pragma omp parallel for schedule(dynamic)
+
+      for (size_t it = 0; it < this->lambSteps; it++) {
+        double cur_lambda = exp(this->lambLogMax - static_cast<double>(it) * this->lambStepsize);
+        alphaSolver(cur_lambda, weight, alpha_search[it], true);
+      }
+
+      // the weak learners of the search are evaluated at the training data in one pass
+      base::DataMatrix alphas_search(alpha_train.getSize(), this->lambSteps);
+
+      for (size_t it = 0; it < this->lambSteps; it++) {
+        alphas_search.setColumn(it, alpha_search[it]);
+      }
+
+      base::DataMatrix values_search;
+      sharedTrainEval.multMatrix(alphas_search, values_search);
+      base::DataVector value_search(this->numData);
 
       for (size_t it = 0; it < this->lambSteps; it++) {
         std::cout << std::endl;
         std::cout << "This is the " << it + 1 << "th search of " << this->actualBaseLearners
                   << "th weak learner." << std::endl;
         std::cout << std::endl;
-        alpha_train.setAll(0.0);
-        cur_lambda = exp(this->lambLogMax - static_cast<double>(it) * this->lambStepsize);
-
-        alphaSolver(cur_lambda, weight, alpha_train, true);
+        alpha_train.copyFrom(alpha_search[it]);
+        values_search.getColumn(it, value_search);
 
         for (size_t i = 0; i < this->numData; i++) {
-          this->data->getRow(i, p_train);
-          double value_seach = opEval->eval(alpha_train, p_train);
-          newclasses.set(i, hValue(value_seach));
+          newclasses.set(i, hValue(value_search.get(i)));
         }
 
         for (size_t i = 0; i < this->numData; i++) {
@@ -238,45 +312,30 @@ void AlgorithmAdaBoostBase::doDiscreteAdaBoost(
       hypoWeight.set(count, hypoweight);
     }
 
-// calculate the algorithm value of the testing data and training data
-// for training data
-#pragma omp parallel for schedule(static)
+    // calculate the algorithm value of the testing data and training data
+    // for training data
+    getTrainEval().mult(alpha_learn, value_train);
 
     for (size_t i = 0; i < numData; i++) {
-      base::DataVector p_train_private(this->dim);
-      this->data->getRow(i, p_train_private);
-      double value_train = opEval->eval(alpha_learn, p_train_private);
-
       // when there is only one baselearner actually, we do as following,
       // just use normal classify to get the value
       if (this->numBaseLearners == 1)
-        algorithmValueTrain.set(i, count, value_train);
+        algorithmValueTrain.set(i, count, value_train.get(i));
       else if (count == 0)
-        algorithmValueTrain.set(i, count, hypoweight * hValue(value_train));
+        algorithmValueTrain.set(i, count, hypoweight * hValue(value_train.get(i)));
       // each column is the sum value of baselearner respect to the column index
       else
-        algorithmValueTrain.set(
-            i, count, algorithmValueTrain.get(i, count - 1) + hypoweight * hValue(value_train));
+        algorithmValueTrain.set(i, count,
+                                algorithmValueTrain.get(i, count - 1) +
+                                    hypoweight * hValue(value_train.get(i)));
     }
 
-// for testing data
-#pragma omp parallel for schedule(static)
-
-    for (size_t i = 0; i < testData.getNrows(); i++) {
-      base::DataVector p_test_private(this->dim);
-      testData.getRow(i, p_test_private);
-      double value_test = opEval->eval(alpha_learn, p_test_private);
-
-      // when there is only one baselearner actually, we do as following,
-      // just use normal classify to get the value
-      if (this->numBaseLearners == 1)
-        algorithmValueTest.set(i, count, value_test);
-      else if (count == 0)
-        algorithmValueTest.set(i, count, hypoweight * hValue(value_test));
-      // each column is the sum value of baselearner respect to the column index
-      else
-        algorithmValueTest.set(
-            i, count, algorithmValueTest.get(i, count - 1) + hypoweight * hValue(value_test));
+    // for testing data
+    if (this->refinement) {
+      testEval->mult(alpha_learn, value_test);
+      addTestValues(count, value_test);
+    } else {
+      alphaLearners.push_back(alpha_learn);
     }
 
     double helper;
@@ -330,23 +389,46 @@ void AlgorithmAdaBoostBase::doDiscreteAdaBoost(
       }
 
       this->grid->getGenerator().regular(this->level);
+      resetEvaluations();
+      testEval.reset(op_factory::createOperationMultipleEval(*this->grid, testData));
       std::cout << std::endl;
     }
   }
+
+  evalTestStacked(*testEval, alphaLearners, addTestValues);
 }
 
 void AlgorithmAdaBoostBase::doRealAdaBoost(base::DataMatrix& weights, base::DataMatrix& testData,
                                            base::DataMatrix& algorithmValueTrain,
                                            base::DataMatrix& algorithmValueTest) {
   base::DataVector weight(this->numData, 1.0 / static_cast<double>(this->numData));
-  std::unique_ptr<base::OperationEval> opEval(op_factory::createOperationEval(*this->grid));
+  resetEvaluations();
+  std::unique_ptr<base::OperationMultipleEval> testEval(
+      op_factory::createOperationMultipleEval(*this->grid, testData));
 
-  // to store certain train data point
-  base::DataVector p_train(this->dim);
-  // to store certain train data point
-  base::DataVector p_test(this->dim);
 
   base::DataVector tmpweight(this->numData);
+  // to store the prediction training values
+  base::DataVector value_train(this->numData);
+  // to store the prediction testing values
+  base::DataVector value_test(testData.getNrows());
+  // without refinement, all weak learners share the grid and are evaluated at the testing data
+  // in one pass after the boosting
+  std::vector<base::DataVector> alphaLearners;
+  auto addTestValues = [&](size_t count, base::DataVector& value_test) {
+    for (size_t i = 0; i < testData.getNrows(); i++) {
+      // when there is only one baselearner actually, we do as following,
+      // just use normal classify to get the value
+      if (this->numBaseLearners == 1)
+        algorithmValueTest.set(i, count, 0.5 * value_test.get(i));
+      else if (count == 0)
+        algorithmValueTest.set(i, count, 0.5 * value_test.get(i));
+      // each column is the sum value of baselearner respect to the column index
+      else
+        algorithmValueTest.set(i, count,
+                               algorithmValueTest.get(i, count - 1) + 0.5 * value_test.get(i));
+    }
+  };
 
   for (size_t count = 0; count < this->numBaseLearners; count++) {
     (this->actualBaseLearners)++;
@@ -381,35 +463,32 @@ void AlgorithmAdaBoostBase::doRealAdaBoost(base::DataMatrix& weights, base::Data
 
     if (this->refinement) {
       doRefinement(alpha_train, weight, count + 1);
-      opEval.reset(op_factory::createOperationEval(*this->grid));
+      testEval.reset(op_factory::createOperationMultipleEval(*this->grid, testData));
       alpha_learn.resizeZero(alpha_train.getSize());
     }
 
     // set the alpha for testing data(copy of alpha for training data)
     alpha_learn.copyFrom(alpha_train);
 
-// calculate the algorithm value of the testing data and training data
-// for training data
-#pragma omp parallel for schedule(static)
+    // calculate the algorithm value of the testing data and training data
+    // for training data
+    getTrainEval().mult(alpha_learn, value_train);
 
     for (size_t i = 0; i < numData; i++) {
-      base::DataVector p_train_private(this->dim);
-      this->data->getRow(i, p_train_private);
-      double value_train = opEval->eval(alpha_learn, p_train_private);
-      double helper = weight.get(i) * exp(-this->classes->get(i) * value_train);
+      double helper = weight.get(i) * exp(-this->classes->get(i) * value_train.get(i));
       tmpweight.set(i, helper);
 
       // when there is only one baselearner actually, we do as following,
       // just use normal classify to get the value
       if (this->numBaseLearners == 1)
         // 0.5 as the coefficient (the original algorithm)
-        algorithmValueTrain.set(i, count, 0.5 * value_train);
+        algorithmValueTrain.set(i, count, 0.5 * value_train.get(i));
       else if (count == 0)
-        algorithmValueTrain.set(i, count, 0.5 * value_train);
+        algorithmValueTrain.set(i, count, 0.5 * value_train.get(i));
       // each column is the sum value of baselearner respect to the column index
       else
         algorithmValueTrain.set(i, count,
-                                algorithmValueTrain.get(i, count - 1) + 0.5 * value_train);
+                                algorithmValueTrain.get(i, count - 1) + 0.5 * value_train.get(i));
     }
 
     // normalize weight
@@ -418,23 +497,12 @@ void AlgorithmAdaBoostBase::doRealAdaBoost(base::DataMatrix& weights, base::Data
     tmpweight.mult(1.0 / normalizer);
     weight = tmpweight;
 
-// for testing data
-#pragma omp parallel for schedule(static)
-
-    for (size_t i = 0; i < testData.getNrows(); i++) {
-      base::DataVector p_test_private(this->dim);
-      testData.getRow(i, p_test_private);
-      double value_test = opEval->eval(alpha_learn, p_test_private);
-
-      // when there is only one baselearner actually, we do as following,
-      // just use normal classify to get the value
-      if (this->numBaseLearners == 1)
-        algorithmValueTest.set(i, count, 0.5 * value_test);
-      else if (count == 0)
-        algorithmValueTest.set(i, count, 0.5 * value_test);
-      // each column is the sum value of baselearner respect to the column index
-      else
-        algorithmValueTest.set(i, count, algorithmValueTest.get(i, count - 1) + 0.5 * value_test);
+    // for testing data
+    if (this->refinement) {
+      testEval->mult(alpha_learn, value_test);
+      addTestValues(count, value_test);
+    } else {
+      alphaLearners.push_back(alpha_learn);
     }
 
     if (count < this->numBaseLearners - 1 && this->refinement) {
@@ -460,9 +528,13 @@ void AlgorithmAdaBoostBase::doRealAdaBoost(base::DataMatrix& weights, base::Data
       }
 
       this->grid->getGenerator().regular(this->level);
+      resetEvaluations();
+      testEval.reset(op_factory::createOperationMultipleEval(*this->grid, testData));
       std::cout << std::endl;
     }
   }
+
+  evalTestStacked(*testEval, alphaLearners, addTestValues);
 }
 
 void AlgorithmAdaBoostBase::doAdaBoostR2(base::DataMatrix& weights, base::DataMatrix& testData,
@@ -476,11 +548,9 @@ void AlgorithmAdaBoostBase::doAdaBoostR2(base::DataMatrix& weights, base::DataMa
   }
 
   base::DataVector weight(this->numData, 1.0 / static_cast<double>(this->numData));
-  std::unique_ptr<base::OperationEval> opEval(op_factory::createOperationEval(*this->grid));
-  // to store certain train data point
-  base::DataVector p_train(this->dim);
-  // to store certain train data point
-  base::DataVector p_test(this->dim);
+  resetEvaluations();
+  std::unique_ptr<base::OperationMultipleEval> testEval(
+      op_factory::createOperationMultipleEval(*this->grid, testData));
   base::DataVector tmpweight(this->numData);
 
   // to store the loss
@@ -495,6 +565,23 @@ void AlgorithmAdaBoostBase::doAdaBoostR2(base::DataMatrix& weights, base::DataMa
   double meanloss;
   base::DataVector beta(this->numBaseLearners);         // [0,1]
   base::DataVector logBetaSumR(this->numBaseLearners);  // [0,1]
+  // without refinement, all weak learners share the grid and are evaluated at the testing data
+  // in one pass after the boosting
+  std::vector<base::DataVector> alphaLearners;
+  auto addTestValues = [&](size_t count, base::DataVector& value_test) {
+    base::DataVector TeValueHelper(testData.getNrows());
+
+    if (count == 0) {
+      algorithmValueTest.setColumn(count, value_test);
+    } else {
+      // each column is the sum value of baselearner respect to the column index
+      algorithmValueTest.getColumn(count - 1, TeValueHelper);
+      TeValueHelper.mult(logBetaSumR.get(count - 1));
+      TeValueHelper.axpy(log(1 / beta.get(count)), value_test);
+      TeValueHelper.mult(1 / logBetaSumR.get(count));
+      algorithmValueTest.setColumn(count, TeValueHelper);
+    }
+  };
 
   for (size_t count = 0; count < this->numBaseLearners; count++) {
     (this->actualBaseLearners)++;
@@ -529,21 +616,18 @@ void AlgorithmAdaBoostBase::doAdaBoostR2(base::DataMatrix& weights, base::DataMa
 
     if (this->refinement) {
       doRefinement(alpha_train, weight, count + 1);
-      opEval.reset(op_factory::createOperationEval(*this->grid));
+      testEval.reset(op_factory::createOperationMultipleEval(*this->grid, testData));
       alpha_learn.resizeZero(alpha_train.getSize());
     }
 
     // set the alpha for testing data(copy of alpha for training data)
     alpha_learn.copyFrom(alpha_train);
 
-// calculate the algorithm value of the testing data and training data
-// for training data
-#pragma omp parallel for schedule(static)
+    // calculate the algorithm value of the testing data and training data
+    // for training data
+    getTrainEval().mult(alpha_learn, value_train);
 
     for (size_t i = 0; i < numData; i++) {
-      base::DataVector p_train_private(this->dim);
-      this->data->getRow(i, p_train_private);
-      value_train.set(i, opEval->eval(alpha_learn, p_train_private));
       loss.set(i, this->classes->get(i) - value_train.get(i));
     }
 
@@ -608,26 +692,12 @@ void AlgorithmAdaBoostBase::doAdaBoostR2(base::DataMatrix& weights, base::DataMa
     tmpweight.mult(1.0 / normalizer);
     weight = tmpweight;
 
-// for testing data
-#pragma omp parallel for schedule(static)
-
-    for (size_t i = 0; i < testData.getNrows(); i++) {
-      base::DataVector p_test_private(this->dim);
-      testData.getRow(i, p_test_private);
-      value_test.set(i, opEval->eval(alpha_learn, p_test_private));
-    }
-
-    base::DataVector TeValueHelper(testData.getNrows());
-
-    if (count == 0) {
-      algorithmValueTest.setColumn(count, value_test);
+    // for testing data
+    if (this->refinement) {
+      testEval->mult(alpha_learn, value_test);
+      addTestValues(count, value_test);
     } else {
-      // each column is the sum value of baselearner respect to the column index
-      algorithmValueTest.getColumn(count - 1, TeValueHelper);
-      TeValueHelper.mult(logBetaSumR.get(count - 1));
-      TeValueHelper.axpy(loghelp, value_test);
-      TeValueHelper.mult(1 / logBetaSumR.get(count));
-      algorithmValueTest.setColumn(count, TeValueHelper);
+      alphaLearners.push_back(alpha_learn);
     }
 
     if (count < this->numBaseLearners - 1 && this->refinement) {
@@ -653,9 +723,13 @@ void AlgorithmAdaBoostBase::doAdaBoostR2(base::DataMatrix& weights, base::DataMa
       }
 
       this->grid->getGenerator().regular(this->level);
+      resetEvaluations();
+      testEval.reset(op_factory::createOperationMultipleEval(*this->grid, testData));
       std::cout << std::endl;
     }
   }
+
+  evalTestStacked(*testEval, alphaLearners, addTestValues);
 }
 
 void AlgorithmAdaBoostBase::doAdaBoostRT(base::DataMatrix& weights, base::DataMatrix& testData,
@@ -675,11 +749,9 @@ void AlgorithmAdaBoostBase::doAdaBoostRT(base::DataMatrix& weights, base::DataMa
   }
 
   base::DataVector weight(this->numData, 1.0 / static_cast<double>(this->numData));
-  std::unique_ptr<base::OperationEval> opEval(op_factory::createOperationEval(*this->grid));
-  // to store certain train data point
-  base::DataVector p_train(this->dim);
-  // to store certain train data point
-  base::DataVector p_test(this->dim);
+  resetEvaluations();
+  std::unique_ptr<base::OperationMultipleEval> testEval(
+      op_factory::createOperationMultipleEval(*this->grid, testData));
   base::DataVector tmpweight(this->numData);
 
   // to store the absolute relative error
@@ -692,6 +764,23 @@ void AlgorithmAdaBoostBase::doAdaBoostRT(base::DataMatrix& weights, base::DataMa
   base::DataVector beta(this->numBaseLearners);
   base::DataVector logBetaSumR(this->numBaseLearners);
   double errorRate;
+  // without refinement, all weak learners share the grid and are evaluated at the testing data
+  // in one pass after the boosting
+  std::vector<base::DataVector> alphaLearners;
+  auto addTestValues = [&](size_t count, base::DataVector& value_test) {
+    base::DataVector TeValueHelper(testData.getNrows());
+
+    if (count == 0) {
+      algorithmValueTest.setColumn(count, value_test);
+    } else {
+      // each column is the sum value of baselearner respect to the column index
+      algorithmValueTest.getColumn(count - 1, TeValueHelper);
+      TeValueHelper.mult(logBetaSumR.get(count - 1));
+      TeValueHelper.axpy(log(1 / beta.get(count)), value_test);
+      TeValueHelper.mult(1 / logBetaSumR.get(count));
+      algorithmValueTest.setColumn(count, TeValueHelper);
+    }
+  };
 
   for (size_t count = 0; count < this->numBaseLearners; count++) {
     (this->actualBaseLearners)++;
@@ -726,7 +815,7 @@ void AlgorithmAdaBoostBase::doAdaBoostRT(base::DataMatrix& weights, base::DataMa
 
     if (this->refinement) {
       doRefinement(alpha_train, weight, count + 1);
-      opEval.reset(op_factory::createOperationEval(*this->grid));
+      testEval.reset(op_factory::createOperationMultipleEval(*this->grid, testData));
       alpha_learn.resizeZero(alpha_train.getSize());
     }
 
@@ -736,12 +825,9 @@ void AlgorithmAdaBoostBase::doAdaBoostRT(base::DataMatrix& weights, base::DataMa
     // calculate the algorithm value of the testing data and training data
     // for training data
     errorRate = 0;
-#pragma omp parallel for schedule(static)
+    getTrainEval().mult(alpha_learn, value_train);
 
     for (size_t i = 0; i < numData; i++) {
-      base::DataVector p_train_private(this->dim);
-      this->data->getRow(i, p_train_private);
-      value_train.set(i, opEval->eval(alpha_learn, p_train_private));
       ARE.set(i, std::abs((this->classes->get(i) - value_train.get(i)) / this->classes->get(i)));
 
       if (ARE.get(i) > Tvalue) errorRate += weight.get(i);
@@ -789,26 +875,12 @@ void AlgorithmAdaBoostBase::doAdaBoostRT(base::DataMatrix& weights, base::DataMa
     tmpweight.mult(1.0 / normalizer);
     weight = tmpweight;
 
-// for testing data
-#pragma omp parallel for schedule(static)
-
-    for (size_t i = 0; i < testData.getNrows(); i++) {
-      base::DataVector p_test_private(this->dim);
-      testData.getRow(i, p_test_private);
-      value_test.set(i, opEval->eval(alpha_learn, p_test_private));
-    }
-
-    base::DataVector TeValueHelper(testData.getNrows());
-
-    if (count == 0) {
-      algorithmValueTest.setColumn(count, value_test);
+    // for testing data
+    if (this->refinement) {
+      testEval->mult(alpha_learn, value_test);
+      addTestValues(count, value_test);
     } else {
-      // each column is the sum value of baselearner respect to the column index
-      algorithmValueTest.getColumn(count - 1, TeValueHelper);
-      TeValueHelper.mult(logBetaSumR.get(count - 1));
-      TeValueHelper.axpy(loghelp, value_test);
-      TeValueHelper.mult(1 / logBetaSumR.get(count));
-      algorithmValueTest.setColumn(count, TeValueHelper);
+      alphaLearners.push_back(alpha_learn);
     }
 
     if (count < this->numBaseLearners - 1 && this->refinement) {
@@ -834,9 +906,13 @@ void AlgorithmAdaBoostBase::doAdaBoostRT(base::DataMatrix& weights, base::DataMa
       }
 
       this->grid->getGenerator().regular(this->level);
+      resetEvaluations();
+      testEval.reset(op_factory::createOperationMultipleEval(*this->grid, testData));
       std::cout << std::endl;
     }
   }
+
+  evalTestStacked(*testEval, alphaLearners, addTestValues);
 }
 
 void AlgorithmAdaBoostBase::eval(base::DataMatrix& testData, base::DataMatrix& algorithmValueTrain,
@@ -1001,6 +1077,7 @@ void AlgorithmAdaBoostBase::doRefinement(base::DataVector& alpha_ada, base::Data
 
     base::SurplusRefinementFunctor myRefineFunc(alpha_ada, refineNumber, 0.0);
     myGenerator.refine(myRefineFunc);
+    resetEvaluations();
 
     base::GridStorage* gridStorage_ada = &this->grid->getStorage();
     size_t gridPts = gridStorage_ada->getSize();
@@ -24,8 +24,11 @@
 #include <sgpp/globaldef.hpp>
 
 #include <cmath>
+#include <functional>
+#include <memory>
 #include <string>
 #include <utility>
+#include <vector>
 #include <iostream>
 #include <cstdlib>
 
@@ -103,9 +106,38 @@ class AlgorithmAdaBoostBase {
   double perOfAda;
   /// Set the boost mode (1: Discrete Adaboost, 2: Real Adaboost)
   size_t boostMode;
+  /// evaluation of the training data on the current grid, shared by all weak learners
+  std::unique_ptr<base::OperationMultipleEval> trainEval;
 
   /**
-   * Performs a solver to get alpha
+   * Returns the evaluation operation of the training data on the current grid. It is created on
+   * the first call after the grid has changed, see resetEvaluations().
+   *
+   * @return evaluation operation of the training data
+   */
+  base::OperationMultipleEval& getTrainEval();
+
+  /**
+   * Discards the evaluation operations, has to be called whenever the grid is changed
+   */
+  void resetEvaluations();
+
+  /**
+   * Evaluates the weak learners of a boosting run at the testing data. The surplus vectors (on
+   * the same grid) are stacked into one matrix and evaluated with one multMatrix.
+   *
+   * @param testEval evaluation operation of the testing data
+   * @param alphaLearners surplus vectors of the weak learners in the order of the boosting
+   * @param addTestValues accumulates the values of the weak learner with the given number
+   */
+  void evalTestStacked(base::OperationMultipleEval& testEval,
+                       std::vector<base::DataVector>& alphaLearners,
+                       const std::function<void(size_t, base::DataVector&)>& addTestValues);
+
+  /**
+   * Performs a solver to get alpha. The solvers for different lambdas may run concurrently (the
+   * lambda search in doDiscreteAdaBoost), so implementations must not change the grid and should
+   * apply the system matrix with the shared operation getTrainEval().
    *
    * @param lambda the regularisation parameter
    * @param weight the weights of examples
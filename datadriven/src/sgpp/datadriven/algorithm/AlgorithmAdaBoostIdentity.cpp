@@ -39,7 +39,7 @@ void AlgorithmAdaBoostIdentity::alphaSolver(double& lambda, sgpp::base::DataVect
                                             sgpp::base::DataVector& alpha, bool final) {
   std::unique_ptr < sgpp::base::OperationMatrix
       > C(sgpp::op_factory::createOperationIdentity(*this->grid));
-  sgpp::datadriven::DMWeightMatrix WMatrix(*this->grid, *this->data, *C, lambda, weight);
+  sgpp::datadriven::DMWeightMatrix WMatrix(getTrainEval(), *C, lambda, weight);
   sgpp::base::DataVector rhs(alpha.getSize());
   WMatrix.generateb(*this->classes, rhs);
 
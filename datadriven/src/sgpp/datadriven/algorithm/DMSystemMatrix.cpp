@@ -73,6 +73,21 @@ void DMSystemMatrix::mult(sgpp::base::DataVector& alpha, sgpp::base::DataVector&
   result.axpy(static_cast<double>(M) * this->lambda_, temptwo);
 }
 
+void DMSystemMatrix::multMatrix(sgpp::base::DataMatrix& alphas, sgpp::base::DataMatrix& result) {
+  size_t M = this->dataset_.getNrows();
+
+  std::unique_ptr<base::OperationMultipleEval> op(
+      sgpp::op_factory::createOperationMultipleEval(grid, this->dataset_));
+  sgpp::base::DataMatrix temp(M, alphas.getNcols());
+  op->multMatrix(alphas, temp);
+  op->multTransposeMatrix(temp, result);
+
+  sgpp::base::DataMatrix temptwo(alphas.getNrows(), alphas.getNcols());
+  this->C->multMatrix(alphas, temptwo);
+  temptwo.mult(static_cast<double>(M) * this->lambda_);
+  result.add(temptwo);
+}
+
 void DMSystemMatrix::generateb(sgpp::base::DataVector& classes, sgpp::base::DataVector& b) {
   // this->B->multTranspose((*this->dataset_), classes, b);
   // this->B->multTranspose(classes, b);
@@ -82,5 +97,11 @@ void DMSystemMatrix::generateb(sgpp::base::DataVector& classes, sgpp::base::Data
   op->multTranspose(classes, b);
 }
 
+void DMSystemMatrix::generateb(sgpp::base::DataMatrix& classes, sgpp::base::DataMatrix& b) {
+  std::unique_ptr<base::OperationMultipleEval> op(
+      sgpp::op_factory::createOperationMultipleEval(grid, this->dataset_));
+  op->multTransposeMatrix(classes, b);
+}
+
 }  // namespace datadriven
 }  // namespace sgpp
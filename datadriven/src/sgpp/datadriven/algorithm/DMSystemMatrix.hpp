@@ -51,6 +51,15 @@ class DMSystemMatrix : public DMSystemMatrixBase {
 
   virtual void mult(base::DataVector& alpha, base::DataVector& result);
 
+  /**
+   * Applies the system matrix to all columns of alphas, the data set is traversed once for all
+   * columns instead of once per column
+   *
+   * @param alphas matrix whose columns are the vectors the system matrix is applied to
+   * @param result matrix into which the results are stored column by column
+   */
+  void multMatrix(base::DataMatrix& alphas, base::DataMatrix& result) override;
+
   /**
    * Generates the right hand side of the classification equation
    *
@@ -59,6 +68,14 @@ class DMSystemMatrix : public DMSystemMatrixBase {
    *   multiplication on the rhs
    */
   virtual void generateb(base::DataVector& classes, base::DataVector& b);
+
+  /**
+   * Generates the right hand sides for several target vectors at once
+   *
+   * @param classes matrix whose columns are the targets of the training data
+   * @param b matrix into which the right hand sides are stored column by column
+   */
+  virtual void generateb(base::DataMatrix& classes, base::DataMatrix& b);
 };
 
 }  // namespace datadriven
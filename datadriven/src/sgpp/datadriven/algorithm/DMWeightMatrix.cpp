@@ -19,21 +19,27 @@ DMWeightMatrix::DMWeightMatrix(sgpp::base::Grid& SparseGrid,
   // create the operations needed in ApplyMatrix
   this->C = &C;
   this->lamb = lambda;
-  this->data = &trainData;
-  // this->B = SparseGrid.createOperationMultipleEval(this->data);
-  this->B = sgpp::op_factory::createOperationMultipleEval(SparseGrid, *(this->data));
+  this->ownedB.reset(sgpp::op_factory::createOperationMultipleEval(SparseGrid, trainData));
+  this->B = this->ownedB.get();
   this->weight = &w;
 }
 
-DMWeightMatrix::~DMWeightMatrix() {
-  delete this->B;
+DMWeightMatrix::DMWeightMatrix(sgpp::base::OperationMultipleEval& B,
+                               sgpp::base::OperationMatrix& C, double lambda,
+                               sgpp::base::DataVector& w) {
+  this->C = &C;
+  this->lamb = lambda;
+  this->B = &B;
+  this->weight = &w;
 }
 
+DMWeightMatrix::~DMWeightMatrix() {}
+
 
 void DMWeightMatrix::mult(sgpp::base::DataVector& alpha,
                           sgpp::base::DataVector& result) {
-  sgpp::base::DataVector temp((*data).getNrows());
-  // size_t M = (*data).getNrows();
+  // one entry per training data point
+  sgpp::base::DataVector temp(weight->getSize());
   //// Operation B
   this->B->mult(alpha, temp);
   temp.componentwise_mult(*weight);
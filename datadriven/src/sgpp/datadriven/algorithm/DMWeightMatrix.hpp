@@ -13,6 +13,7 @@
 
 #include <sgpp/globaldef.hpp>
 
+#include <memory>
 
 namespace sgpp {
 namespace datadriven {
@@ -29,8 +30,8 @@ class DMWeightMatrix : public sgpp::base::OperationMatrix {
   sgpp::base::OperationMatrix* C;
   /// OperationB for calculating the data matrix
   sgpp::base::OperationMultipleEval* B;
-  /// Pointer to the data vector
-  sgpp::base::DataMatrix* data;
+  /// OperationB if it was created by this matrix
+  std::unique_ptr<sgpp::base::OperationMultipleEval> ownedB;
   /// Pointer to the weight vector
   sgpp::base::DataVector* weight;
 
@@ -47,6 +48,18 @@ class DMWeightMatrix : public sgpp::base::OperationMatrix {
   DMWeightMatrix(sgpp::base::Grid& SparseGrid, sgpp::base::DataMatrix& trainData,
                  sgpp::base::OperationMatrix& C, double lambda, sgpp::base::DataVector& w);
 
+  /**
+   * Constructor for an already prepared evaluation operation of the training data, e.g. one
+   * that is shared by several system matrices with different weights or lambdas
+   *
+   * @param B the evaluation operation of the training data (not owned)
+   * @param C the regression functional
+   * @param lambda the lambda, the regression parameter
+   * @param w the weights to the training data
+   */
+  DMWeightMatrix(sgpp::base::OperationMultipleEval& B, sgpp::base::OperationMatrix& C,
+                 double lambda, sgpp::base::DataVector& w);
+
   /**
    * Std-Destructor
    */
@@ -16,6 +16,7 @@
 #include <sgpp/globaldef.hpp>
 
 #include <map>
+#include <memory>
 #include <cstdlib>
 #include <fstream>
 #include <iostream>
@@ -28,6 +29,61 @@
 namespace sgpp {
 namespace datadriven {
 
+namespace {
+
+/// number of evaluation points that share a block of samples
+const size_t pointsPerBlock = 16;
+/// number of samples that are evaluated at once
+const size_t samplesPerBlock = 256;
+
+/**
+ * Evaluates the product kernels prod_d K((x_d - s_d[k]) / h_d) for count samples given by one
+ * column per dimension. The loops run over the samples, so they are vectorized.
+ */
+void evalProductKernels(KernelType kernelType, const double* x, const double* const* columns,
+                        size_t offset, size_t count, size_t ndim, const double* bandwidths,
+                        double* values) {
+  switch (kernelType) {
+    case KernelType::GAUSSIAN:
+      // prod_d exp(-y_d^2 / 2) = exp(-sum_d y_d^2 / 2)
+      for (size_t k = 0; k < count; k++) {
+        values[k] = 0.0;
+      }
+      for (size_t idim = 0; idim < ndim; idim++) {
+        const double xd = x[idim];
+        const double h = bandwidths[idim];
+        const double* s = columns[idim] + offset;
+#pragma omp simd
+        for (size_t k = 0; k < count; k++) {
+          double y = (xd - s[k]) / h;
+          values[k] += y * y;
+        }
+      }
+#pragma omp simd
+      for (size_t k = 0; k < count; k++) {
+        values[k] = std::exp(-0.5 * values[k]);
+      }
+      break;
+    case KernelType::EPANECHNIKOV:
+      for (size_t k = 0; k < count; k++) {
+        values[k] = 1.0;
+      }
+      for (size_t idim = 0; idim < ndim; idim++) {
+        const double xd = x[idim];
+        const double h = bandwidths[idim];
+        const double* s = columns[idim] + offset;
+#pragma omp simd
+        for (size_t k = 0; k < count; k++) {
+          double y = (xd - s[k]) / h;
+          values[k] *= (y * y < 1.0) ? 1.0 - y * y : 0.0;
+        }
+      }
+      break;
+  }
+}
+
+}  // namespace
+
 // -------------------- constructors and desctructors --------------------
 KernelDensityEstimator::KernelDensityEstimator(KernelType kernelType,
                                                BandwidthOptimizationType bandwidthOptimizationType)
@@ -37,7 +93,8 @@ KernelDensityEstimator::KernelDensityEstimator(KernelType kernelType,
       norm(0),
       cond(0),
       sumCondInv(1.0),
-      bandwidthOptimizationType(bandwidthOptimizationType) {
+      bandwidthOptimizationType(bandwidthOptimizationType),
+      approximationTolerance(0.0) {
   initializeKernel(kernelType);
 }
 
@@ -50,7 +107,8 @@ KernelDensityEstimator::KernelDensityEstimator(
       norm(samplesVec.size()),
       cond(0.0),
       sumCondInv(0.0),
-      bandwidthOptimizationType(bandwidthOptimizationType) {
+      bandwidthOptimizationType(bandwidthOptimizationType),
+      approximationTolerance(0.0) {
   initializeKernel(kernelType);
   initialize(samplesVec);
 }
@@ -63,7 +121,8 @@ KernelDensityEstimator::KernelDensityEstimator(base::DataMatrix& samples, Kernel
       norm(samples.getNcols()),
       cond(samples.getNrows()),
       sumCondInv(0.0),
-      bandwidthOptimizationType(bandwidthOptimizationType) {
+      bandwidthOptimizationType(bandwidthOptimizationType),
+      approximationTolerance(0.0) {
   initializeKernel(kernelType);
   initialize(samples);
 }
@@ -77,6 +136,7 @@ KernelDensityEstimator::KernelDensityEstimator(const KernelDensityEstimator& kde
   cond = base::DataVector(kde.cond);
   sumCondInv = kde.sumCondInv;
   bandwidthOptimizationType = kde.bandwidthOptimizationType;
+  approximationTolerance = kde.approximationTolerance;
 
   initializeKernel(kde.kernel->getType());
 }
@@ -96,6 +156,7 @@ void KernelDensityEstimator::initializeKernel(KernelType kernelType) {
 }
 
 void KernelDensityEstimator::initialize(base::DataMatrix& samples) {
+  tree.reset();
   ndim = samples.getNcols();
   nsamples = samples.getNrows();
 
@@ -137,6 +198,7 @@ void KernelDensityEstimator::initialize(base::DataMatrix& samples) {
 }
 
 void KernelDensityEstimator::initialize(std::vector<std::shared_ptr<base::DataVector>>& samples) {
+  tree.reset();
   ndim = samples.size();
 
   if (ndim > 0) {
@@ -218,34 +280,139 @@ void KernelDensityEstimator::setBandwidths(const base::DataVector& sigma) {
 }
 
 void KernelDensityEstimator::pdf(base::DataMatrix& data, base::DataVector& res) {
-  // init variables
-  base::DataVector x(ndim);
+  const size_t numPoints = data.getNrows();
+  const size_t stride = data.getNcols();
+  const double* points = data.getPointer();
 
   // resize result vector
-  res.resize(data.getNrows());
+  res.resize(numPoints);
   res.setAll(0.0);
-
-  // run over all data points
-  for (size_t idata = 0; idata < data.getNrows(); idata++) {
-    // copy samples
-    for (size_t idim = 0; idim < ndim; idim++) {
-      x[idim] = data.get(idata, idim);
+  double* results = res.getPointer();
+  const double factor = normProduct() * sumCondInv;
+
+  if (approximationTolerance > 0.0) {
+    KernelDensityTree& kdTree = getTree();
+#pragma omp parallel
+    {
+      std::vector<double> values;
+#pragma omp for schedule(dynamic, pointsPerBlock)
+      for (size_t idata = 0; idata < numPoints; idata++) {
+        results[idata] = factor * kdTree.eval(points + idata * stride, bandwidths, *kernel,
+                                              approximationTolerance, values);
+      }
+    }
+  } else {
+    const size_t numBlocks = (numPoints + pointsPerBlock - 1) / pointsPerBlock;
+#pragma omp parallel
+    {
+      std::vector<double> values(samplesPerBlock);
+#pragma omp for schedule(dynamic)
+      for (size_t block = 0; block < numBlocks; block++) {
+        const size_t first = block * pointsPerBlock;
+        const size_t count = std::min(pointsPerBlock, numPoints - first);
+        sumKernels(points + first * stride, stride, count, nsamples, results + first, values);
+        for (size_t idata = first; idata < first + count; idata++) {
+          results[idata] *= factor;
+        }
+      }
     }
-
-    res[idata] = pdf(x);
   }
 }
 
 double KernelDensityEstimator::pdf(base::DataVector& x) {
-  // init variables
+  std::vector<double> values(samplesPerBlock);
   double res = 0.0;
 
-  // run over all data points
-  for (size_t isample = 0; isample < nsamples; isample++) {
-    res += evalKernel(x, isample);
+  if (approximationTolerance > 0.0) {
+    res = getTree().eval(x.getPointer(), bandwidths, *kernel, approximationTolerance, values);
+  } else {
+    sumKernels(x.getPointer(), ndim, 1, nsamples, &res, values);
   }
 
-  return res * sumCondInv;
+  return res * normProduct() * sumCondInv;
+}
+
+void KernelDensityEstimator::pdfLeaveOneOut(base::DataVector& res) {
+  // the samples as evaluation points
+  std::shared_ptr<base::DataMatrix> points = getSamples();
+  const double* samples = points->getPointer();
+
+  res.resize(nsamples);
+  double* results = res.getPointer();
+  const double norms = normProduct();
+  const double sumCond = 1. / sumCondInv;
+  const size_t numBlocks = (nsamples + pointsPerBlock - 1) / pointsPerBlock;
+
+#pragma omp parallel
+  {
+    std::vector<double> values(samplesPerBlock);
+#pragma omp for schedule(dynamic)
+    for (size_t block = 0; block < numBlocks; block++) {
+      const size_t first = block * pointsPerBlock;
+      const size_t count = std::min(pointsPerBlock, nsamples - first);
+      sumKernels(samples + first * ndim, ndim, count, first, results + first, values);
+      for (size_t isample = first; isample < first + count; isample++) {
+        results[isample] *= norms / (sumCond - cond[isample]);
+      }
+    }
+  }
+}
+
+void KernelDensityEstimator::sumKernels(const double* points, size_t stride, size_t numPoints,
+                                        size_t firstSample, double* sums,
+                                        std::vector<double>& values) {
+  std::vector<const double*> columns(ndim);
+  for (size_t idim = 0; idim < ndim; idim++) {
+    columns[idim] = samplesVec[idim]->getPointer();
+  }
+  const double* weights = cond.getPointer();
+  values.resize(samplesPerBlock);
+
+  for (size_t ipoint = 0; ipoint < numPoints; ipoint++) {
+    sums[ipoint] = 0.0;
+  }
+
+  for (size_t offset = 0; offset < nsamples; offset += samplesPerBlock) {
+    const size_t count = std::min(samplesPerBlock, nsamples - offset);
+    for (size_t ipoint = 0; ipoint < numPoints; ipoint++) {
+      evalProductKernels(kernel->getType(), points + ipoint * stride, columns.data(), offset,
+                         count, ndim, bandwidths.getPointer(), values.data());
+
+      // skip the kernel of the point itself
+      size_t self = firstSample + ipoint;
+      if (firstSample < nsamples && offset <= self && self < offset + count) {
+        values[self - offset] = 0.0;
+      }
+
+      double sum = 0.0;
+#pragma omp simd reduction(+ : sum)
+      for (size_t k = 0; k < count; k++) {
+        sum += weights[offset + k] * values[k];
+      }
+      sums[ipoint] += sum;
+    }
+  }
+}
+
+double KernelDensityEstimator::normProduct() {
+  double res = 1.0;
+  for (size_t idim = 0; idim < ndim; idim++) {
+    res *= norm[idim];
+  }
+  return res;
+}
+
+void KernelDensityEstimator::setApproximationTolerance(double tolerance) {
+  approximationTolerance = tolerance;
+}
+
+double KernelDensityEstimator::getApproximationTolerance() { return approximationTolerance; }
+
+KernelDensityTree& KernelDensityEstimator::getTree() {
+  if (tree == nullptr) {
+    tree.reset(new KernelDensityTree(samplesVec, cond));
+  }
+  return *tree;
 }
 
 double KernelDensityEstimator::evalSubset(base::DataVector& x, std::vector<size_t> skipElements) {
@@ -258,7 +425,7 @@ double KernelDensityEstimator::evalSubset(base::DataVector& x, std::vector<size_
 
   // just add those kernels which are not in the skipElements list
   while (isample < nsamples) {
-    if (isample < skipElements[j]) {
+    if (j >= skipElements.size() || isample < skipElements[j]) {
       res += evalKernel(x, isample);
     } else {
       j++;
@@ -407,6 +574,8 @@ void KernelDensityEstimator::setConditionalizationFactor(base::DataVector& pcond
   }
 
   sumCondInv = 1. / sumCond;
+  // the weights of the tree nodes have changed
+  tree.reset();
 }
 
 void KernelDensityEstimator::updateConditionalizationFactors(base::DataVector& x,
@@ -500,6 +669,160 @@ double EpanechnikovKernel::variance() { return 0.2; }
 
 KernelType EpanechnikovKernel::getType() { return KernelType::EPANECHNIKOV; }
 
+// ----------------------------------------------------------------------------------
+// kd-tree
+
+KernelDensityTree::KernelDensityTree(std::vector<std::shared_ptr<base::DataVector>>& samplesVec,
+                                     base::DataVector& cond, size_t leafSize)
+    : ndim(samplesVec.size()), leafSize(std::max(leafSize, static_cast<size_t>(1))) {
+  size_t nsamples = cond.getSize();
+  std::vector<size_t> permutation(nsamples);
+  for (size_t isample = 0; isample < nsamples; isample++) {
+    permutation[isample] = isample;
+  }
+  build(0, nsamples, permutation, samplesVec, cond);
+
+  // store the samples in tree order
+  columns.resize(ndim);
+  for (size_t idim = 0; idim < ndim; idim++) {
+    columns[idim].resize(nsamples);
+    for (size_t isample = 0; isample < nsamples; isample++) {
+      columns[idim][isample] = samplesVec[idim]->get(permutation[isample]);
+    }
+  }
+  weights.resize(nsamples);
+  for (size_t isample = 0; isample < nsamples; isample++) {
+    weights[isample] = cond[permutation[isample]];
+  }
+}
+
+size_t KernelDensityTree::build(size_t begin, size_t end, std::vector<size_t>& permutation,
+                                std::vector<std::shared_ptr<base::DataVector>>& samplesVec,
+                                base::DataVector& cond) {
+  size_t node = nodes.size();
+  nodes.push_back(Node{begin, end, 0, 0, 0.0});
+  lower.resize(lower.size() + ndim, std::numeric_limits<double>::infinity());
+  upper.resize(upper.size() + ndim, -std::numeric_limits<double>::infinity());
+
+  // bounding box and weight
+  double weight = 0.0;
+  for (size_t i = begin; i < end; i++) {
+    for (size_t idim = 0; idim < ndim; idim++) {
+      double value = samplesVec[idim]->get(permutation[i]);
+      lower[node * ndim + idim] = std::min(lower[node * ndim + idim], value);
+      upper[node * ndim + idim] = std::max(upper[node * ndim + idim], value);
+    }
+    weight += cond[permutation[i]];
+  }
+  nodes[node].weight = weight;
+
+  if (end - begin <= leafSize) {
+    return node;
+  }
+
+  // split at the median of the widest dimension
+  size_t splitDim = 0;
+  for (size_t idim = 1; idim < ndim; idim++) {
+    if (upper[node * ndim + idim] - lower[node * ndim + idim] >
+        upper[node * ndim + splitDim] - lower[node * ndim + splitDim]) {
+      splitDim = idim;
+    }
+  }
+  if (upper[node * ndim + splitDim] == lower[node * ndim + splitDim]) {
+    // all samples are identical
+    return node;
+  }
+
+  size_t middle = begin + (end - begin) / 2;
+  base::DataVector& samples1d = *samplesVec[splitDim];
+  std::nth_element(permutation.begin() + begin, permutation.begin() + middle,
+                   permutation.begin() + end,
+                   [&samples1d](size_t i, size_t j) { return samples1d[i] < samples1d[j]; });
+
+  size_t left = build(begin, middle, permutation, samplesVec, cond);
+  size_t right = build(middle, end, permutation, samplesVec, cond);
+  nodes[node].left = left;
+  nodes[node].right = right;
+  return node;
+}
+
+void KernelDensityTree::kernelBounds(size_t node, const double* x, base::DataVector& bandwidths,
+                                     Kernel& kernel, double& kmin, double& kmax) const {
+  kmin = 1.0;
+  kmax = 1.0;
+  for (size_t idim = 0; idim < ndim; idim++) {
+    double toLower = x[idim] - lower[node * ndim + idim];
+    double toUpper = upper[node * ndim + idim] - x[idim];
+    double minDist = std::max(std::max(-toLower, -toUpper), 0.0);
+    double maxDist = std::max(std::fabs(toLower), std::fabs(toUpper));
+    kmax *= kernel.eval(minDist / bandwidths[idim]);
+    kmin *= kernel.eval(maxDist / bandwidths[idim]);
+  }
+}
+
+double KernelDensityTree::eval(const double* x, base::DataVector& bandwidths, Kernel& kernel,
+                               double tolerance, std::vector<double>& values) const {
+  if (nodes.empty() || nodes[0].weight <= 0.0) {
+    return 0.0;
+  }
+  double kmin = 0.0, kmax = 0.0;
+  kernelBounds(0, x, bandwidths, kernel, kmin, kmax);
+  double lowerBound = nodes[0].weight * kmin;
+  return evalNode(0, x, bandwidths, kernel, tolerance, kmin, lowerBound, values);
+}
+
+double KernelDensityTree::evalNode(size_t node, const double* x, base::DataVector& bandwidths,
+                                   Kernel& kernel, double tolerance, double kmin,
+                                   double& lowerBound, std::vector<double>& values) const {
+  const Node& current = nodes[node];
+
+  if (current.left == 0) {
+    // leaf: evaluate all kernels
+    size_t count = current.end - current.begin;
+    values.resize(count);
+    std::vector<const double*> leafColumns(ndim);
+    for (size_t idim = 0; idim < ndim; idim++) {
+      leafColumns[idim] = columns[idim].data();
+    }
+    evalProductKernels(kernel.getType(), x, leafColumns.data(), current.begin, count, ndim,
+                       bandwidths.getPointer(), values.data());
+    double sum = 0.0;
+    for (size_t k = 0; k < count; k++) {
+      sum += weights[current.begin + k] * values[k];
+    }
+    lowerBound += sum - current.weight * kmin;
+    return sum;
+  }
+
+  // tighten the lower bound with the bounds of the children
+  size_t children[2] = {current.left, current.right};
+  double kmins[2], kmaxs[2];
+  for (size_t i = 0; i < 2; i++) {
+    kernelBounds(children[i], x, bandwidths, kernel, kmins[i], kmaxs[i]);
+  }
+  lowerBound += nodes[children[0]].weight * kmins[0] + nodes[children[1]].weight * kmins[1] -
+                current.weight * kmin;
+
+  // visit the closer child first, this improves the lower bound for the other one
+  size_t first = (kmaxs[1] > kmaxs[0]) ? 1 : 0;
+  double sum = 0.0;
+  double totalWeight = nodes[0].weight;
+
+  for (size_t i = first; i < first + 2; i++) {
+    size_t child = i % 2;
+    // the error of the approximation is at most weight * (kmax - kmin) / 2, which is bounded by
+    // the child's share of tolerance * lowerBound
+    if (kmaxs[child] - kmins[child] <= 2.0 * tolerance * lowerBound / totalWeight) {
+      sum += nodes[children[child]].weight * (kmaxs[child] + kmins[child]) / 2.0;
+    } else {
+      sum += evalNode(children[child], x, bandwidths, kernel, tolerance, kmins[child], lowerBound,
+                      values);
+    }
+  }
+
+  return sum;
+}
+
 // ----------------------------------------------------------------------------------
 // bandwidth optimizers
 
@@ -603,7 +926,16 @@ void ScottsRule::optimizeBandwidths(KernelDensityEstimator* kde, base::DataVecto
 
 KDEMaximumLikelihoodCrossValidation::KDEMaximumLikelihoodCrossValidation(
     KernelDensityEstimator& kde, size_t kfold, std::uint64_t seedValue)
-    : sgpp::base::ScalarFunction(kde.getDim()), kde(kde), strain(kfold), stest(kfold) {
+    : sgpp::base::ScalarFunction(kde.getDim()),
+      kde(kde),
+      leaveOneOut(kfold >= kde.getNsamples()),
+      strain(leaveOneOut ? 0 : kfold),
+      stest(leaveOneOut ? 0 : kfold) {
+  if (leaveOneOut) {
+    // the likelihoods are evaluated in one pass on the full data set
+    return;
+  }
+
   // split the data set
   auto samples = kde.getSamples();
   size_t numSamples = samples->getNrows();
@@ -665,6 +997,22 @@ void MaximumLikelihoodCrossValidation::optimizeBandwidths(KernelDensityEstimator
 }
 
 double KDEMaximumLikelihoodCrossValidation::eval(const base::DataVector& x) {
+  base::DataVector values;
+
+  if (leaveOneOut) {
+    // copy shares the samples
+    KernelDensityEstimator localKDE(kde);
+    localKDE.setBandwidths(x);
+    localKDE.pdfLeaveOneOut(values);
+
+    // compute the cross entropy
+    double sum = 0.0;
+    for (size_t i = 0; i < values.getSize(); i++) {
+      sum += std::log2(std::max(1e-10, values[i]));
+    }
+    return -1.0 * sum / static_cast<double>(values.getSize());
+  }
+
   double result = 0.0;
   // do the k-fold cross validation
   for (size_t k = 0; k < strain.size(); k++) {
@@ -676,8 +1024,14 @@ double KDEMaximumLikelihoodCrossValidation::eval(const base::DataVector& x) {
                                     BandwidthOptimizationType::NONE);
     localKDE.setBandwidths(x);
 
-    // compute the cross entropy
-    result += localKDE.crossEntropy(*testSamples);
+    // compute the cross entropy, same as localKDE.crossEntropy(*testSamples) but with the parallel
+    // evaluation of all test samples
+    localKDE.pdf(*testSamples, values);
+    double sum = 0.0;
+    for (size_t i = 0; i < values.getSize(); i++) {
+      sum += std::log2(std::max(1e-10, values[i]));
+    }
+    result += -1.0 * sum / static_cast<double>(values.getSize());
   }
 
   return result / static_cast<double>(strain.size());
@@ -12,6 +12,7 @@
 
 #include <sgpp/globaldef.hpp>
 
+#include <memory>
 #include <vector>
 #include <random>
 
@@ -65,6 +66,77 @@ class EpanechnikovKernel : public Kernel {
 
 // --------------------------------------------------------------------------------
 
+/**
+ * kd-tree over the samples of a kernel density estimator, used for the approximate evaluation of
+ * the density. Every node stores the bounding box of its samples and the sum of their
+ * conditionalization factors. The contribution of a node is approximated by the mean of the
+ * kernel bounds over its bounding box if the resulting error is small enough compared to a lower
+ * bound of the total density (single-tree variant of Gray and Moore).
+ */
+class KernelDensityTree {
+ public:
+  /**
+   * Constructor, builds the tree
+   *
+   * @param samplesVec samples, one vector per dimension
+   * @param cond conditionalization factors (weights) of the samples
+   * @param leafSize maximal number of samples in a leaf
+   */
+  KernelDensityTree(std::vector<std::shared_ptr<base::DataVector>>& samplesVec,
+                    base::DataVector& cond, size_t leafSize = 64);
+
+  /**
+   * Approximates the weighted sum of the kernels sum_i cond_i prod_d K((x_d - s_id) / h_d)
+   * with a relative error of at most tolerance (up to rounding).
+   *
+   * @param x evaluation point
+   * @param bandwidths bandwidths of the kernels
+   * @param kernel the kernel, has to be symmetric and non-increasing in |x|
+   * @param tolerance relative error tolerance
+   * @param values buffer of the calling thread
+   * @return the approximated sum
+   */
+  double eval(const double* x, base::DataVector& bandwidths, Kernel& kernel, double tolerance,
+              std::vector<double>& values) const;
+
+ private:
+  struct Node {
+    /// range of the samples in the permuted order
+    size_t begin;
+    size_t end;
+    /// children, 0 for leaves
+    size_t left;
+    size_t right;
+    /// sum of the weights of the samples
+    double weight;
+  };
+
+  size_t build(size_t begin, size_t end, std::vector<size_t>& permutation,
+               std::vector<std::shared_ptr<base::DataVector>>& samplesVec,
+               base::DataVector& cond);
+
+  void kernelBounds(size_t node, const double* x, base::DataVector& bandwidths, Kernel& kernel,
+                    double& kmin, double& kmax) const;
+
+  double evalNode(size_t node, const double* x, base::DataVector& bandwidths, Kernel& kernel,
+                  double tolerance, double kmin, double& lowerBound,
+                  std::vector<double>& values) const;
+
+  size_t ndim;
+  size_t leafSize;
+  /// nodes, the root is the first one
+  std::vector<Node> nodes;
+  /// lower and upper corners of the bounding boxes (nodes x ndim)
+  std::vector<double> lower;
+  std::vector<double> upper;
+  /// samples in tree order, one column per dimension
+  std::vector<std::vector<double>> columns;
+  /// weights of the samples in tree order
+  std::vector<double> weights;
+};
+
+// --------------------------------------------------------------------------------
+
 class KernelDensityEstimator : public DensityEstimator {
  public:
   explicit KernelDensityEstimator(KernelType kernelType = KernelType::GAUSSIAN,
@@ -97,6 +169,26 @@ class KernelDensityEstimator : public DensityEstimator {
 
   double evalSubset(base::DataVector& x, std::vector<size_t> skipElements);
 
+  /**
+   * Evaluates the leave-one-out densities of all samples in one pass, i.e. the density of the
+   * estimator without sample i at sample i. Compared to calling evalSubset for every sample, the
+   * kernels are evaluated in parallel blocks. The remaining kernels are weighted and normalized
+   * with the conditionalization factors, for the default factors this equals evalSubset.
+   *
+   * @param[out] res leave-one-out densities of the samples
+   */
+  void pdfLeaveOneOut(base::DataVector& res);
+
+  /**
+   * Sets the relative error tolerance for the evaluation of the density. For tolerance 0 (default)
+   * all kernels are evaluated exactly, otherwise the samples are organized in a kd-tree and far
+   * away groups of samples are approximated (see KernelDensityTree).
+   *
+   * @param tolerance relative error tolerance
+   */
+  void setApproximationTolerance(double tolerance);
+  double getApproximationTolerance();
+
   /// getter and setter functions
   void getConditionalizationFactor(base::DataVector& pcond);
   void setConditionalizationFactor(base::DataVector& pcond);
@@ -119,6 +211,31 @@ class KernelDensityEstimator : public DensityEstimator {
  private:
   double evalKernel(base::DataVector& x, size_t i);
 
+  /**
+   * Computes the weighted kernel sums sum_i cond_i prod_d K((x_d - s_id) / h_d) of a block of
+   * points, the samples are processed in blocks which are shared by all points.
+   *
+   * @param points first point, row-major
+   * @param stride distance between two consecutive points
+   * @param numPoints number of points
+   * @param firstSample if the points are the samples starting at this index, the kernel of each
+   * point's own sample is skipped; nsamples otherwise
+   * @param[out] sums the kernel sums
+   * @param values buffer of the calling thread
+   */
+  void sumKernels(const double* points, size_t stride, size_t numPoints, size_t firstSample,
+                  double* sums, std::vector<double>& values);
+
+  /**
+   * @return product of the normalization factors of the 1d kernels
+   */
+  double normProduct();
+
+  /**
+   * @return the kd-tree over the samples, builds it if necessary
+   */
+  KernelDensityTree& getTree();
+
   /// samples
   std::vector<std::shared_ptr<base::DataVector>> samplesVec;
 
@@ -139,6 +256,11 @@ class KernelDensityEstimator : public DensityEstimator {
   /// bandwith optimization type
   BandwidthOptimizationType bandwidthOptimizationType;
 
+  /// relative error tolerance of the evaluation, 0 for exact evaluation
+  double approximationTolerance;
+  /// kd-tree for approximate evaluation, built on demand
+  std::unique_ptr<KernelDensityTree> tree;
+
   void computeAndSetOptKDEbdwth();
   void computeNormalizationFactors();
 };
@@ -147,7 +269,8 @@ class KernelDensityEstimator : public DensityEstimator {
 class KDEMaximumLikelihoodCrossValidation : public sgpp::base::ScalarFunction {
  public:
   /**
-   * Constructor.
+   * Constructor. If kfold is at least the number of samples, the leave-one-out likelihood is
+   * computed in one pass (see KernelDensityEstimator::pdfLeaveOneOut).
    */
   explicit KDEMaximumLikelihoodCrossValidation(
       KernelDensityEstimator& kde, size_t kfold = 10,
@@ -165,6 +288,7 @@ class KDEMaximumLikelihoodCrossValidation : public sgpp::base::ScalarFunction {
 
  private:
   KernelDensityEstimator& kde;
+  bool leaveOneOut;
   std::vector<std::shared_ptr<base::DataMatrix>> strain;
   std::vector<std::shared_ptr<base::DataMatrix>> stest;
 };
@@ -19,9 +19,14 @@
 #include <sgpp/datadriven/algorithm/RefinementMonitorPeriodic.hpp>
 #include <sgpp/datadriven/application/LearnerSGD.hpp>
 
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
 #include <algorithm>
 #include <cmath>
 #include <string>
+#include <vector>
 
 using sgpp::base::GridStorage;
 using sgpp::base::HashRefinement;
@@ -55,7 +60,9 @@ LearnerSGD::LearnerSGD(base::RegularGridConfiguration& gridConfig,
       gamma(gamma),
       currentGamma(gamma),
       batchSize(batchSize),
-      useValidData(useValidData) {
+      useValidData(useValidData),
+      miniBatchSize(1),
+      hogwild(false) {
   // if no validation data is provided -> create buffer
   // which contains already processed data points
   // (required for computing error contributions used for predictive refinement)
@@ -84,8 +91,23 @@ void LearnerSGD::initialize() {
   alpha.resize(grid->getSize(), 0.0);
   // vector for averaged surpluses
   alphaAvg.resize(grid->getSize(), 0.0);
+  resetEvaluations();
+}
+
+void LearnerSGD::setMiniBatchSize(size_t miniBatchSize) {
+  if (miniBatchSize == 0) {
+    throw base::application_exception(
+        "LearnerSGD::setMiniBatchSize : the mini-batch size has to be positive");
+  }
+  this->miniBatchSize = miniBatchSize;
 }
 
+size_t LearnerSGD::getMiniBatchSize() const { return miniBatchSize; }
+
+void LearnerSGD::setHogwild(bool hogwild) { this->hogwild = hogwild; }
+
+bool LearnerSGD::isHogwild() const { return hogwild; }
+
 std::unique_ptr<base::Grid> LearnerSGD::createRegularGrid() {
   // load grid
   std::unique_ptr<base::Grid> uGrid;
@@ -105,6 +127,7 @@ void LearnerSGD::train(size_t maxDataPasses, std::string refType, std::string re
                        size_t refPeriod, double errorDeclineThreshold,
                        size_t errorDeclineBufferSize, size_t minRefInterval) {
   size_t dim = trainData.getNcols();
+  size_t numData = trainData.getNrows();
 
   // initialize counter for dataset passes
   size_t cntDataPasses = 0;
@@ -124,114 +147,86 @@ void LearnerSGD::train(size_t maxDataPasses, std::string refType, std::string re
                                                minRefInterval);
   }
 
-  // reduction factor for addaptive learning rate
-  // double lGamma = 0.001;
-
   // auxiliary variable for accuracy (error) measurement
   double acc = getAccuracy(testData, testLabels, 0.0);
   avgErrors.append(1.0 - acc);
 
-  // parameters for ADAM
-  /*sgpp::base::DataVector m(alpha.getSize(), 0.0);
-  sgpp::base::DataVector v(alpha.getSize(), 0.0);
-  double beta_1 = 0.25;
-  double beta_2 = 0.95;
-  double epsilon = 1e-8;*/
+  // one mini-batch per thread for Hogwild-style updates, otherwise the steps are sequential
+  size_t numThreads = 1;
+#ifdef _OPENMP
+  if (hogwild) {
+    numThreads = static_cast<size_t>(omp_get_max_threads());
+  }
+#endif
+  std::vector<MiniBatch> miniBatches(numThreads);
+
+  // number of SGD steps per pass over the training data
+  size_t stepsPerPass = (numData + miniBatchSize - 1) / miniBatchSize;
 
-  // counts total number of processed data points
+  // counts total number of processed data points and SGD steps
   size_t processedPoints = 0;
+  size_t processedSteps = 0;
   // main loop which performs the learning process
   while (cntDataPasses < maxDataPasses) {
-    for (size_t currIt = 0; currIt < trainData.getNrows(); currIt++) {
-      // get next training sample x and its label y
-      sgpp::base::DataVector x(dim);
-      trainData.getRow(currIt, x);
-      double y = trainLabels.get(currIt);
+    for (size_t currIt = 0; currIt < numData;) {
+      // perform SGD steps for the next mini-batches (concurrently with Hogwild-style updates)
+      size_t numSteps =
+          std::min(numThreads, (numData - currIt + miniBatchSize - 1) / miniBatchSize);
+      size_t roundEnd = std::min(numData, currIt + numSteps * miniBatchSize);
+
+#pragma omp parallel for schedule(static, 1) if (numSteps > 1)
+      for (size_t step = 0; step < numSteps; step++) {
+        size_t first = currIt + step * miniBatchSize;
+        doStep(first, std::min(miniBatchSize, numData - first), miniBatches[step]);
+      }
+
+      // with Hogwild-style updates, the weight decay of all steps of the round is applied at once
+      if (hogwild) {
+        alpha.mult(std::pow(1.0 - currentGamma * lambda, static_cast<double>(numSteps)));
+      }
 
-      // store data point in batch dataset used for checking
+      // store data points in batch dataset used for checking
       // predictive refinement criterion
       // if validation set is used -> not needed
       if (!useValidData) {
-        pushToBatch(x, y);
+        sgpp::base::DataVector x(dim);
+        for (size_t i = currIt; i < roundEnd; i++) {
+          trainData.getRow(i, x);
+          pushToBatch(x, trainLabels.get(i));
+        }
+        // the batch data has changed, so its evaluation operation has to be prepared again
+        batchEval.reset();
       }
 
-      sgpp::base::DataVector delta(alpha.getSize());
-
-      sgpp::base::DataVector singleAlpha(1);
-      singleAlpha[0] = 1.0;
-
-      // perform SGD step
-      sgpp::base::DataMatrix dm(x.getPointer(), 1, x.getSize());
-      std::unique_ptr<base::OperationMultipleEval> multEval(
-          op_factory::createOperationMultipleEval(*grid, dm));
-      multEval->multTranspose(singleAlpha, delta);
-
-      double residual = delta.dotProduct(alpha) - y;
-
-      // ADAM
-      // gradient
-      /*delta.mult(residual);
-      delta.axpy(lambda, alpha);
-      sgpp::base::DataVector grad_1(delta);
-      sgpp::base::DataVector grad_2(delta);
-      //update biased first and second moment estimates
-      grad_1.mult(1.0-beta_1);
-      m.mult(beta_1);
-      m.add(grad_1);
-      grad_2.sqr();
-      grad_2.mult(1.0-beta_2);
-      v.mult(beta_2);
-      v.add(grad_2);
-      //update bias-corrected first and second moment estimates
-      //m.mult(1.0/(1.0-std::pow(beta_1,currIt+1)));
-      //v.mult(1.0/(1.0-std::pow(beta_2,currIt+1)));
-      m.mult(1.0/(1.0-std::pow(beta_1,processedPoints+1)));
-      v.mult(1.0/(1.0-std::pow(beta_2,processedPoints+1)));
-      //update alpha
-      v.sqrt();
-      sgpp::base::DataVector eps_vec(alpha.getSize(), epsilon);
-      v.add(eps_vec);
-      m.componentwise_div(v);
-      m.mult(currentGamma);
-      alpha.sub(m);*/
-
-      // SGD
-      alpha.mult(1 - currentGamma * lambda);
-      alpha.axpy(-currentGamma * residual, delta);
-
-      // learning rate according to L. Bottou
-      /*currentGamma =
-          gamma *
-          std::pow(
-              (1 + gamma * lGamma * (static_cast<double>(processedPoints) + 1)),
-              -0.75);*/
-      currentGamma =
-          gamma *
-          std::pow((1 + gamma * lambda * (static_cast<double>(processedPoints) + 1)), -0.75);
-
-      // smoothing according to L. Bottou
-      size_t t1 = (processedPoints > dim + 1) ? processedPoints - dim : 1;
-      size_t t2 =
-          (processedPoints > trainData.getNrows() + 1) ? processedPoints - trainData.getNrows() : 1;
-      double mu = (t1 > t2) ? static_cast<double>(t1) : static_cast<double>(t2);
-      mu = 1.0 / mu;
-
-      // average SGD / ADAM
-      alphaAvg.mult(1 - mu);
-      alphaAvg.axpy(mu, alpha);
+      for (size_t step = 0; step < numSteps; step++) {
+        // learning rate according to L. Bottou
+        currentGamma =
+            gamma *
+            std::pow((1 + gamma * lambda * (static_cast<double>(processedSteps) + 1)), -0.75);
+
+        // smoothing according to L. Bottou
+        size_t t1 = (processedSteps > dim + 1) ? processedSteps - dim : 1;
+        size_t t2 = (processedSteps > stepsPerPass + 1) ? processedSteps - stepsPerPass : 1;
+        double mu = (t1 > t2) ? static_cast<double>(t1) : static_cast<double>(t2);
+        mu = 1.0 / mu;
+
+        // average SGD
+        alphaAvg.mult(1 - mu);
+        alphaAvg.axpy(mu, alpha);
+
+        processedSteps++;
+      }
 
       size_t refinementsNecessary = 0;
       if (refCnt < refNum && processedPoints > 0 && monitor) {
         // check if refinement should be performed
         currentBatchError = getError(*batchData, *batchLabels, "MSE");
         currentTrainError = getError(trainData, trainLabels, "MSE");
-        monitor->pushToBuffer(1, currentBatchError, currentTrainError);
+        monitor->pushToBuffer(roundEnd - currIt, currentBatchError, currentTrainError);
         refinementsNecessary = monitor->refinementsNecessary();
       }
 
       while (refinementsNecessary > 0) {
-        // acc = getAccuracy(testData, testLabels, 0.0);
-        // avgErrors.append(1.0 - acc);
         std::cout << "refinement at iteration: " << processedPoints + 1 << std::endl;
 
         base::GridStorage& gridStorage = grid->getStorage();
@@ -256,9 +251,11 @@ void LearnerSGD::train(size_t maxDataPasses, std::string refType, std::string re
         alpha.resizeZero(grid->getSize());
         alphaAvg.resizeZero(grid->getSize());
 
-        // required for ADAM
-        // m.resizeZero(grid->getSize());
-        // v.resizeZero(grid->getSize());
+        // the evaluation operations have to be recreated for the new grid
+        resetEvaluations();
+        for (MiniBatch& miniBatch : miniBatches) {
+          miniBatch.eval.reset();
+        }
 
         std::cout << "refinement step: " << refCnt + 1 << std::endl;
         std::cout << "new grid size: " << grid->getSize() << std::endl;
@@ -267,13 +264,14 @@ void LearnerSGD::train(size_t maxDataPasses, std::string refType, std::string re
         refinementsNecessary--;
       }
 
-      // save current error
-      if ((processedPoints + 1) % 10 == 0) {
+      // save current error (every 10 data points)
+      if ((processedPoints + roundEnd - currIt) / 10 > processedPoints / 10) {
         acc = getAccuracy(testData, testLabels, 0.0);
         avgErrors.append(1.0 - acc);
       }
 
-      processedPoints++;
+      processedPoints += roundEnd - currIt;
+      currIt = roundEnd;
     }
     cntDataPasses++;
   }
@@ -285,6 +283,78 @@ void LearnerSGD::train(size_t maxDataPasses, std::string refType, std::string re
   error = 1.0 - getAccuracy(testData, testLabels, 0.0);
 }
 
+void LearnerSGD::doStep(size_t first, size_t count, MiniBatch& miniBatch) {
+  size_t dim = trainData.getNcols();
+
+  // copy the data points, the evaluation operation refers to the matrix of the mini-batch and is
+  // recreated if the number of data points changes (last mini-batch of a pass)
+  if (miniBatch.eval && (miniBatch.data.getNrows() != count)) {
+    miniBatch.eval.reset();
+  }
+  miniBatch.data.resizeRowsCols(count, dim);
+  std::copy(trainData.getPointer() + first * dim, trainData.getPointer() + (first + count) * dim,
+            miniBatch.data.getPointer());
+  if (!miniBatch.eval) {
+    miniBatch.eval.reset(op_factory::createOperationMultipleEval(*grid, miniBatch.data));
+  }
+  miniBatch.eval->prepare();
+
+  // residuals of the current model
+  miniBatch.residuals.resize(count);
+  miniBatch.eval->mult(alpha, miniBatch.residuals);
+  for (size_t i = 0; i < count; i++) {
+    miniBatch.residuals[i] -= trainLabels.get(first + i);
+  }
+
+  // gradient of the squared loss of the mini-batch
+  miniBatch.delta.resize(alpha.getSize());
+  miniBatch.eval->multTranspose(miniBatch.residuals, miniBatch.delta);
+
+  double stepWidth = currentGamma / static_cast<double>(count);
+  double* alphaData = alpha.getPointer();
+  const double* deltaData = miniBatch.delta.getPointer();
+
+  if (hogwild) {
+    // other threads update alpha at the same time, only the surpluses of the basis functions
+    // which are nonzero on the mini-batch are written (the weight decay follows after the round)
+    for (size_t j = 0; j < alpha.getSize(); j++) {
+      if (deltaData[j] != 0.0) {
+#pragma omp atomic
+        alphaData[j] -= stepWidth * deltaData[j];
+      }
+    }
+  } else {
+    double decay = 1.0 - currentGamma * lambda;
+    for (size_t j = 0; j < alpha.getSize(); j++) {
+      alphaData[j] = decay * alphaData[j] - stepWidth * deltaData[j];
+    }
+  }
+}
+
+base::OperationMultipleEval& LearnerSGD::getEvaluation(
+    base::DataMatrix& data, std::unique_ptr<base::OperationMultipleEval>& temporary) {
+  std::unique_ptr<base::OperationMultipleEval>* eval = &temporary;
+  if (&data == &trainData) {
+    eval = &trainEval;
+  } else if (&data == &testData) {
+    eval = &testEval;
+  } else if (&data == batchData) {
+    eval = &batchEval;
+  }
+
+  if (!*eval) {
+    eval->reset(op_factory::createOperationMultipleEval(*grid, data));
+    (*eval)->prepare();
+  }
+  return **eval;
+}
+
+void LearnerSGD::resetEvaluations() {
+  trainEval.reset();
+  testEval.reset();
+  batchEval.reset();
+}
+
 void LearnerSGD::storeResults(base::DataMatrix& testDataset) {
   base::DataVector predictedLabels(testDataset.getNrows());
   predict(testDataset, predictedLabels);
@@ -358,9 +428,8 @@ double LearnerSGD::getError(sgpp::base::DataMatrix& data, sgpp::base::DataVector
   sgpp::base::DataVector result(numData);
   sgpp::base::DataVector error(numData);
 
-  std::unique_ptr<base::OperationMultipleEval> opEval(
-      op_factory::createOperationMultipleEval(*grid, data));
-  opEval->mult(alphaAvg, result);
+  std::unique_ptr<base::OperationMultipleEval> temporary;
+  getEvaluation(data, temporary).mult(alphaAvg, result);
 
   double res = -1.0;
   if (errorType == "MSE") {
@@ -392,9 +461,8 @@ void LearnerSGD::getBatchError(sgpp::base::DataMatrix& data, const sgpp::base::D
   size_t numData = data.getNrows();
   sgpp::base::DataVector result(numData);
 
-  std::unique_ptr<base::OperationMultipleEval> opEval(
-      op_factory::createOperationMultipleEval(*grid, data));
-  opEval->mult(alphaAvg, result);
+  std::unique_ptr<base::OperationMultipleEval> temporary;
+  getEvaluation(data, temporary).mult(alphaAvg, result);
 
   for (size_t i = 0; i < numData; i++) {
     batchError.set(i, pow(labels.get(i) - result.get(i), 2));
@@ -435,9 +503,8 @@ void LearnerSGD::predict(base::DataMatrix& testData, base::DataVector& predicted
   predictedLabels.resize(testData.getNrows());
   sgpp::base::DataVector result(testData.getNrows());
 
-  std::unique_ptr<base::OperationMultipleEval> opEval(
-      op_factory::createOperationMultipleEval(*grid, testData));
-  opEval->mult(alphaAvg, result);
+  std::unique_ptr<base::OperationMultipleEval> temporary;
+  getEvaluation(testData, temporary).mult(alphaAvg, result);
 
   for (size_t i = 0; i < testData.getNrows(); i++) {
     if (result.get(i) >= 0.0) {
@@ -8,9 +8,11 @@
 #include <sgpp/base/datatypes/DataMatrix.hpp>
 #include <sgpp/base/datatypes/DataVector.hpp>
 #include <sgpp/base/grid/Grid.hpp>
+#include <sgpp/base/operation/hash/OperationMultipleEval.hpp>
 
 #include <sgpp/globaldef.hpp>
 
+#include <memory>
 #include <string>
 #include <vector>
 
@@ -19,6 +21,15 @@ namespace datadriven {
 
 /**
  * LearnerSGD learns the data using stochastic gradient descent.
+ *
+ * Each step processes a mini-batch of consecutive training data points (one data point by
+ * default): the residuals are computed with one OperationMultipleEval::mult and the gradient with
+ * one OperationMultipleEval::multTranspose. With Hogwild-style updates, the threads process one
+ * mini-batch each and concurrently update only those surpluses whose basis functions are nonzero
+ * on their mini-batch (with atomic writes, but without synchronizing the steps), the weight decay
+ * of the round is applied afterwards. The refinement checks and error measurements take place
+ * between these rounds. The evaluation operations for the training, test and batch data are
+ * created once and reused.
  */
 
 class LearnerSGD {
@@ -98,6 +109,27 @@ class LearnerSGD {
    */
   void storeResults(base::DataMatrix& testDataset);
 
+  /**
+   * @param miniBatchSize The number of data points per SGD step (default 1)
+   */
+  void setMiniBatchSize(size_t miniBatchSize);
+
+  /**
+   * @return The number of data points per SGD step
+   */
+  size_t getMiniBatchSize() const;
+
+  /**
+   * @param hogwild Specifies if the threads process mini-batches concurrently and update the
+   *        surpluses without synchronizing the steps (default false)
+   */
+  void setHogwild(bool hogwild);
+
+  /**
+   * @return Specifies if Hogwild-style parallel updates are used
+   */
+  bool isHogwild() const;
+
   // The final classification error
   double error;
   // A vector to store error evaluations
@@ -160,6 +192,46 @@ class LearnerSGD {
    */
   void pushToBatch(sgpp::base::DataVector& x, double y);
 
+  /**
+   * Buffers of a mini-batch
+   */
+  struct MiniBatch {
+    /// the data points of the mini-batch
+    base::DataMatrix data;
+    /// the residuals (predictions minus labels)
+    base::DataVector residuals;
+    /// the gradient of the loss without regularization
+    base::DataVector delta;
+    /// evaluation operation for the data points
+    std::unique_ptr<base::OperationMultipleEval> eval;
+  };
+
+  /**
+   * Performs an SGD step for a mini-batch of training data points.
+   *
+   * @param first The index of the first data point
+   * @param count The number of data points
+   * @param miniBatch The buffers of the mini-batch
+   */
+  void doStep(size_t first, size_t count, MiniBatch& miniBatch);
+
+  /**
+   * Returns the evaluation operation for the training, test or batch data. The operations are
+   * created at the first call and reused until the grid changes. For other datasets, a
+   * temporary operation is stored in the given pointer.
+   *
+   * @param data The data points
+   * @param temporary Storage for an operation for other datasets
+   * @return The evaluation operation
+   */
+  base::OperationMultipleEval& getEvaluation(
+      base::DataMatrix& data, std::unique_ptr<base::OperationMultipleEval>& temporary);
+
+  /**
+   * Deletes the evaluation operations, required after the grid has changed.
+   */
+  void resetEvaluations();
+
   std::unique_ptr<base::Grid> grid;
   base::DataVector alpha;
   base::DataVector alphaAvg;
@@ -181,6 +253,13 @@ class LearnerSGD {
   size_t batchSize;
 
   bool useValidData;
+
+  size_t miniBatchSize;
+  bool hogwild;
+
+  std::unique_ptr<base::OperationMultipleEval> trainEval;
+  std::unique_ptr<base::OperationMultipleEval> testEval;
+  std::unique_ptr<base::OperationMultipleEval> batchEval;
 };
 
 }  // namespace datadriven
@@ -247,13 +247,10 @@ void LearnerSVM::storeResults(sgpp::base::DataMatrix& testDataset) {
   // evaluate learned function at all points from values
   // and write result to csv file
   output.open("SVM_fun_evals.csv");
-  size_t dim = values.getNcols();
+  sgpp::base::DataVector res(values.getNrows());
+  svm->predictRaw(*grid, values, res);
   for (size_t i = 0; i < values.getNrows(); i++) {
-    // get next test sample x
-    sgpp::base::DataVector x(2);
-    values.getRow(i, x);
-    double res = svm->predictRaw(*grid, x, dim);
-    output << res << ";" << std::endl;
+    output << res[i] << ";" << std::endl;
   }
   output.close();
 }
@@ -294,29 +291,21 @@ double LearnerSVM::getAccuracy(const sgpp::base::DataVector& referenceLabels,
 
 void LearnerSVM::predict(sgpp::base::DataMatrix& testData,
                          sgpp::base::DataVector& predictedLabels) {
-  predictedLabels.resize(testData.getNrows());
-  size_t dim = testData.getNcols();
-
-  for (size_t i = 0; i < testData.getNrows(); i++) {
-    // get next test sample x
-    sgpp::base::DataVector x(dim);
-    testData.getRow(i, x);
-    predictedLabels.set(i, svm->predict(*grid, x, dim));
-  }
+  svm->predict(*grid, testData, predictedLabels);
 }
 
 double LearnerSVM::getError(sgpp::base::DataMatrix& data, sgpp::base::DataVector& labels,
                             std::string errorType) {
   size_t numData = data.getNrows();
-  size_t dim = data.getNcols();
   sgpp::base::DataVector error(numData);
+  // raw predictions of all data points
+  sgpp::base::DataVector predictions(numData);
+  svm->predictRaw(*grid, data, predictions);
 
   double res = -1.0;
   if (errorType == "MSE") {
     for (size_t i = 0; i < numData; i++) {
-      sgpp::base::DataVector x(dim);
-      data.getRow(i, x);
-      error.set(i, labels.get(i) - svm->predictRaw(*grid, x, dim));
+      error.set(i, labels.get(i) - predictions.get(i));
     }
     // loss (MSE)
     double sum = 0;
@@ -327,9 +316,7 @@ double LearnerSVM::getError(sgpp::base::DataMatrix& data, sgpp::base::DataVector
   }
   if (errorType == "Hinge") {
     for (size_t i = 0; i < numData; i++) {
-      sgpp::base::DataVector x(dim);
-      data.getRow(i, x);
-      error.set(i, std::max(0.0, 1.0 - labels.get(i) * svm->predictRaw(*grid, x, dim)));
+      error.set(i, std::max(0.0, 1.0 - labels.get(i) * predictions.get(i)));
     }
     // loss (Hinge)
     double sum = 0;
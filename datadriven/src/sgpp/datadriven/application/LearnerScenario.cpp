@@ -133,6 +133,8 @@ void LearnerScenario::setSolverConfigurationRefine(
     (*this)["solverRefine"].replaceIDAttr("type", "CG");
   } else if (solverConfigRefine.type_ == solver::SLESolverType::BiCGSTAB) {
     (*this)["solverRefine"].replaceIDAttr("type", "BiCGSTAB");
+  } else if (solverConfigRefine.type_ == solver::SLESolverType::PipelinedCG) {
+    (*this)["solverRefine"].replaceIDAttr("type", "PipelinedCG");
   } else {
     throw base::not_implemented_exception(
         "error: learner does not support the specified solver type");
@@ -149,6 +151,8 @@ solver::SLESolverConfiguration LearnerScenario::getSolverConfigurationRefine() {
     solverConfigFinal.type_ = solver::SLESolverType::CG;
   } else if (solverType.compare("BiCGSTAB") == 0) {
     solverConfigFinal.type_ = solver::SLESolverType::BiCGSTAB;
+  } else if (solverType.compare("PipelinedCG") == 0) {
+    solverConfigFinal.type_ = solver::SLESolverType::PipelinedCG;
   } else {
     throw base::not_implemented_exception(
         "error: learner does not support the specified solver type");
@@ -167,6 +171,8 @@ void LearnerScenario::setSolverConfigurationFinal(
     (*this)["solverFinal"].replaceIDAttr("type", "CG");
   } else if (solverConfigFinal.type_ == solver::SLESolverType::BiCGSTAB) {
     (*this)["solverFinal"].replaceIDAttr("type", "BiCGSTAB");
+  } else if (solverConfigFinal.type_ == solver::SLESolverType::PipelinedCG) {
+    (*this)["solverFinal"].replaceIDAttr("type", "PipelinedCG");
   } else {
     throw base::not_implemented_exception(
         "error: learner does not support the specified solver type");
@@ -183,6 +189,8 @@ solver::SLESolverConfiguration LearnerScenario::getSolverConfigurationFinal() {
     solverConfigFinal.type_ = solver::SLESolverType::CG;
   } else if (solverType.compare("BiCGSTAB") == 0) {
     solverConfigFinal.type_ = solver::SLESolverType::BiCGSTAB;
+  } else if (solverType.compare("PipelinedCG") == 0) {
+    solverConfigFinal.type_ = solver::SLESolverType::PipelinedCG;
   } else {
     throw base::not_implemented_exception(
         "error: learner does not support the specified solver type");
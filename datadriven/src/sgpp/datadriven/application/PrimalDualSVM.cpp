@@ -9,7 +9,9 @@
 
 #include <sgpp/globaldef.hpp>
 
+#include <algorithm>
 #include <cmath>
+#include <vector>
 
 namespace sgpp {
 namespace datadriven {
@@ -23,7 +25,8 @@ PrimalDualSVM::PrimalDualSVM(size_t dim, size_t dataDim, size_t budget,
       w2(sgpp::base::DataVector(dim, 0.0)),
       budget(budget),
       useBias(useBias),
-      bias(0.0) {
+      bias(0.0),
+      removalBatchSize(0) {
   svs.reserveAdditionalRows(budget);
 }
 
@@ -61,6 +64,30 @@ int PrimalDualSVM::predict(sgpp::base::Grid& grid, sgpp::base::DataVector& x,
   }
 }
 
+void PrimalDualSVM::predictRaw(sgpp::base::Grid& grid,
+                               sgpp::base::DataMatrix& data,
+                               sgpp::base::DataVector& result) {
+  result.resize(data.getNrows());
+  // one SG-kernel evaluation for all data points
+  std::unique_ptr<base::OperationMultipleEval> multEval(
+      op_factory::createOperationMultipleEval(grid, data));
+  multEval->mult(w, result);
+  if (useBias) {
+    for (size_t i = 0; i < result.getSize(); i++) {
+      result[i] += bias;
+    }
+  }
+}
+
+void PrimalDualSVM::predict(sgpp::base::Grid& grid,
+                            sgpp::base::DataMatrix& data,
+                            sgpp::base::DataVector& predictedLabels) {
+  predictRaw(grid, data, predictedLabels);
+  for (size_t i = 0; i < predictedLabels.getSize(); i++) {
+    predictedLabels[i] = std::signbit(predictedLabels[i]) ? -1.0 : 1.0;
+  }
+}
+
 void PrimalDualSVM::multiply(double scalar) {
   if (scalar != 1.0) {
     w.mult(scalar);
@@ -76,6 +103,9 @@ void PrimalDualSVM::multiply(double scalar) {
 
 void PrimalDualSVM::add(sgpp::base::Grid& grid, sgpp::base::DataVector& x,
                         double alpha, size_t dataDim) {
+  if (svs.getNrows() >= budget && removalBatchSize > 0) {
+    removeSupportVectors(grid, std::min(removalBatchSize, svs.getNrows()));
+  }
   if (svs.getNrows() < budget) {
     sgpp::base::DataVector xTrans(grid.getSize());
     // SG-kernel evaluation
@@ -102,9 +132,76 @@ void PrimalDualSVM::add(sgpp::base::Grid& grid, sgpp::base::DataVector& x,
   }
 }
 
-/*void PrimalDualSVM::remove(size_t idx) {
-  // ToDo:
-}*/
+void PrimalDualSVM::setRemovalBatchSize(size_t removalBatchSize) {
+  this->removalBatchSize = removalBatchSize;
+}
+
+size_t PrimalDualSVM::getRemovalBatchSize() const { return removalBatchSize; }
+
+void PrimalDualSVM::removeSupportVectors(sgpp::base::Grid& grid,
+                                         size_t numRemovals) {
+  size_t numSVs = svs.getNrows();
+  numRemovals = std::min(numRemovals, numSVs);
+  if (numRemovals == 0) {
+    return;
+  }
+
+  // select the support vectors with the smallest contributions
+  std::vector<size_t> order(numSVs);
+  for (size_t i = 0; i < numSVs; i++) {
+    order[i] = i;
+  }
+  std::vector<double> contributions(numSVs);
+  for (size_t i = 0; i < numSVs; i++) {
+    contributions[i] = std::abs(alphas[i]) * std::sqrt(norms[i]);
+  }
+  std::nth_element(order.begin(), order.begin() + (numRemovals - 1), order.end(),
+                   [&contributions](size_t a, size_t b) {
+                     return (contributions[a] < contributions[b]) ||
+                            (contributions[a] == contributions[b] && a < b);
+                   });
+  std::vector<bool> removed(numSVs, false);
+  for (size_t i = 0; i < numRemovals; i++) {
+    removed[order[i]] = true;
+  }
+
+  // subtract their contributions from w and w2 with one SG-kernel evaluation
+  sgpp::base::DataMatrix removedSVs(numRemovals, svs.getNcols());
+  sgpp::base::DataVector removedAlphas(numRemovals);
+  sgpp::base::DataVector removedAbsAlphas(numRemovals);
+  sgpp::base::DataVector row(svs.getNcols());
+  size_t numKept = 0;
+  size_t numRemoved = 0;
+  for (size_t i = 0; i < numSVs; i++) {
+    svs.getRow(i, row);
+    if (removed[i]) {
+      removedSVs.setRow(numRemoved, row);
+      removedAlphas[numRemoved] = alphas[i];
+      removedAbsAlphas[numRemoved] = std::abs(alphas[i]);
+      numRemoved++;
+      if (useBias) {
+        bias -= alphas[i];
+      }
+    } else {
+      // keep the order of the remaining support vectors
+      svs.setRow(numKept, row);
+      alphas[numKept] = alphas[i];
+      norms[numKept] = norms[i];
+      numKept++;
+    }
+  }
+  svs.resizeRows(numKept);
+  alphas.resize(numKept);
+  norms.resize(numKept);
+
+  std::unique_ptr<base::OperationMultipleEval> multEval(
+      op_factory::createOperationMultipleEval(grid, removedSVs));
+  sgpp::base::DataVector contribution(w.getSize());
+  multEval->multTranspose(removedAlphas, contribution);
+  w.sub(contribution);
+  multEval->multTranspose(removedAbsAlphas, contribution);
+  w2.sub(contribution);
+}
 
 }  // namespace datadriven
 }  // namespace sgpp
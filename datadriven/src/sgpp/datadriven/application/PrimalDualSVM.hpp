@@ -18,6 +18,14 @@ namespace datadriven {
  * Implementation of a support vector machine in primal
  * formulation which additionally stores support vectors.
  * For non-linear classification, sparse grid kernels are applied.
+ *
+ * The normal vector w is the sum of the feature representations of the
+ * support vectors weighted with their alphas. As w is stored explicitly,
+ * predictions do not depend on the number of support vectors; batches of
+ * data points are evaluated with one OperationMultipleEval::mult.
+ * If the budget is exhausted, new support vectors are either discarded
+ * (default) or the support vectors with the smallest contributions
+ * |alpha| * ||phi(x)|| are removed in bulk (see setRemovalBatchSize).
  */
 
 class PrimalDualSVM {
@@ -60,6 +68,26 @@ class PrimalDualSVM {
   int predict(sgpp::base::Grid& grid, sgpp::base::DataVector& x,
               size_t dataDim);
 
+  /**
+   * Raw prediction for a batch of data points.
+   *
+   * @param grid The sparse grid which defines the transformation
+   * @param data The data points (one per row)
+   * @param result The raw prediction values
+   */
+  void predictRaw(sgpp::base::Grid& grid, sgpp::base::DataMatrix& data,
+                  sgpp::base::DataVector& result);
+
+  /**
+   * Class prediction for a batch of data points.
+   *
+   * @param grid The sparse grid which defines the transformation
+   * @param data The data points (one per row)
+   * @param predictedLabels The predicted class labels (-1 or 1)
+   */
+  void predict(sgpp::base::Grid& grid, sgpp::base::DataMatrix& data,
+               sgpp::base::DataVector& predictedLabels);
+
   /**
    * Adds a data point to the set of support vectors.
    *
@@ -71,6 +99,29 @@ class PrimalDualSVM {
   void add(sgpp::base::Grid& grid, sgpp::base::DataVector& x, double alpha,
            size_t dataDim);
 
+  /**
+   * Sets the budget maintenance strategy.
+   *
+   * @param removalBatchSize The number of support vectors which are removed
+   *        at once if a support vector is added to a full budget, 0 (default)
+   *        discards the new support vector instead
+   */
+  void setRemovalBatchSize(size_t removalBatchSize);
+
+  /**
+   * @return The number of support vectors which are removed at once
+   */
+  size_t getRemovalBatchSize() const;
+
+  /**
+   * Removes the support vectors with the smallest contributions
+   * |alpha| * ||phi(x)|| and subtracts their contributions from w and w2.
+   *
+   * @param grid The sparse grid which defines the transformation
+   * @param numRemovals The number of support vectors to remove
+   */
+  void removeSupportVectors(sgpp::base::Grid& grid, size_t numRemovals);
+
   /**
    * Scales the normal vector w.
    *
@@ -78,8 +129,6 @@ class PrimalDualSVM {
    */
   void multiply(double scalar);
 
-  // void remove(size_t idx);
-
   // the set of support vectors
   base::DataMatrix svs;
   // alphas corresponding to support vectors (sv-weights, signed)
@@ -98,6 +147,8 @@ class PrimalDualSVM {
   bool useBias;
   // parameter to change position of decision hyperplane
   double bias;
+  // number of support vectors removed at once if the budget is exhausted
+  size_t removalBatchSize;
 };
 
 }  // namespace datadriven
@@ -14,6 +14,7 @@
 #include <sgpp/datadriven/datamining/modules/dataSource/DataSourceFileTypeParser.hpp>
 #include <sgpp/datadriven/datamining/modules/dataSource/FileSampleProvider.hpp>
 #include <sgpp/datadriven/datamining/modules/dataSource/GzipFileSampleDecorator.hpp>
+#include <sgpp/datadriven/datamining/modules/dataSource/MmapFileSampleProvider.hpp>
 #include <sgpp/datadriven/datamining/modules/dataSource/shuffling/DataShufflingFunctorFactory.hpp>
 
 #include <algorithm>
@@ -41,6 +42,11 @@ DataSourceBuilder& DataSourceBuilder::withBatchSize(size_t batchSize) {
   return *this;
 }
 
+DataSourceBuilder& DataSourceBuilder::withPrefetchDepth(size_t prefetchDepth) {
+  config.prefetchDepth_ = prefetchDepth;
+  return *this;
+}
+
 DataSourceBuilder& DataSourceBuilder::withCompression(bool isCompressed) {
   config.isCompressed_ = isCompressed;
 
@@ -54,6 +60,11 @@ DataSourceBuilder& DataSourceBuilder::withCompression(bool isCompressed) {
   return *this;
 }
 
+DataSourceBuilder& DataSourceBuilder::withBinaryCache(bool useBinaryCache) {
+  config.useBinaryCache_ = useBinaryCache;
+  return *this;
+}
+
 DataSourceBuilder& DataSourceBuilder::withPath(const std::string& filePath) {
   config.filePath_ = filePath;
   if (config.fileType_ == DataSourceFileType::NONE) {
@@ -70,9 +81,11 @@ DataSourceSplitting* DataSourceBuilder::splittingAssemble() const {
   SampleProvider* sampleProvider = nullptr;
 
   if (config.fileType_ == DataSourceFileType::ARFF) {
-    sampleProvider = new ArffFileSampleProvider(shuffling);
+    sampleProvider = new ArffFileSampleProvider(shuffling, config.useBinaryCache_);
   } else if (config.fileType_ == DataSourceFileType::CSV) {
-    sampleProvider = new CSVFileSampleProvider(shuffling);
+    sampleProvider = new CSVFileSampleProvider(shuffling, config.useBinaryCache_);
+  } else if (config.fileType_ == DataSourceFileType::BINARY) {
+    sampleProvider = new MmapFileSampleProvider(shuffling);
   } else {
     throw data_exception("DataSourceBuilder::splittingAssemble() unknown file type");
   }
@@ -108,9 +121,13 @@ DataSourceCrossValidation* DataSourceBuilder::crossValidationAssemble() const {
   SampleProvider* sampleProvider = nullptr;
 
   if (config.fileType_ == DataSourceFileType::ARFF) {
-    sampleProvider = new ArffFileSampleProvider(crossValidationShuffling);
+    sampleProvider =
+        new ArffFileSampleProvider(crossValidationShuffling, config.useBinaryCache_);
   } else if (config.fileType_ == DataSourceFileType::CSV) {
-    sampleProvider = new CSVFileSampleProvider(crossValidationShuffling);
+    sampleProvider =
+        new CSVFileSampleProvider(crossValidationShuffling, config.useBinaryCache_);
+  } else if (config.fileType_ == DataSourceFileType::BINARY) {
+    sampleProvider = new MmapFileSampleProvider(crossValidationShuffling);
   } else {
     throw data_exception("DataSourceBuilder::crossValidationAssemble() unknown file type");
   }
@@ -44,6 +44,15 @@ class DataSourceBuilder {
    */
   DataSourceBuilder& withCompression(bool isCompressed);
 
+  /**
+   * Optionally specify if parsed files should be cached in binary form next to the source file.
+   * The cache is reused on the next run as long as the source file is unchanged. Defaults to
+   * false.
+   * @param useBinaryCache true if the binary cache should be used, false otherwise.
+   * @return Reference to this object, used for chaining.
+   */
+  DataSourceBuilder& withBinaryCache(bool useBinaryCache);
+
   /**
    * Optionally Specify the file type if files are used. If data source does not use any files,
    * this is set to none by default. See DataSourceFileType for supported file types.
@@ -68,6 +77,14 @@ class DataSourceBuilder {
    */
   DataSourceBuilder& withBatchSize(size_t batchSize);
 
+  /**
+   * Optionally specify how many batches are prepared on a background thread while the current
+   * batch is processed. Defaults to 0 (batches are loaded synchronously).
+   * @param prefetchDepth maximal number of batches prepared in advance.
+   * @return Reference to this object, used for chaining.
+   */
+  DataSourceBuilder& withPrefetchDepth(size_t prefetchDepth);
+
   /**
    * Based on the currently specified configuration, build and configure an instance of a data
    * source object.
@@ -126,10 +126,14 @@ bool DataMiningConfigParser::getDataSourceConfig(DataSourceConfig &config,
     config.filePath_ = parseString(*dataSourceConfig, "filePath", defaults.filePath_, "dataSource");
     config.isCompressed_ =
         parseBool(*dataSourceConfig, "compression", defaults.isCompressed_, "dataSource");
+    config.useBinaryCache_ =
+        parseBool(*dataSourceConfig, "binaryCache", defaults.useBinaryCache_, "dataSource");
     config.numBatches_ =
         parseUInt(*dataSourceConfig, "numBatches", defaults.numBatches_, "dataSource");
     config.batchSize_ =
         parseUInt(*dataSourceConfig, "batchSize", defaults.batchSize_, "dataSource");
+    config.prefetchDepth_ =
+        parseUInt(*dataSourceConfig, "prefetchDepth", defaults.prefetchDepth_, "dataSource");
     config.hasTargets_ =
         parseBool(*dataSourceConfig, "hasTargets", defaults.hasTargets_, "dataSource");
     config.validationPortion_ = parseDouble(*dataSourceConfig, "validationPortion",
@@ -229,10 +233,14 @@ bool DataMiningConfigParser::getMultiDataSourceConfig(
     // Fill in all parameters for first dataset (except the filePath)
     config[0].isCompressed_ =
         parseBool(*dataSourceConfig, "compression", defaults[0].isCompressed_, "dataSource");
+    config[0].useBinaryCache_ =
+        parseBool(*dataSourceConfig, "binaryCache", defaults[0].useBinaryCache_, "dataSource");
     config[0].numBatches_ =
         parseUInt(*dataSourceConfig, "numBatches", defaults[0].numBatches_, "dataSource");
     config[0].batchSize_ =
         parseUInt(*dataSourceConfig, "batchSize", defaults[0].batchSize_, "dataSource");
+    config[0].prefetchDepth_ = parseUInt(*dataSourceConfig, "prefetchDepth",
+                                         defaults[0].prefetchDepth_, "dataSource");
     config[0].hasTargets_ =
         parseBool(*dataSourceConfig, "hasTargets", defaults[0].hasTargets_, "dataSource");
     config[0].validationPortion_ = parseDouble(*dataSourceConfig, "validationPortion",
@@ -1151,6 +1159,7 @@ void DataMiningConfigParser::parseRosenblattTransformationConfig(
   config.solverEps_ = parseDouble(dict, "solverEps", defaults.solverEps_, parentNode);
   config.solverThreshold_ =
       parseDouble(dict, "solverThreshold", defaults.solverThreshold_, parentNode);
+  config.modelFile_ = parseString(dict, "modelFile", defaults.modelFile_, parentNode);
 }
 
 bool DataMiningConfigParser::getFitterDatabaseConfig(
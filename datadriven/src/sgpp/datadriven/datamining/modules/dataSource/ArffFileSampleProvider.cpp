@@ -9,6 +9,7 @@
 #include <sgpp/base/datatypes/DataVector.hpp>
 #include <sgpp/base/exception/data_exception.hpp>
 #include <sgpp/base/exception/file_exception.hpp>
+#include <sgpp/datadriven/tools/BinaryDatasetCache.hpp>
 #include <sgpp/datadriven/tools/ARFFTools.hpp>
 
 #include <string>
@@ -18,8 +19,8 @@ namespace sgpp {
 
 namespace datadriven {
 
-ArffFileSampleProvider::ArffFileSampleProvider(DataShufflingFunctor* shuffling)
-    : shuffling{shuffling}, dataset(Dataset{}), counter(0) {}
+ArffFileSampleProvider::ArffFileSampleProvider(DataShufflingFunctor* shuffling, bool useBinaryCache)
+    : shuffling{shuffling}, useBinaryCache{useBinaryCache}, dataset(Dataset{}), counter(0) {}
 
 SampleProvider* ArffFileSampleProvider::clone() const {
   return dynamic_cast<SampleProvider*>(new ArffFileSampleProvider{*this});
@@ -44,6 +45,11 @@ size_t ArffFileSampleProvider::getNumSamples() const {
 void ArffFileSampleProvider::readFile(const std::string& fileName, bool hasTargets,
                                       size_t readinCutoff, std::vector<size_t> readinColumns,
                                       std::vector<double> readinClasses) {
+  const std::string options = BinaryDatasetCache::describeOptions(
+      "arff", hasTargets, readinCutoff, readinColumns, readinClasses);
+  if (useBinaryCache && BinaryDatasetCache::load(fileName, options, dataset)) {
+    return;
+  }
   try {
     dataset = ARFFTools::readARFFFromFile(fileName, hasTargets, readinCutoff, readinColumns,
                                           readinClasses);
@@ -52,6 +58,13 @@ void ArffFileSampleProvider::readFile(const std::string& fileName, bool hasTarge
     // exception safe implementation.
     throw base::data_exception{"Failed to parse ARFF File."};
   }
+  if (useBinaryCache) {
+    try {
+      BinaryDatasetCache::store(fileName, options, dataset);
+    } catch (base::file_exception&) {
+      // failing to write the cache (e.g. in a read-only directory) is not an error
+    }
+  }
 }
 
 Dataset* ArffFileSampleProvider::getNextSamples(size_t howMany) {
@@ -83,6 +96,18 @@ void ArffFileSampleProvider::readString(const std::string& input, bool hasTarget
   }
 }
 
+void ArffFileSampleProvider::readStream(std::istream& stream, bool hasTargets,
+                                        size_t readinCutoff, std::vector<size_t> readinColumns,
+                                        std::vector<double> readinClasses) {
+  try {
+    dataset = ARFFTools::readARFF(stream, hasTargets, readinCutoff, readinColumns, readinClasses);
+  } catch (...) {
+    // TODO(lettrich): catching all exceptions is bad design. Replace call to ARFFTools with
+    // exception safe implementation.
+    throw base::data_exception{"Failed to parse ARFF data."};
+  }
+}
+
 Dataset* ArffFileSampleProvider::splitDataset(size_t howMany) {
   const size_t size = counter + howMany <= dataset.getNumberInstances()
                           ? howMany
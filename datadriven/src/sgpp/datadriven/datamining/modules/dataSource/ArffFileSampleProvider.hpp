@@ -26,8 +26,11 @@ class ArffFileSampleProvider : public FileSampleProvider {
   /**
    * Default constructor
    * @param shuffling functor to permute the training data indexes
+   * @param useBinaryCache whether parsed files are cached in binary form next to the source file
+   * (see #sgpp::datadriven::BinaryDatasetCache) and the cache is reused if the source is unchanged
    */
-  explicit ArffFileSampleProvider(DataShufflingFunctor *shuffling = nullptr);
+  explicit ArffFileSampleProvider(DataShufflingFunctor *shuffling = nullptr,
+                                  bool useBinaryCache = false);
 
   /**
    * Clone Pattern to allow copying of derived classes.
@@ -70,6 +73,19 @@ class ArffFileSampleProvider : public FileSampleProvider {
                   std::vector<size_t> readinColumns = std::vector<size_t>(),
                   std::vector<double> readinClasses = std::vector<double>()) override;
 
+  /**
+   * Parse ARFF data from a stream and store its contents inside this class. Throws if the
+   * stream can not be parsed.
+   * @param stream stream containing information in ARFF file format
+   * @param hasTargets whether the file has targest (i.e. supervised learning)
+   * @param readinCutoff see FileSampleProvider.hpp
+   * @param readinColumns see FileSampleProvider.hpp
+   * @param readinClasses see FileSampleProvider.hpp
+   */
+  void readStream(std::istream &stream, bool hasTargets, size_t readinCutoff = -1,
+                  std::vector<size_t> readinColumns = std::vector<size_t>(),
+                  std::vector<double> readinClasses = std::vector<double>()) override;
+
   /**
    * Resets the state of the sample provider (e.g. to start a new epoch)
    */
@@ -89,6 +105,11 @@ class ArffFileSampleProvider : public FileSampleProvider {
    */
   DataShufflingFunctor *shuffling;
 
+  /**
+   * Whether parsed files are cached in binary form
+   */
+  bool useBinaryCache;
+
   /**
    * #sgpp::datadriven::Dataset containing the samples read from file or string.
    */
@@ -0,0 +1,109 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#include <sgpp/datadriven/datamining/modules/dataSource/BatchPrefetcher.hpp>
+
+#include <utility>
+
+namespace sgpp {
+namespace datadriven {
+
+BatchPrefetcher::BatchPrefetcher(Loader loader, size_t queueDepth)
+    : loader(std::move(loader)),
+      queueDepth(queueDepth > 0 ? queueDepth : 1),
+      finished(true),
+      cancelled(false) {}
+
+BatchPrefetcher::~BatchPrefetcher() { stop(); }
+
+Dataset* BatchPrefetcher::next(size_t iteration) {
+  std::unique_lock<std::mutex> lock(queueMutex);
+  if (queue.empty() && finished) {
+    if (error) {
+      std::exception_ptr loaderError = error;
+      error = nullptr;
+      std::rethrow_exception(loaderError);
+    }
+    // the worker has paused (or never run), restart it at the requested iteration
+    lock.unlock();
+    if (worker.joinable()) {
+      worker.join();
+    }
+    lock.lock();
+    finished = false;
+    cancelled = false;
+    worker = std::thread(&BatchPrefetcher::run, this, iteration);
+  }
+
+  queueNotEmpty.wait(lock, [this]() { return finished || !queue.empty(); });
+  if (queue.empty()) {
+    std::exception_ptr loaderError = error;
+    error = nullptr;
+    std::rethrow_exception(loaderError);
+  }
+  Dataset* dataset = queue.front();
+  queue.pop_front();
+  queueNotFull.notify_one();
+  return dataset;
+}
+
+void BatchPrefetcher::stop() {
+  {
+    std::lock_guard<std::mutex> lock(queueMutex);
+    cancelled = true;
+  }
+  queueNotFull.notify_all();
+  if (worker.joinable()) {
+    worker.join();
+  }
+
+  std::lock_guard<std::mutex> lock(queueMutex);
+  for (Dataset* dataset : queue) {
+    delete dataset;
+  }
+  queue.clear();
+  error = nullptr;
+  finished = true;
+}
+
+void BatchPrefetcher::run(size_t firstIteration) {
+  for (size_t iteration = firstIteration;; ++iteration) {
+    {
+      std::unique_lock<std::mutex> lock(queueMutex);
+      queueNotFull.wait(lock, [this]() { return cancelled || queue.size() < queueDepth; });
+      if (cancelled) {
+        break;
+      }
+    }
+
+    Dataset* dataset = nullptr;
+    try {
+      dataset = loader(iteration);
+    } catch (...) {
+      std::lock_guard<std::mutex> lock(queueMutex);
+      error = std::current_exception();
+      break;
+    }
+
+    std::lock_guard<std::mutex> lock(queueMutex);
+    if (cancelled) {
+      delete dataset;
+      break;
+    }
+    queue.push_back(dataset);
+    queueNotEmpty.notify_one();
+    if (dataset->getNumberInstances() == 0) {
+      // the sample provider is exhausted, pause until the batch has been consumed
+      break;
+    }
+  }
+
+  std::lock_guard<std::mutex> lock(queueMutex);
+  finished = true;
+  queueNotEmpty.notify_all();
+}
+
+}  // namespace datadriven
+}  // namespace sgpp
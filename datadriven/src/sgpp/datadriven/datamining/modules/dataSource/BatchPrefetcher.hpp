@@ -0,0 +1,116 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#pragma once
+
+#include <sgpp/datadriven/tools/Dataset.hpp>
+
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <thread>
+
+namespace sgpp {
+namespace datadriven {
+
+/**
+ * Prepares the batches of a #sgpp::datadriven::DataSource on a worker thread, so reading,
+ * shuffling and transforming batch k+1 overlaps with training on batch k.
+ *
+ * The worker calls the loader for consecutive iterations and stores up to queueDepth batches.
+ * It pauses after the first empty batch, because the sample provider is exhausted then. Batches
+ * are handed out in the order they were loaded, so the sequence of batches is exactly the one of
+ * synchronous loading. Whenever the underlying sample provider is manipulated from outside (e.g.
+ * on reset), the prefetcher has to be stopped first.
+ */
+class BatchPrefetcher {
+ public:
+  /**
+   * Loads the batch of the given iteration (starting at 1), ownership is passed to the caller
+   */
+  typedef std::function<Dataset*(size_t)> Loader;
+
+  /**
+   * Constructor
+   * @param loader function that loads a batch, only called from the worker thread
+   * @param queueDepth maximal number of batches that are prepared in advance
+   */
+  BatchPrefetcher(Loader loader, size_t queueDepth);
+
+  BatchPrefetcher(const BatchPrefetcher&) = delete;
+
+  BatchPrefetcher& operator=(const BatchPrefetcher&) = delete;
+
+  /**
+   * Stops the worker and releases all batches that were not consumed
+   */
+  ~BatchPrefetcher();
+
+  /**
+   * Returns the next batch. Starts the worker with the given iteration if it is not running and
+   * waits until the batch is available. Errors raised by the loader are rethrown here.
+   * @param iteration iteration of the requested batch, only used if the worker is not running
+   * @return the batch, owned by the caller
+   */
+  Dataset* next(size_t iteration);
+
+  /**
+   * Stops the worker and discards all prepared batches. Afterwards the sample provider is
+   * advanced by all batches loaded so far, including the discarded ones, so it has to be reset or
+   * repositioned by the caller.
+   */
+  void stop();
+
+ private:
+  /**
+   * Main loop of the worker thread
+   * @param firstIteration iteration of the first batch to load
+   */
+  void run(size_t firstIteration);
+
+  /**
+   * Function that loads a batch
+   */
+  Loader loader;
+
+  /**
+   * Maximal number of prepared batches
+   */
+  size_t queueDepth;
+
+  /**
+   * Batches that have been prepared, but not consumed yet
+   */
+  std::deque<Dataset*> queue;
+
+  std::mutex queueMutex;
+  std::condition_variable queueNotEmpty;
+  std::condition_variable queueNotFull;
+
+  /**
+   * The worker has paused or failed and does not produce any more batches
+   */
+  bool finished;
+
+  /**
+   * The worker has been requested to stop
+   */
+  bool cancelled;
+
+  /**
+   * Error raised by the loader
+   */
+  std::exception_ptr error;
+
+  /**
+   * Worker thread
+   */
+  std::thread worker;
+};
+
+} /* namespace datadriven */
+} /* namespace sgpp */
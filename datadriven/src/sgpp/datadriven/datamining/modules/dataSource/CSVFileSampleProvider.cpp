@@ -9,8 +9,10 @@
 #include <sgpp/base/datatypes/DataVector.hpp>
 #include <sgpp/base/exception/data_exception.hpp>
 #include <sgpp/base/exception/file_exception.hpp>
+#include <sgpp/datadriven/tools/BinaryDatasetCache.hpp>
 #include <sgpp/datadriven/tools/CSVTools.hpp>
 
+#include <sstream>
 #include <string>
 #include <vector>
 
@@ -18,8 +20,8 @@ namespace sgpp {
 
 namespace datadriven {
 
-CSVFileSampleProvider::CSVFileSampleProvider(DataShufflingFunctor* shuffling)
-    : shuffling{shuffling}, dataset(Dataset{}), counter(0) {}
+CSVFileSampleProvider::CSVFileSampleProvider(DataShufflingFunctor* shuffling, bool useBinaryCache)
+    : shuffling{shuffling}, useBinaryCache{useBinaryCache}, dataset(Dataset{}), counter(0) {}
 
 SampleProvider* CSVFileSampleProvider::clone() const {
   return dynamic_cast<SampleProvider*>(new CSVFileSampleProvider{*this});
@@ -44,6 +46,11 @@ size_t CSVFileSampleProvider::getNumSamples() const {
 void CSVFileSampleProvider::readFile(const std::string& fileName, bool hasTargets,
                                      size_t readinCutoff, std::vector<size_t> readinColumns,
                                      std::vector<double> readinClasses) {
+  const std::string options = BinaryDatasetCache::describeOptions(
+      "csv", hasTargets, readinCutoff, readinColumns, readinClasses);
+  if (useBinaryCache && BinaryDatasetCache::load(fileName, options, dataset)) {
+    return;
+  }
   try {
     // call readCSV with skipfirstline set to true
     dataset = CSVTools::readCSVFromFile(fileName, true, hasTargets, readinCutoff, readinColumns,
@@ -53,6 +60,13 @@ void CSVFileSampleProvider::readFile(const std::string& fileName, bool hasTarget
     // exception safe implementation.
     throw base::data_exception{"Failed to parse CSV File."};
   }
+  if (useBinaryCache) {
+    try {
+      BinaryDatasetCache::store(fileName, options, dataset);
+    } catch (base::file_exception&) {
+      // the cache is an optimization only, a read-only location must not break reading the data
+    }
+  }
 }
 
 Dataset* CSVFileSampleProvider::getNextSamples(size_t howMany) {
@@ -74,13 +88,22 @@ Dataset* CSVFileSampleProvider::getAllSamples() {
 void CSVFileSampleProvider::readString(const std::string& input, bool hasTargets,
                                        size_t readinCutoff, std::vector<size_t> readinColumns,
                                        std::vector<double> readinClasses) {
-  // try {
-  //   dataset = CSVTools::readCSVFromString(input);
-  // } catch (...) {
-  // TODO(lettrich): catching all exceptions is bad design. Replace call to CSVTools with
-  // exception safe implementation.
-  throw base::data_exception{"Failed to parse CSV data. Reading from string is not implemented."};
-  // }
+  std::istringstream stream(input);
+  readStream(stream, hasTargets, readinCutoff, readinColumns, readinClasses);
+}
+
+void CSVFileSampleProvider::readStream(std::istream& stream, bool hasTargets,
+                                       size_t readinCutoff, std::vector<size_t> readinColumns,
+                                       std::vector<double> readinClasses) {
+  try {
+    // the first line contains the column titles
+    dataset =
+        CSVTools::readCSV(stream, true, hasTargets, readinCutoff, readinColumns, readinClasses);
+  } catch (...) {
+    // TODO(lettrich): catching all exceptions is bad design. Replace call to CSVTools with
+    // exception safe implementation.
+    throw base::data_exception{"Failed to parse CSV data."};
+  }
 }
 
 Dataset* CSVFileSampleProvider::splitDataset(size_t howMany) {
@@ -27,8 +27,11 @@ class CSVFileSampleProvider : public FileSampleProvider {
   /**
    * Default constructor
    * @param shuffling functor to permute the training data indexes
+   * @param useBinaryCache whether parsed files are cached in binary form next to the source file
+   * (see #sgpp::datadriven::BinaryDatasetCache) and the cache is reused if the source is unchanged
    */
-  explicit CSVFileSampleProvider(DataShufflingFunctor *shuffling = nullptr);
+  explicit CSVFileSampleProvider(DataShufflingFunctor *shuffling = nullptr,
+                                 bool useBinaryCache = false);
 
   /**
    * Clone Pattern to allow copying of derived classes.
@@ -59,7 +62,8 @@ class CSVFileSampleProvider : public FileSampleProvider {
                 std::vector<double> readinClasses = std::vector<double>()) override;
 
   /**
-   * Currently not implemented.
+   * Parse CSV data from a string and store its contents inside this class. Throws if the string
+   * can not be parsed.
    * @param input string containing information in CSV file format
    * @param hasTargets whether the file has targest (i.e. supervised learning)
    * @param readinCutoff see FileSampleProvider.hpp
@@ -70,6 +74,19 @@ class CSVFileSampleProvider : public FileSampleProvider {
                   std::vector<size_t> readinColumns = std::vector<size_t>(),
                   std::vector<double> readinClasses = std::vector<double>()) override;
 
+  /**
+   * Parse CSV data from a stream and store its contents inside this class. Throws if the
+   * stream can not be parsed.
+   * @param stream stream containing information in CSV file format
+   * @param hasTargets whether the file has targest (i.e. supervised learning)
+   * @param readinCutoff see FileSampleProvider.hpp
+   * @param readinColumns see FileSampleProvider.hpp
+   * @param readinClasses see FileSampleProvider.hpp
+   */
+  void readStream(std::istream &stream, bool hasTargets, size_t readinCutoff = -1,
+                  std::vector<size_t> readinColumns = std::vector<size_t>(),
+                  std::vector<double> readinClasses = std::vector<double>()) override;
+
   /**
    * Resets the state of the sample provider (e.g. to start a new epoch)
    */
@@ -89,6 +106,11 @@ class CSVFileSampleProvider : public FileSampleProvider {
    */
   DataShufflingFunctor *shuffling;
 
+  /**
+   * Whether parsed files are cached in binary form
+   */
+  bool useBinaryCache;
+
   /**
    * #sgpp::datadriven::Dataset containing the samples read from file or string.
    */
@@ -31,6 +31,16 @@ DataSource::DataSource(DataSourceConfig conf, SampleProvider* sp)
   // Build data transformation
   DataTransformationBuilder dataTrBuilder;
   dataTransformation = dataTrBuilder.buildTransformation(conf.dataTransformationConfig_);
+
+  if (config.prefetchDepth_ > 0) {
+    prefetcher = std::make_unique<BatchPrefetcher>(
+        [this](size_t iteration) { return loadNextSamples(iteration); }, config.prefetchDepth_);
+  }
+}
+
+DataSource::~DataSource() {
+  // the worker uses the sample provider, so it has to be stopped before any member is released
+  stopPrefetching();
 }
 
 DataSourceIterator DataSource::begin() { return DataSourceIterator(*this, 0); }
@@ -40,6 +50,8 @@ DataSourceIterator DataSource::end() { return DataSourceIterator(*this, config.n
 Dataset* DataSource::getAllSamples() {
   Dataset* dataset = nullptr;
 
+  // prefetched batches are discarded, the provider is repositioned to the current iteration below
+  stopPrefetching();
   sampleProvider->reset();
 
   dataset = sampleProvider->getAllSamples();
@@ -57,11 +69,18 @@ Dataset* DataSource::getAllSamples() {
 }
 
 Dataset* DataSource::getNextSamples() {
+  currentIteration++;
+  if (prefetcher) {
+    return prefetcher->next(currentIteration);
+  }
+  return loadNextSamples(currentIteration);
+}
+
+Dataset* DataSource::loadNextSamples(size_t iteration) {
   Dataset* dataset = nullptr;
 
   // only one iteration: we want all samples
   if (config.numBatches_ == 1 && config.batchSize_ == 0) {
-    currentIteration++;
     dataset = sampleProvider->getAllSamples();
 
     // Transform dataset if wanted
@@ -74,10 +93,9 @@ Dataset* DataSource::getNextSamples() {
     // several iterations
   } else {
     dataset = sampleProvider->getNextSamples(config.batchSize_);
-    currentIteration++;
 
     // If data transformation wanted and first batch -> initialize transformation
-    if (currentIteration == 1 &&
+    if (iteration == 1 &&
         !(config.dataTransformationConfig_.type_ == DataTransformationType::NONE)) {
       dataTransformation->initialize(dataset, config.dataTransformationConfig_);
       return dataTransformation->doTransformation(dataset);
@@ -91,6 +109,12 @@ Dataset* DataSource::getNextSamples() {
   }
 }
 
+void DataSource::stopPrefetching() {
+  if (prefetcher) {
+    prefetcher->stop();
+  }
+}
+
 const DataSourceConfig& DataSource::getConfig() const { return config; }
 
 size_t DataSource::getCurrentIteration() const { return currentIteration; }
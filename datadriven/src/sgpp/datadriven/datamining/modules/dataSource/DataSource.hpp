@@ -5,12 +5,14 @@
 
 #pragma once
 
+#include <sgpp/datadriven/datamining/modules/dataSource/BatchPrefetcher.hpp>
 #include <sgpp/datadriven/datamining/modules/dataSource/DataSourceConfig.hpp>
 #include <sgpp/datadriven/datamining/modules/dataSource/DataSourceIterator.hpp>
 #include <sgpp/datadriven/datamining/modules/dataSource/DataTransformation.hpp>
 #include <sgpp/datadriven/datamining/modules/dataSource/SampleProvider.hpp>
 #include <sgpp/datadriven/tools/Dataset.hpp>
 
+#include <memory>
 #include <string>
 
 namespace sgpp {
@@ -32,7 +34,7 @@ class DataSource {
    */
   DataSource(DataSourceConfig config, SampleProvider* sampleProvider);
 
-  virtual ~DataSource() = default;
+  virtual ~DataSource();
 
   /**
    * Read only access to the configuration used by DataSource and underlying SampleProvider.
@@ -42,7 +44,8 @@ class DataSource {
 
   /**
    * Request data from the underlying SampleProvider as specified in the provided configuration
-   * object upon construction.
+   * object upon construction. If prefetching is configured, the batch has been prepared in the
+   * background while the previous one was processed.
    * @return #sgpp::datadriven::Dataset containing requested amount of samples (if available).
    */
   virtual Dataset* getNextSamples();
@@ -83,6 +86,20 @@ class DataSource {
   virtual Dataset *getValidationData() = 0;
 
  protected:
+  /**
+   * Reads, shuffles (as part of the sample provider) and transforms the batch of the given
+   * iteration. Called synchronously or from the worker of the prefetcher.
+   * @param iteration the iteration of the batch, starting at 1
+   * @return #sgpp::datadriven::Dataset containing requested amount of samples (if available).
+   */
+  Dataset* loadNextSamples(size_t iteration);
+
+  /**
+   * Stops prefetching and discards the prepared batches. Has to be called before the sample
+   * provider is accessed other than through #loadNextSamples.
+   */
+  void stopPrefetching();
+
   /**
    * Configuration file that determines all relevant properties of the object.
    */
@@ -102,6 +119,11 @@ class DataSource {
    * pointer to DataTransformation to perform transformations on init.
    */
   DataTransformation* dataTransformation;
+
+  /**
+   * Prepares upcoming batches in the background, only set if prefetching is configured
+   */
+  std::unique_ptr<BatchPrefetcher> prefetcher;
 };
 
 } /* namespace datadriven */
@@ -16,7 +16,7 @@ namespace datadriven {
 /**
  * Supported file types for sgpp::datadriven::FileSampleProvider
  */
-enum class DataSourceFileType { NONE, ARFF, CSV };
+enum class DataSourceFileType { NONE, ARFF, CSV, BINARY };
 
 /**
  * Enumeration of all supported shuffling types used to permute samples in a dataset. An entry
@@ -42,6 +42,11 @@ struct DataSourceConfig {
    * The dataset is gzip compressed
    */
   bool isCompressed_ = false;
+  /**
+   * Cache the parsed dataset in binary form next to the source file and reuse the cache on the
+   * next run if the source file is unchanged
+   */
+  bool useBinaryCache_ = false;
   /**
    * How many batches should the dataset be split into for batch learning - if 1, take the
    * entire dataset
@@ -51,6 +56,11 @@ struct DataSourceConfig {
    * size of a batch - if 0, take all available samples.
    */
   size_t batchSize_ = 0;
+  /**
+   * How many batches are prepared in advance on a background thread while the current batch is
+   * processed - if 0, batches are loaded synchronously
+   */
+  size_t prefetchDepth_ = 0;
   /*
    * The portion of the dataset that is used for validation
    */
@@ -27,6 +27,7 @@ DataSourceCrossValidation::DataSourceCrossValidation(
 Dataset* DataSourceCrossValidation::getValidationData() { return validationData; }
 
 void DataSourceCrossValidation::reset() {
+  stopPrefetching();
   sampleProvider->reset();
 
   // Retrieve validation data again
@@ -35,7 +36,11 @@ void DataSourceCrossValidation::reset() {
   validationData = sampleProvider->getNextSamples(validationSize);
 }
 
-void DataSourceCrossValidation::setFold(size_t foldIdx) { shuffling->setFold(foldIdx); }
+void DataSourceCrossValidation::setFold(size_t foldIdx) {
+  // the shuffling is used by the prefetching worker
+  stopPrefetching();
+  shuffling->setFold(foldIdx);
+}
 
 const CrossvalidationConfiguration& DataSourceCrossValidation::getCrossValidationConfig() const {
   return crossValidationConfig;
@@ -25,6 +25,8 @@ DataSourceFileType DataSourceFileTypeParser::parse(const std::string &input) {
     return DataSourceFileType::NONE;
   } else if (inputLower == "csv") {
     return DataSourceFileType::CSV;
+  } else if (inputLower == "bin" || inputLower == "binary") {
+    return DataSourceFileType::BINARY;
   } else {
     const std::string errorMsg =
         "Failed to convert string \"" + input + "\" to any known DataSourceFileType";
@@ -39,7 +41,8 @@ const std::string &sgpp::datadriven::DataSourceFileTypeParser::toString(DataSour
 const DataSourceFileTypeParser::FileTypeMap_t DataSourceFileTypeParser::fileTypeMap = []() {
   return DataSourceFileTypeParser::FileTypeMap_t{std::make_pair(DataSourceFileType::NONE, "None"),
                                                  std::make_pair(DataSourceFileType::ARFF, "ARFF"),
-                                                 std::make_pair(DataSourceFileType::CSV, "CSV")};
+                                                 std::make_pair(DataSourceFileType::CSV, "CSV"),
+                                                 std::make_pair(DataSourceFileType::BINARY, "BIN")};
 }();
 } /* namespace datadriven */
 } /* namespace sgpp */
@@ -54,5 +54,13 @@ void FileSampleDecorator::readString(const std::string &input,
                                      std::vector<double> readinClasses) {
   fileSampleProvider->readString(input, hasTargets, readinCutoff, readinColumns, readinClasses);
 }
+
+void FileSampleDecorator::readStream(std::istream &stream,
+                                     bool hasTargets,
+                                     size_t readinCutoff,
+                                     std::vector<size_t> readinColumns,
+                                     std::vector<double> readinClasses) {
+  fileSampleProvider->readStream(stream, hasTargets, readinCutoff, readinColumns, readinClasses);
+}
 } /* namespace datadriven */
 } /* namespace sgpp */
@@ -79,6 +79,20 @@ class FileSampleDecorator : public FileSampleProvider {
                   std::vector<size_t> readinColumns = std::vector<size_t>(),
                   std::vector<double> readinClasses = std::vector<double>()) override;
 
+  /**
+   * Reads a file's content from a stream
+   * @param stream stream providing the file's content
+   * @param hasTargets whether the file has targets (i.e. supervised learning)
+   * @param readinCutoff see FileSampleProvider.hpp
+   * @param readinColumns see FileSampleProvider.hpp
+   * @param readinClasses see FileSampleProvider.hpp
+   */
+  void readStream(std::istream &stream,
+                  bool hasTargets,
+                  size_t readinCutoff = -1,
+                  std::vector<size_t> readinColumns = std::vector<size_t>(),
+                  std::vector<double> readinClasses = std::vector<double>()) override;
+
  protected:
   /**
    * Delegate #sgpp::datadriven::FileSampleProvider object. Calls to the object will be wrapped by
@@ -7,6 +7,7 @@
 
 #include <sgpp/datadriven/datamining/modules/dataSource/SampleProvider.hpp>
 
+#include <istream>
 #include <string>
 #include <vector>
 
@@ -54,6 +55,24 @@ class FileSampleProvider : public SampleProvider {
                           size_t readinCutoff = -1,
                           std::vector<size_t> readinColumns = std::vector<size_t>(),
                           std::vector<double> readinClasses = std::vector<double>()) = 0;
+
+  /**
+   * Read the contents of a stream, for example a file that is decompressed on the fly. Has to
+   * throw an exception if the stream can not be parsed. The stream is consumed incrementally, so
+   * the whole content never has to be held in memory as raw text.
+   * @param stream the input stream to parse
+   * @param hasTargets whether the file has targest (i.e. supervised learning)
+   * @param readinCutoff data line number after which to stop reading. Default: MAX_UINT - 1
+   * @param readinColumns specifies a subset of columns (dimensions). Only these columns are read in
+   *        Order sensitive. Default: empty which means all columns are considered
+   * @param readinClasses specifies a subset of classes. Only data lines with one of these classes
+   *        is read in. Default: empty which means all classes are considered
+   */
+  virtual void readStream(std::istream &stream,
+                          bool hasTargets,
+                          size_t readinCutoff = -1,
+                          std::vector<size_t> readinColumns = std::vector<size_t>(),
+                          std::vector<double> readinClasses = std::vector<double>()) = 0;
 };
 } /* namespace datadriven */
 } /* namespace sgpp */
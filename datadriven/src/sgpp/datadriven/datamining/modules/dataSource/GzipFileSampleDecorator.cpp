@@ -9,8 +9,9 @@
 
 #include <sgpp/base/exception/file_exception.hpp>
 #include <sgpp/datadriven/datamining/modules/dataSource/SampleProvider.hpp>
+#include <sgpp/datadriven/tools/GzipStreamBuffer.hpp>
 
-#include <zlib.h>
+#include <istream>
 #include <string>
 #include <vector>
 
@@ -29,32 +30,12 @@ void GzipFileSampleDecorator::readFile(const std::string& fileName,
                                        size_t readinCutoff,
                                        std::vector<size_t> readinColumns,
                                        std::vector<double> readinClasses) {
-  gzFile inFileZ = gzopen(fileName.c_str(), "rb");
-
-  if (inFileZ == nullptr) {
-    throw base::file_exception("failed to open Gzip compressed file.");
-  }
-
-  size_t unzippedBytes = 0;
-  std::vector<char> unzippedData(8192);
-
-  std::string convert;
-  convert.reserve(unzippedData.size());
-
-  while (true) {
-    unzippedBytes =
-        gzread(inFileZ, unzippedData.data(), static_cast<unsigned int>(unzippedData.size() - 1));
-
-    if (unzippedBytes > 0) {
-      convert.append(unzippedData.begin(), unzippedData.begin() + unzippedBytes);
-    } else {
-      break;
-    }
-  }
-
-  gzclose(inFileZ);
-  fileSampleProvider->readString(convert, hasTargets,
-    readinCutoff, readinColumns, readinClasses);
+  // decompression runs in the background while the delegate parses the stream
+  GzipStreamBuffer buffer(fileName);
+  std::istream stream(&buffer);
+  // propagate decompression errors instead of silently ending the stream
+  stream.exceptions(std::ios::badbit);
+  fileSampleProvider->readStream(stream, hasTargets, readinCutoff, readinColumns, readinClasses);
 }
 
 void GzipFileSampleDecorator::reset() {
@@ -17,7 +17,9 @@ namespace datadriven {
  * Adds the ability to read gzip compressed files to file sample providers.
  *
  * This class wraps any valid #sgpp::datadriven::FileSampleProvider object and adds a decompression
- * step to the #readFile member function before trying to parse the contents of the file.
+ * step to the #readFile member function. The file is decompressed on a background thread by
+ * #sgpp::datadriven::GzipStreamBuffer and consumed incrementally by the wrapped object's
+ * #readStream member function, so the decompressed file is never held in memory as a whole.
  */
 class GzipFileSampleDecorator : public FileSampleDecorator {
  public:
@@ -31,7 +33,7 @@ class GzipFileSampleDecorator : public FileSampleDecorator {
   SampleProvider* clone() const override;
 
   /**
-   * Decompresses a .gz file and delegates the contents down to the
+   * Decompresses a .gz file and streams the contents down to the
    * sample provider.
    * @param fileName path to the file
    * @param hasTargets whether the file has targets (i.e. supervised learning)
@@ -0,0 +1,143 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#include <sgpp/datadriven/datamining/modules/dataSource/MmapFileSampleProvider.hpp>
+
+#include <sgpp/base/exception/data_exception.hpp>
+#include <sgpp/base/exception/file_exception.hpp>
+
+#include <algorithm>
+#include <string>
+#include <vector>
+
+namespace sgpp {
+namespace datadriven {
+
+MmapFileSampleProvider::MmapFileSampleProvider(DataShufflingFunctor* shuffling)
+    : shuffling{shuffling},
+      file{nullptr},
+      header{},
+      hasTargets{false},
+      selectedCols{},
+      rowIndices{},
+      numberInstances{0},
+      counter{0} {}
+
+MmapFileSampleProvider::MmapFileSampleProvider(const MmapFileSampleProvider& rhs)
+    : FileSampleProvider{rhs},
+      shuffling{rhs.shuffling != nullptr ? rhs.shuffling->clone() : nullptr},
+      file{rhs.file},
+      header{rhs.header},
+      hasTargets{rhs.hasTargets},
+      selectedCols{rhs.selectedCols},
+      rowIndices{rhs.rowIndices},
+      numberInstances{rhs.numberInstances},
+      counter{rhs.counter} {}
+
+MmapFileSampleProvider& MmapFileSampleProvider::operator=(const MmapFileSampleProvider& rhs) {
+  if (&rhs == this) {
+    return *this;
+  }
+  FileSampleProvider::operator=(rhs);
+  shuffling.reset(rhs.shuffling != nullptr ? rhs.shuffling->clone() : nullptr);
+  file = rhs.file;
+  header = rhs.header;
+  hasTargets = rhs.hasTargets;
+  selectedCols = rhs.selectedCols;
+  rowIndices = rhs.rowIndices;
+  numberInstances = rhs.numberInstances;
+  counter = rhs.counter;
+  return *this;
+}
+
+SampleProvider* MmapFileSampleProvider::clone() const {
+  return dynamic_cast<SampleProvider*>(new MmapFileSampleProvider{*this});
+}
+
+size_t MmapFileSampleProvider::getDim() const {
+  if (file != nullptr) {
+    return selectedCols.empty() ? header.dimension : selectedCols.size();
+  } else {
+    throw base::file_exception{"No dataset loaded."};
+  }
+}
+
+size_t MmapFileSampleProvider::getNumSamples() const {
+  if (file != nullptr) {
+    return numberInstances;
+  } else {
+    throw base::file_exception{"No dataset loaded."};
+  }
+}
+
+void MmapFileSampleProvider::readFile(const std::string& fileName, bool hasTargets,
+                                      size_t readinCutoff, std::vector<size_t> readinColumns,
+                                      std::vector<double> readinClasses) {
+  auto mappedFile = std::make_shared<MemoryMappedFile>(fileName);
+  BinaryTools::Header fileHeader = BinaryTools::parseHeader(mappedFile->getData(),
+                                                            mappedFile->getSize());
+
+  if (hasTargets && !fileHeader.hasTargets) {
+    throw base::data_exception{"Binary dataset file does not contain targets."};
+  }
+  if (!readinColumns.empty() &&
+      *std::max_element(readinColumns.begin(), readinColumns.end()) >= fileHeader.dimension) {
+    throw base::data_exception{"Invalid column selection for binary dataset file."};
+  }
+
+  numberInstances = BinaryTools::selectRows(mappedFile->getData(), fileHeader, readinCutoff,
+                                            hasTargets ? readinClasses : std::vector<double>(),
+                                            rowIndices);
+  file = mappedFile;
+  header = fileHeader;
+  this->hasTargets = hasTargets;
+  selectedCols = readinColumns;
+  counter = 0;
+}
+
+void MmapFileSampleProvider::readString(const std::string& input, bool hasTargets,
+                                        size_t readinCutoff, std::vector<size_t> readinColumns,
+                                        std::vector<double> readinClasses) {
+  throw base::data_exception{"Binary datasets can only be read from files."};
+}
+
+void MmapFileSampleProvider::readStream(std::istream& stream, bool hasTargets,
+                                        size_t readinCutoff, std::vector<size_t> readinColumns,
+                                        std::vector<double> readinClasses) {
+  throw base::data_exception{"Binary datasets can only be read from files."};
+}
+
+Dataset* MmapFileSampleProvider::getNextSamples(size_t howMany) {
+  if (file == nullptr) {
+    throw base::file_exception("No dataset loaded.");
+  }
+  const size_t size = counter + howMany <= numberInstances ? howMany : numberInstances - counter;
+
+  // the shuffling functors are stateful, so the source indices are determined sequentially
+  std::vector<size_t> sourceRows(size);
+  for (size_t i = 0; i < size; ++i) {
+    size_t idx = shuffling != nullptr ? (*shuffling)(counter + i, numberInstances) : counter + i;
+    sourceRows[i] = rowIndices.empty() ? idx : rowIndices[idx];
+  }
+
+  auto batch = std::make_unique<Dataset>(size, getDim());
+  BinaryTools::copyRows(file->getData(), header, sourceRows, selectedCols, hasTargets, *batch);
+  counter += size;
+
+  return batch.release();
+}
+
+Dataset* MmapFileSampleProvider::getAllSamples() {
+  if (file != nullptr) {
+    return this->getNextSamples(numberInstances);
+  } else {
+    throw base::file_exception{"No dataset loaded."};
+  }
+}
+
+void MmapFileSampleProvider::reset() { counter = 0; }
+
+} /* namespace datadriven */
+} /* namespace sgpp */
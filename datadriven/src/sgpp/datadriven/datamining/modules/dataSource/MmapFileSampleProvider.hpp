@@ -0,0 +1,149 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#pragma once
+
+#include <sgpp/datadriven/datamining/modules/dataSource/FileSampleProvider.hpp>
+#include <sgpp/datadriven/tools/BinaryTools.hpp>
+#include <sgpp/datadriven/tools/MemoryMappedFile.hpp>
+
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace sgpp {
+namespace datadriven {
+
+/**
+ * MmapFileSampleProvider provides samples stored in the binary dataset format of
+ * #sgpp::datadriven::BinaryTools. The file is memory mapped instead of being parsed and held in
+ * memory as a whole. Each batch is copied directly from the mapped file into the returned
+ * #sgpp::datadriven::Dataset, in the unshuffled double precision case with a single memcpy.
+ * Clones share the mapping.
+ */
+class MmapFileSampleProvider : public FileSampleProvider {
+ public:
+  /**
+   * Default constructor
+   * @param shuffling functor to permute the training data indexes. The provider takes ownership
+   * of this object.
+   */
+  explicit MmapFileSampleProvider(DataShufflingFunctor *shuffling = nullptr);
+
+  /**
+   * Copy constructor. The copy shares the mapping, but gets its own copy of the shuffling functor.
+   * @param rhs the provider to copy
+   */
+  MmapFileSampleProvider(const MmapFileSampleProvider &rhs);
+
+  MmapFileSampleProvider(MmapFileSampleProvider &&rhs) = default;
+
+  MmapFileSampleProvider &operator=(const MmapFileSampleProvider &rhs);
+
+  MmapFileSampleProvider &operator=(MmapFileSampleProvider &&rhs) = default;
+
+  ~MmapFileSampleProvider() override = default;
+
+  /**
+   * Clone Pattern to allow copying of derived classes.
+   * @return a Pointer to a new instance of #sgpp::datadriven::MmapFileSampleProvider with copied
+   * state. Caller owns the new object.
+   */
+  SampleProvider *clone() const override;
+
+  Dataset *getNextSamples(size_t howMany) override;
+
+  Dataset *getAllSamples() override;
+
+  size_t getDim() const override;
+
+  size_t getNumSamples() const override;
+
+  /**
+   * Map an existing binary dataset file into memory. Throws if the file can not be opened or is
+   * not a valid binary dataset.
+   * @param filePath Path to an existing file.
+   * @param hasTargets whether the file has targets (i.e. supervised learning)
+   * @param readinCutoff see FileSampleProvider.hpp
+   * @param readinColumns see FileSampleProvider.hpp
+   * @param readinClasses see FileSampleProvider.hpp
+   */
+  void readFile(const std::string &filePath, bool hasTargets, size_t readinCutoff = -1,
+                std::vector<size_t> readinColumns = std::vector<size_t>(),
+                std::vector<double> readinClasses = std::vector<double>()) override;
+
+  /**
+   * Not supported for binary files, always throws.
+   * @param input string containing a binary dataset
+   * @param hasTargets whether the file has targest (i.e. supervised learning)
+   * @param readinCutoff see FileSampleProvider.hpp
+   * @param readinColumns see FileSampleProvider.hpp
+   * @param readinClasses see FileSampleProvider.hpp
+   */
+  void readString(const std::string &input, bool hasTargets, size_t readinCutoff = -1,
+                  std::vector<size_t> readinColumns = std::vector<size_t>(),
+                  std::vector<double> readinClasses = std::vector<double>()) override;
+
+  /**
+   * Not supported for binary files, always throws.
+   * @param stream stream containing a binary dataset
+   * @param hasTargets whether the file has targest (i.e. supervised learning)
+   * @param readinCutoff see FileSampleProvider.hpp
+   * @param readinColumns see FileSampleProvider.hpp
+   * @param readinClasses see FileSampleProvider.hpp
+   */
+  void readStream(std::istream &stream, bool hasTargets, size_t readinCutoff = -1,
+                  std::vector<size_t> readinColumns = std::vector<size_t>(),
+                  std::vector<double> readinClasses = std::vector<double>()) override;
+
+  /**
+   * Resets the state of the sample provider (e.g. to start a new epoch)
+   */
+  void reset() override;
+
+ private:
+  /**
+   * Functor to shuffle the data (permute the indexes), owned by this provider
+   */
+  std::unique_ptr<DataShufflingFunctor> shuffling;
+
+  /**
+   * The mapped file, shared between clones
+   */
+  std::shared_ptr<MemoryMappedFile> file;
+
+  /**
+   * Meta data of the mapped file
+   */
+  BinaryTools::Header header;
+
+  /**
+   * Whether targets are read
+   */
+  bool hasTargets;
+
+  /**
+   * Columns of the file that are used as dimensions, empty for all
+   */
+  std::vector<size_t> selectedCols;
+
+  /**
+   * Indices of the admissible instances in the file, empty if these are simply the first
+   * #numberInstances ones
+   */
+  std::vector<size_t> rowIndices;
+
+  /**
+   * Number of admissible instances
+   */
+  size_t numberInstances;
+
+  /**
+   * Indicates the index where #getNextSamples will start grabbing new samples in its next call.
+   */
+  size_t counter;
+};
+} /* namespace datadriven */
+} /* namespace sgpp */
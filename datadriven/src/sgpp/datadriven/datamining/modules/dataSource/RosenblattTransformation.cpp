@@ -7,20 +7,37 @@
 #include <sgpp/datadriven/operation/hash/simple/OperationInverseRosenblattTransformation.hpp>
 #include <sgpp/datadriven/operation/hash/simple/OperationRosenblattTransformation.hpp>
 
+#include <sgpp/base/exception/application_exception.hpp>
+#include <sgpp/base/exception/data_exception.hpp>
+#include <sgpp/base/exception/file_exception.hpp>
 #include <sgpp/datadriven/DatadrivenOpFactory.hpp>
 #include <sgpp/datadriven/application/LearnerSGDE.hpp>
 
+#include <fstream>
+#include <iterator>
 #include <random>
+#include <string>
 
 namespace sgpp {
 namespace datadriven {
 
 RosenblattTransformation::RosenblattTransformation()
-    : grid(nullptr), alpha(nullptr), datasetTransformed(nullptr), datasetInvTransformed(nullptr) {}
+    : grid(nullptr),
+      alpha(nullptr),
+      tables(nullptr),
+      datasetTransformed(nullptr),
+      datasetInvTransformed(nullptr) {}
 
 void RosenblattTransformation::initialize(Dataset *dataset, DataTransformationConfig config) {
   RosenblattTransformationConfig rbConfig = config.rosenblattConfig_;
 
+  // reuse the PDF fitted in a previous run
+  if (!rbConfig.modelFile_.empty() && std::ifstream(rbConfig.modelFile_).good()) {
+    loadDensity(rbConfig.modelFile_, dataset->getDimension());
+    std::cout << "Rosenblatt transformation loaded from " << rbConfig.modelFile_ << std::endl;
+    return;
+  }
+
   // Sample #numSamples random samples from dataset
   DataMatrix samples(rbConfig.numSamples_, dataset->getDimension());
   DataVector currSample(dataset->getDimension());
@@ -44,29 +61,43 @@ void RosenblattTransformation::initialize(Dataset *dataset, DataTransformationCo
   // Get grid and alpha
   grid = learner.getSharedGrid();
   alpha = learner.getSharedSurpluses();
+  prepareTables();
+
+  if (!rbConfig.modelFile_.empty()) {
+    storeDensity(rbConfig.modelFile_);
+  }
 
   std::cout << "Rosenblatt transformation initialized" << std::endl;
 }
 
 Dataset *RosenblattTransformation::doTransformation(Dataset *dataset) {
   std::cout << "Performing Rosenblatt transformation" << std::endl;
-  OperationRosenblattTransformation *opRos(
-      sgpp::op_factory::createOperationRosenblattTransformation(*this->grid));
   datasetTransformed = new Dataset{dataset->getNumberInstances(), dataset->getDimension()};
 
-  opRos->doTransformation(this->alpha.get(), &dataset->getData(), &datasetTransformed->getData());
+  if (tables) {
+    tables->doTransformation(dataset->getData(), datasetTransformed->getData());
+  } else {
+    std::unique_ptr<OperationRosenblattTransformation> opRos(
+        sgpp::op_factory::createOperationRosenblattTransformation(*this->grid));
+    opRos->doTransformation(this->alpha.get(), &dataset->getData(),
+                            &datasetTransformed->getData());
+  }
 
   return datasetTransformed;
 }
 
 Dataset *RosenblattTransformation::doInverseTransformation(Dataset *dataset) {
   std::cout << "Performing Rosenblatt inverse transformation" << std::endl;
-  std::unique_ptr<sgpp::datadriven::OperationInverseRosenblattTransformation> opInvRos(
-      sgpp::op_factory::createOperationInverseRosenblattTransformation(*this->grid));
   datasetInvTransformed = new Dataset{dataset->getNumberInstances(), dataset->getDimension()};
 
-  opInvRos->doTransformation(this->alpha.get(), &dataset->getData(),
-                             &datasetInvTransformed->getData());
+  if (tables) {
+    tables->doInverseTransformation(dataset->getData(), datasetInvTransformed->getData());
+  } else {
+    std::unique_ptr<sgpp::datadriven::OperationInverseRosenblattTransformation> opInvRos(
+        sgpp::op_factory::createOperationInverseRosenblattTransformation(*this->grid));
+    opInvRos->doTransformation(this->alpha.get(), &dataset->getData(),
+                               &datasetInvTransformed->getData());
+  }
 
   return datasetInvTransformed;
 }
@@ -101,5 +132,55 @@ sgpp::datadriven::LearnerSGDE RosenblattTransformation::createSGDELearner(
                                         regularizationConfig, crossValidationConfig);
   return learner;
 }
+
+void RosenblattTransformation::storeDensity(const std::string &filename) const {
+  if (!grid || !alpha) {
+    throw base::application_exception(
+        "RosenblattTransformation::storeDensity: transformation is not initialized");
+  }
+  std::ofstream stream(filename, std::ios::trunc);
+  grid->serialize(stream);
+  stream << alpha->toString() << std::endl;
+  if (!stream) {
+    throw base::file_exception("RosenblattTransformation::storeDensity: failed to write file");
+  }
+}
+
+void RosenblattTransformation::loadDensity(const std::string &filename, size_t dim) {
+  std::ifstream stream(filename);
+  if (!stream) {
+    throw base::file_exception("RosenblattTransformation::loadDensity: failed to open file");
+  }
+  std::shared_ptr<base::Grid> loadedGrid(base::Grid::unserialize(stream));
+  std::string serializedAlpha((std::istreambuf_iterator<char>(stream)),
+                              std::istreambuf_iterator<char>());
+  auto loadedAlpha = std::make_shared<base::DataVector>(DataVector::fromString(serializedAlpha));
+  if (loadedAlpha->getSize() != loadedGrid->getSize()) {
+    throw base::file_exception("RosenblattTransformation::loadDensity: invalid density file");
+  }
+  // the file may stem from another dataset, the transformation would then access coordinates
+  // beyond the samples
+  if (loadedGrid->getDimension() != dim) {
+    throw base::data_exception(
+        "RosenblattTransformation::loadDensity: dimension of the density does not match the "
+        "data, delete the model file to fit the density again");
+  }
+  if (loadedGrid->getType() != base::GridType::Linear) {
+    throw base::file_exception(
+        "RosenblattTransformation::loadDensity: only densities on linear grids are supported");
+  }
+
+  grid = loadedGrid;
+  alpha = loadedAlpha;
+  prepareTables();
+}
+
+void RosenblattTransformation::prepareTables() {
+  if (grid->getType() == base::GridType::Linear) {
+    tables = std::make_shared<RosenblattTransformationTables>(*grid, *alpha);
+  } else {
+    tables.reset();
+  }
+}
 } /* namespace datadriven */
 } /* namespace sgpp */
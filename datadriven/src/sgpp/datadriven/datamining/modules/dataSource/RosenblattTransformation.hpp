@@ -6,6 +6,7 @@
 #pragma once
 
 #include <sgpp/datadriven/datamining/modules/dataSource/DataTransformation.hpp>
+#include <sgpp/datadriven/datamining/modules/dataSource/RosenblattTransformationTables.hpp>
 #include <sgpp/datadriven/application/LearnerSGDE.hpp>
 
 #include <sgpp/base/grid/Grid.hpp>
@@ -13,6 +14,9 @@
 #include <sgpp/base/datatypes/DataVector.hpp>
 #include <sgpp/base/operation/BaseOpFactory.hpp>
 
+#include <memory>
+#include <string>
+
 namespace sgpp {
 
 using sgpp::base::Grid;
@@ -32,7 +36,8 @@ class RosenblattTransformation : public DataTransformation {
 
   /**
    * Initializes a transformation by approximating probability density function (PDF),
-   * calculates grid and alpha for numSamples samples of a dataset
+   * calculates grid and alpha for numSamples samples of a dataset. If a model file is configured
+   * and exists, the PDF is loaded from it instead, otherwise the fitted PDF is stored there.
    * @param dataset pointer to the dataset to be initialized
    * @param config configuration containing parameters for initalization
    */
@@ -62,7 +67,27 @@ class RosenblattTransformation : public DataTransformation {
    */
   LearnerSGDE createSGDELearner(size_t dim, RosenblattTransformationConfig config);
 
+  /**
+   * Stores the approximated PDF (grid and alpha) in a file
+   * @param filename path of the file
+   */
+  void storeDensity(const std::string &filename) const;
+
+  /**
+   * Loads the PDF from a file written by #storeDensity and prepares the transformation
+   * @param filename path of the file
+   * @param dim dimension of the data that is transformed, a density of another dimension or on a
+   * grid that is not #sgpp::base::GridType::Linear is rejected with an exception
+   */
+  void loadDensity(const std::string &filename, size_t dim);
+
  private:
+  /**
+   * Precomputes the data for the transformation, if the grid type is supported by
+   * #sgpp::datadriven::RosenblattTransformationTables
+   */
+  void prepareTables();
+
   /**
      * the sparse grid that approximates the data.
      */
@@ -73,6 +98,11 @@ class RosenblattTransformation : public DataTransformation {
    */
   std::shared_ptr<base::DataVector> alpha;
 
+  /**
+   * Precomputed marginal CDFs and 1D grids, the operations of the op_factory are used if not set
+   */
+  std::shared_ptr<RosenblattTransformationTables> tables;
+
   /**
    * Pointer to #sgpp::datadriven::Dataset
    */
@@ -24,6 +24,13 @@ struct RosenblattTransformationConfig {
   size_t solverMaxIterations_ = 1000;
   double solverEps_ = 1e-10;
   double solverThreshold_ = 1e-10;
+
+  /**
+   * Path of a file the fitted density is stored in. If the file exists, the density is loaded from
+   * it instead of being fitted again, so it has to be deleted whenever the data changes. Empty to
+   * always fit the density.
+   */
+  std::string modelFile_ = "";
 };
 } /* namespace datadriven */
 } /* namespace sgpp */
@@ -0,0 +1,300 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#include <sgpp/datadriven/datamining/modules/dataSource/RosenblattTransformationTables.hpp>
+
+#include <sgpp/base/exception/operation_exception.hpp>
+#include <sgpp/base/grid/storage/hashmap/HashGridStorage.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+namespace sgpp {
+namespace datadriven {
+
+namespace {
+
+/**
+ * Number of samples that are processed by a thread at once
+ */
+const size_t samplesPerBlock = 64;
+
+inline double evalHat(double levelScale, double index, double x) {
+  return std::max(1. - std::fabs(x * levelScale - index), 0.);
+}
+
+}  // namespace
+
+RosenblattTransformationTables::Workspace::Workspace(size_t gridSize)
+    : weights(gridSize), integrals(gridSize) {}
+
+RosenblattTransformationTables::RosenblattTransformationTables(base::Grid& grid,
+                                                               const base::DataVector& alpha)
+    : dim(grid.getDimension()), gridSize(grid.getSize()), alpha(alpha.begin(), alpha.end()) {
+  if (grid.getType() != base::GridType::Linear) {
+    throw base::operation_exception(
+        "RosenblattTransformationTables: only linear grids without boundary are supported");
+  }
+  if (alpha.getSize() != gridSize) {
+    throw base::operation_exception("RosenblattTransformationTables: alpha has wrong size");
+  }
+
+  base::GridStorage& storage = grid.getStorage();
+  levelScales.resize(gridSize * dim);
+  indices.resize(gridSize * dim);
+  totalIntegrals.assign(gridSize, 1.0);
+  for (size_t i = 0; i < gridSize; i++) {
+    base::GridPoint& gp = storage.getPoint(i);
+    for (size_t d = 0; d < dim; d++) {
+      levelScales[i * dim + d] = std::pow(2.0, static_cast<double>(gp.getLevel(d)));
+      indices[i * dim + d] = static_cast<double>(gp.getIndex(d));
+      totalIntegrals[i] /= levelScales[i * dim + d];
+    }
+  }
+
+  // sorted 1D points of every dimension, including the boundary
+  dimensions.resize(dim);
+  for (size_t d = 0; d < dim; d++) {
+    Dimension1D& dim1d = dimensions[d];
+    std::vector<double> unique;
+    for (size_t i = 0; i < gridSize; i++) {
+      unique.push_back(indices[i * dim + d] / levelScales[i * dim + d]);
+    }
+    std::sort(unique.begin(), unique.end());
+    unique.erase(std::unique(unique.begin(), unique.end()), unique.end());
+
+    dim1d.coordinates.reserve(unique.size() + 2);
+    dim1d.coordinates.push_back(0.0);
+    dim1d.coordinates.insert(dim1d.coordinates.end(), unique.begin(), unique.end());
+    dim1d.coordinates.push_back(1.0);
+
+    // level and index of the basis function belonging to each 1D point
+    std::vector<double> pointScales(dim1d.coordinates.size(), 0.0);
+    std::vector<double> pointIndices(dim1d.coordinates.size(), 0.0);
+    dim1d.pointOfGridPoint.resize(gridSize);
+    for (size_t i = 0; i < gridSize; i++) {
+      double x = indices[i * dim + d] / levelScales[i * dim + d];
+      size_t p = static_cast<size_t>(
+          std::lower_bound(dim1d.coordinates.begin() + 1, dim1d.coordinates.end() - 1, x) -
+          dim1d.coordinates.begin());
+      dim1d.pointOfGridPoint[i] = p;
+      pointScales[p] = levelScales[i * dim + d];
+      pointIndices[p] = indices[i * dim + d];
+    }
+
+    // values of the 1D basis functions in the inner 1D points
+    dim1d.basisOffsets.push_back(0);
+    for (size_t m = 0; m < dim1d.coordinates.size(); m++) {
+      if (m > 0 && m + 1 < dim1d.coordinates.size()) {
+        for (size_t p = 1; p + 1 < dim1d.coordinates.size(); p++) {
+          double value = evalHat(pointScales[p], pointIndices[p], dim1d.coordinates[m]);
+          if (value > 0.0) {
+            dim1d.basisPoints.push_back(p);
+            dim1d.basisValues.push_back(value);
+          }
+        }
+      }
+      dim1d.basisOffsets.push_back(dim1d.basisPoints.size());
+    }
+  }
+
+  // CDFs of the 1D marginal densities
+  marginalCdfs.resize(dim);
+  std::vector<double> coefficients;
+  std::vector<double> pdf;
+  for (size_t d = 0; d < dim; d++) {
+    coefficients.assign(dimensions[d].coordinates.size(), 0.0);
+    for (size_t i = 0; i < gridSize; i++) {
+      coefficients[dimensions[d].pointOfGridPoint[i]] +=
+          this->alpha[i] * totalIntegrals[i] * levelScales[i * dim + d];
+    }
+    computeCdf(dimensions[d], coefficients, pdf, marginalCdfs[d]);
+  }
+}
+
+void RosenblattTransformationTables::doTransformation(const base::DataMatrix& points,
+                                                      base::DataMatrix& pointsCdf) const {
+  transformAll(points, pointsCdf, false);
+}
+
+void RosenblattTransformationTables::doInverseTransformation(const base::DataMatrix& pointsCdf,
+                                                             base::DataMatrix& points) const {
+  transformAll(pointsCdf, points, true);
+}
+
+void RosenblattTransformationTables::transformAll(const base::DataMatrix& input,
+                                                  base::DataMatrix& output, bool inverse) const {
+  if (input.getNcols() != dim || output.getNcols() != dim ||
+      output.getNrows() != input.getNrows()) {
+    throw base::operation_exception("RosenblattTransformationTables: dimension mismatch");
+  }
+
+  // change the start dimension when the bucket size is reached, this distributes the error in the
+  // projection uniformly to all dimensions
+  const size_t numSamples = input.getNrows();
+  const size_t bucketSize = numSamples / dim + 1;
+  const size_t numBlocks = (numSamples + samplesPerBlock - 1) / samplesPerBlock;
+
+#pragma omp parallel
+  {
+    Workspace workspace(gridSize);
+
+#pragma omp for schedule(dynamic)
+    for (size_t block = 0; block < numBlocks; block++) {
+      const size_t end = std::min(numSamples, (block + 1) * samplesPerBlock);
+      for (size_t i = block * samplesPerBlock; i < end; i++) {
+        // same as counting the reached buckets of all preceding samples
+        size_t startDim = std::min((i + 1) / bucketSize, (numSamples - 1) / bucketSize);
+        transformSample(input.getPointer() + i * dim, output.getPointer() + i * dim, startDim,
+                        inverse, workspace);
+      }
+    }
+  }
+}
+
+void RosenblattTransformationTables::transformSample(const double* input, double* output,
+                                                     size_t startDim, bool inverse,
+                                                     Workspace& workspace) const {
+  // coordinates of the sample in the unit cube, known after each step
+  const double* coords = inverse ? output : input;
+
+  const Dimension1D& start = dimensions[startDim];
+  output[startDim] = inverse ? evalInverseCdf(start.coordinates, marginalCdfs[startDim],
+                                              input[startDim])
+                             : evalCdf(start.coordinates, marginalCdfs[startDim], input[startDim]);
+  if (dim == 1) {
+    return;
+  }
+
+  std::vector<double>& weights = workspace.weights;
+  std::vector<double>& integrals = workspace.integrals;
+  std::vector<size_t>& remaining = workspace.remaining;
+  std::copy(alpha.begin(), alpha.end(), weights.begin());
+  std::copy(totalIntegrals.begin(), totalIntegrals.end(), integrals.begin());
+  remaining.resize(dim);
+  for (size_t d = 0; d < dim; d++) {
+    remaining[d] = d;
+  }
+
+  // dimensions are paired in the same order as in the conditioning and marginalization chain of
+  // OperationRosenblattTransformationLinear: opDim refers to the remaining dimensions of the
+  // conditioned density, currDim to the dimensions of the sample
+  size_t opDim = startDim;
+  size_t currDim = startDim;
+  while (remaining.size() > 1) {
+    // condition the density on the current coordinate
+    const size_t conditioned = remaining[opDim];
+    const double x = coords[currDim];
+    double theta = 0.0;
+    for (size_t i = 0; i < gridSize; i++) {
+      const size_t k = i * dim + conditioned;
+      integrals[i] *= levelScales[k];
+      weights[i] *= evalHat(levelScales[k], indices[k], x);
+      theta += weights[i] * integrals[i];
+    }
+    if (theta != 0.0) {
+      const double thetaInv = 1. / theta;
+      for (size_t i = 0; i < gridSize; i++) {
+        weights[i] *= thetaInv;
+      }
+    }
+    remaining.erase(remaining.begin() + opDim);
+
+    // move on to the next dimension
+    currDim = (currDim + 1) % dim;
+    opDim = (opDim + 1) % remaining.size();
+
+    // marginalize to the next dimension
+    const size_t next = remaining[opDim];
+    const Dimension1D& dim1d = dimensions[next];
+    workspace.coefficients.assign(dim1d.coordinates.size(), 0.0);
+    for (size_t i = 0; i < gridSize; i++) {
+      workspace.coefficients[dim1d.pointOfGridPoint[i]] +=
+          weights[i] * integrals[i] * levelScales[i * dim + next];
+    }
+    computeCdf(dim1d, workspace.coefficients, workspace.pdf, workspace.cdf);
+
+    output[currDim] = inverse ? evalInverseCdf(dim1d.coordinates, workspace.cdf, input[currDim])
+                              : evalCdf(dim1d.coordinates, workspace.cdf, input[currDim]);
+  }
+}
+
+void RosenblattTransformationTables::computeCdf(const Dimension1D& dim1d,
+                                                const std::vector<double>& coefficients,
+                                                std::vector<double>& pdf,
+                                                std::vector<double>& cdf) {
+  const size_t numPoints = dim1d.coordinates.size();
+  pdf.resize(numPoints);
+  for (size_t m = 0; m < numPoints; m++) {
+    double value = 0.0;
+    for (size_t k = dim1d.basisOffsets[m]; k < dim1d.basisOffsets[m + 1]; k++) {
+      value += coefficients[dim1d.basisPoints[k]] * dim1d.basisValues[k];
+    }
+    pdf[m] = value;
+  }
+
+  // make sure that all the pdf values are positive
+  // if not, interpolate between the closest positive neighbors
+  pdf[0] = std::max(pdf[0], 0.0);
+  for (size_t m = 1; m < numPoints; m++) {
+    if (pdf[m] < 0.0) {
+      size_t right = m;
+      while (right < numPoints && pdf[right] <= 0.0) {
+        right++;
+      }
+      pdf[m] = (pdf[m - 1] + (right < numPoints ? pdf[right] : 0.0)) / 2.0;
+    }
+  }
+
+  // composite trapezoidal rule, negative areas are skipped to keep the CDF monotone
+  cdf.resize(numPoints);
+  cdf[0] = 0.0;
+  for (size_t m = 1; m < numPoints; m++) {
+    double area =
+        (dim1d.coordinates[m] - dim1d.coordinates[m - 1]) / 2 * (pdf[m - 1] + pdf[m]);
+    cdf[m] = cdf[m - 1] + std::max(area, 0.0);
+  }
+  const double sum = cdf[numPoints - 1];
+  if (sum > 0.0) {
+    for (size_t m = 0; m < numPoints; m++) {
+      cdf[m] /= sum;
+    }
+  } else {
+    // without probability mass (e.g. the density vanishes on the conditioned slice), fall back to
+    // the uniform distribution instead of dividing by zero
+    for (size_t m = 0; m < numPoints; m++) {
+      cdf[m] = dim1d.coordinates[m];
+    }
+  }
+}
+
+double RosenblattTransformationTables::evalCdf(const std::vector<double>& coordinates,
+                                               const std::vector<double>& cdf, double x) {
+  // first 1D point that is not smaller than x, at least the second one
+  size_t m = static_cast<size_t>(
+      std::lower_bound(coordinates.begin() + 1, coordinates.end() - 1, x) - coordinates.begin());
+  const double x1 = coordinates[m - 1], x2 = coordinates[m];
+  const double y1 = cdf[m - 1], y2 = cdf[m];
+  return (y2 - y1) / (x2 - x1) * (x - x1) + y1;
+}
+
+double RosenblattTransformationTables::evalInverseCdf(const std::vector<double>& coordinates,
+                                                      const std::vector<double>& cdf, double y) {
+  // first 1D point whose CDF value is not smaller than y, at least the second one
+  size_t m = static_cast<size_t>(std::lower_bound(cdf.begin() + 1, cdf.end() - 1, y) -
+                                 cdf.begin());
+  const double x1 = coordinates[m - 1], x2 = coordinates[m];
+  const double y1 = cdf[m - 1], y2 = cdf[m];
+  // flat segments are only reached at the ends of the CDF, e.g. for y = 0 if the density vanishes
+  // close to 0
+  if (y2 <= y1) {
+    return x1;
+  }
+  return (x2 - x1) / (y2 - y1) * (y - y1) + x1;
+}
+
+}  // namespace datadriven
+}  // namespace sgpp
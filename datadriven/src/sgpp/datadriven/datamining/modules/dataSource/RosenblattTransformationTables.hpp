@@ -0,0 +1,176 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#pragma once
+
+#include <sgpp/base/datatypes/DataMatrix.hpp>
+#include <sgpp/base/datatypes/DataVector.hpp>
+#include <sgpp/base/grid/Grid.hpp>
+
+#include <vector>
+
+namespace sgpp {
+namespace datadriven {
+
+/**
+ * Precomputed data for the (inverse) Rosenblatt transformation of a density that is given on a
+ * sparse grid with piecewise linear basis functions (#sgpp::base::GridType::Linear).
+ *
+ * The transformation computes the same result as
+ * #sgpp::datadriven::OperationRosenblattTransformationLinear and
+ * #sgpp::datadriven::OperationInverseRosenblattTransformationLinear, including the order in which
+ * the dimensions are conditioned and marginalized, but it does not create any intermediate grids:
+ * - the sorted 1D grid points of every dimension and the evaluation of the 1D basis functions in
+ *   these points are computed once,
+ * - the CDFs of the 1D marginal densities (one for each start dimension) are tabulated once,
+ * - the conditional 1D densities of a sample are assembled directly from the coefficients of the
+ *   full grid, which are updated in place while conditioning dimension after dimension.
+ * The CDFs are piecewise linear, so the inverse transformation inverts the tabulated CDFs exactly.
+ *
+ * All methods are const, the samples are processed in parallel blocks with OpenMP.
+ */
+class RosenblattTransformationTables {
+ public:
+  /**
+   * Constructor, precomputes all data that does not depend on the samples
+   * @param grid sparse grid with piecewise linear basis functions without boundary
+   * @param alpha coefficients of the density on the grid
+   */
+  RosenblattTransformationTables(base::Grid& grid, const base::DataVector& alpha);
+
+  /**
+   * Rosenblatt transformation with mixed start dimension. The start dimension changes after every
+   * numSamples / dim + 1 samples, exactly as in OperationRosenblattTransformationLinear.
+   * @param points samples in the unit cube (rows: samples, columns: dimensions)
+   * @param[out] pointsCdf transformed samples, same size as points
+   */
+  void doTransformation(const base::DataMatrix& points, base::DataMatrix& pointsCdf) const;
+
+  /**
+   * Inverse Rosenblatt transformation with mixed start dimension
+   * @param pointsCdf samples in the unit cube (rows: samples, columns: dimensions)
+   * @param[out] points backwards transformed samples, same size as pointsCdf
+   */
+  void doInverseTransformation(const base::DataMatrix& pointsCdf,
+                               base::DataMatrix& points) const;
+
+ private:
+  /**
+   * Sorted grid points of one dimension including the boundary points 0 and 1
+   */
+  struct Dimension1D {
+    /// coordinates of the 1D points, sorted
+    std::vector<double> coordinates;
+    /// position of the 1D point of each grid point in #coordinates
+    std::vector<size_t> pointOfGridPoint;
+    /// nonzero values of the 1D basis functions in the 1D points in compressed row format
+    std::vector<size_t> basisOffsets;
+    /// position of the basis function in #coordinates
+    std::vector<size_t> basisPoints;
+    /// value of the basis function
+    std::vector<double> basisValues;
+  };
+
+  /**
+   * Thread local buffers for the transformation of a single sample
+   */
+  struct Workspace {
+    explicit Workspace(size_t gridSize);
+    /// coefficients of the conditioned density
+    std::vector<double> weights;
+    /// product of the integrals of the basis functions over the remaining dimensions
+    std::vector<double> integrals;
+    /// coefficients of the 1D density
+    std::vector<double> coefficients;
+    /// values of the 1D density in the 1D points
+    std::vector<double> pdf;
+    /// values of the 1D CDF in the 1D points
+    std::vector<double> cdf;
+    /// original dimensions that have not been conditioned yet
+    std::vector<size_t> remaining;
+  };
+
+  /**
+   * Transforms a single sample (forward or backward) with the given start dimension
+   * @param input the sample
+   * @param[out] output the transformed sample
+   * @param startDim start dimension
+   * @param inverse whether the inverse transformation is performed
+   * @param workspace buffers of the calling thread
+   */
+  void transformSample(const double* input, double* output, size_t startDim, bool inverse,
+                       Workspace& workspace) const;
+
+  /**
+   * Transforms all samples, dispatches blocks of samples to the threads
+   */
+  void transformAll(const base::DataMatrix& input, base::DataMatrix& output, bool inverse) const;
+
+  /**
+   * Computes the tabulated CDF of a 1D density given by its coefficients in the 1D points.
+   * Negative density values are replaced in the same way as in the operations.
+   * @param dim1d the 1D points
+   * @param coefficients coefficients of the 1D basis functions (indexed by 1D point)
+   * @param[out] pdf buffer for the density values
+   * @param[out] cdf the CDF values in the 1D points
+   */
+  static void computeCdf(const Dimension1D& dim1d, const std::vector<double>& coefficients,
+                         std::vector<double>& pdf, std::vector<double>& cdf);
+
+  /**
+   * Evaluates a tabulated CDF
+   */
+  static double evalCdf(const std::vector<double>& coordinates, const std::vector<double>& cdf,
+                        double x);
+
+  /**
+   * Evaluates the inverse of a tabulated CDF
+   */
+  static double evalInverseCdf(const std::vector<double>& coordinates,
+                               const std::vector<double>& cdf, double y);
+
+  /**
+   * Dimensionality
+   */
+  size_t dim;
+
+  /**
+   * Number of grid points
+   */
+  size_t gridSize;
+
+  /**
+   * Coefficients of the density
+   */
+  std::vector<double> alpha;
+
+  /**
+   * 2^level of every grid point and dimension (row-major, gridSize x dim)
+   */
+  std::vector<double> levelScales;
+
+  /**
+   * Index of every grid point and dimension (row-major, gridSize x dim)
+   */
+  std::vector<double> indices;
+
+  /**
+   * Product of the integrals of the basis function of each grid point over all dimensions
+   */
+  std::vector<double> totalIntegrals;
+
+  /**
+   * 1D points of every dimension
+   */
+  std::vector<Dimension1D> dimensions;
+
+  /**
+   * Tabulated CDF of the marginal density of every dimension
+   */
+  std::vector<std::vector<double>> marginalCdfs;
+};
+
+}  // namespace datadriven
+}  // namespace sgpp
@@ -142,6 +142,63 @@ void OperationMultiEvalStreaming::multTranspose(sgpp::base::DataVector& source,
   this->duration = this->myTimer_.stop();
 }
 
+void OperationMultiEvalStreaming::multMatrix(sgpp::base::DataMatrix& alphas,
+                                             sgpp::base::DataMatrix& result) {
+  this->myTimer_.start();
+
+  const size_t numVectors = alphas.getNcols();
+  const size_t paddedSize = this->preparedDataset.getNcols();
+
+  // results for the padded dataset, one row per data point
+  sgpp::base::DataMatrix paddedResult(paddedSize, numVectors, 0.0);
+
+#pragma omp parallel
+  {
+    size_t start;
+    size_t end;
+    getOpenMPPartitionSegment(0, paddedSize, &start, &end, getChunkDataPoints());
+
+    this->multMatrixImpl(level_, index_, &this->preparedDataset, alphas, paddedResult, 0,
+                         alphas.getNrows(), start, end);
+  }
+
+  paddedResult.resizeRows(this->dataset.getNrows());
+  result = paddedResult;
+  this->duration = this->myTimer_.stop();
+}
+
+void OperationMultiEvalStreaming::multTransposeMatrix(sgpp::base::DataMatrix& sources,
+                                                      sgpp::base::DataMatrix& result) {
+  this->myTimer_.start();
+
+  const size_t numVectors = sources.getNcols();
+  const size_t paddedSize = this->preparedDataset.getNcols();
+
+  // the padding area of the sources is zero
+  sgpp::base::DataMatrix paddedSources(sources);
+  paddedSources.resizeRows(paddedSize);
+
+  for (size_t i = sources.getNrows() * numVectors; i < paddedSources.getSize(); i++) {
+    paddedSources[i] = 0.0;
+  }
+
+  result.resizeRowsCols(this->storage->getSize(), numVectors);
+  result.setAll(0.0);
+
+#pragma omp parallel
+  {
+    size_t start;
+    size_t end;
+
+    getOpenMPPartitionSegment(0, this->storage->getSize(), &start, &end, 1);
+
+    this->multTransposeMatrixImpl(this->level_, this->index_, &this->preparedDataset,
+                                  paddedSources, result, start, end, 0, paddedSize);
+  }
+
+  this->duration = this->myTimer_.stop();
+}
+
 void OperationMultiEvalStreaming::recalculateLevelAndIndex() {
   if (this->level_ != nullptr) delete this->level_;
 
@@ -49,6 +49,11 @@ class OperationMultiEvalStreaming : public base::OperationMultipleEval {
 
   void multTranspose(sgpp::base::DataVector& source, sgpp::base::DataVector& result) override;
 
+  void multMatrix(sgpp::base::DataMatrix& alphas, sgpp::base::DataMatrix& result) override;
+
+  void multTransposeMatrix(sgpp::base::DataMatrix& sources,
+                           sgpp::base::DataMatrix& result) override;
+
   void prepare() override;
 
   double getDuration() override;
@@ -74,6 +79,25 @@ class OperationMultiEvalStreaming : public base::OperationMultipleEval {
                          const size_t end_index_grid, const size_t start_index_data,
                          const size_t end_index_data);
 
+  /**
+   * Kernel of multMatrix, evaluates every basis function once per data point for all vectors
+   */
+  void multMatrixImpl(sgpp::base::DataMatrix* level, sgpp::base::DataMatrix* index,
+                      sgpp::base::DataMatrix* dataset, sgpp::base::DataMatrix& alphas,
+                      sgpp::base::DataMatrix& result, const size_t start_index_grid,
+                      const size_t end_index_grid, const size_t start_index_data,
+                      const size_t end_index_data);
+
+  /**
+   * Kernel of multTransposeMatrix, evaluates every basis function once per data point for all
+   * vectors
+   */
+  void multTransposeMatrixImpl(sgpp::base::DataMatrix* level, sgpp::base::DataMatrix* index,
+                               sgpp::base::DataMatrix* dataset, sgpp::base::DataMatrix& sources,
+                               sgpp::base::DataMatrix& result, const size_t start_index_grid,
+                               const size_t end_index_grid, const size_t start_index_data,
+                               const size_t end_index_data);
+
   void recalculateLevelAndIndex();
 };
 
@@ -0,0 +1,140 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#include <sgpp/datadriven/operation/hash/OperationMultiEvalStreaming/OperationMultiEvalStreaming.hpp>
+#include <sgpp/globaldef.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+namespace sgpp {
+namespace datadriven {
+
+namespace {
+
+/**
+ * Evaluates a basis function at a chunk of data points (transposed dataset), the loop over the
+ * data points is vectorized by the compiler
+ *
+ * @return false if the basis function vanishes at all data points of the chunk
+ */
+inline bool evalBasisChunk(const double* ptrLevel, const double* ptrIndex, const double* ptrData,
+                           size_t dims, size_t dataSize, size_t grid_index, size_t data_start,
+                           size_t chunk_size, double* support) {
+  for (size_t i = 0; i < chunk_size; i++) {
+    support[i] = 1.0;
+  }
+
+  for (size_t d = 0; d < dims; d++) {
+    const double level = ptrLevel[(grid_index * dims) + d];
+    const double index = ptrIndex[(grid_index * dims) + d];
+    const double* data = ptrData + (d * dataSize) + data_start;
+    bool nonZero = false;
+
+    for (size_t i = 0; i < chunk_size; i++) {
+      support[i] *= std::max<double>(1.0 - std::fabs(level * data[i] - index), 0.0);
+      nonZero |= (support[i] != 0.0);
+    }
+
+    if (!nonZero) {
+      return false;
+    }
+  }
+
+  return true;
+}
+
+}  // namespace
+
+void OperationMultiEvalStreaming::multMatrixImpl(
+    sgpp::base::DataMatrix* level, sgpp::base::DataMatrix* index, sgpp::base::DataMatrix* dataset,
+    sgpp::base::DataMatrix& alphas, sgpp::base::DataMatrix& result, const size_t start_index_grid,
+    const size_t end_index_grid, const size_t start_index_data, const size_t end_index_data) {
+  const double* ptrLevel = level->getPointer();
+  const double* ptrIndex = index->getPointer();
+  const double* ptrAlphas = alphas.getPointer();
+  const double* ptrData = dataset->getPointer();
+  double* ptrResult = result.getPointer();
+  const size_t dataSize = dataset->getNcols();
+  const size_t dims = dataset->getNrows();
+  const size_t numVectors = alphas.getNcols();
+
+  std::vector<double> support(getChunkDataPoints());
+
+  // the results of a chunk of data points stay in the cache while the grid is streamed
+  for (size_t c = start_index_data; c < end_index_data;
+       c += std::min<size_t>(getChunkDataPoints(), (end_index_data - c))) {
+    const size_t chunk_size = std::min<size_t>(getChunkDataPoints(), (end_index_data - c));
+
+    for (size_t j = start_index_grid; j < end_index_grid; j++) {
+      if (!evalBasisChunk(ptrLevel, ptrIndex, ptrData, dims, dataSize, j, c, chunk_size,
+                          support.data())) {
+        continue;
+      }
+
+      const double* alphaRow = ptrAlphas + j * numVectors;
+
+      for (size_t i = 0; i < chunk_size; i++) {
+        if (support[i] != 0.0) {
+          double* resultRow = ptrResult + (c + i) * numVectors;
+
+          for (size_t k = 0; k < numVectors; k++) {
+            resultRow[k] += support[i] * alphaRow[k];
+          }
+        }
+      }
+    }
+  }
+}
+
+void OperationMultiEvalStreaming::multTransposeMatrixImpl(
+    sgpp::base::DataMatrix* level, sgpp::base::DataMatrix* index, sgpp::base::DataMatrix* dataset,
+    sgpp::base::DataMatrix& sources, sgpp::base::DataMatrix& result, const size_t start_index_grid,
+    const size_t end_index_grid, const size_t start_index_data, const size_t end_index_data) {
+  const double* ptrLevel = level->getPointer();
+  const double* ptrIndex = index->getPointer();
+  const double* ptrSources = sources.getPointer();
+  const double* ptrData = dataset->getPointer();
+  double* ptrResult = result.getPointer();
+  const size_t dataSize = dataset->getNcols();
+  const size_t dims = dataset->getNrows();
+  const size_t numVectors = sources.getNcols();
+
+  std::vector<double> support(getChunkDataPoints());
+
+  // the results of a block of grid points stay in the cache while the data is streamed
+  for (size_t m = start_index_grid; m < end_index_grid;
+       m += std::min<size_t>(getChunkGridPoints(), (end_index_grid - m))) {
+    const size_t grid_end = std::min<size_t>(getChunkGridPoints() + m, end_index_grid);
+
+    for (size_t c = start_index_data; c < end_index_data;
+         c += std::min<size_t>(getChunkDataPoints(), (end_index_data - c))) {
+      const size_t chunk_size = std::min<size_t>(getChunkDataPoints(), (end_index_data - c));
+
+      for (size_t j = m; j < grid_end; j++) {
+        if (!evalBasisChunk(ptrLevel, ptrIndex, ptrData, dims, dataSize, j, c, chunk_size,
+                            support.data())) {
+          continue;
+        }
+
+        double* resultRow = ptrResult + j * numVectors;
+
+        for (size_t i = 0; i < chunk_size; i++) {
+          if (support[i] != 0.0) {
+            const double* sourceRow = ptrSources + (c + i) * numVectors;
+
+            for (size_t k = 0; k < numVectors; k++) {
+              resultRow[k] += support[i] * sourceRow[k];
+            }
+          }
+        }
+      }
+    }
+  }
+}
+
+}  // namespace datadriven
+}  // namespace sgpp
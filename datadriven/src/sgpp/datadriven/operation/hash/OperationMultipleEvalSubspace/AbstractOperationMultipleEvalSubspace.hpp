@@ -13,6 +13,9 @@
 
 #include <sgpp/globaldef.hpp>
 
+#include <algorithm>
+#include <vector>
+
 namespace sgpp {
 namespace datadriven {
 
@@ -93,6 +96,103 @@ class AbstractOperationMultipleEvalSubspace : public base::OperationMultipleEval
     this->duration = this->timer.stop();
   }
 
+  /**
+   * The subspace kernels keep a single flattened coefficient vector, therefore the vectors are
+   * processed one after the other, but in a single parallel region: every thread evaluates the
+   * same partition of the dataset for all vectors, so the partition stays in its cache and the
+   * subspace structures are prepared only once.
+   */
+  void multMatrix(sgpp::base::DataMatrix& alphas, sgpp::base::DataMatrix& result) override {
+    if (!this->isPrepared) {
+      this->prepare();
+    }
+
+    const size_t numVectors = alphas.getNcols();
+    const size_t start_index_data = 0;
+    const size_t end_index_data = this->getPaddedDatasetSize();
+
+    std::vector<base::DataVector> sources(numVectors, base::DataVector(alphas.getNrows()));
+    std::vector<base::DataVector> results(numVectors, base::DataVector(end_index_data, 0.0));
+
+    for (size_t k = 0; k < numVectors; k++) {
+      alphas.getColumn(k, sources[k]);
+    }
+
+    this->timer.start();
+
+#pragma omp parallel
+    {
+      size_t start;
+      size_t end;
+      PartitioningTool::getOpenMPPartitionSegment(start_index_data, end_index_data, &start, &end,
+                                                  this->getAlignment());
+
+      for (size_t k = 0; k < numVectors; k++) {
+        this->multImpl(sources[k], results[k], start, end);
+        // the coefficients of the next vector replace the current ones
+#pragma omp barrier
+      }
+    }
+
+    result.resizeRowsCols(this->dataset.getNrows(), numVectors);
+
+    for (size_t k = 0; k < numVectors; k++) {
+      results[k].resize(this->dataset.getNrows());
+      result.setColumn(k, results[k]);
+    }
+
+    this->duration = this->timer.stop();
+  }
+
+  /**
+   * See multMatrix(), the vectors are processed in a single parallel region.
+   */
+  void multTransposeMatrix(sgpp::base::DataMatrix& sources,
+                           sgpp::base::DataMatrix& result) override {
+    if (!this->isPrepared) {
+      this->prepare();
+    }
+
+    const size_t numVectors = sources.getNcols();
+    const size_t start_index_data = 0;
+    const size_t end_index_data = this->getPaddedDatasetSize();
+
+    // the source vectors are padded to the padded size of the dataset
+    std::vector<base::DataVector> paddedSources(numVectors,
+                                                base::DataVector(end_index_data, 0.0));
+    std::vector<base::DataVector> results(numVectors, base::DataVector(this->grid.getSize()));
+    base::DataVector source(sources.getNrows());
+
+    for (size_t k = 0; k < numVectors; k++) {
+      sources.getColumn(k, source);
+      std::copy(source.begin(), source.end(), paddedSources[k].begin());
+      results[k].setAll(0.0);
+    }
+
+    this->timer.start();
+
+#pragma omp parallel
+    {
+      size_t start;
+      size_t end;
+      PartitioningTool::getOpenMPPartitionSegment(start_index_data, end_index_data, &start, &end,
+                                                  this->getAlignment());
+
+      for (size_t k = 0; k < numVectors; k++) {
+        this->multTransposeImpl(paddedSources[k], results[k], start, end);
+#pragma omp barrier
+      }
+    }
+
+    result.resizeRowsCols(this->grid.getSize(), numVectors);
+
+    for (size_t k = 0; k < numVectors; k++) {
+      result.setColumn(k, results[k]);
+    }
+
+    this->duration = this->timer.stop();
+  }
+
   virtual size_t getPaddedDatasetSize() { return this->dataset.getNrows(); }
 
   virtual size_t getAlignment() = 0;
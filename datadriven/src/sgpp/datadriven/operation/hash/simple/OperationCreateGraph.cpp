@@ -0,0 +1,132 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#include <sgpp/datadriven/operation/hash/simple/OperationCreateGraph.hpp>
+
+#include <sgpp/base/exception/operation_exception.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <utility>
+#include <vector>
+
+namespace sgpp {
+namespace datadriven {
+
+namespace {
+
+size_t findRoot(std::vector<std::atomic<size_t>>& parents, size_t node) {
+  size_t parent = parents[node].load();
+  while (parent != node) {
+    // path halving, concurrent updates only shorten the path
+    size_t grandParent = parents[parent].load();
+    parents[node].compare_exchange_weak(parent, grandParent);
+    node = grandParent;
+    parent = parents[node].load();
+  }
+  return node;
+}
+
+void unite(std::vector<std::atomic<size_t>>& parents, size_t first, size_t second) {
+  while (true) {
+    first = findRoot(parents, first);
+    second = findRoot(parents, second);
+    if (first == second) {
+      return;
+    }
+    // the smaller index becomes the root, so every root is the first datapoint of its component
+    if (first < second) {
+      std::swap(first, second);
+    }
+    size_t expected = first;
+    if (parents[first].compare_exchange_strong(expected, second)) {
+      return;
+    }
+  }
+}
+
+}  // namespace
+
+OperationCreateGraph::OperationCreateGraph(base::DataMatrix& dataset, size_t k)
+    : k(k), index(dataset) {
+  if (k == 0) {
+    throw base::operation_exception("OperationCreateGraph: k has to be positive");
+  }
+}
+
+OperationCreateGraph::~OperationCreateGraph() {}
+
+NearestNeighborIndex& OperationCreateGraph::getIndex() { return index; }
+
+void OperationCreateGraph::create_graph(std::vector<int>& resultVector, int startid,
+                                        int chunksize) {
+  size_t first = static_cast<size_t>(startid);
+  size_t count = chunksize > 0 ? static_cast<size_t>(chunksize) : index.getNumPoints() - first;
+  if (first + count > index.getNumPoints()) {
+    throw base::operation_exception("OperationCreateGraph: chunk exceeds the dataset");
+  }
+  if (resultVector.size() < count * k) {
+    resultVector.resize(count * k);
+  }
+
+  std::vector<size_t> neighbors;
+  base::DataMatrix distances;
+  index.queryDataset(k, first, count, neighbors, distances);
+#pragma omp parallel for
+  for (size_t i = 0; i < count * k; i++) {
+    resultVector[i] = neighbors[i] == NearestNeighborIndex::NO_NEIGHBOR
+                          ? -2
+                          : static_cast<int>(neighbors[i]);
+  }
+}
+
+std::vector<size_t> OperationCreateGraph::find_clusters(std::vector<int>& graph, size_t k) {
+  const size_t numNodes = graph.size() / k;
+
+  // a node takes part in the clustering if it was not removed and has at least one edge left,
+  // like in the OpenCL version a node with only pruned edges (-2) is noise, but edges pointing
+  // to it are ignored instead of turning their source into noise
+  std::vector<char> active(numNodes, 0);
+#pragma omp parallel for
+  for (size_t node = 0; node < numNodes; node++) {
+    for (size_t i = node * k; i < (node + 1) * k; i++) {
+      if (graph[i] >= 0) {
+        active[node] = 1;
+        break;
+      }
+    }
+  }
+
+  std::vector<std::atomic<size_t>> parents(numNodes);
+  for (size_t node = 0; node < numNodes; node++) {
+    parents[node].store(node);
+  }
+
+#pragma omp parallel for schedule(dynamic, 256)
+  for (size_t node = 0; node < numNodes; node++) {
+    if (!active[node]) {
+      continue;
+    }
+    for (size_t i = node * k; i < (node + 1) * k; i++) {
+      if (graph[i] >= 0 && active[static_cast<size_t>(graph[i])]) {
+        unite(parents, node, static_cast<size_t>(graph[i]));
+      }
+    }
+  }
+
+  // number the components in the order of their first node
+  std::vector<size_t> clusters(numNodes, 0);
+  size_t clusterCount = 0;
+  for (size_t node = 0; node < numNodes; node++) {
+    if (active[node]) {
+      size_t root = findRoot(parents, node);
+      clusters[node] = (root == node) ? ++clusterCount : clusters[root];
+    }
+  }
+  return clusters;
+}
+
+}  // namespace datadriven
+}  // namespace sgpp
@@ -0,0 +1,84 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#pragma once
+
+#include <sgpp/base/datatypes/DataMatrix.hpp>
+#include <sgpp/datadriven/tools/NearestNeighborIndex.hpp>
+
+#include <sgpp/globaldef.hpp>
+
+#include <vector>
+
+namespace sgpp {
+namespace datadriven {
+
+/**
+ * Creates the k nearest neighbor graph of a dataset on the CPU. This is the multithreaded
+ * counterpart of DensityOCLMultiPlatform::OperationCreateGraphOCL and uses the same graph layout:
+ * the graph is a vector with k entries per datapoint containing the indices of its neighbors.
+ * Instead of comparing every pair of datapoints, the neighbors are searched in a
+ * NearestNeighborIndex.
+ *
+ * The neighbors of a datapoint are sorted by their distance (ties are broken by the index). If the
+ * dataset contains less than k + 1 datapoints, the missing entries are marked as removed (-2).
+ */
+class OperationCreateGraph {
+ public:
+  /**
+   * Constructor, builds the nearest neighbor index
+   *
+   * @param dataset the datapoints (one per row)
+   * @param k number of neighbors of each datapoint
+   */
+  OperationCreateGraph(base::DataMatrix& dataset, size_t k);
+
+  /**
+   * Destructor
+   */
+  virtual ~OperationCreateGraph();
+
+  /**
+   * Creates the k nearest neighbor graph for a chunk of datapoints
+   *
+   * @param[out] resultVector neighbors of the datapoints startid, ..., startid + chunksize - 1
+   * (chunksize * k entries), resized if necessary
+   * @param startid first datapoint of the chunk
+   * @param chunksize number of datapoints in the chunk, 0 for all remaining datapoints
+   */
+  virtual void create_graph(std::vector<int>& resultVector, int startid = 0, int chunksize = 0);
+
+  /**
+   * Assigns a cluster index to each datapoint using the connected components of the (pruned)
+   * graph, the components are computed with a parallel union-find. Removed datapoints (-1) and
+   * datapoints without any remaining edge get the cluster index 0, the other clusters are numbered
+   * from 1 in the order of their first datapoint.
+   *
+   * This matches DensityOCLMultiPlatform::OperationCreateGraphOCL::find_clusters, which also
+   * assigns 0 to a datapoint whose edges were all pruned (-2), except for edges pointing to such
+   * a datapoint: here they are ignored, whereas the recursive traversal of the OpenCL version
+   * propagates the cluster index 0 to the datapoints reaching it (depending on the traversal
+   * order). Therefore, the CPU version keeps these datapoints in their cluster.
+   *
+   * @param graph the graph, k entries per datapoint
+   * @param k number of neighbors of each datapoint
+   * @return cluster index of every datapoint
+   */
+  static std::vector<size_t> find_clusters(std::vector<int>& graph, size_t k);
+
+  /**
+   * @return the nearest neighbor index, e.g. to trade recall for speed
+   */
+  NearestNeighborIndex& getIndex();
+
+ protected:
+  /// number of neighbors
+  size_t k;
+  /// index over the datapoints
+  NearestNeighborIndex index;
+};
+
+}  // namespace datadriven
+}  // namespace sgpp
@@ -0,0 +1,76 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#include <sgpp/datadriven/operation/hash/simple/OperationDensityClustering.hpp>
+
+#include <sgpp/base/operation/BaseOpFactory.hpp>
+#include <sgpp/datadriven/algorithm/DensitySystemMatrix.hpp>
+#include <sgpp/datadriven/operation/hash/simple/OperationCreateGraph.hpp>
+#include <sgpp/datadriven/operation/hash/simple/OperationPruneGraph.hpp>
+#include <sgpp/solver/sle/ConjugateGradients.hpp>
+
+#include <chrono>
+#include <iostream>
+#include <vector>
+
+namespace sgpp {
+namespace datadriven {
+
+OperationDensityClustering::OperationDensityClustering(bool verbose) : verbose(verbose) {}
+
+OperationDensityClustering::~OperationDensityClustering() {}
+
+std::vector<size_t> OperationDensityClustering::calculate_clusters(base::Grid& grid,
+                                                                   base::DataMatrix& dataset,
+                                                                   double lambda, size_t k,
+                                                                   double threshold) {
+  std::chrono::time_point<std::chrono::system_clock> start, end;
+  start = std::chrono::system_clock::now();
+  size_t gridsize = grid.getSize();
+  base::DataVector alpha(gridsize);
+  base::DataVector b(gridsize);
+
+  DensitySystemMatrix systemMatrix(grid, dataset, op_factory::createOperationIdentity(grid),
+                                   lambda);
+  if (verbose) {
+    std::cout << "Creating rhs..." << std::endl;
+  }
+  systemMatrix.generateb(b);
+
+  if (verbose) {
+    std::cout << "Creating alpha..." << std::endl;
+  }
+  solver::ConjugateGradients solver(1000, 0.001);
+  solver.solve(systemMatrix, alpha, b, false, verbose);
+  double max = alpha.max();
+  double min = alpha.min();
+  for (size_t i = 0; i < gridsize; i++) {
+    alpha[i] = alpha[i] * 1.0 / (max - min);
+  }
+
+  if (verbose) {
+    std::cout << "Starting graph creation..." << std::endl;
+  }
+  OperationCreateGraph graphOperation(dataset, k);
+  std::vector<int> graph(dataset.getNrows() * k);
+  graphOperation.create_graph(graph);
+
+  if (verbose) {
+    std::cout << "Starting graph pruning..." << std::endl;
+  }
+  OperationPruneGraph pruneOperation(grid, alpha, dataset, threshold, k);
+  pruneOperation.prune_graph(graph);
+
+  std::vector<size_t> clusters = OperationCreateGraph::find_clusters(graph, k);
+  end = std::chrono::system_clock::now();
+  if (verbose) {
+    std::chrono::duration<double> elapsed_seconds = end - start;
+    std::cout << "Time required for clustering: " << elapsed_seconds.count() << std::endl;
+  }
+  return clusters;
+}
+
+}  // namespace datadriven
+}  // namespace sgpp
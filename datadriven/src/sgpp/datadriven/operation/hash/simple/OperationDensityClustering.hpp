@@ -0,0 +1,60 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#pragma once
+
+#include <sgpp/base/datatypes/DataMatrix.hpp>
+#include <sgpp/base/grid/Grid.hpp>
+
+#include <sgpp/globaldef.hpp>
+
+#include <vector>
+
+namespace sgpp {
+namespace datadriven {
+
+/**
+ * Density based clustering on the CPU, the counterpart of ClusteringOCL::OperationClusteringOCL.
+ * The chain consists of
+ * - the sparse grid density estimation (DensitySystemMatrix with identity regularization, solved
+ *   with conjugate gradients),
+ * - the k nearest neighbor graph (OperationCreateGraph),
+ * - the removal of nodes and edges in areas of low density (OperationPruneGraph),
+ * - the connected components of the pruned graph (OperationCreateGraph::find_clusters).
+ */
+class OperationDensityClustering {
+ public:
+  /**
+   * Constructor
+   *
+   * @param verbose print the progress
+   */
+  explicit OperationDensityClustering(bool verbose = false);
+
+  /**
+   * Destructor
+   */
+  virtual ~OperationDensityClustering();
+
+  /**
+   * Computes the clusters of the dataset
+   *
+   * @param grid the sparse grid of the density
+   * @param dataset the datapoints (one per row)
+   * @param lambda regularization parameter of the density estimation
+   * @param k number of neighbors in the graph
+   * @param threshold density threshold for the pruning of the graph, relative to the range of the
+   * density coefficients
+   * @return cluster index of every datapoint (0 for noise)
+   */
+  virtual std::vector<size_t> calculate_clusters(base::Grid& grid, base::DataMatrix& dataset,
+                                                 double lambda, size_t k, double threshold);
+
+ protected:
+  bool verbose;
+};
+
+}  // namespace datadriven
+}  // namespace sgpp
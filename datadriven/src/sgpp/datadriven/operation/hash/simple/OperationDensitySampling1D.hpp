@@ -7,6 +7,7 @@
 #define OPERATIONDENSITYSAMPLING1D_HPP
 
 #include <sgpp/base/grid/Grid.hpp>
+#include <sgpp/base/tools/RandomNumberGenerator.hpp>
 
 #include <sgpp/globaldef.hpp>
 #include <cstring>
@@ -33,6 +34,18 @@ class OperationDensitySampling1D {
    */
   virtual void doSampling1D(base::DataVector* alpha, size_t num_samples, base::DataVector*& samples,
                             unsigned int* seedp) = 0;
+
+  /**
+   * Sampling on 1D grid, the samples only depend on the state of the stream
+   * (and not on the number of threads)
+   *
+   * @param alpha Coefficient vector for current grid (1D grid)
+   * @param num_samples # of samples to draw
+   * @param samples Output DataVector
+   * @param stream random number stream
+   */
+  virtual void doSampling1D(base::DataVector* alpha, size_t num_samples, base::DataVector*& samples,
+                            base::RandomNumberStream& stream) = 0;
 };
 }  // namespace datadriven
 }  // namespace sgpp
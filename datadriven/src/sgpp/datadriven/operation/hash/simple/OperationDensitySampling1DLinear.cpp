@@ -31,6 +31,14 @@ OperationDensitySampling1DLinear::~OperationDensitySampling1DLinear() {}
 void OperationDensitySampling1DLinear::doSampling1D(base::DataVector* alpha, size_t num_samples,
                                                     base::DataVector*& samples,
                                                     unsigned int* seedp) {
+  base::RandomNumberStream stream(*seedp, 0);
+  doSampling1D(alpha, num_samples, samples, stream);
+  *seedp = static_cast<unsigned int>(stream());
+}
+
+void OperationDensitySampling1DLinear::doSampling1D(base::DataVector* alpha, size_t num_samples,
+                                                    base::DataVector*& samples,
+                                                    base::RandomNumberStream& stream) {
   /***************** STEP 1. Compute CDF  ********************/
 
   // compute PDF, sort by coordinates
@@ -89,25 +97,24 @@ void OperationDensitySampling1DLinear::doSampling1D(base::DataVector* alpha, siz
   /***************** STEP 2. Sampling  ********************/
   samples = new base::DataVector(num_samples);
 
-  double y, x1, x2, y1, y2;
+  // every sample has its own stream, so the samples do not depend on the number of threads
+  const uint64_t key = stream();
 
+#pragma omp parallel for schedule(static) if (num_samples > 1000)
   for (size_t i = 0; i < num_samples; i++) {
-// drand48_r() is thread_safe
-#ifdef _WIN32
-    y = static_cast<double>(rand()) / RAND_MAX;
-#else
-    y = static_cast<double>(rand_r(seedp)) / RAND_MAX;
-#endif
+    base::RandomNumberStream sampleStream(key, i);
+    double y = sampleStream.getUniformRN();
 
     // find cdf interval
-    for (it1 = coord_cdf.begin(); it1 != coord_cdf.end(); ++it1)
-      if ((*it1).second >= y) break;
-
-    x2 = (*it1).first;
-    y2 = (*it1).second;
-    --it1;
-    x1 = (*it1).first;
-    y1 = (*it1).second;
+    std::multimap<double, double>::const_iterator it = coord_cdf.begin();
+
+    while ((*it).second < y) ++it;
+
+    double x2 = (*it).first;
+    double y2 = (*it).second;
+    --it;
+    double x1 = (*it).first;
+    double y1 = (*it).second;
     // find x (linear interpolation): (y-y1)/(x-x1) = (y2-y1)/(x2-x1)
     (*samples)[i] = (x2 - x1) / (y2 - y1) * (y - y1) + x1;
   }
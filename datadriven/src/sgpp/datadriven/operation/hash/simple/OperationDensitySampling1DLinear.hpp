@@ -27,10 +27,21 @@ class OperationDensitySampling1DLinear : public OperationDensitySampling1D {
    * @param alpha Coefficient vector for current grid (1D grid)
    * @param num_samples # of samples to draw
    * @param samples Output DataVector
-  * @param seedp seed
+   * @param seedp seed, a new seed is stored for the next call
    */
   void doSampling1D(base::DataVector* alpha, size_t num_samples, base::DataVector*& samples,
                     unsigned int* seedp);
+
+  /**
+   * Sampling on 1D grid, the samples are drawn in parallel
+   *
+   * @param alpha Coefficient vector for current grid (1D grid)
+   * @param num_samples # of samples to draw
+   * @param samples Output DataVector
+   * @param stream random number stream, only used to derive one stream per sample
+   */
+  void doSampling1D(base::DataVector* alpha, size_t num_samples, base::DataVector*& samples,
+                    base::RandomNumberStream& stream);
 };
 }  // namespace datadriven
 }  // namespace sgpp
@@ -4,219 +4,339 @@
 // sgpp.sparsegrids.org
 
 #include <sgpp/datadriven/operation/hash/simple/OperationDensitySamplingLinear.hpp>
-#include <sgpp/datadriven/operation/hash/simple/OperationDensityConditional.hpp>
-#include <sgpp/datadriven/operation/hash/simple/OperationDensityMargTo1D.hpp>
-#include <sgpp/datadriven/operation/hash/simple/OperationDensitySampling1D.hpp>
-#include <sgpp/datadriven/DatadrivenOpFactory.hpp>
 #include <sgpp/base/exception/operation_exception.hpp>
+#include <sgpp/base/tools/RandomNumberGenerator.hpp>
 #include <sgpp/globaldef.hpp>
 
-#ifdef _OPENMP
-#include <omp.h>
-#endif
+#include <algorithm>
+#include <cmath>
+#include <vector>
 
 namespace sgpp {
 namespace datadriven {
 
-void OperationDensitySamplingLinear::doSampling(base::DataVector* alpha, base::DataMatrix*& samples,
-                                                size_t num_samples) {
-  size_t num_dims = this->grid->getDimension();
+namespace {
+
+/**
+ * Tables for sampling dimension by dimension from a density on a linear grid.
+ *
+ * Let F be the dimensions that have already been sampled and M the dimensions that are
+ * marginalized. Then the density in dimension t is (up to a constant factor)
+ *   sum_j alpha_j * prod_{d in F} phi_{l_d, i_d}(x_d) * prod_{d in M} 2^(-l_d) * phi_{l_t, i_t}(y),
+ * i.e., a function of y on the 1D grid of dimension t. Only the weights of the grid points
+ * (the products over F and M) depend on the sample.
+ */
+class ConditionalSampler {
+ public:
+  ConditionalSampler(base::Grid& grid, const base::DataVector& alpha);
+
+  /**
+   * Draws samples with a given starting dimension in parallel
+   *
+   * @param dim_start starting dimension
+   * @param first_row row of the first sample in the output matrix
+   * @param num_samples number of samples
+   * @param key key of the random number streams, the sample in row r uses the stream r
+   * @param samples output matrix
+   */
+  void doSampling(size_t dim_start, size_t first_row, size_t num_samples, uint64_t key,
+                  base::DataMatrix& samples) const;
+
+ private:
+  /**
+   * 1D grid of a dimension
+   */
+  struct Table {
+    /// coordinates of the nodes: 0, the sorted grid points, 1
+    std::vector<double> nodes;
+    /// node of each point of the full grid
+    std::vector<size_t> pointNodes;
+    /// the values of the basis function of node k at the nodes are
+    /// basisValues[basisBegin[k], ..., basisBegin[k + 1] - 1] at the nodes basisNodes[...]
+    std::vector<size_t> basisBegin;
+    std::vector<size_t> basisNodes;
+    std::vector<double> basisValues;
+  };
+
+  /**
+   * Buffers of a thread
+   */
+  struct Workspace {
+    /// grid points with nonzero weight
+    std::vector<size_t> active;
+    /// weights of the grid points
+    std::vector<double> weights;
+    /// coefficients of the 1D basis functions
+    std::vector<double> coefficients;
+    /// values of the density at the nodes
+    std::vector<double> values;
+    /// (not normalized) CDF at the nodes
+    std::vector<double> cdf;
+  };
+
+  /**
+   * Initializes the weights with the integrals of the basis functions (all dimensions are
+   * marginalized)
+   */
+  void reset(Workspace& workspace) const;
+
+  /**
+   * Computes the CDF of the density in dimension t for the current weights
+   */
+  void computeCDF(size_t t, Workspace& workspace) const;
+
+  /**
+   * Inverts the CDF, which is piecewise quadratic as the density is piecewise linear
+   *
+   * @param t dimension
+   * @param workspace values of the density and CDF at the nodes of dimension t
+   * @param y uniformly distributed number in (0, 1)
+   * @return coordinate in dimension t
+   */
+  double invertCDF(size_t t, const Workspace& workspace, double y) const;
+
+  /**
+   * Conditions the weights on the coordinate x in dimension t, i.e., moves t from M to F
+   */
+  void condition(size_t t, double x, Workspace& workspace) const;
+
+  size_t numDims;
+  size_t numPoints;
+  const base::DataVector& alpha;
+  /// 2^l and i of the grid points (numPoints x numDims)
+  std::vector<double> levelScales;
+  std::vector<double> indices;
+  /// integrals of the basis functions
+  std::vector<double> integrals;
+  std::vector<Table> tables;
+};
+
+ConditionalSampler::ConditionalSampler(base::Grid& grid, const base::DataVector& alpha)
+    : numDims(grid.getDimension()),
+      numPoints(grid.getSize()),
+      alpha(alpha),
+      levelScales(numPoints * numDims),
+      indices(numPoints * numDims),
+      integrals(numPoints, 1.0),
+      tables(numDims) {
+  base::GridStorage& storage = grid.getStorage();
+
+  for (size_t j = 0; j < numPoints; j++) {
+    base::GridPoint& gp = storage.getPoint(j);
+
+    for (size_t d = 0; d < numDims; d++) {
+      levelScales[j * numDims + d] = std::ldexp(1.0, static_cast<int>(gp.getLevel(d)));
+      indices[j * numDims + d] = static_cast<double>(gp.getIndex(d));
+      integrals[j] /= levelScales[j * numDims + d];
+    }
+  }
 
-  // output matrix
-  samples = new base::DataMatrix(num_samples, num_dims);
+  for (size_t t = 0; t < numDims; t++) {
+    Table& table = tables[t];
+    table.nodes.push_back(0.0);
+    table.nodes.push_back(1.0);
 
-  size_t size = num_samples / num_dims;
+    for (size_t j = 0; j < numPoints; j++) {
+      table.nodes.push_back(indices[j * numDims + t] / levelScales[j * numDims + t]);
+    }
 
-  if (size <= 0)
-    throw base::operation_exception(
-        "Error: # of dimensions greater than # of samples. Operation aborted!");
+    std::sort(table.nodes.begin(), table.nodes.end());
+    table.nodes.erase(std::unique(table.nodes.begin(), table.nodes.end()), table.nodes.end());
 
-  size_t trunk = size;
+    table.pointNodes.resize(numPoints);
+    std::vector<double> nodeScales(table.nodes.size(), 0.0);
 
-  for (size_t dim_start = 0; dim_start < num_dims; dim_start++) {
-    if (dim_start == num_dims - 1) size += num_samples % num_dims;
+    for (size_t j = 0; j < numPoints; j++) {
+      const double x = indices[j * numDims + t] / levelScales[j * numDims + t];
+      const size_t k =
+          std::lower_bound(table.nodes.begin(), table.nodes.end(), x) - table.nodes.begin();
+      table.pointNodes[j] = k;
+      nodeScales[k] = levelScales[j * numDims + t];
+    }
 
-    // 1. marginalize to dim_start
-    base::Grid* g1d = nullptr;
-    base::DataVector* a1d = nullptr;
-    op_factory::createOperationDensityMargTo1D(*this->grid)->margToDimX(alpha, g1d, a1d, dim_start);
+    // the basis function of a node is nonzero at the nodes within its support
+    table.basisBegin.push_back(0);
+
+    for (size_t k = 0; k < table.nodes.size(); k++) {
+      if (nodeScales[k] > 0.0) {
+        const double h = 1.0 / nodeScales[k];
+        size_t first =
+            std::upper_bound(table.nodes.begin(), table.nodes.end(), table.nodes[k] - h) -
+            table.nodes.begin();
+
+        for (size_t m = first; (m < table.nodes.size()) && (table.nodes[m] < table.nodes[k] + h);
+             m++) {
+          table.basisNodes.push_back(m);
+          table.basisValues.push_back(1.0 -
+                                      std::fabs(table.nodes[m] - table.nodes[k]) * nodeScales[k]);
+        }
+      }
 
-    // 2. 1D sampling on dim_start
-    base::DataVector* samples_start = nullptr;
-    unsigned int tseedp = static_cast<unsigned int>(static_cast<double>(time(nullptr)) * 0.0001);
-    op_factory::createOperationDensitySampling1D(*g1d)->doSampling1D(
-        a1d, size, samples_start, &tseedp);
-    delete g1d;
-    delete a1d;
+      table.basisBegin.push_back(table.basisNodes.size());
+    }
+  }
+}
 
-// 3. for every sample do...
-#pragma omp parallel
-    {
-      base::DataVector* sampleVec = new base::DataVector(num_dims);
-      unsigned int seedp;
-      size_t samplesSize = samples_start->getSize();
-#pragma omp critical
-      {
-#ifdef _WIN32
-        double a = static_cast<double>(rand()) / RAND_MAX;
-        int64_t b = static_cast<int64_t>(rand());
-#else
-        double a = static_cast<double>(rand_r(&tseedp)) / RAND_MAX;
-        int64_t b = static_cast<int64_t>(rand_r(&tseedp));
-#endif
-#ifdef _OPENMP
-        seedp =
-            static_cast<unsigned int>(static_cast<double>(time(nullptr)) * a +
-                                      static_cast<double>((omp_get_thread_num() + 1) * 1000 * b));
-#else
-        seedp = static_cast<unsigned int>(static_cast<double>(time(nullptr)) * a +
-                                          static_cast<double>((1 + 1) * 1000 * b));
-#endif
-      }
-#pragma omp for schedule(dynamic)
+void ConditionalSampler::reset(Workspace& workspace) const {
+  workspace.active.clear();
+  workspace.weights.resize(numPoints);
+
+  for (size_t j = 0; j < numPoints; j++) {
+    if (alpha[j] != 0.0) {
+      workspace.active.push_back(j);
+      workspace.weights[j] = integrals[j];
+    }
+  }
+}
 
-      for (size_t i = 0; i < samplesSize; i++) {
-        sampleVec->set(dim_start, samples_start->get(i));
-        doSampling_start_dimX(this->grid, alpha, dim_start, sampleVec, &seedp);
+void ConditionalSampler::computeCDF(size_t t, Workspace& workspace) const {
+  const Table& table = tables[t];
+  const size_t numNodes = table.nodes.size();
 
-        for (size_t j = 0; j < num_dims; j++)
-          samples->set(dim_start * trunk + i, j, sampleVec->get(j));
-      }
+  // coefficients of the 1D function, the integral in dimension t is replaced by the basis function
+  workspace.coefficients.assign(numNodes, 0.0);
 
-      delete sampleVec;
+  for (size_t j : workspace.active) {
+    workspace.coefficients[table.pointNodes[j]] +=
+        alpha[j] * workspace.weights[j] * levelScales[j * numDims + t];
+  }
+
+  // values at the nodes
+  workspace.values.assign(numNodes, 0.0);
+
+  for (size_t k = 0; k < numNodes; k++) {
+    const double coefficient = workspace.coefficients[k];
+
+    if (coefficient != 0.0) {
+      for (size_t m = table.basisBegin[k]; m < table.basisBegin[k + 1]; m++) {
+        workspace.values[table.basisNodes[m]] += coefficient * table.basisValues[m];
+      }
     }
-    delete samples_start;
   }
 
-  return;
+  // composite trapezoidal rule, negative values are cut off
+  workspace.cdf.resize(numNodes);
+  workspace.cdf[0] = 0.0;
+
+  for (size_t k = 1; k < numNodes; k++) {
+    workspace.cdf[k] = workspace.cdf[k - 1] + (table.nodes[k] - table.nodes[k - 1]) / 2.0 *
+                                                  (std::max(workspace.values[k - 1], 0.0) +
+                                                   std::max(workspace.values[k], 0.0));
+  }
 }
 
-void OperationDensitySamplingLinear::doSampling(base::DataVector* alpha, base::DataMatrix*& samples,
-                                                size_t num_samples, size_t dim_x) {
-  size_t num_dims = this->grid->getDimension();
+double ConditionalSampler::invertCDF(size_t t, const Workspace& workspace, double y) const {
+  const std::vector<double>& nodes = tables[t].nodes;
+  const std::vector<double>& cdf = workspace.cdf;
 
-  if ((dim_x >= num_dims))
-    throw base::operation_exception("Error: starting dimension out of range. Operation aborted!");
+  // without probability mass, fall back to the uniform distribution
+  if (!(cdf.back() > 0.0)) {
+    return y;
+  }
 
-  // output matrix
-  samples = new base::DataMatrix(num_samples, num_dims);
+  // first node with cdf >= y, y is never 0 or 1
+  const double yScaled = y * cdf.back();
+  size_t k = std::lower_bound(cdf.begin(), cdf.end(), yScaled) - cdf.begin();
+  k = std::min(std::max(k, static_cast<size_t>(1)), cdf.size() - 1);
+  // with the density v0 + (v1 - v0) s at x = x0 + s (x1 - x0), the CDF in the interval is
+  // cdf0 + (x1 - x0) (v0 s + (v1 - v0) s^2 / 2), solve for s (cancellation-free root)
+  const double width = nodes[k] - nodes[k - 1];
+  const double v0 = std::max(workspace.values[k - 1], 0.0);
+  const double v1 = std::max(workspace.values[k], 0.0);
+  const double r = std::max(yScaled - cdf[k - 1], 0.0) / width;
+  const double denominator = v0 + std::sqrt(std::max(v0 * v0 + 2.0 * (v1 - v0) * r, 0.0));
+  const double s = (denominator > 0.0) ? std::min(2.0 * r / denominator, 1.0) : 0.0;
+  return nodes[k - 1] + s * width;
+}
+
+void ConditionalSampler::condition(size_t t, double x, Workspace& workspace) const {
+  size_t numActive = 0;
 
-  // 1. marginalize to dim_x
-  base::Grid* g1d = nullptr;
-  base::DataVector* a1d = nullptr;
-  op_factory::createOperationDensityMargTo1D(*this->grid)->margToDimX(alpha, g1d, a1d, dim_x);
+  for (size_t j : workspace.active) {
+    const double scale = levelScales[j * numDims + t];
+    const double phi = 1.0 - std::fabs(x * scale - indices[j * numDims + t]);
 
-  // 2. 1D sampling on dim_start
-  base::DataVector* samples_start = nullptr;
-  unsigned int tseedp = static_cast<unsigned int>(static_cast<double>(time(nullptr)) * 0.0001);
-  op_factory::createOperationDensitySampling1D(*g1d)->doSampling1D(
-      a1d, num_samples, samples_start, &tseedp);
-  delete g1d;
-  delete a1d;
+    if (phi > 0.0) {
+      // replace the integral 2^(-l) by the value of the basis function
+      workspace.weights[j] *= phi * scale;
+      workspace.active[numActive++] = j;
+    }
+  }
+
+  workspace.active.resize(numActive);
+}
+
+void ConditionalSampler::doSampling(size_t dim_start, size_t first_row, size_t num_samples,
+                                    uint64_t key, base::DataMatrix& samples) const {
+  // marginal density in the starting dimension, shared by all samples
+  Workspace marginal;
+  reset(marginal);
+  computeCDF(dim_start, marginal);
 
-// 3. for every sample do...
 #pragma omp parallel
   {
-    base::DataVector* sampleVec = new base::DataVector(num_dims);
-    unsigned int seedp = 0;
-
-#pragma omp critical
-    {
-#ifdef _WIN32
-      double a = static_cast<double>(rand()) / RAND_MAX;
-      int64_t b = static_cast<int64_t>(rand());
-#else
-      double a = static_cast<double>(rand_r(&tseedp)) / RAND_MAX;
-      int64_t b = static_cast<int64_t>(rand_r(&tseedp));
-#endif
-#ifdef _OPENMP
-      seedp =
-          static_cast<unsigned int>(static_cast<double>(time(nullptr)) * a +
-                                    static_cast<double>((omp_get_thread_num() + 1) * 1000 * b));
-#else
-      seedp = static_cast<unsigned int>(static_cast<double>(time(nullptr)) * a +
-                                        static_cast<double>((1 + 1) * 1000 * b));
-#endif
-    }
-#pragma omp for schedule(dynamic)
+    Workspace workspace;
 
+#pragma omp for schedule(dynamic)
     for (size_t i = 0; i < num_samples; i++) {
-      sampleVec->set(dim_x, samples_start->get(i));
-      doSampling_start_dimX(this->grid, alpha, dim_x, sampleVec, &seedp);
-
-      for (size_t j = 0; j < num_dims; j++) samples->set(i, j, sampleVec->get(j));
+      // the stream only depends on the row of the sample
+      const size_t row = first_row + i;
+      base::RandomNumberStream stream(key, row);
+      double x = invertCDF(dim_start, marginal, stream.getUniformRN());
+      samples.set(row, dim_start, x);
+      reset(workspace);
+
+      for (size_t step = 1; step < numDims; step++) {
+        condition((dim_start + step - 1) % numDims, x, workspace);
+        const size_t t = (dim_start + step) % numDims;
+        computeCDF(t, workspace);
+        x = invertCDF(t, workspace, stream.getUniformRN());
+        samples.set(row, t, x);
+      }
     }
   }
-  delete samples_start;
-  return;
 }
 
-void OperationDensitySamplingLinear::doSampling_start_dimX(base::Grid* g_in, base::DataVector* a_in,
-                                                           size_t dim_start,
-                                                           base::DataVector*& sampleVec,
-                                                           unsigned int* seedp) {
-  size_t dims = sampleVec->getSize();  // total dimensions
-
-  if ((dims > 1) && (dim_start <= dims - 1)) {
-    size_t curr_dim = dim_start;
-    doSampling_in_next_dim(g_in, a_in, dim_start, sampleVec, curr_dim, seedp);
-  } else if (dims == 1) {
-    throw base::operation_exception("Error: # of dimensions = 1. No operation needed!");
-  } else {
-    throw base::operation_exception("Error: dimension out of range. Operation aborted!");
+}  // namespace
+
+void OperationDensitySamplingLinear::doSampling(base::DataVector* alpha, base::DataMatrix*& samples,
+                                                size_t num_samples) {
+  size_t num_dims = this->grid->getDimension();
+
+  // output matrix
+  samples = new base::DataMatrix(num_samples, num_dims);
+
+  size_t size = num_samples / num_dims;
+
+  if (size <= 0)
+    throw base::operation_exception(
+        "Error: # of dimensions greater than # of samples. Operation aborted!");
+
+  size_t trunk = size;
+  const uint64_t key = base::RandomNumberGenerator::getInstance().getStreamKey();
+  ConditionalSampler sampler(*this->grid, *alpha);
+
+  for (size_t dim_start = 0; dim_start < num_dims; dim_start++) {
+    if (dim_start == num_dims - 1) size += num_samples % num_dims;
+
+    sampler.doSampling(dim_start, dim_start * trunk, size, key, *samples);
   }
 
   return;
 }
 
-void OperationDensitySamplingLinear::doSampling_in_next_dim(base::Grid* g_in,
-                                                            base::DataVector* a_in, size_t dim_x,
-                                                            base::DataVector*& sampleVec,
-                                                            size_t& curr_dim, unsigned int* seedp) {
-  size_t dims = sampleVec->getSize();  // total dimensions
-  unsigned int op_dim =
-      (curr_dim < dim_x) ? 0 : static_cast<unsigned int>(dim_x);  // actual dim to be operated on
-
-  /* Step 1: do conditional in current dim */
-  base::Grid* g_out = nullptr;
-  base::DataVector* a_out = new base::DataVector(1);
-  op_factory::createOperationDensityConditional(*g_in)->doConditional(
-      *a_in, g_out, *a_out, op_dim, sampleVec->get(curr_dim));
-
-  // move on to next dim
-  curr_dim = (curr_dim + 1) % dims;
-  op_dim = (curr_dim < dim_x) ? 0 : static_cast<unsigned int>(dim_x);
-
-  /* Step 2: draw a sample in next dim */
-  base::DataVector* sample = nullptr;
-
-  if (g_out->getDimension() > 1) {
-    // Marginalize to next dimension
-    base::Grid* g1d = nullptr;
-    base::DataVector* a1d = nullptr;
-    op_factory::createOperationDensityMargTo1D(*g_out)->margToDimX(a_out, g1d, a1d, op_dim);
-
-    // Draw a sample in next dimension
-    op_factory::createOperationDensitySampling1D(*g1d)->doSampling1D(a1d, 1, sample, seedp);
-    delete g1d;
-    delete a1d;
-
-  } else {
-    // skip Marginalize, directly draw a sample in next dimension
-    op_factory::createOperationDensitySampling1D(*g_out)->doSampling1D(a_out, 1, sample, seedp);
-  }
-
-  /* Step 3: copy sample to output */
-  sampleVec->set(curr_dim, sample->get(0));
-  delete sample;
+void OperationDensitySamplingLinear::doSampling(base::DataVector* alpha, base::DataMatrix*& samples,
+                                                size_t num_samples, size_t dim_x) {
+  size_t num_dims = this->grid->getDimension();
 
-  /* Step 4: sample in next dimension */
-  if (g_out->getDimension() > 1)
-    doSampling_in_next_dim(g_out, a_out, dim_x, sampleVec, curr_dim, seedp);
+  if ((dim_x >= num_dims))
+    throw base::operation_exception("Error: starting dimension out of range. Operation aborted!");
 
-  delete g_out;
-  delete a_out;
+  // output matrix
+  samples = new base::DataMatrix(num_samples, num_dims);
 
+  const uint64_t key = base::RandomNumberGenerator::getInstance().getStreamKey();
+  ConditionalSampler(*this->grid, *alpha).doSampling(dim_x, 0, num_samples, key, *samples);
   return;
 }
 }  // namespace datadriven
@@ -15,7 +15,19 @@ namespace sgpp {
 namespace datadriven {
 
 /**
- * keep applying marginalize to function until it's reduced to only 1 dimension
+ * Draws samples from a density on a linear grid dimension by dimension: the coordinate in the
+ * starting dimension is drawn from the marginal density, every following coordinate from the
+ * density conditioned on the previous coordinates and marginalized to the next dimension.
+ *
+ * The conditional densities are not computed on copies of the grid (as
+ * OperationDensityConditional and OperationDensityMargTo1D would do), but from 1D tables that are
+ * computed once per call: for every dimension the sorted 1D grid and the values of its basis
+ * functions at the grid points. For each sample, only the weights of the grid points change.
+ * Negative values of the density are treated as zero.
+ *
+ * The samples are drawn in parallel. Every sample uses its own base::RandomNumberStream, whose key
+ * is drawn from base::RandomNumberGenerator, so the samples are reproducible with
+ * base::RandomNumberGenerator::setSeed and do not depend on the number of threads.
  */
 
 class OperationDensitySamplingLinear : public OperationDensitySampling {
@@ -45,10 +57,6 @@ class OperationDensitySamplingLinear : public OperationDensitySampling {
 
  protected:
   base::Grid* grid;
-  void doSampling_start_dimX(base::Grid* g_in, base::DataVector* a_in, size_t dim_start,
-                             base::DataVector*& sampleVec, unsigned int* seedp);
-  void doSampling_in_next_dim(base::Grid* g_in, base::DataVector* a_in, size_t dim_x,
-                              base::DataVector*& sampleVec, size_t& curr_dim, unsigned int* seedp);
 };
 }  // namespace datadriven
 }  // namespace sgpp
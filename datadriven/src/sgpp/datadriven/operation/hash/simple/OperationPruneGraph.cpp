@@ -0,0 +1,73 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#include <sgpp/datadriven/operation/hash/simple/OperationPruneGraph.hpp>
+
+#include <sgpp/base/exception/operation_exception.hpp>
+#include <sgpp/base/operation/BaseOpFactory.hpp>
+#include <sgpp/base/operation/hash/OperationMultipleEval.hpp>
+
+#include <algorithm>
+#include <memory>
+#include <vector>
+
+namespace sgpp {
+namespace datadriven {
+
+OperationPruneGraph::OperationPruneGraph(base::Grid& grid, base::DataVector& alpha,
+                                         base::DataMatrix& data, double threshold, size_t k)
+    : grid(grid), alpha(alpha), data(data), threshold(threshold), k(k) {}
+
+OperationPruneGraph::~OperationPruneGraph() {}
+
+void OperationPruneGraph::prune_graph(std::vector<int>& graph, size_t startid, size_t chunksize) {
+  const size_t dims = data.getNcols();
+  const size_t count = chunksize > 0 ? chunksize : data.getNrows() - startid;
+  if (startid + count > data.getNrows() || graph.size() < count * k) {
+    throw base::operation_exception("OperationPruneGraph: chunk exceeds the dataset or graph");
+  }
+
+  // evaluation points: the midpoints of all edges followed by the datapoints of the chunk
+  base::DataMatrix evalPoints(count * k + count, dims);
+  double* evalData = evalPoints.getPointer();
+  const double* points = data.getPointer();
+
+#pragma omp parallel for
+  for (size_t i = 0; i < count; i++) {
+    const double* point = points + (startid + i) * dims;
+    for (size_t j = 0; j < k; j++) {
+      double* midpoint = evalData + (i * k + j) * dims;
+      int neighbor = graph[i * k + j];
+      const double* other = neighbor >= 0 ? points + static_cast<size_t>(neighbor) * dims : point;
+      for (size_t d = 0; d < dims; d++) {
+        midpoint[d] = other[d] + (point[d] - other[d]) * 0.5;
+      }
+    }
+    std::copy(point, point + dims, evalData + (count * k + i) * dims);
+  }
+
+  base::DataVector density(evalPoints.getNrows());
+  std::unique_ptr<base::OperationMultipleEval> opEval(
+      op_factory::createOperationMultipleEval(grid, evalPoints));
+  opEval->mult(alpha, density);
+
+#pragma omp parallel for
+  for (size_t i = 0; i < count; i++) {
+    if (density[count * k + i] < threshold) {
+      for (size_t j = 0; j < k; j++) {
+        graph[i * k + j] = -1;
+      }
+      continue;
+    }
+    for (size_t j = 0; j < k; j++) {
+      if (graph[i * k + j] >= 0 && density[i * k + j] < threshold) {
+        graph[i * k + j] = -2;
+      }
+    }
+  }
+}
+
+}  // namespace datadriven
+}  // namespace sgpp
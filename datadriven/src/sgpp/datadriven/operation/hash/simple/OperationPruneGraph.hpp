@@ -0,0 +1,64 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#pragma once
+
+#include <sgpp/base/datatypes/DataMatrix.hpp>
+#include <sgpp/base/datatypes/DataVector.hpp>
+#include <sgpp/base/grid/Grid.hpp>
+
+#include <sgpp/globaldef.hpp>
+
+#include <vector>
+
+namespace sgpp {
+namespace datadriven {
+
+/**
+ * Removes the nodes and edges of a k nearest neighbor graph which lie in areas of low density, this
+ * is the CPU counterpart of DensityOCLMultiPlatform::OperationPruneGraphOCL. An edge is removed
+ * (-2) if the density in the middle of the edge is below the threshold, a node is removed (all of
+ * its entries are set to -1) if the density in the datapoint itself is below the threshold.
+ * The density is evaluated in all datapoints and edge midpoints of a chunk at once with
+ * OperationMultipleEval.
+ */
+class OperationPruneGraph {
+ public:
+  /**
+   * Constructor
+   *
+   * @param grid the sparse grid of the density
+   * @param alpha coefficients of the density
+   * @param data the datapoints of the graph
+   * @param threshold density threshold
+   * @param k number of neighbors of each datapoint
+   */
+  OperationPruneGraph(base::Grid& grid, base::DataVector& alpha, base::DataMatrix& data,
+                      double threshold, size_t k);
+
+  /**
+   * Destructor
+   */
+  virtual ~OperationPruneGraph();
+
+  /**
+   * Prunes the graph of a chunk of datapoints
+   *
+   * @param graph the graph of the chunk (chunksize * k entries)
+   * @param startid first datapoint of the chunk
+   * @param chunksize number of datapoints in the chunk, 0 for all remaining datapoints
+   */
+  virtual void prune_graph(std::vector<int>& graph, size_t startid = 0, size_t chunksize = 0);
+
+ protected:
+  base::Grid& grid;
+  base::DataVector& alpha;
+  base::DataMatrix& data;
+  double threshold;
+  size_t k;
+};
+
+}  // namespace datadriven
+}  // namespace sgpp
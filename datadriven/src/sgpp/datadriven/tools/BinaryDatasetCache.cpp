@@ -0,0 +1,192 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#include <sgpp/datadriven/tools/BinaryDatasetCache.hpp>
+
+#include <sgpp/base/datatypes/DataMatrix.hpp>
+#include <sgpp/base/datatypes/DataVector.hpp>
+#include <sgpp/base/exception/file_exception.hpp>
+
+#include <sys/stat.h>
+
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace sgpp {
+namespace datadriven {
+
+namespace {
+
+const char cacheMagic[8] = {'S', 'G', 'P', 'P', 'D', 'S', 'C', '1'};
+
+struct SourceInfo {
+  uint64_t size;
+  int64_t modificationTime;
+};
+
+bool getSourceInfo(const std::string& sourcePath, SourceInfo& info) {
+  struct stat status;
+  if (stat(sourcePath.c_str(), &status) != 0) {
+    return false;
+  }
+  info.size = static_cast<uint64_t>(status.st_size);
+  info.modificationTime = static_cast<int64_t>(status.st_mtime);
+  return true;
+}
+
+template <typename T>
+void writeValue(std::ostream& stream, T value) {
+  stream.write(reinterpret_cast<const char*>(&value), sizeof(T));
+}
+
+template <typename T>
+bool readValue(std::istream& stream, T& value) {
+  stream.read(reinterpret_cast<char*>(&value), sizeof(T));
+  return static_cast<bool>(stream);
+}
+
+}  // namespace
+
+std::string BinaryDatasetCache::getCachePath(const std::string& sourcePath) {
+  return sourcePath + ".sgppcache";
+}
+
+std::string BinaryDatasetCache::describeOptions(const std::string& fileType, bool hasTargets,
+                                                size_t readinCutoff,
+                                                const std::vector<size_t>& readinColumns,
+                                                const std::vector<double>& readinClasses) {
+  std::ostringstream options;
+  options.precision(17);
+  options << fileType << ";targets=" << hasTargets << ";cutoff=" << readinCutoff << ";columns=";
+  for (size_t column : readinColumns) {
+    options << column << ",";
+  }
+  options << ";classes=";
+  for (double readinClass : readinClasses) {
+    options << readinClass << ",";
+  }
+  return options.str();
+}
+
+bool BinaryDatasetCache::load(const std::string& sourcePath, const std::string& options,
+                              Dataset& dataset) {
+  SourceInfo source;
+  if (!getSourceInfo(sourcePath, source)) {
+    return false;
+  }
+
+  std::ifstream stream(getCachePath(sourcePath), std::ios::binary);
+  if (!stream) {
+    return false;
+  }
+
+  char magic[sizeof(cacheMagic)];
+  stream.read(magic, sizeof(magic));
+  if (!stream || std::memcmp(magic, cacheMagic, sizeof(cacheMagic)) != 0) {
+    return false;
+  }
+
+  SourceInfo cachedSource;
+  uint64_t optionsLength;
+  if (!readValue(stream, cachedSource.size) || !readValue(stream, cachedSource.modificationTime) ||
+      !readValue(stream, optionsLength)) {
+    return false;
+  }
+  if (cachedSource.size != source.size ||
+      cachedSource.modificationTime != source.modificationTime ||
+      optionsLength != options.size()) {
+    return false;
+  }
+  std::string cachedOptions(optionsLength, '\0');
+  stream.read(&cachedOptions[0], static_cast<std::streamsize>(optionsLength));
+  if (!stream || cachedOptions != options) {
+    return false;
+  }
+
+  uint64_t numberInstances;
+  uint64_t dimension;
+  if (!readValue(stream, numberInstances) || !readValue(stream, dimension)) {
+    return false;
+  }
+
+  base::DataMatrix data(numberInstances, dimension);
+  base::DataVector column(numberInstances);
+  for (size_t d = 0; d < dimension; ++d) {
+    stream.read(reinterpret_cast<char*>(column.data()),
+                static_cast<std::streamsize>(numberInstances * sizeof(double)));
+    if (!stream) {
+      return false;
+    }
+    data.setColumn(d, column);
+  }
+  base::DataVector targets(numberInstances);
+  stream.read(reinterpret_cast<char*>(targets.data()),
+              static_cast<std::streamsize>(numberInstances * sizeof(double)));
+  if (!stream) {
+    return false;
+  }
+
+  dataset = Dataset(std::move(data), std::move(targets));
+  return true;
+}
+
+void BinaryDatasetCache::store(const std::string& sourcePath, const std::string& options,
+                               const Dataset& dataset) {
+  SourceInfo source;
+  if (!getSourceInfo(sourcePath, source)) {
+    throw base::file_exception("BinaryDatasetCache::store: source file does not exist");
+  }
+
+  const std::string cachePath = getCachePath(sourcePath);
+  const std::string temporaryPath = cachePath + ".tmp";
+  {
+    std::ofstream stream(temporaryPath, std::ios::binary | std::ios::trunc);
+    if (!stream) {
+      throw base::file_exception("BinaryDatasetCache::store: unable to open cache file");
+    }
+
+    const base::DataMatrix& data = dataset.getData();
+    const base::DataVector& targets = dataset.getTargets();
+    const uint64_t numberInstances = data.getNrows();
+    const uint64_t dimension = data.getNcols();
+
+    stream.write(cacheMagic, sizeof(cacheMagic));
+    writeValue(stream, source.size);
+    writeValue(stream, source.modificationTime);
+    writeValue(stream, static_cast<uint64_t>(options.size()));
+    stream.write(options.data(), static_cast<std::streamsize>(options.size()));
+    writeValue(stream, numberInstances);
+    writeValue(stream, dimension);
+
+    base::DataVector column(numberInstances);
+    for (size_t d = 0; d < dimension; ++d) {
+      data.getColumn(d, column);
+      stream.write(reinterpret_cast<const char*>(column.data()),
+                   static_cast<std::streamsize>(numberInstances * sizeof(double)));
+    }
+    stream.write(reinterpret_cast<const char*>(targets.data()),
+                 static_cast<std::streamsize>(numberInstances * sizeof(double)));
+
+    if (!stream) {
+      std::remove(temporaryPath.c_str());
+      throw base::file_exception("BinaryDatasetCache::store: failed to write cache file");
+    }
+  }
+
+  std::remove(cachePath.c_str());
+  if (std::rename(temporaryPath.c_str(), cachePath.c_str()) != 0) {
+    std::remove(temporaryPath.c_str());
+    throw base::file_exception("BinaryDatasetCache::store: failed to move cache file");
+  }
+}
+
+}  // namespace datadriven
+}  // namespace sgpp
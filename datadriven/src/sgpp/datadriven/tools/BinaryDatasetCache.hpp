@@ -0,0 +1,75 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#pragma once
+
+#include <sgpp/globaldef.hpp>
+
+#include <sgpp/datadriven/tools/Dataset.hpp>
+
+#include <string>
+#include <vector>
+
+namespace sgpp {
+namespace datadriven {
+
+/**
+ * Binary cache for datasets parsed from text files (CSV, ARFF).
+ *
+ * The cache is stored next to the source file (same path with the suffix ".sgppcache") in a
+ * columnar layout: a header containing the size and modification time of the source file and the
+ * parsing options, followed by the data columns and the targets as native double arrays. A cache
+ * is only used if the source file and the parsing options are unchanged, so it never has to be
+ * invalidated by hand. The cache uses the native byte order and is not meant to be exchanged
+ * between machines.
+ */
+class BinaryDatasetCache {
+ public:
+  /**
+   * @param sourcePath path to the original text file
+   * @return path of the cache file belonging to the source file
+   */
+  static std::string getCachePath(const std::string& sourcePath);
+
+  /**
+   * Generates a string representation of all parsing options that influence the content of the
+   * parsed dataset. See #sgpp::datadriven::FileSampleProvider::readFile for the parameters.
+   *
+   * @param fileType name of the file format
+   * @param hasTargets whether the file has targets
+   * @param readinCutoff data line number after which to stop reading
+   * @param readinColumns subset of columns that is read
+   * @param readinClasses subset of classes that is read
+   * @return string identifying the parsing options
+   */
+  static std::string describeOptions(const std::string& fileType, bool hasTargets,
+                                     size_t readinCutoff, const std::vector<size_t>& readinColumns,
+                                     const std::vector<double>& readinClasses);
+
+  /**
+   * Loads the cached dataset if a valid cache exists for the source file.
+   *
+   * @param sourcePath path to the original text file
+   * @param options parsing options as generated by #describeOptions
+   * @param[out] dataset the cached dataset, only written if the cache is valid
+   * @return whether a valid cache was found and loaded
+   */
+  static bool load(const std::string& sourcePath, const std::string& options, Dataset& dataset);
+
+  /**
+   * Writes the dataset parsed from the source file to its cache file. The file is written to a
+   * temporary location first and then moved to its final position. Throws
+   * #sgpp::base::file_exception if the cache can not be written.
+   *
+   * @param sourcePath path to the original text file
+   * @param options parsing options as generated by #describeOptions
+   * @param dataset dataset parsed from the source file
+   */
+  static void store(const std::string& sourcePath, const std::string& options,
+                    const Dataset& dataset);
+};
+
+}  // namespace datadriven
+}  // namespace sgpp
@@ -0,0 +1,225 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#include <sgpp/datadriven/tools/BinaryTools.hpp>
+
+#include <sgpp/base/exception/file_exception.hpp>
+#include <sgpp/datadriven/tools/MemoryMappedFile.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <fstream>
+#include <numeric>
+#include <string>
+#include <vector>
+
+namespace sgpp {
+namespace datadriven {
+
+namespace {
+
+const char binaryMagic[8] = {'S', 'G', 'P', 'P', 'D', 'A', 'T', '1'};
+
+template <typename T>
+inline T loadValue(const char* position) {
+  T value;
+  std::memcpy(&value, position, sizeof(T));
+  return value;
+}
+
+inline double loadEntry(const char* position, bool singlePrecision) {
+  return singlePrecision ? static_cast<double>(loadValue<float>(position))
+                         : loadValue<double>(position);
+}
+
+inline size_t valueSize(const BinaryTools::Header& header) {
+  return header.singlePrecision ? sizeof(float) : sizeof(double);
+}
+
+inline size_t targetsOffset(const BinaryTools::Header& header) {
+  return BinaryTools::headerSize + header.numberInstances * header.dimension * valueSize(header);
+}
+
+}  // namespace
+
+void BinaryTools::writeBinaryToFile(const std::string& filename, const Dataset& dataset,
+                                    bool hasTargets, bool singlePrecision) {
+  std::ofstream stream(filename, std::ios::binary | std::ios::trunc);
+  if (!stream) {
+    throw base::file_exception("writeBinaryToFile: unable to open file");
+  }
+
+  const base::DataMatrix& data = dataset.getData();
+  const base::DataVector& targets = dataset.getTargets();
+  const uint64_t numberInstances = data.getNrows();
+  const uint64_t dimension = data.getNcols();
+  const uint32_t valueType = singlePrecision ? 1 : 0;
+  const uint32_t targetsFlag = hasTargets ? 1 : 0;
+
+  stream.write(binaryMagic, sizeof(binaryMagic));
+  stream.write(reinterpret_cast<const char*>(&numberInstances), sizeof(numberInstances));
+  stream.write(reinterpret_cast<const char*>(&dimension), sizeof(dimension));
+  stream.write(reinterpret_cast<const char*>(&valueType), sizeof(valueType));
+  stream.write(reinterpret_cast<const char*>(&targetsFlag), sizeof(targetsFlag));
+
+  if (singlePrecision) {
+    std::vector<float> row(dimension);
+    for (size_t i = 0; i < numberInstances; ++i) {
+      for (size_t d = 0; d < dimension; ++d) {
+        row[d] = static_cast<float>(data.get(i, d));
+      }
+      stream.write(reinterpret_cast<const char*>(row.data()),
+                   static_cast<std::streamsize>(dimension * sizeof(float)));
+    }
+    if (hasTargets) {
+      std::vector<float> singleTargets(targets.begin(), targets.end());
+      stream.write(reinterpret_cast<const char*>(singleTargets.data()),
+                   static_cast<std::streamsize>(numberInstances * sizeof(float)));
+    }
+  } else {
+    stream.write(reinterpret_cast<const char*>(data.data()),
+                 static_cast<std::streamsize>(numberInstances * dimension * sizeof(double)));
+    if (hasTargets) {
+      stream.write(reinterpret_cast<const char*>(targets.data()),
+                   static_cast<std::streamsize>(numberInstances * sizeof(double)));
+    }
+  }
+
+  if (!stream) {
+    throw base::file_exception("writeBinaryToFile: failed to write file");
+  }
+}
+
+Dataset BinaryTools::readBinaryFromFile(const std::string& filename, bool hasTargets,
+                                        size_t instanceCutoff, std::vector<size_t> selectedCols,
+                                        std::vector<double> selectedTargets) {
+  MemoryMappedFile file(filename);
+  Header header = parseHeader(file.getData(), file.getSize());
+
+  if (hasTargets && !header.hasTargets) {
+    throw base::file_exception("readBinaryFromFile: file does not contain targets");
+  }
+  if (!selectedCols.empty() &&
+      *std::max_element(selectedCols.begin(), selectedCols.end()) >= header.dimension) {
+    throw base::file_exception("readBinaryFromFile: invalid column selection");
+  }
+
+  std::vector<size_t> rowIndices;
+  size_t numberInstances = selectRows(file.getData(), header, instanceCutoff,
+                                      hasTargets ? selectedTargets : std::vector<double>(),
+                                      rowIndices);
+  if (rowIndices.empty()) {
+    rowIndices.resize(numberInstances);
+    std::iota(rowIndices.begin(), rowIndices.end(), 0);
+  }
+
+  Dataset dataset(numberInstances, selectedCols.empty() ? header.dimension : selectedCols.size());
+  copyRows(file.getData(), header, rowIndices, selectedCols, hasTargets, dataset);
+  return dataset;
+}
+
+BinaryTools::Header BinaryTools::parseHeader(const char* data, size_t size) {
+  if (size < headerSize || std::memcmp(data, binaryMagic, sizeof(binaryMagic)) != 0) {
+    throw base::file_exception("BinaryTools: not a binary dataset file");
+  }
+
+  Header header;
+  header.numberInstances = static_cast<size_t>(loadValue<uint64_t>(data + 8));
+  header.dimension = static_cast<size_t>(loadValue<uint64_t>(data + 16));
+  uint32_t valueType = loadValue<uint32_t>(data + 24);
+  uint32_t targetsFlag = loadValue<uint32_t>(data + 28);
+  if (valueType > 1 || targetsFlag > 1) {
+    throw base::file_exception("BinaryTools: invalid binary dataset header");
+  }
+  header.singlePrecision = valueType == 1;
+  header.hasTargets = targetsFlag == 1;
+
+  size_t expectedSize =
+      targetsOffset(header) + (header.hasTargets ? header.numberInstances * valueSize(header) : 0);
+  if (size < expectedSize) {
+    throw base::file_exception("BinaryTools: binary dataset file is truncated");
+  }
+  return header;
+}
+
+size_t BinaryTools::selectRows(const char* data, const Header& header, size_t instanceCutoff,
+                               const std::vector<double>& selectedTargets,
+                               std::vector<size_t>& rowIndices) {
+  rowIndices.clear();
+  if (selectedTargets.empty()) {
+    return std::min(header.numberInstances, instanceCutoff);
+  }
+  if (!header.hasTargets) {
+    throw base::file_exception("BinaryTools: can not select targets in a file without targets");
+  }
+
+  const char* targets = data + targetsOffset(header);
+  for (size_t i = 0; i < header.numberInstances && rowIndices.size() < instanceCutoff; ++i) {
+    double target = loadEntry(targets + i * valueSize(header), header.singlePrecision);
+    for (double selected : selectedTargets) {
+      // same float comparison as used by CSVTools and ARFFTools
+      if (std::fabs(target - selected) < 0.001) {
+        rowIndices.push_back(i);
+        break;
+      }
+    }
+  }
+  return rowIndices.size();
+}
+
+void BinaryTools::copyRows(const char* data, const Header& header,
+                           const std::vector<size_t>& sourceRows,
+                           const std::vector<size_t>& selectedCols, bool copyTargets,
+                           Dataset& destination) {
+  const size_t count = sourceRows.size();
+  if (count == 0) {
+    return;
+  }
+
+  const char* values = data + headerSize;
+  const char* targets = data + targetsOffset(header);
+  const size_t entrySize = valueSize(header);
+  const size_t rowSize = header.dimension * entrySize;
+  base::DataMatrix& destData = destination.getData();
+  base::DataVector& destTargets = destination.getTargets();
+
+  bool contiguous = !header.singlePrecision && selectedCols.empty() &&
+                    sourceRows.back() - sourceRows.front() + 1 == count;
+  for (size_t i = 1; contiguous && i < count; ++i) {
+    contiguous = sourceRows[i] == sourceRows[i - 1] + 1;
+  }
+
+  if (contiguous) {
+    std::memcpy(destData.data(), values + sourceRows.front() * rowSize, count * rowSize);
+    if (copyTargets) {
+      std::memcpy(destTargets.data(), targets + sourceRows.front() * entrySize,
+                  count * entrySize);
+    }
+    return;
+  }
+
+  const size_t dimension = destData.getNcols();
+
+#pragma omp parallel for if (count > 1024)
+  for (size_t i = 0; i < count; ++i) {
+    const char* row = values + sourceRows[i] * rowSize;
+    if (selectedCols.empty()) {
+      for (size_t d = 0; d < dimension; ++d) {
+        destData.set(i, d, loadEntry(row + d * entrySize, header.singlePrecision));
+      }
+    } else {
+      for (size_t d = 0; d < dimension; ++d) {
+        destData.set(i, d, loadEntry(row + selectedCols[d] * entrySize, header.singlePrecision));
+      }
+    }
+    if (copyTargets) {
+      destTargets[i] = loadEntry(targets + sourceRows[i] * entrySize, header.singlePrecision);
+    }
+  }
+}
+
+}  // namespace datadriven
+}  // namespace sgpp
@@ -0,0 +1,123 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#pragma once
+
+#include <sgpp/globaldef.hpp>
+
+#include <sgpp/datadriven/tools/Dataset.hpp>
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace sgpp {
+namespace datadriven {
+
+/**
+ * Class that provides functionality to read and write datasets in the native binary format of
+ * SG++.
+ *
+ * A binary dataset file consists of a header of #headerSize bytes (the magic string "SGPPDAT1",
+ * the number of instances and the dimension as 64 bit unsigned integers, the value type and a
+ * targets flag as 32 bit unsigned integers) followed by the row-major payload of all instances
+ * and, if present, the targets. Values are stored either as float64 or as float32 in native byte
+ * order. The payload starts at an 8 byte aligned offset, so it can be used directly from a memory
+ * mapped file.
+ */
+class BinaryTools {
+ public:
+  /**
+   * Meta data stored in the header of a binary dataset file
+   */
+  struct Header {
+    /// number of instances in the file
+    size_t numberInstances = 0;
+    /// dimension of the instances
+    size_t dimension = 0;
+    /// values are stored as float32 instead of float64
+    bool singlePrecision = false;
+    /// the file contains targets behind the data
+    bool hasTargets = false;
+  };
+
+  /**
+   * Size of the header in bytes
+   */
+  static const size_t headerSize = 32;
+
+  /**
+   * Writes a dataset to a binary dataset file.
+   *
+   * @param filename path of the file to write
+   * @param dataset the dataset to write
+   * @param hasTargets whether the targets of the dataset are written, too
+   * @param singlePrecision whether values are stored as float32 instead of float64
+   */
+  static void writeBinaryToFile(const std::string& filename, const Dataset& dataset,
+                                bool hasTargets = true, bool singlePrecision = false);
+
+  /**
+   * Reads a binary dataset file. See #sgpp::datadriven::CSVTools::readCSV for a detailed
+   * description of the parameters.
+   *
+   * @param filename path of the file to read
+   * @param hasTargets whether the targets should be read, the file has to contain targets then
+   * @param instanceCutoff maximal number of instances to read
+   * @param selectedCols columns to use as dimensions, empty for all
+   * @param selectedTargets admissible targets, empty for all
+   * @return the dataset stored in the file
+   */
+  static Dataset readBinaryFromFile(const std::string& filename, bool hasTargets = true,
+                                    size_t instanceCutoff = -1,
+                                    std::vector<size_t> selectedCols = std::vector<size_t>(),
+                                    std::vector<double> selectedTargets = std::vector<double>());
+
+  /**
+   * Parses and validates the header of a binary dataset file. Throws
+   * #sgpp::base::file_exception if the content is not a valid binary dataset.
+   *
+   * @param data pointer to the content of the file
+   * @param size size of the file in bytes
+   * @return the meta data of the file
+   */
+  static Header parseHeader(const char* data, size_t size);
+
+  /**
+   * Determines the instances of a binary dataset file that are admissible with respect to the
+   * read-in restrictions.
+   *
+   * @param data pointer to the content of the file
+   * @param header meta data of the file
+   * @param instanceCutoff maximal number of instances
+   * @param selectedTargets admissible targets, empty for all
+   * @param[out] rowIndices indices of the admissible instances. Empty if the admissible instances
+   *        are simply the first ones, which is always the case if selectedTargets is empty.
+   * @return number of admissible instances
+   */
+  static size_t selectRows(const char* data, const Header& header, size_t instanceCutoff,
+                           const std::vector<double>& selectedTargets,
+                           std::vector<size_t>& rowIndices);
+
+  /**
+   * Copies instances from a binary dataset file into a dataset. Contiguous double precision
+   * ranges are copied as a single block, everything else row by row in parallel.
+   *
+   * @param data pointer to the content of the file
+   * @param header meta data of the file
+   * @param sourceRows indices of the instances in the file that are copied
+   * @param selectedCols columns to use as dimensions, empty for all
+   * @param copyTargets whether the targets are copied as well
+   * @param[out] destination dataset with at least sourceRows.size() instances. Instance i of the
+   *        destination is set to instance sourceRows[i] of the file.
+   */
+  static void copyRows(const char* data, const Header& header,
+                       const std::vector<size_t>& sourceRows,
+                       const std::vector<size_t>& selectedCols, bool copyTargets,
+                       Dataset& destination);
+};
+
+}  // namespace datadriven
+}  // namespace sgpp
@@ -5,7 +5,7 @@
 
 #include <sgpp/datadriven/tools/CSVTools.hpp>
 #include <sgpp/base/exception/file_exception.hpp>
-#include <sgpp/base/tools/StringTokenizer.hpp>
+#include <sgpp/datadriven/tools/ParallelDataParser.hpp>
 
 #include <sgpp/globaldef.hpp>
 
@@ -60,73 +60,8 @@ Dataset CSVTools::readCSV(std::istream& stream,
                           size_t instanceCutoff,
                           std::vector<size_t> selectedCols,
                           std::vector<double> selectedTargets) {
-  size_t maxInst = 0;
-  size_t maxDim = 0;
-  size_t dimension = 0;
-  size_t numberInstances = 0;
-  readCSVSize(stream, maxInst, maxDim, skipFirstLine, hasTargets, selectedTargets);
-  // reset the stream
-  stream.clear();
-  stream.seekg(0, std::ios::beg);
-  // make sure selectedCols has admissible values if it is not empty
-  if (selectedCols.size() > 0) {
-    if (*std::max_element(selectedCols.begin(), selectedCols.end()) >= maxDim) {
-      throw sgpp::base::file_exception("readCSV invalid column selection");
-    }
-    dimension = selectedCols.size();
-  } else {
-    dimension = maxDim;
-  }
-  numberInstances = std::min(maxInst, instanceCutoff);
-  Dataset dataset(numberInstances, dimension);
-  std::string line;
-  size_t rowIndex = 0;
-  std::vector<double> rowEntries;
-  while (!stream.eof()) {
-    std::getline(stream, line);
-    if (skipFirstLine) {
-      skipFirstLine = false;
-      continue;
-    }
-    if (line.empty()) {
-      continue;
-    }
-    rowEntries = tokenizeLine(line);
-    // if we want a target, we remove it from line as we process it
-    if (hasTargets) {
-      double cl = rowEntries.back();
-      rowEntries.pop_back();  // removes last element from vector
-      // if no classes are specified, always accept the line
-      bool isSelectedClass = selectedTargets.size() == 0;
-      // TODO(sebastian): this float comp is probably implemented in SGPP
-      for (size_t i = 0; i < selectedTargets.size(); i++) {
-        isSelectedClass = isSelectedClass ||
-          (fabs(cl - selectedTargets.at(i)) < 0.001);
-      }
-      if (isSelectedClass) {
-        dataset.getTargets().set(rowIndex, cl);
-      } else {
-        // line has class which is not in selectedTargets
-        continue;
-      }
-    }
-    // We want all columns as dimensions
-    if (selectedCols.size() == 0) {
-      for (size_t i = 0; i < rowEntries.size(); i++) {
-        dataset.getData().set(rowIndex, i, rowEntries.at(i));
-      }
-    } else {
-      // only write dimensions specified in selectedCols
-      for (size_t i = 0; i < selectedCols.size(); i++) {
-        dataset.getData().set(rowIndex, i, rowEntries.at(selectedCols.at(i)));
-      }
-    }
-    rowIndex++;
-    if (rowIndex >= numberInstances) {
-      break;
-    }
-  }
-  return dataset;
+  return ParallelDataParser::parse(stream, ParallelDataParser::LineFilter::CSV, skipFirstLine,
+                                   hasTargets, instanceCutoff, selectedCols, selectedTargets);
 }
 
 void CSVTools::readCSVSize(std::istream& stream,
@@ -174,17 +109,6 @@ void CSVTools::readCSVSize(std::istream& stream,
   }
 }
 
-std::vector<double> CSVTools::tokenizeLine(const std::string& line) {
-  sgpp::base::StringTokenizer tokenizer;
-  std::vector<std::string> toks;
-  tokenizer.tokenize(line, ",", toks);
-  std::vector<double> vals;
-  for (size_t i = 0; i < toks.size(); i++) {
-    vals.push_back(atof(toks.at(i).c_str()));
-  }
-  return vals;
-}
-
 void CSVTools::writeMatrixToCSVFile(const std::string& path, sgpp::base::DataMatrix matrix) {
   std::cout << "Writing to file " + path + ".csv" << std::endl;
   std::ofstream output;
@@ -25,7 +25,8 @@ namespace datadriven {
 class CSVTools {
  public:
   /**
-   * Sequentially reads a CSV file.
+   * Reads a CSV file. The data is parsed in parallel chunks by
+   * #sgpp::datadriven::ParallelDataParser.
    *
    * @param stream constains the raw data. Note: After this function exists,
    *        stream will be at eof. For further use it should be cleared and 
@@ -109,12 +110,6 @@ class CSVTools {
    * Method to write the content of a matrix to a CSV File
    */
   static void writeMatrixToCSVFile(const std::string& path, sgpp::base::DataMatrix matrix);
-
- private:
-  /**
-   * Take a comma-sererated line and return its values as double values
-   */
-  static std::vector<double> tokenizeLine(const std::string& line);
 };
 
 }  // namespace datadriven
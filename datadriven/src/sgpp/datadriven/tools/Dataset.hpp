@@ -31,6 +31,14 @@ class Dataset {
    */
   Dataset(size_t numberInstances, size_t dimension);
 
+  /**
+   * Constructs a dataset by taking over already filled data and targets.
+   *
+   * @param data samples of the dataset, one instance per row
+   * @param targets targets of the dataset, has to have as many entries as data has rows
+   */
+  Dataset(sgpp::base::DataMatrix&& data, sgpp::base::DataVector&& targets);
+
   /**
    * @return number of instances in the dataset
    */
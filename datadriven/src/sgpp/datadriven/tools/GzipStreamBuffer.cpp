@@ -0,0 +1,245 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#ifdef ZLIB
+
+#include <sgpp/datadriven/tools/GzipStreamBuffer.hpp>
+
+#include <sgpp/base/exception/file_exception.hpp>
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+#include <zlib.h>
+
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace sgpp {
+namespace datadriven {
+
+namespace {
+
+inline size_t readLittleEndian(const unsigned char* position, size_t bytes) {
+  size_t value = 0;
+  for (size_t i = 0; i < bytes; ++i) {
+    value |= static_cast<size_t>(position[i]) << (8 * i);
+  }
+  return value;
+}
+
+/**
+ * Inflates a complete gzip member into a buffer of exactly the expected size.
+ */
+bool inflateMember(const unsigned char* member, size_t memberSize, char* output,
+                   size_t outputSize) {
+  z_stream stream;
+  stream.zalloc = Z_NULL;
+  stream.zfree = Z_NULL;
+  stream.opaque = Z_NULL;
+  stream.next_in = const_cast<unsigned char*>(member);
+  stream.avail_in = static_cast<uInt>(memberSize);
+  // 16 + MAX_WBITS: expect a gzip wrapper
+  if (inflateInit2(&stream, 16 + MAX_WBITS) != Z_OK) {
+    return false;
+  }
+  char dummy;
+  stream.next_out = reinterpret_cast<unsigned char*>(outputSize > 0 ? output : &dummy);
+  stream.avail_out = static_cast<uInt>(outputSize > 0 ? outputSize : 1);
+  int result = inflate(&stream, Z_FINISH);
+  bool success = result == Z_STREAM_END && stream.total_out == outputSize;
+  inflateEnd(&stream);
+  return success;
+}
+
+}  // namespace
+
+GzipStreamBuffer::GzipStreamBuffer(const std::string& filename, size_t blockSize,
+                                   size_t queueDepth)
+    : filename(filename),
+      blockSize(blockSize),
+      queueDepth(queueDepth > 0 ? queueDepth : 1),
+      file(new MemoryMappedFile(filename)),
+      finished(false),
+      cancelled(false) {
+  if (!indexMembers()) {
+    members.clear();
+    file.reset();
+  }
+
+  producer = std::thread([this]() {
+    try {
+      if (file != nullptr) {
+        decompressMembers();
+      } else {
+        decompressSequential();
+      }
+    } catch (...) {
+      std::lock_guard<std::mutex> lock(queueMutex);
+      error = std::current_exception();
+    }
+    std::lock_guard<std::mutex> lock(queueMutex);
+    finished = true;
+    queueNotEmpty.notify_all();
+  });
+}
+
+GzipStreamBuffer::~GzipStreamBuffer() {
+  {
+    std::lock_guard<std::mutex> lock(queueMutex);
+    cancelled = true;
+  }
+  queueNotFull.notify_all();
+  if (producer.joinable()) {
+    producer.join();
+  }
+}
+
+bool GzipStreamBuffer::isBlockParallel() const { return file != nullptr; }
+
+GzipStreamBuffer::int_type GzipStreamBuffer::underflow() {
+  if (gptr() < egptr()) {
+    return traits_type::to_int_type(*gptr());
+  }
+  if (!pop(current)) {
+    return traits_type::eof();
+  }
+  setg(&current[0], &current[0], &current[0] + current.size());
+  return traits_type::to_int_type(*gptr());
+}
+
+bool GzipStreamBuffer::push(std::string&& block) {
+  std::unique_lock<std::mutex> lock(queueMutex);
+  queueNotFull.wait(lock, [this]() { return cancelled || queue.size() < queueDepth; });
+  if (cancelled) {
+    return false;
+  }
+  queue.push_back(std::move(block));
+  queueNotEmpty.notify_one();
+  return true;
+}
+
+bool GzipStreamBuffer::pop(std::string& block) {
+  std::unique_lock<std::mutex> lock(queueMutex);
+  // empty blocks are never queued, so a non-empty queue always provides data
+  queueNotEmpty.wait(lock, [this]() { return finished || !queue.empty(); });
+  if (!queue.empty()) {
+    block = std::move(queue.front());
+    queue.pop_front();
+    queueNotFull.notify_one();
+    return true;
+  }
+  if (error) {
+    std::rethrow_exception(error);
+  }
+  return false;
+}
+
+void GzipStreamBuffer::decompressSequential() {
+  gzFile inFileZ = gzopen(filename.c_str(), "rb");
+  if (inFileZ == nullptr) {
+    throw base::file_exception("GzipStreamBuffer: failed to open gzip compressed file");
+  }
+  gzbuffer(inFileZ, 256 * 1024);
+
+  while (true) {
+    std::string block(blockSize, '\0');
+    int unzippedBytes = gzread(inFileZ, &block[0], static_cast<unsigned int>(blockSize));
+    if (unzippedBytes < 0) {
+      gzclose(inFileZ);
+      throw base::file_exception("GzipStreamBuffer: failed to decompress file");
+    }
+    if (unzippedBytes == 0) {
+      break;
+    }
+    block.resize(static_cast<size_t>(unzippedBytes));
+    if (!push(std::move(block))) {
+      break;
+    }
+  }
+  gzclose(inFileZ);
+}
+
+void GzipStreamBuffer::decompressMembers() {
+  const unsigned char* data = reinterpret_cast<const unsigned char*>(file->getData());
+
+  size_t batchBegin = 0;
+  while (batchBegin < members.size()) {
+    // collect members until the decompressed batch reaches the block size; the decompressed size
+    // of each member is stored in its last four bytes
+    std::vector<size_t> outputOffsets{0};
+    size_t batchEnd = batchBegin;
+    while (batchEnd < members.size() && outputOffsets.back() < blockSize) {
+      const auto& member = members[batchEnd];
+      outputOffsets.push_back(outputOffsets.back() +
+                              readLittleEndian(data + member.first + member.second - 4, 4));
+      ++batchEnd;
+    }
+
+    std::string block(outputOffsets.back(), '\0');
+    bool success = true;
+    const int numMembers = static_cast<int>(batchEnd - batchBegin);
+
+#pragma omp parallel for schedule(dynamic) reduction(&& : success)
+    for (int i = 0; i < numMembers; ++i) {
+      const auto& member = members[batchBegin + i];
+      success = success &&
+                inflateMember(data + member.first, member.second, &block[0] + outputOffsets[i],
+                              outputOffsets[i + 1] - outputOffsets[i]);
+    }
+
+    if (!success) {
+      throw base::file_exception("GzipStreamBuffer: failed to decompress gzip member");
+    }
+    if (!block.empty() && !push(std::move(block))) {
+      return;
+    }
+    batchBegin = batchEnd;
+  }
+}
+
+bool GzipStreamBuffer::indexMembers() {
+  const unsigned char* data = reinterpret_cast<const unsigned char*>(file->getData());
+  const size_t size = file->getSize();
+  const unsigned char flagExtra = 4;
+
+  size_t offset = 0;
+  while (offset < size) {
+    // fixed header (10 bytes), extra length (2 bytes), trailer (8 bytes)
+    if (size - offset < 20 || data[offset] != 0x1f || data[offset + 1] != 0x8b ||
+        data[offset + 2] != 8 || (data[offset + 3] & flagExtra) == 0) {
+      return false;
+    }
+    const size_t extraBegin = offset + 12;
+    const size_t extraEnd = extraBegin + readLittleEndian(data + offset + 10, 2);
+    if (extraEnd > size) {
+      return false;
+    }
+
+    size_t memberSize = 0;
+    for (size_t field = extraBegin; field + 4 <= extraEnd;) {
+      const size_t fieldLength = readLittleEndian(data + field + 2, 2);
+      if (data[field] == 'B' && data[field + 1] == 'C' && fieldLength == 2 &&
+          field + 6 <= extraEnd) {
+        memberSize = readLittleEndian(data + field + 4, 2) + 1;
+        break;
+      }
+      field += 4 + fieldLength;
+    }
+    if (memberSize == 0 || memberSize > size - offset || memberSize < extraEnd - offset + 8) {
+      return false;
+    }
+
+    members.push_back(std::make_pair(offset, memberSize));
+    offset += memberSize;
+  }
+  return members.size() > 1;
+}
+
+}  // namespace datadriven
+}  // namespace sgpp
+#endif
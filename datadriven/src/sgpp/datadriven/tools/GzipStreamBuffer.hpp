@@ -0,0 +1,165 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#ifdef ZLIB
+#pragma once
+
+#include <sgpp/globaldef.hpp>
+
+#include <sgpp/datadriven/tools/MemoryMappedFile.hpp>
+
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <streambuf>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace sgpp {
+namespace datadriven {
+
+/**
+ * Input stream buffer that decompresses a gzip file on a background thread.
+ *
+ * Decompressed data is handed to the consumer in blocks through a bounded queue, so parsing the
+ * data (e.g. by #sgpp::datadriven::ParallelDataParser) overlaps with decompression and at most
+ * queueDepth blocks of decompressed data are held in memory at any time.
+ *
+ * Archives consisting of several gzip members that carry their compressed size in a "BC" extra
+ * subfield (BGZF, as written by bgzip) are decompressed block-parallel with OpenMP. All other
+ * archives (including plain multi-member archives, whose member boundaries are only known after
+ * decoding) are inflated sequentially by the background thread.
+ *
+ * Errors during decompression are rethrown by the consuming stream, if its exception mask
+ * contains std::ios::badbit.
+ */
+class GzipStreamBuffer : public std::streambuf {
+ public:
+  /**
+   * Opens the file and starts decompressing in the background. Throws
+   * #sgpp::base::file_exception if the file can not be opened.
+   *
+   * @param filename path to the gzip compressed file
+   * @param blockSize size of the decompressed blocks in bytes for sequential decompression
+   * @param queueDepth maximal number of decompressed blocks waiting to be consumed
+   */
+  explicit GzipStreamBuffer(const std::string& filename, size_t blockSize = 4 * 1024 * 1024,
+                            size_t queueDepth = 8);
+
+  GzipStreamBuffer(const GzipStreamBuffer&) = delete;
+
+  GzipStreamBuffer& operator=(const GzipStreamBuffer&) = delete;
+
+  /**
+   * Stops the background thread, even if the data was not consumed completely.
+   */
+  ~GzipStreamBuffer() override;
+
+  /**
+   * @return whether the archive is decompressed block-parallel
+   */
+  bool isBlockParallel() const;
+
+ protected:
+  int_type underflow() override;
+
+ private:
+  /**
+   * Producer for arbitrary gzip files, inflates the file sequentially using gzread.
+   */
+  void decompressSequential();
+
+  /**
+   * Producer for archives with indexed members, inflates batches of members in parallel.
+   */
+  void decompressMembers();
+
+  /**
+   * Scans the member headers of the mapped file for BGZF block sizes.
+   * @return whether the whole file could be split into members this way
+   */
+  bool indexMembers();
+
+  /**
+   * Appends a decompressed block to the queue, waits while the queue is full.
+   * @param block the decompressed data
+   * @return false if the consumer has been destroyed in the meantime
+   */
+  bool push(std::string&& block);
+
+  /**
+   * Takes the next decompressed block from the queue, waits while the queue is empty.
+   * @param[out] block the decompressed data
+   * @return false if all data has been consumed
+   */
+  bool pop(std::string& block);
+
+  /**
+   * Path to the compressed file
+   */
+  std::string filename;
+
+  /**
+   * Size of the decompressed blocks for sequential decompression
+   */
+  size_t blockSize;
+
+  /**
+   * Maximal number of blocks in the queue
+   */
+  size_t queueDepth;
+
+  /**
+   * Mapped compressed file for block-parallel decompression
+   */
+  std::unique_ptr<MemoryMappedFile> file;
+
+  /**
+   * Offset and size of each gzip member in the mapped file
+   */
+  std::vector<std::pair<size_t, size_t>> members;
+
+  /**
+   * Decompressed blocks that have not been consumed yet
+   */
+  std::deque<std::string> queue;
+
+  /**
+   * Block that is currently consumed
+   */
+  std::string current;
+
+  std::mutex queueMutex;
+  std::condition_variable queueNotEmpty;
+  std::condition_variable queueNotFull;
+
+  /**
+   * Producer has finished (successfully or not)
+   */
+  bool finished;
+
+  /**
+   * Consumer is being destroyed
+   */
+  bool cancelled;
+
+  /**
+   * Error raised by the producer
+   */
+  std::exception_ptr error;
+
+  /**
+   * Background decompression thread
+   */
+  std::thread producer;
+};
+
+}  // namespace datadriven
+}  // namespace sgpp
+#endif
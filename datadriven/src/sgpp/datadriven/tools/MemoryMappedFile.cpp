@@ -0,0 +1,80 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#include <sgpp/datadriven/tools/MemoryMappedFile.hpp>
+
+#include <sgpp/base/exception/file_exception.hpp>
+
+#ifdef _WIN32
+#include <fstream>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#include <string>
+
+namespace sgpp {
+namespace datadriven {
+
+#ifdef _WIN32
+
+MemoryMappedFile::MemoryMappedFile(const std::string& filename) : data(nullptr), size(0) {
+  std::ifstream stream(filename, std::ios::binary | std::ios::ate);
+  if (!stream) {
+    throw base::file_exception("MemoryMappedFile: unable to open file");
+  }
+  size = static_cast<size_t>(stream.tellg());
+  buffer.resize(size);
+  stream.seekg(0, std::ios::beg);
+  if (!stream.read(buffer.data(), static_cast<std::streamsize>(size))) {
+    throw base::file_exception("MemoryMappedFile: unable to read file");
+  }
+  data = buffer.data();
+}
+
+MemoryMappedFile::~MemoryMappedFile() {}
+
+#else
+
+MemoryMappedFile::MemoryMappedFile(const std::string& filename) : data(nullptr), size(0) {
+  int fileDescriptor = open(filename.c_str(), O_RDONLY);
+  if (fileDescriptor < 0) {
+    throw base::file_exception("MemoryMappedFile: unable to open file");
+  }
+  struct stat status;
+  if (fstat(fileDescriptor, &status) != 0) {
+    close(fileDescriptor);
+    throw base::file_exception("MemoryMappedFile: unable to determine file size");
+  }
+  size = static_cast<size_t>(status.st_size);
+  if (size > 0) {
+    void* mapping = mmap(nullptr, size, PROT_READ, MAP_SHARED, fileDescriptor, 0);
+    if (mapping == MAP_FAILED) {
+      close(fileDescriptor);
+      throw base::file_exception("MemoryMappedFile: unable to map file");
+    }
+    data = static_cast<const char*>(mapping);
+  }
+  // the mapping stays valid after closing the descriptor
+  close(fileDescriptor);
+}
+
+MemoryMappedFile::~MemoryMappedFile() {
+  if (data != nullptr) {
+    munmap(const_cast<char*>(data), size);
+  }
+}
+
+#endif
+
+const char* MemoryMappedFile::getData() const { return data; }
+
+size_t MemoryMappedFile::getSize() const { return size; }
+
+}  // namespace datadriven
+}  // namespace sgpp
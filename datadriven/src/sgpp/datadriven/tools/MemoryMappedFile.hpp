@@ -0,0 +1,69 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#pragma once
+
+#include <sgpp/globaldef.hpp>
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+namespace sgpp {
+namespace datadriven {
+
+/**
+ * Read-only view of a whole file mapped into memory. On POSIX systems the file is mapped with
+ * mmap, so pages are only loaded on access and shared with the page cache. On other systems the
+ * file content is read into a buffer instead.
+ */
+class MemoryMappedFile {
+ public:
+  /**
+   * Maps the given file into memory. Throws #sgpp::base::file_exception if the file can not be
+   * opened or mapped.
+   *
+   * @param filename path to the file
+   */
+  explicit MemoryMappedFile(const std::string& filename);
+
+  MemoryMappedFile(const MemoryMappedFile&) = delete;
+
+  MemoryMappedFile& operator=(const MemoryMappedFile&) = delete;
+
+  /**
+   * Unmaps the file.
+   */
+  ~MemoryMappedFile();
+
+  /**
+   * @return pointer to the first byte of the file content
+   */
+  const char* getData() const;
+
+  /**
+   * @return size of the file in bytes
+   */
+  size_t getSize() const;
+
+ private:
+  /**
+   * Start of the mapped memory region
+   */
+  const char* data;
+
+  /**
+   * Size of the mapped file in bytes
+   */
+  size_t size;
+
+  /**
+   * Holds the file content on systems without mmap
+   */
+  std::vector<char> buffer;
+};
+
+}  // namespace datadriven
+}  // namespace sgpp
@@ -0,0 +1,405 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#include <sgpp/datadriven/tools/NearestNeighborIndex.hpp>
+
+#include <sgpp/base/exception/data_exception.hpp>
+#include <sgpp/base/exception/file_exception.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <fstream>
+#include <functional>
+#include <limits>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace sgpp {
+namespace datadriven {
+
+namespace {
+
+const char indexMagic[8] = {'S', 'G', 'P', 'P', 'K', 'N', 'N', '1'};
+
+/// subtrees with more datapoints are built in a separate task
+const size_t taskThreshold = 4096;
+
+template <typename T>
+void writeValue(std::ostream& stream, T value) {
+  stream.write(reinterpret_cast<const char*>(&value), sizeof(T));
+}
+
+template <typename T>
+bool readValue(std::istream& stream, T& value) {
+  stream.read(reinterpret_cast<char*>(&value), sizeof(T));
+  return static_cast<bool>(stream);
+}
+
+template <typename T>
+void writeVector(std::ostream& stream, const std::vector<T>& values) {
+  stream.write(reinterpret_cast<const char*>(values.data()),
+               static_cast<std::streamsize>(values.size() * sizeof(T)));
+}
+
+template <typename T>
+bool readVector(std::istream& stream, std::vector<T>& values, size_t size) {
+  values.resize(size);
+  stream.read(reinterpret_cast<char*>(values.data()),
+              static_cast<std::streamsize>(size * sizeof(T)));
+  return static_cast<bool>(stream);
+}
+
+inline double squaredDistance(const double* first, const double* second, size_t dims) {
+  double dist = 0.0;
+  for (size_t d = 0; d < dims; d++) {
+    double diff = first[d] - second[d];
+    dist += diff * diff;
+  }
+  return dist;
+}
+
+}  // namespace
+
+const size_t NearestNeighborIndex::NO_NEIGHBOR;
+
+NearestNeighborIndex::NearestNeighborIndex(const base::DataMatrix& dataset, size_t leafSize)
+    : dims(dataset.getNcols()),
+      leafSize(leafSize),
+      epsilon(0.0),
+      maxDistanceEvaluations(0),
+      permutation(dataset.getNrows()),
+      positions(dataset.getNrows()),
+      points(dataset.getPointer(), dataset.getPointer() + dataset.getSize()) {
+  if (leafSize == 0) {
+    throw base::data_exception("NearestNeighborIndex: leafSize has to be positive");
+  }
+  const size_t numPoints = dataset.getNrows();
+  for (size_t i = 0; i < numPoints; i++) {
+    permutation[i] = i;
+  }
+
+  // the shape of the tree only depends on the number of datapoints, so the nodes can be
+  // allocated upfront and the subtrees can be built concurrently
+  nodes.resize(countNodes(numPoints));
+  lower.resize(nodes.size() * dims);
+  upper.resize(nodes.size() * dims);
+#pragma omp parallel
+  {
+#pragma omp single
+    build(0, 0, numPoints);
+  }
+
+  // store the datapoints in tree order
+  std::vector<double> original;
+  original.swap(points);
+  points.resize(original.size());
+  for (size_t i = 0; i < numPoints; i++) {
+    positions[permutation[i]] = i;
+    std::copy(original.begin() + permutation[i] * dims,
+              original.begin() + (permutation[i] + 1) * dims, points.begin() + i * dims);
+  }
+}
+
+NearestNeighborIndex::NearestNeighborIndex(const std::string& fileName)
+    : dims(0), leafSize(0), epsilon(0.0), maxDistanceEvaluations(0) {
+  std::ifstream stream(fileName, std::ios::binary);
+  if (!stream) {
+    throw base::file_exception("NearestNeighborIndex: unable to open index file");
+  }
+
+  char magic[sizeof(indexMagic)];
+  stream.read(magic, sizeof(magic));
+  if (!stream || !std::equal(magic, magic + sizeof(magic), indexMagic)) {
+    throw base::file_exception("NearestNeighborIndex: not an index file");
+  }
+
+  uint64_t fileDims, numPoints, fileLeafSize, fileMaxEvaluations, numNodes;
+  if (!readValue(stream, fileDims) || !readValue(stream, numPoints) ||
+      !readValue(stream, fileLeafSize) || !readValue(stream, epsilon) ||
+      !readValue(stream, fileMaxEvaluations) || !readValue(stream, numNodes) ||
+      !readVector(stream, permutation, numPoints) ||
+      !readVector(stream, points, numPoints * fileDims) || !readVector(stream, nodes, numNodes) ||
+      !readVector(stream, lower, numNodes * fileDims) ||
+      !readVector(stream, upper, numNodes * fileDims)) {
+    throw base::file_exception("NearestNeighborIndex: index file is truncated");
+  }
+  dims = fileDims;
+  leafSize = fileLeafSize;
+  maxDistanceEvaluations = fileMaxEvaluations;
+
+  positions.resize(numPoints);
+  for (size_t i = 0; i < numPoints; i++) {
+    if (permutation[i] >= numPoints) {
+      throw base::file_exception("NearestNeighborIndex: index file is corrupt");
+    }
+    positions[permutation[i]] = i;
+  }
+}
+
+void NearestNeighborIndex::save(const std::string& fileName) const {
+  std::ofstream stream(fileName, std::ios::binary | std::ios::trunc);
+  if (!stream) {
+    throw base::file_exception("NearestNeighborIndex::save: unable to open index file");
+  }
+  stream.write(indexMagic, sizeof(indexMagic));
+  writeValue<uint64_t>(stream, dims);
+  writeValue<uint64_t>(stream, permutation.size());
+  writeValue<uint64_t>(stream, leafSize);
+  writeValue<double>(stream, epsilon);
+  writeValue<uint64_t>(stream, maxDistanceEvaluations);
+  writeValue<uint64_t>(stream, nodes.size());
+  writeVector(stream, permutation);
+  writeVector(stream, points);
+  writeVector(stream, nodes);
+  writeVector(stream, lower);
+  writeVector(stream, upper);
+  if (!stream) {
+    throw base::file_exception("NearestNeighborIndex::save: failed to write index file");
+  }
+}
+
+void NearestNeighborIndex::setApproximation(double epsilon) {
+  if (epsilon < 0.0) {
+    throw base::data_exception("NearestNeighborIndex: epsilon must not be negative");
+  }
+  this->epsilon = epsilon;
+}
+
+double NearestNeighborIndex::getApproximation() const { return epsilon; }
+
+void NearestNeighborIndex::setMaxDistanceEvaluations(size_t maxDistanceEvaluations) {
+  this->maxDistanceEvaluations = maxDistanceEvaluations;
+}
+
+size_t NearestNeighborIndex::getMaxDistanceEvaluations() const { return maxDistanceEvaluations; }
+
+size_t NearestNeighborIndex::getNumPoints() const { return permutation.size(); }
+
+size_t NearestNeighborIndex::getDimension() const { return dims; }
+
+size_t NearestNeighborIndex::countNodes(size_t numPointsInSubtree) const {
+  if (numPointsInSubtree <= leafSize) {
+    return 1;
+  }
+  return 1 + countNodes(numPointsInSubtree / 2) +
+         countNodes(numPointsInSubtree - numPointsInSubtree / 2);
+}
+
+void NearestNeighborIndex::build(size_t node, size_t begin, size_t end) {
+  const size_t count = end - begin;
+  double* nodeLower = lower.data() + node * dims;
+  double* nodeUpper = upper.data() + node * dims;
+  std::fill(nodeLower, nodeLower + dims, std::numeric_limits<double>::infinity());
+  std::fill(nodeUpper, nodeUpper + dims, -std::numeric_limits<double>::infinity());
+  for (size_t i = begin; i < end; i++) {
+    const double* point = &points[permutation[i] * dims];
+    for (size_t d = 0; d < dims; d++) {
+      nodeLower[d] = std::min(nodeLower[d], point[d]);
+      nodeUpper[d] = std::max(nodeUpper[d], point[d]);
+    }
+  }
+  nodes[node] = Node{begin, end, 0, 0};
+  if (count <= leafSize) {
+    return;
+  }
+
+  // split at the median of the widest dimension
+  size_t splitDim = 0;
+  for (size_t d = 1; d < dims; d++) {
+    if (nodeUpper[d] - nodeLower[d] > nodeUpper[splitDim] - nodeLower[splitDim]) {
+      splitDim = d;
+    }
+  }
+  const size_t middle = begin + count / 2;
+  std::nth_element(permutation.begin() + begin, permutation.begin() + middle,
+                   permutation.begin() + end, [this, splitDim](size_t i, size_t j) {
+                     return points[i * dims + splitDim] < points[j * dims + splitDim];
+                   });
+
+  const size_t left = node + 1;
+  const size_t right = left + countNodes(count / 2);
+  nodes[node].left = left;
+  nodes[node].right = right;
+
+#pragma omp task if (count > taskThreshold)
+  build(left, begin, middle);
+  build(right, middle, end);
+}
+
+double NearestNeighborIndex::boxDistance(size_t node, const double* point) const {
+  const double* nodeLower = lower.data() + node * dims;
+  const double* nodeUpper = upper.data() + node * dims;
+  double dist = 0.0;
+  for (size_t d = 0; d < dims; d++) {
+    double diff = std::max(std::max(nodeLower[d] - point[d], point[d] - nodeUpper[d]), 0.0);
+    dist += diff * diff;
+  }
+  return dist;
+}
+
+void NearestNeighborIndex::search(const double* point, size_t exclude, size_t k, double epsilon,
+                                  size_t maxEvaluations, Workspace& workspace, size_t* neighbors,
+                                  double* distances) const {
+  std::vector<Candidate>& candidates = workspace.candidates;
+  std::vector<std::pair<double, size_t>>& queue = workspace.queue;
+  std::greater<std::pair<double, size_t>> queueOrder;
+  candidates.clear();
+  queue.clear();
+
+  // a node is skipped if its squared box distance times this factor exceeds the squared distance
+  // of the k-th candidate
+  const double boundFactor = (1.0 + epsilon) * (1.0 + epsilon);
+  auto isPruned = [&](double dist) {
+    return candidates.size() == k && boundFactor * dist > candidates.front().first;
+  };
+
+  size_t evaluations = 0;
+  if (k > 0 && !nodes.empty()) {
+    queue.emplace_back(boxDistance(0, point), 0);
+  }
+  while (!queue.empty()) {
+    std::pop_heap(queue.begin(), queue.end(), queueOrder);
+    const double dist = queue.back().first;
+    const Node& current = nodes[queue.back().second];
+    queue.pop_back();
+    if (isPruned(dist)) {
+      // all remaining nodes are at least as far away
+      break;
+    }
+    if (maxEvaluations > 0 && evaluations >= maxEvaluations) {
+      break;
+    }
+
+    if (current.left != 0) {
+      for (size_t child : {current.left, current.right}) {
+        double childDist = boxDistance(child, point);
+        if (!isPruned(childDist)) {
+          queue.emplace_back(childDist, child);
+          std::push_heap(queue.begin(), queue.end(), queueOrder);
+        }
+      }
+      continue;
+    }
+
+    for (size_t i = current.begin; i < current.end; i++) {
+      Candidate candidate(squaredDistance(point, &points[i * dims], dims), permutation[i]);
+      if (candidate.second == exclude) {
+        continue;
+      } else if (candidates.size() < k) {
+        candidates.push_back(candidate);
+        std::push_heap(candidates.begin(), candidates.end());
+      } else if (candidate < candidates.front()) {
+        std::pop_heap(candidates.begin(), candidates.end());
+        candidates.back() = candidate;
+        std::push_heap(candidates.begin(), candidates.end());
+      }
+    }
+    evaluations += current.end - current.begin;
+  }
+
+  std::sort_heap(candidates.begin(), candidates.end());
+  for (size_t i = 0; i < k; i++) {
+    if (i < candidates.size()) {
+      neighbors[i] = candidates[i].second;
+      distances[i] = std::sqrt(candidates[i].first);
+    } else {
+      neighbors[i] = NO_NEIGHBOR;
+      distances[i] = std::numeric_limits<double>::infinity();
+    }
+  }
+}
+
+void NearestNeighborIndex::query(const base::DataVector& point, size_t k,
+                                 std::vector<size_t>& neighbors,
+                                 std::vector<double>& distances) const {
+  if (point.getSize() != dims) {
+    throw base::data_exception("NearestNeighborIndex::query: dimension mismatch");
+  }
+  Workspace workspace;
+  neighbors.resize(k);
+  distances.resize(k);
+  search(point.getPointer(), NO_NEIGHBOR, k, epsilon, maxDistanceEvaluations, workspace,
+         neighbors.data(), distances.data());
+}
+
+void NearestNeighborIndex::query(const base::DataMatrix& points, size_t k,
+                                 std::vector<size_t>& neighbors,
+                                 base::DataMatrix& distances) const {
+  if (points.getNcols() != dims) {
+    throw base::data_exception("NearestNeighborIndex::query: dimension mismatch");
+  }
+  const size_t numQueries = points.getNrows();
+  neighbors.resize(numQueries * k);
+  distances.resize(numQueries, k);
+
+#pragma omp parallel
+  {
+    Workspace workspace;
+#pragma omp for schedule(dynamic, 64)
+    for (size_t i = 0; i < numQueries; i++) {
+      search(points.getPointer() + i * dims, NO_NEIGHBOR, k, epsilon, maxDistanceEvaluations,
+             workspace, &neighbors[i * k], distances.getPointer() + i * k);
+    }
+  }
+}
+
+void NearestNeighborIndex::queryDataset(size_t k, size_t first, size_t count,
+                                        std::vector<size_t>& neighbors,
+                                        base::DataMatrix& distances) const {
+  if (first + count > permutation.size()) {
+    throw base::data_exception("NearestNeighborIndex::queryDataset: range exceeds the dataset");
+  }
+  neighbors.resize(count * k);
+  distances.resize(count, k);
+
+#pragma omp parallel
+  {
+    Workspace workspace;
+#pragma omp for schedule(dynamic, 64)
+    for (size_t i = 0; i < count; i++) {
+      search(&points[positions[first + i] * dims], first + i, k, epsilon, maxDistanceEvaluations,
+             workspace, &neighbors[i * k], distances.getPointer() + i * k);
+    }
+  }
+}
+
+double NearestNeighborIndex::estimateRecall(size_t k, size_t numQueries) const {
+  const size_t numPoints = permutation.size();
+  numQueries = std::min(numQueries, numPoints);
+  if (k == 0 || numQueries == 0) {
+    return 1.0;
+  }
+
+  size_t found = 0;
+  size_t total = 0;
+#pragma omp parallel reduction(+ : found, total)
+  {
+    Workspace workspace;
+    std::vector<size_t> exact(k), approximated(k);
+    std::vector<double> distances(k);
+#pragma omp for schedule(dynamic)
+    for (size_t q = 0; q < numQueries; q++) {
+      const size_t index = q * numPoints / numQueries;
+      const double* point = &points[positions[index] * dims];
+      search(point, index, k, 0.0, 0, workspace, exact.data(), distances.data());
+      search(point, index, k, epsilon, maxDistanceEvaluations, workspace, approximated.data(),
+             distances.data());
+      std::sort(exact.begin(), exact.end());
+      std::sort(approximated.begin(), approximated.end());
+      for (size_t i = 0; i < k && exact[i] != NO_NEIGHBOR; i++) {
+        total++;
+        if (std::binary_search(approximated.begin(), approximated.end(), exact[i])) {
+          found++;
+        }
+      }
+    }
+  }
+  return total > 0 ? static_cast<double>(found) / static_cast<double>(total) : 1.0;
+}
+
+}  // namespace datadriven
+}  // namespace sgpp
@@ -0,0 +1,223 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#pragma once
+
+#include <sgpp/base/datatypes/DataMatrix.hpp>
+#include <sgpp/base/datatypes/DataVector.hpp>
+
+#include <sgpp/globaldef.hpp>
+
+#include <limits>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace sgpp {
+namespace datadriven {
+
+/**
+ * Index for k nearest neighbor queries (Euclidean distance) over the rows of a dataset.
+ *
+ * The index is a kd-tree: every inner node splits its datapoints at the median of the dimension
+ * with the largest extent and stores the bounding box of its datapoints, leaves keep their
+ * datapoints contiguously in memory. Queries visit the nodes best-first, i.e. in the order of the
+ * distance of the query point to their bounding boxes, and stop as soon as no remaining box can
+ * contain a closer datapoint than the current k-th neighbor.
+ *
+ * By default the queries are exact. The recall can be traded for speed in two ways:
+ * - #setApproximation(epsilon) skips a node if it can not contain a datapoint that is closer than
+ *   the current k-th neighbor divided by (1 + epsilon), so every returned distance is at most
+ *   (1 + epsilon) times the exact one,
+ * - #setMaxDistanceEvaluations(n) stops each query after n distance evaluations.
+ * #estimateRecall measures the effect of these settings on a subset of the datapoints.
+ *
+ * The tree is built in parallel with OpenMP tasks, batch queries are distributed over the threads.
+ * Missing neighbors (if the dataset is too small) are marked with #NO_NEIGHBOR and an infinite
+ * distance.
+ */
+class NearestNeighborIndex {
+ public:
+  /// marks a missing neighbor
+  static const size_t NO_NEIGHBOR = std::numeric_limits<size_t>::max();
+
+  /**
+   * Constructor, builds the index
+   *
+   * @param dataset the datapoints (one per row), the index keeps a copy
+   * @param leafSize maximal number of datapoints in a leaf
+   */
+  explicit NearestNeighborIndex(const base::DataMatrix& dataset, size_t leafSize = 16);
+
+  /**
+   * Constructor, loads an index that was written with #save
+   *
+   * @param fileName path of the index file
+   */
+  explicit NearestNeighborIndex(const std::string& fileName);
+
+  /**
+   * Writes the index including the datapoints to a binary file (native byte order). Throws
+   * #sgpp::base::file_exception if the file can not be written.
+   *
+   * @param fileName path of the index file
+   */
+  void save(const std::string& fileName) const;
+
+  /**
+   * @param epsilon relative approximation of the neighbor distances, 0 for exact queries
+   */
+  void setApproximation(double epsilon);
+
+  /**
+   * @return relative approximation of the neighbor distances
+   */
+  double getApproximation() const;
+
+  /**
+   * @param maxDistanceEvaluations maximal number of distance evaluations per query, 0 for no limit
+   */
+  void setMaxDistanceEvaluations(size_t maxDistanceEvaluations);
+
+  /**
+   * @return maximal number of distance evaluations per query, 0 for no limit
+   */
+  size_t getMaxDistanceEvaluations() const;
+
+  /**
+   * @return number of datapoints in the index
+   */
+  size_t getNumPoints() const;
+
+  /**
+   * @return dimensionality of the datapoints
+   */
+  size_t getDimension() const;
+
+  /**
+   * Searches the k nearest neighbors of a single point
+   *
+   * @param point the query point
+   * @param k number of neighbors
+   * @param[out] neighbors indices of the neighbors, sorted by distance (k entries)
+   * @param[out] distances distances of the neighbors (k entries)
+   */
+  void query(const base::DataVector& point, size_t k, std::vector<size_t>& neighbors,
+             std::vector<double>& distances) const;
+
+  /**
+   * Searches the k nearest neighbors of a batch of points in parallel
+   *
+   * @param points the query points (one per row)
+   * @param k number of neighbors
+   * @param[out] neighbors indices of the neighbors, k entries per query point sorted by distance
+   * @param[out] distances distances of the neighbors (query points x k)
+   */
+  void query(const base::DataMatrix& points, size_t k, std::vector<size_t>& neighbors,
+             base::DataMatrix& distances) const;
+
+  /**
+   * Searches the k nearest neighbors of a range of the indexed datapoints in parallel, every
+   * datapoint is excluded from its own neighbors. This is the k nearest neighbor graph of the
+   * dataset.
+   *
+   * @param k number of neighbors
+   * @param first first datapoint
+   * @param count number of datapoints
+   * @param[out] neighbors indices of the neighbors, k entries per datapoint sorted by distance
+   * @param[out] distances distances of the neighbors (count x k)
+   */
+  void queryDataset(size_t k, size_t first, size_t count, std::vector<size_t>& neighbors,
+                    base::DataMatrix& distances) const;
+
+  /**
+   * Estimates the recall of the current approximation settings, i.e. the fraction of exact
+   * neighbors that are found, on evenly spaced datapoints of the index
+   *
+   * @param k number of neighbors
+   * @param numQueries number of datapoints used for the estimate
+   * @return estimated recall between 0 and 1
+   */
+  double estimateRecall(size_t k, size_t numQueries = 1000) const;
+
+ private:
+  /**
+   * Node of the tree, the datapoints of a node are a contiguous range in tree order
+   */
+  struct Node {
+    size_t begin;
+    size_t end;
+    /// children, 0 for leaves
+    size_t left;
+    size_t right;
+  };
+
+  /// candidate neighbor (squared distance, index), the search keeps a max-heap of them
+  typedef std::pair<double, size_t> Candidate;
+
+  /**
+   * Thread local buffers of a search
+   */
+  struct Workspace {
+    /// max-heap of the best candidates
+    std::vector<Candidate> candidates;
+    /// min-heap of the nodes to visit (squared box distance, node)
+    std::vector<std::pair<double, size_t>> queue;
+  };
+
+  /**
+   * @return number of nodes of a subtree with the given number of datapoints
+   */
+  size_t countNodes(size_t numPointsInSubtree) const;
+
+  /**
+   * Builds the subtree of the given node and datapoints (tree order)
+   */
+  void build(size_t node, size_t begin, size_t end);
+
+  /**
+   * Squared distance between a point and the bounding box of a node
+   */
+  double boxDistance(size_t node, const double* point) const;
+
+  /**
+   * Searches the k nearest neighbors of a point
+   *
+   * @param point the query point
+   * @param exclude index of a datapoint that is skipped, #NO_NEIGHBOR for none
+   * @param k number of neighbors
+   * @param epsilon relative approximation
+   * @param maxEvaluations maximal number of distance evaluations, 0 for no limit
+   * @param workspace buffers of the calling thread
+   * @param[out] neighbors k entries
+   * @param[out] distances k entries
+   */
+  void search(const double* point, size_t exclude, size_t k, double epsilon,
+              size_t maxEvaluations, Workspace& workspace, size_t* neighbors,
+              double* distances) const;
+
+  /// dimensionality of the datapoints
+  size_t dims;
+  /// maximal number of datapoints in a leaf
+  size_t leafSize;
+  /// relative approximation of the neighbor distances
+  double epsilon;
+  /// maximal number of distance evaluations per query
+  size_t maxDistanceEvaluations;
+  /// original index of the datapoints in tree order
+  std::vector<size_t> permutation;
+  /// position of the datapoints in tree order
+  std::vector<size_t> positions;
+  /// datapoints in tree order (row-major)
+  std::vector<double> points;
+  /// nodes of the tree, the root is the first one
+  std::vector<Node> nodes;
+  /// bounding boxes of the nodes (nodes x dims)
+  std::vector<double> lower;
+  std::vector<double> upper;
+};
+
+}  // namespace datadriven
+}  // namespace sgpp
@@ -0,0 +1,363 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#include <sgpp/datadriven/tools/ParallelDataParser.hpp>
+
+#include <sgpp/base/datatypes/DataMatrix.hpp>
+#include <sgpp/base/datatypes/DataVector.hpp>
+#include <sgpp/base/exception/file_exception.hpp>
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace sgpp {
+namespace datadriven {
+
+const size_t ParallelDataParser::blockSize = 64 * 1024 * 1024;
+const size_t ParallelDataParser::minChunkSize = 1024 * 1024;
+
+namespace {
+
+const double powersOfTen[] = {1e0,  1e1,  1e2,  1e3,  1e4,  1e5,  1e6,  1e7,
+                              1e8,  1e9,  1e10, 1e11, 1e12, 1e13, 1e14, 1e15,
+                              1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22};
+
+inline bool isSpace(char c) { return c == ' ' || c == '\t' || c == '\r' || c == '\n'; }
+
+inline bool isDigit(char c) { return c >= '0' && c <= '9'; }
+
+/**
+ * Extracts the line starting at pos (without the line break and a trailing carriage return) and
+ * moves pos behind its line break.
+ */
+inline void nextLine(const char*& pos, const char* end, const char*& lineBegin,
+                     const char*& lineEnd) {
+  lineBegin = pos;
+  const char* lineBreak =
+      static_cast<const char*>(std::memchr(pos, '\n', static_cast<size_t>(end - pos)));
+  if (lineBreak == nullptr) {
+    lineEnd = end;
+    pos = end;
+  } else {
+    lineEnd = lineBreak;
+    pos = lineBreak + 1;
+  }
+  if (lineEnd > lineBegin && *(lineEnd - 1) == '\r') {
+    --lineEnd;
+  }
+}
+
+inline bool isDataLine(ParallelDataParser::LineFilter filter, const char* lineBegin,
+                       const char* lineEnd) {
+  if (lineBegin == lineEnd) {
+    return false;
+  }
+  if (filter == ParallelDataParser::LineFilter::ARFF) {
+    for (const char* c = lineBegin; c < lineEnd; ++c) {
+      if (*c == '%' || *c == '@') {
+        return false;
+      }
+    }
+  }
+  return true;
+}
+
+inline size_t countColumns(const char* lineBegin, const char* lineEnd) {
+  return static_cast<size_t>(std::count(lineBegin, lineEnd, ',')) + 1;
+}
+
+inline bool isSelectedTarget(double target, const std::vector<double>& selectedTargets) {
+  if (selectedTargets.empty()) {
+    return true;
+  }
+  for (double selected : selectedTargets) {
+    // same float comparison as used by CSVTools and ARFFTools
+    if (std::fabs(target - selected) < 0.001) {
+      return true;
+    }
+  }
+  return false;
+}
+
+inline double parseLastField(const char* lineBegin, const char* lineEnd) {
+  const char* fieldBegin = lineEnd;
+  while (fieldBegin > lineBegin && *(fieldBegin - 1) != ',') {
+    --fieldBegin;
+  }
+  return ParallelDataParser::parseDouble(fieldBegin, lineEnd);
+}
+
+}  // namespace
+
+double ParallelDataParser::parseDouble(const char* first, const char* last) {
+  while (first < last && isSpace(*first)) {
+    ++first;
+  }
+  while (last > first && isSpace(*(last - 1))) {
+    --last;
+  }
+
+  const char* pos = first;
+  bool negative = false;
+  if (pos < last && (*pos == '-' || *pos == '+')) {
+    negative = *pos == '-';
+    ++pos;
+  }
+
+  uint64_t mantissa = 0;
+  int significantDigits = 0;
+  int exponent = 0;
+  bool hasDigits = false;
+
+  for (; pos < last && isDigit(*pos); ++pos) {
+    hasDigits = true;
+    mantissa = mantissa * 10 + static_cast<uint64_t>(*pos - '0');
+    significantDigits += mantissa != 0 ? 1 : 0;
+  }
+  if (pos < last && *pos == '.') {
+    for (++pos; pos < last && isDigit(*pos); ++pos) {
+      hasDigits = true;
+      mantissa = mantissa * 10 + static_cast<uint64_t>(*pos - '0');
+      significantDigits += mantissa != 0 ? 1 : 0;
+      --exponent;
+    }
+  }
+
+  bool fastPath = hasDigits && significantDigits <= 18;
+
+  if (fastPath && pos < last && (*pos == 'e' || *pos == 'E')) {
+    ++pos;
+    bool negativeExponent = false;
+    if (pos < last && (*pos == '-' || *pos == '+')) {
+      negativeExponent = *pos == '-';
+      ++pos;
+    }
+    int explicitExponent = 0;
+    int exponentDigits = 0;
+    for (; pos < last && isDigit(*pos); ++pos) {
+      explicitExponent = explicitExponent * 10 + (*pos - '0');
+      ++exponentDigits;
+    }
+    fastPath = exponentDigits > 0 && exponentDigits <= 4;
+    exponent += negativeExponent ? -explicitExponent : explicitExponent;
+  }
+
+  // fast path: both mantissa and power of ten are exactly representable, so a single rounding
+  // yields the correctly rounded result
+  if (fastPath && pos == last) {
+    if (mantissa == 0) {
+      return negative ? -0.0 : 0.0;
+    }
+    if (mantissa <= (uint64_t(1) << 53) && exponent >= -22 && exponent <= 22) {
+      double value = static_cast<double>(mantissa);
+      value = exponent < 0 ? value / powersOfTen[-exponent] : value * powersOfTen[exponent];
+      return negative ? -value : value;
+    }
+  }
+
+  // slow path for everything else
+  std::string token(first, last);
+  return std::strtod(token.c_str(), nullptr);
+}
+
+Dataset ParallelDataParser::parse(std::istream& stream, LineFilter filter, bool skipFirstLine,
+                                  bool hasTargets, size_t instanceCutoff,
+                                  const std::vector<size_t>& selectedCols,
+                                  const std::vector<double>& selectedTargets) {
+  base::DataMatrix data(0, 0);
+  base::DataVector targets(0);
+
+  size_t numberColumns = 0;
+  size_t numberInstances = 0;
+
+#ifdef _OPENMP
+  const size_t maxChunks = 4 * static_cast<size_t>(omp_get_max_threads());
+#else
+  const size_t maxChunks = 1;
+#endif
+
+  std::string buffer;
+  bool endOfStream = false;
+
+  while (!endOfStream && numberInstances < instanceCutoff) {
+    // append the next block to the incomplete line left over from the last iteration
+    size_t previousSize = buffer.size();
+    buffer.resize(previousSize + blockSize);
+    stream.read(&buffer[previousSize], static_cast<std::streamsize>(blockSize));
+    buffer.resize(previousSize + static_cast<size_t>(stream.gcount()));
+    endOfStream = !stream;
+
+    const char* begin = buffer.data();
+    const char* end = begin + buffer.size();
+
+    // only process complete lines unless we are at the end of the stream
+    if (!endOfStream) {
+      const char* lastLineBreak = end;
+      while (lastLineBreak > begin && *(lastLineBreak - 1) != '\n') {
+        --lastLineBreak;
+      }
+      if (lastLineBreak == begin) {
+        // line is longer than a block, keep on reading
+        continue;
+      }
+      end = lastLineBreak;
+    }
+
+    const char* pos = begin;
+    const char* lineBegin;
+    const char* lineEnd;
+
+    if (skipFirstLine) {
+      nextLine(pos, end, lineBegin, lineEnd);
+      skipFirstLine = false;
+    }
+
+    // the first data line determines the layout of the data
+    if (numberColumns == 0) {
+      const char* search = pos;
+      while (search < end) {
+        nextLine(search, end, lineBegin, lineEnd);
+        if (isDataLine(filter, lineBegin, lineEnd)) {
+          numberColumns = countColumns(lineBegin, lineEnd);
+          break;
+        }
+      }
+      if (numberColumns != 0) {
+        size_t maxDim = hasTargets ? numberColumns - 1 : numberColumns;
+        size_t dimension = maxDim;
+        if (!selectedCols.empty()) {
+          if (*std::max_element(selectedCols.begin(), selectedCols.end()) >= maxDim) {
+            throw base::file_exception("ParallelDataParser: invalid column selection");
+          }
+          dimension = selectedCols.size();
+        }
+        data.resize(0, dimension);
+      }
+    }
+
+    if (numberColumns != 0 && pos < end) {
+      // split the block into chunks of whole lines
+      size_t numChunks =
+          std::max<size_t>(1, std::min(maxChunks, static_cast<size_t>(end - pos) / minChunkSize));
+      std::vector<const char*> bounds(numChunks + 1);
+      bounds[0] = pos;
+      bounds[numChunks] = end;
+      for (size_t k = 1; k < numChunks; ++k) {
+        const char* bound = std::max(bounds[k - 1], pos + (end - pos) * k / numChunks);
+        if (bound > bounds[k - 1] && *(bound - 1) != '\n') {
+          const char* lineBreak =
+              static_cast<const char*>(std::memchr(bound, '\n', static_cast<size_t>(end - bound)));
+          bound = lineBreak == nullptr ? end : lineBreak + 1;
+        }
+        bounds[k] = bound;
+      }
+
+      // first pass: count admissible instances and validate the number of columns
+      std::vector<size_t> chunkInstances(numChunks, 0);
+      std::vector<bool> chunkHasError(numChunks, false);
+
+#pragma omp parallel for schedule(dynamic)
+      for (size_t k = 0; k < numChunks; ++k) {
+        const char* chunkPos = bounds[k];
+        const char* first;
+        const char* last;
+        while (chunkPos < bounds[k + 1]) {
+          nextLine(chunkPos, bounds[k + 1], first, last);
+          if (!isDataLine(filter, first, last)) {
+            continue;
+          }
+          if (countColumns(first, last) != numberColumns) {
+            chunkHasError[k] = true;
+            break;
+          }
+          if (!hasTargets || selectedTargets.empty() ||
+              isSelectedTarget(parseLastField(first, last), selectedTargets)) {
+            ++chunkInstances[k];
+          }
+        }
+      }
+
+      std::vector<size_t> chunkOffsets(numChunks);
+      size_t totalInstances = numberInstances;
+      for (size_t k = 0; k < numChunks; ++k) {
+        chunkOffsets[k] = totalInstances;
+        totalInstances += chunkInstances[k];
+        if (chunkHasError[k]) {
+          // only complain about malformed lines that would actually be read
+          if (totalInstances < instanceCutoff) {
+            throw base::file_exception("ParallelDataParser: Columns missing in data line");
+          }
+          numChunks = k + 1;
+          break;
+        }
+      }
+      totalInstances = std::min(totalInstances, instanceCutoff);
+
+      data.resizeRows(totalInstances);
+      targets.resize(totalInstances);
+
+      // second pass: convert values to their final position
+#pragma omp parallel for schedule(dynamic)
+      for (size_t k = 0; k < numChunks; ++k) {
+        std::vector<double> values(numberColumns);
+        size_t row = chunkOffsets[k];
+        const char* chunkPos = bounds[k];
+        const char* first;
+        const char* last;
+        while (chunkPos < bounds[k + 1] && row < totalInstances) {
+          nextLine(chunkPos, bounds[k + 1], first, last);
+          if (!isDataLine(filter, first, last)) {
+            continue;
+          }
+          const char* fieldBegin = first;
+          for (size_t col = 0; col < numberColumns; ++col) {
+            const char* fieldEnd = static_cast<const char*>(
+                std::memchr(fieldBegin, ',', static_cast<size_t>(last - fieldBegin)));
+            if (fieldEnd == nullptr) {
+              fieldEnd = last;
+            }
+            values[col] = parseDouble(fieldBegin, fieldEnd);
+            fieldBegin = fieldEnd < last ? fieldEnd + 1 : last;
+          }
+          if (hasTargets) {
+            if (!isSelectedTarget(values[numberColumns - 1], selectedTargets)) {
+              continue;
+            }
+            targets[row] = values[numberColumns - 1];
+          }
+          if (selectedCols.empty()) {
+            std::copy(values.begin(), values.begin() + data.getNcols(),
+                      data.getPointer() + row * data.getNcols());
+          } else {
+            for (size_t i = 0; i < selectedCols.size(); ++i) {
+              data.set(row, i, values[selectedCols[i]]);
+            }
+          }
+          ++row;
+        }
+      }
+
+      numberInstances = totalInstances;
+    }
+
+    // keep the incomplete last line for the next block
+    buffer.erase(0, static_cast<size_t>(end - buffer.data()));
+  }
+
+  return Dataset(std::move(data), std::move(targets));
+}
+
+}  // namespace datadriven
+}  // namespace sgpp
@@ -0,0 +1,85 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#pragma once
+
+#include <sgpp/globaldef.hpp>
+
+#include <sgpp/datadriven/tools/Dataset.hpp>
+
+#include <istream>
+#include <string>
+#include <vector>
+
+namespace sgpp {
+namespace datadriven {
+
+/**
+ * Multithreaded parser for comma separated text data as used by CSV files and the data section
+ * of ARFF files.
+ *
+ * The input is consumed in large blocks. Each block is cut at line boundaries into chunks that are
+ * processed concurrently: a first pass counts (and validates) the admissible lines per chunk, a
+ * second pass converts the values directly into their final position in the resulting
+ * #sgpp::datadriven::Dataset. Hence no separate pass over the whole input is required to determine
+ * its size and the order of the instances is the same as in the input.
+ */
+class ParallelDataParser {
+ public:
+  /**
+   * Line filter rules that distinguish data lines from meta data.
+   */
+  enum class LineFilter {
+    /// every non-empty line is a data line
+    CSV,
+    /// lines containing '%' (comments) or '@' (header) are skipped
+    ARFF
+  };
+
+  /**
+   * Parses comma separated data from a stream. See #sgpp::datadriven::CSVTools::readCSV for a
+   * detailed description of the parameters.
+   *
+   * @param stream contains the raw data. After this function exits the stream will be at eof or
+   *        behind the last line that was needed to reach instanceCutoff
+   * @param filter rule which lines are skipped as meta data
+   * @param skipFirstLine whether to skip the first line of the input
+   * @param hasTargets whether the last column holds the targets
+   * @param instanceCutoff maximal number of instances to read
+   * @param selectedCols columns to use as dimensions, empty for all
+   * @param selectedTargets admissible targets, empty for all
+   * @return the parsed data
+   */
+  static Dataset parse(std::istream& stream, LineFilter filter, bool skipFirstLine,
+                       bool hasTargets, size_t instanceCutoff,
+                       const std::vector<size_t>& selectedCols,
+                       const std::vector<double>& selectedTargets);
+
+  /**
+   * Converts the decimal floating point representation in [first, last) to double. Surrounding
+   * whitespace is ignored. Numbers whose significand fits into 53 bits and whose decimal exponent
+   * is at most 22 in magnitude are converted exactly without calling into the C library,
+   * everything else (including nan and inf) falls back to strtod. Like atof, unparsable input
+   * yields 0.
+   *
+   * @param first pointer to the first character
+   * @param last pointer behind the last character
+   * @return the converted value
+   */
+  static double parseDouble(const char* first, const char* last);
+
+  /**
+   * Size of the blocks read from the stream in bytes
+   */
+  static const size_t blockSize;
+
+  /**
+   * Minimal size of a chunk of lines that is processed by a single thread in bytes
+   */
+  static const size_t minChunkSize;
+};
+
+}  // namespace datadriven
+}  // namespace sgpp
@@ -5,8 +5,75 @@
 
 #include <sgpp/datadriven/tools/PolynomialChaosExpansion.hpp>
 
+#include <sgpp/base/exception/algorithm_exception.hpp>
+#include <sgpp/base/exception/factory_exception.hpp>
+#include <sgpp/base/grid/type/NakBsplineExtendedGrid.hpp>
+#include <sgpp/base/operation/hash/common/basis/NakBsplineExtendedBasis.hpp>
+#include <sgpp/base/tools/GaussLegendreQuadRule1D.hpp>
+#include <sgpp/base/tools/sle/solver/Auto.hpp>
+#include <sgpp/base/tools/sle/system/CloneableSLE.hpp>
+
 namespace sgpp {
 namespace datadriven {
+
+namespace {
+
+/**
+ * Transposed hierarchisation system, used to compute the quadrature weights of the nodal basis
+ */
+class TransposedHierarchisationSLE : public base::CloneableSLE {
+ public:
+  explicit TransposedHierarchisationSLE(base::Grid& grid) : grid(grid), system(grid) {}
+
+  bool isMatrixEntryNonZero(size_t i, size_t j) override {
+    return system.isMatrixEntryNonZero(j, i);
+  }
+
+  double getMatrixEntry(size_t i, size_t j) override { return system.getMatrixEntry(j, i); }
+
+  size_t getDimension() const override { return system.getDimension(); }
+
+  void clone(std::unique_ptr<base::CloneableSLE>& clone) const override {
+    clone = std::unique_ptr<base::CloneableSLE>(new TransposedHierarchisationSLE(grid));
+  }
+
+ private:
+  base::Grid& grid;
+  base::HierarchisationSLE system;
+};
+
+/**
+ * Computes the hierarchical surpluses of the columns of values on the grid
+ */
+void hierarchise(base::Grid& grid, const base::DataMatrix& values, base::DataMatrix& surpluses) {
+  surpluses = values;
+  std::unique_ptr<base::OperationHierarchisation> opHierarchisation;
+  try {
+    opHierarchisation.reset(sgpp::op_factory::createOperationHierarchisation(grid));
+  } catch (base::factory_exception&) {
+    // there is no hierarchisation operation for this grid type, solve the system below
+  }
+
+  if (opHierarchisation) {
+    base::DataVector column(values.getNrows());
+    for (size_t j = 0; j < values.getNcols(); j++) {
+      values.getColumn(j, column);
+      opHierarchisation->doHierarchisation(column);
+      surpluses.setColumn(j, column);
+    }
+    return;
+  }
+
+  base::HierarchisationSLE hierSLE(grid);
+  sgpp::base::sle_solver::Auto sleSolver;
+  base::DataMatrix b(values);
+  if (!sleSolver.solve(hierSLE, b, surpluses)) {
+    throw base::algorithm_exception("PolynomialChaosExpansion: hierarchisation failed");
+  }
+}
+
+}  // namespace
+
 PolynomialChaosExpansion::PolynomialChaosExpansion(std::function<double(const base::DataVector&)> f,
                                                    int order,
                                                    sgpp::base::DistributionsVector distributions)
@@ -114,110 +181,79 @@ PolynomialChaosExpansion::PolynomialChaosExpansion(std::function<double(const ba
         return (std::tgamma(j + this->alpha[i] + 1.0) /
                 (std::tgamma(j + 1.0) * std::tgamma(this->alpha[i] + 1.0)));
       }}};
-  this->evals = std::vector<std::function<double(double, double, size_t)>>{
-      {[this](int n, double x, size_t i) { return evalHermite(n, x); }},
-      {[this](int n, double x, size_t i) { return evalJacobi(n, x, i); }},
-      {[this](int n, double x, size_t i) { return evalLegendre(n, x); }},
-      {[this](int n, double x, size_t i) { return evalLaguerre(n, x); }},
-      {[this](int n, double x, size_t i) { return evalGenLaguerre(n, x, i); }}};
-}
-
-PolynomialChaosExpansion::~PolynomialChaosExpansion() {}
 
-double PolynomialChaosExpansion::evalLegendre(int n, double x) {
-  if (n == 0) {
-    return 1.0;
-  } else if (n == 1) {
-    return x;
-  } else {
-    double next = 0.0;
-    double last = 1.0;
-    double curr = x;
-    for (double i = 1.0; i < n; ++i) {
-      next = ((2.0 * i + 1.0) / (i + 1.0)) * x * curr - (i / (i + 1.0)) * last;
-      last = curr;
-      curr = next;
-    }
-    return next;
-  }
-}
-
-double PolynomialChaosExpansion::evalHermite(int n, double x) {
-  if (n == 0) {
-    return 1.0;
-  } else if (n == 1) {
-    return x;
-  } else {
-    double next = 0.0;
-    double last = 1.0;
-    double curr = x;
-    for (int i = 1.0; i < n; ++i) {
-      next = x * curr - i * last;
-      last = curr;
-      curr = next;
-    }
-    return next;
-  }
-}
-
-double PolynomialChaosExpansion::evalLaguerre(int n, double x) {
-  if (n == 0) {
-    return 1.0;
-  } else if (n == 1) {
-    return 1.0 - x;
-  } else {
-    double next = 0.0;
-    double last = 1.0;
-    double curr = 1.0 - x;
-    for (double i = 1.0; i < n; ++i) {
-      next = ((2.0 * i + 1.0 - x) * curr - i * last) / (i + 1.0);
-      last = curr;
-      curr = next;
+  // three-term recurrences, P_1 = a_0 x + b_0
+  recurrences.resize(types.size());
+  for (std::vector<distributionType>::size_type i = 0; i < types.size(); ++i) {
+    Recurrence& rec = recurrences[i];
+    rec.a.resize(std::max(order, 0));
+    rec.b.resize(rec.a.size());
+    rec.c.resize(rec.a.size());
+    for (size_t j = 0; j < rec.a.size(); ++j) {
+      const double n = static_cast<double>(j);
+      if (types[i] == distributionType::Normal) {
+        // Hermite
+        rec.a[j] = 1.0;
+        rec.b[j] = 0.0;
+        rec.c[j] = n;
+      } else if (types[i] == distributionType::Uniform) {
+        // Legendre
+        rec.a[j] = (2.0 * n + 1.0) / (n + 1.0);
+        rec.b[j] = 0.0;
+        rec.c[j] = n / (n + 1.0);
+      } else if (types[i] == distributionType::Exponential) {
+        // Laguerre
+        rec.a[j] = -1.0 / (n + 1.0);
+        rec.b[j] = (2.0 * n + 1.0) / (n + 1.0);
+        rec.c[j] = n / (n + 1.0);
+      } else if (types[i] == distributionType::Gamma) {
+        // generalized Laguerre
+        rec.a[j] = -1.0 / (n + 1.0);
+        rec.b[j] = (2.0 * n + 1.0 + alpha[i]) / (n + 1.0);
+        rec.c[j] = (n + alpha[i]) / (n + 1.0);
+      } else if (types[i] == distributionType::Beta) {
+        // Jacobi
+        const double a = alpha[i], b = beta[i];
+        if (j == 0) {
+          rec.a[j] = (a + b + 2.0) / 2.0;
+          rec.b[j] = (a - b) / 2.0;
+          rec.c[j] = 0.0;
+        } else {
+          const double m = n + 1.0;
+          const double denom = 2.0 * m * (m + a + b) * (2.0 * m + a + b - 2.0);
+          rec.a[j] = (2.0 * m + a + b - 1.0) * (2.0 * m + a + b) * (2.0 * m + a + b - 2.0) / denom;
+          rec.b[j] = (2.0 * m + a + b - 1.0) * (a * a - b * b) / denom;
+          rec.c[j] = 2.0 * (m + a - 1.0) * (m + b - 1.0) * (2.0 * m + a + b) / denom;
+        }
+      }
     }
-    return next;
   }
+  index = multiIndex(static_cast<int>(types.size()), order);
 }
 
-double PolynomialChaosExpansion::evalJacobi(int n, double x, size_t i) {
-  if (n == 0) {
-    return 1.0;
-  } else if (n == 1) {
-    return (alpha[i] + 1.0) + (alpha[i] + beta[i] + 2.0) * ((x - 1.0) / 2.0);
-  } else {
-    double next = 0.0;
-    double last = 1.0;
-    double curr = (alpha[i] + 1.0) + (alpha[i] + beta[i] + 2.0) * ((x - 1.0) / 2.0);
-    for (size_t i = 2; i <= static_cast<size_t>(n); ++i) {
-      double q1 = ((2.0 * static_cast<double>(i) + alpha[i] + beta[i] - 1.0) *
-                   ((2.0 * static_cast<double>(i) + alpha[i] + beta[i]) * (2.0 * static_cast<double>(i) + alpha[i] + beta[i] - 2.0) * x +
-                    std::pow(alpha[i], 2) - std::pow(beta[i], 2))) /
-                  (2.0 * static_cast<double>(i) * (static_cast<double>(i) + alpha[i] + beta[i]) * (2.0 * static_cast<double>(i) + alpha[i] + beta[i] - 2.0));
-      double q2 =
-          (2.0 * (static_cast<double>(i) + alpha[i] - 1.0) * (static_cast<double>(i) + beta[i] - 1.0) * (2.0 * static_cast<double>(i) + alpha[i] + beta[i])) /
-          (2.0 * static_cast<double>(i) * (static_cast<double>(i) + alpha[i] + beta[i]) * (2.0 * static_cast<double>(i) + alpha[i] + beta[i] - 2.0));
-      next = q1 * curr - q2 * last;
-      last = curr;
-      curr = next;
-    }
-    return next;
-  }
-}
+PolynomialChaosExpansion::~PolynomialChaosExpansion() {}
 
-double PolynomialChaosExpansion::evalGenLaguerre(int n, double x, size_t i) {
-  if (n == 0) {
-    return 1.0;
-  } else if (n == 1) {
-    return 1.0 + alpha[i] - x;
-  } else {
-    double next = 0.0;
-    double last = 1.0;
-    double curr = 1.0 + alpha[i] - x;
-    for (size_t i = 1; i < static_cast<size_t>(n); ++i) {
-      next = ((2.0 * static_cast<double>(i) + 1.0 + alpha[i] - x) * curr - (static_cast<double>(i) + alpha[i]) * last) / (static_cast<double>(i) + 1.0);
-      last = curr;
-      curr = next;
+void PolynomialChaosExpansion::evalPolynomials(size_t dim, const double* x, size_t numPoints,
+                                               double* values) const {
+  const Recurrence& rec = recurrences[dim];
+  double* last = values;
+  std::fill(last, last + numPoints, 1.0);
+  for (size_t j = 0; j < rec.a.size(); ++j) {
+    double* curr = values + j * numPoints;
+    double* next = curr + numPoints;
+    const double a = rec.a[j], b = rec.b[j], c = rec.c[j];
+    if (j == 0) {
+#pragma omp simd
+      for (size_t p = 0; p < numPoints; ++p) {
+        next[p] = (a * x[p] + b) * curr[p];
+      }
+    } else {
+#pragma omp simd
+      for (size_t p = 0; p < numPoints; ++p) {
+        next[p] = (a * x[p] + b) * curr[p] - c * last[p];
+      }
     }
-    return next;
+    last = curr;
   }
 }
 
@@ -382,34 +418,196 @@ std::vector<std::vector<int>> PolynomialChaosExpansion::multiIndex(int dimension
 
   return index;
 }
-base::DataVector PolynomialChaosExpansion::calculateCoefficients(int n, bool use_adaptive) {
-  auto index = multiIndex(static_cast<int>(types.size()), order);
-  base::DataVector result(index.size());
-  // calculate aj for each entry in the multiIndex
-  for (std::vector<std::vector<int>>::size_type j = 0; j < index.size(); ++j) {
-    auto numfunc = [this, &index, &j](const base::DataVector& vec) {
-      double prd = 1;
-      for (base::DataVector::size_type i = 0; i < vec.getSize(); ++i) {
-        prd *= evals[static_cast<int>(types[i])](index[j][i], vec[i], i);
+void PolynomialChaosExpansion::sampleFunction(int n, bool use_adaptive, base::DataMatrix& nodes,
+                                              base::DataVector& values,
+                                              base::DataVector& quadWeights) {
+  const size_t dim = types.size();
+  const size_t degree = 3;
+  std::unique_ptr<sgpp::base::Grid> grid(
+      sgpp::base::Grid::createNakBsplineExtendedGrid(dim, degree));
+  sgpp::base::GridStorage& gridStorage = grid->getStorage();
+
+  // evaluates the function at the grid points [first, size) in parallel
+  auto evalFunction = [this, &gridStorage, &nodes, &values, dim](size_t first) {
+    const size_t size = gridStorage.getSize();
+    nodes.resizeRowsCols(size, dim);
+    values.resize(size);
+#pragma omp parallel
+    {
+      base::DataVector p(dim);
+#pragma omp for schedule(dynamic)
+      for (size_t i = first; i < size; i++) {
+        for (size_t j = 0; j < dim; ++j) {
+          p[j] = gridStorage.getPoint(i).getStandardCoordinate(j) *
+                     (ranges[j].second - ranges[j].first) +
+                 ranges[j].first;
+          nodes.set(i, j, p[j]);
+        }
+        values[i] = func(p);
+      }
+    }
+  };
+
+  if (!use_adaptive) {
+    int level = 0;
+    while (gridStorage.getSize() < static_cast<size_t>(n)) {
+      gridStorage.clear();
+      grid->getGenerator().regular(level);
+      ++level;
+    }
+    evalFunction(0);
+  } else {
+    // the grid is refined according to the surpluses of all (normalized) integrands, so the same
+    // samples serve all coefficients
+    grid->getGenerator().regular(2);
+    evalFunction(0);
+    base::DataMatrix integrands;
+    base::DataMatrix surpluses;
+    while (gridStorage.getSize() < static_cast<size_t>(n)) {
+      evalIntegrands(nodes, values, integrands);
+      hierarchise(*grid, integrands, surpluses);
+      base::DataVector indicator(surpluses.getNrows(), 0.0);
+      for (size_t i = 0; i < surpluses.getNrows(); i++) {
+        for (size_t j = 0; j < surpluses.getNcols(); j++) {
+          indicator[i] += surpluses.get(i, j) * surpluses.get(i, j);
+        }
+        indicator[i] = std::sqrt(indicator[i]);
+      }
+      base::SurplusRefinementFunctor functor(indicator, 10);
+      const size_t oldSize = gridStorage.getSize();
+      grid->getGenerator().refine(functor);
+      if (gridStorage.getSize() == oldSize) {
+        break;
+      }
+      evalFunction(oldSize);
+    }
+  }
+
+  // weighted integrals of the basis functions, the 1D integrals are shared by many grid points
+  const size_t quadOrder = 100;
+  auto quadCoordinates = std::make_shared<base::DataVector>();
+  auto quadRuleWeights = std::make_shared<base::DataVector>();
+  base::GaussLegendreQuadRule1D gauss;
+  gauss.getLevelPointsAndWeightsNormalized(quadOrder, *quadCoordinates, *quadRuleWeights);
+
+  const size_t size = gridStorage.getSize();
+  std::vector<std::map<std::pair<base::level_t, base::index_t>, double>> means(dim);
+  for (size_t i = 0; i < size; i++) {
+    for (size_t j = 0; j < dim; ++j) {
+      means[j][std::make_pair(gridStorage.getPointLevel(i, j), gridStorage.getPointIndex(i, j))] =
+          0.0;
+    }
+  }
+  for (size_t j = 0; j < dim; ++j) {
+    std::vector<std::map<std::pair<base::level_t, base::index_t>, double>::iterator> entries;
+    for (auto it = means[j].begin(); it != means[j].end(); ++it) {
+      entries.push_back(it);
+    }
+#pragma omp parallel
+    {
+      base::SNakBsplineExtendedBase basis(degree);
+#pragma omp for schedule(dynamic)
+      for (size_t k = 0; k < entries.size(); k++) {
+        entries[k]->second = basis.getMean(entries[k]->first.first, entries[k]->first.second,
+                                           standardvec.get(j), quadCoordinates, quadRuleWeights);
       }
-      return prd;
-    };
-    auto intfunc = [this, &numfunc](const base::DataVector& vec) {
-      return numfunc(vec) * func(vec);
-    };
-    double num = 1;
-    if (!use_adaptive) {
-      num = sparseGridQuadrature(intfunc, static_cast<int>(types.size()), n, 100);
-    } else if (use_adaptive) {
-      num = adaptiveQuadratureWeighted(intfunc, static_cast<int>(types.size()), n, 100);
     }
-    // calculate denominator
+  }
+  base::DataVector basisIntegrals(size, 1.0);
+  for (size_t i = 0; i < size; i++) {
+    for (size_t j = 0; j < dim; ++j) {
+      basisIntegrals[i] *= means[j][std::make_pair(gridStorage.getPointLevel(i, j),
+                                                   gridStorage.getPointIndex(i, j))];
+    }
+  }
+
+  // the quadrature of the interpolant is basisIntegrals^T H^{-1} values with the hierarchisation
+  // matrix H, so the weights of the samples solve H^T w = basisIntegrals
+  TransposedHierarchisationSLE transposedSLE(*grid);
+  sgpp::base::sle_solver::Auto sleSolver;
+  if (!sleSolver.solve(transposedSLE, basisIntegrals, quadWeights)) {
+    throw base::algorithm_exception("PolynomialChaosExpansion: computing the weights failed");
+  }
+}
+
+void PolynomialChaosExpansion::evalPolynomials(
+    const base::DataMatrix& nodes, std::vector<std::vector<double>>& polynomials) const {
+  const size_t numNodes = nodes.getNrows();
+  const size_t numDegrees = static_cast<size_t>(std::max(order, 0)) + 1;
+  polynomials.resize(types.size());
+  base::DataVector coordinates(numNodes);
+  for (std::vector<distributionType>::size_type i = 0; i < types.size(); ++i) {
+    nodes.getColumn(i, coordinates);
+    polynomials[i].resize(numDegrees * numNodes);
+    evalPolynomials(i, coordinates.getPointer(), numNodes, polynomials[i].data());
+  }
+}
+
+void PolynomialChaosExpansion::evalIntegrands(const base::DataMatrix& nodes,
+                                              const base::DataVector& values,
+                                              base::DataMatrix& integrands) const {
+  const size_t numNodes = nodes.getNrows();
+  std::vector<std::vector<double>> polynomials;
+  evalPolynomials(nodes, polynomials);
+
+  integrands.resizeRowsCols(numNodes, index.size());
+#pragma omp parallel for schedule(dynamic)
+  for (size_t j = 0; j < index.size(); ++j) {
     double denom = 1.0;
     for (std::vector<distributionType>::size_type i = 0; i < types.size(); ++i) {
       denom *= denoms[static_cast<int>(types[i])](index[j][i], i);
     }
-    double aj = num / denom;
-    result[j] = aj;
+    const double scale = 1.0 / std::sqrt(denom);
+    for (size_t p = 0; p < numNodes; ++p) {
+      double prod = values[p] * scale;
+      for (std::vector<distributionType>::size_type i = 0; i < types.size(); ++i) {
+        prod *= polynomials[i][static_cast<size_t>(index[j][i]) * numNodes + p];
+      }
+      integrands.set(p, j, prod);
+    }
+  }
+}
+
+base::DataVector PolynomialChaosExpansion::calculateCoefficients(int n, bool use_adaptive) {
+  base::DataMatrix nodes;
+  base::DataVector values;
+  base::DataVector quadWeights;
+  sampleFunction(n, use_adaptive, nodes, values, quadWeights);
+  const size_t numNodes = nodes.getNrows();
+
+  // polynomials of all degrees at all nodes
+  std::vector<std::vector<double>> polynomials;
+  evalPolynomials(nodes, polynomials);
+
+  base::DataVector weightedValues(numNodes);
+  for (size_t p = 0; p < numNodes; ++p) {
+    weightedValues[p] = quadWeights[p] * values[p];
+  }
+
+  // aj = sum_p w_p f(x_p) psi_j(x_p) / denominator for all entries of the multiIndex at once
+  base::DataVector result(index.size());
+#pragma omp parallel
+  {
+    std::vector<double> products(numNodes);
+#pragma omp for schedule(dynamic)
+    for (size_t j = 0; j < index.size(); ++j) {
+      std::copy(weightedValues.begin(), weightedValues.end(), products.begin());
+      double denom = 1.0;
+      for (std::vector<distributionType>::size_type i = 0; i < types.size(); ++i) {
+        const double* psi = &polynomials[i][static_cast<size_t>(index[j][i]) * numNodes];
+#pragma omp simd
+        for (size_t p = 0; p < numNodes; ++p) {
+          products[p] *= psi[p];
+        }
+        denom *= denoms[static_cast<int>(types[i])](index[j][i], i);
+      }
+      double num = 0.0;
+#pragma omp simd reduction(+ : num)
+      for (size_t p = 0; p < numNodes; ++p) {
+        num += products[p];
+      }
+      result[j] = num / denom;
+    }
   }
   this->coefficients = result;
   return result;
@@ -445,12 +643,17 @@ double PolynomialChaosExpansion::evalExpansion(const base::DataVector& xi, int n
       temp[i] = xi[i];
     }
   }
-  auto index = multiIndex(static_cast<int>(types.size()), order);
+  // polynomials of all degrees, one row per dimension
+  const size_t numDegrees = static_cast<size_t>(std::max(order, 0)) + 1;
+  std::vector<double> polynomials(types.size() * numDegrees);
+  for (std::vector<distributionType>::size_type i = 0; i < types.size(); ++i) {
+    evalPolynomials(i, &temp[i], 1, &polynomials[i * numDegrees]);
+  }
   double sum = 0.0;
   for (std::vector<std::vector<int>>::size_type j = 0; j < index.size(); ++j) {
     double prod = 1.0;
     for (std::vector<int>::size_type i = 0; i < index[j].size(); ++i) {
-      prod *= evals[static_cast<int>(types[i])](index[j][i], temp[i], i);
+      prod *= polynomials[i * numDegrees + static_cast<size_t>(index[j][i])];
     }
     sum += prod * coefficients[j];
   }
@@ -520,7 +723,6 @@ double PolynomialChaosExpansion::getVariance(int n, bool use_adaptive) {
   base::DataVector temp(coefficients.getSize());
   temp.copyFrom(coefficients);
   temp.set(0, 0.0);
-  auto index = multiIndex(static_cast<int>(types.size()), order);
   for (std::vector<std::vector<int>>::size_type j = 0; j < index.size(); ++j) {
     for (std::vector<int>::size_type i = 0; i < index[j].size(); ++i) {
       temp[j] *= normalization[static_cast<int>(types[i])](index[j][i], i);
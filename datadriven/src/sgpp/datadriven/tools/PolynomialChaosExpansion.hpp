@@ -14,6 +14,7 @@
 #include <memory>
 #include <numeric>
 #include <random>
+#include <sgpp/base/datatypes/DataMatrix.hpp>
 #include <sgpp/base/datatypes/DataVector.hpp>
 #include <sgpp/base/grid/generation/functors/SurplusRefinementFunctor.hpp>
 #include <sgpp/base/operation/BaseOpFactory.hpp>
@@ -36,6 +37,11 @@ enum class distributionType { Normal, Beta, Uniform, Exponential, Gamma };
 /**
  * a PCE object providing different methods to calculate the PCE coefficients and evaluating the
  * expansion
+ *
+ * All coefficients are computed from a single set of function samples on one (adaptive) sparse
+ * grid: the samples are evaluated in parallel, so the function must be thread-safe. The
+ * orthogonal polynomials are evaluated with their three-term recurrences for all quadrature nodes
+ * at once.
  */
 class PolynomialChaosExpansion {
   std::function<double(const base::DataVector&)> func;
@@ -48,23 +54,61 @@ class PolynomialChaosExpansion {
   base::DataVector beta;
   base::DataVector coefficients;
 
+  /**
+   * coefficients of the three-term recurrence P_{n+1}(x) = (a_n x + b_n) P_n(x) - c_n P_{n-1}(x)
+   * of the orthogonal polynomials of one dimension, starting with P_0 = 1 and P_{-1} = 0
+   */
+  struct Recurrence {
+    std::vector<double> a;
+    std::vector<double> b;
+    std::vector<double> c;
+  };
+
  private:
-  double evalLegendre(int n, double x);
-  double evalHermite(int n, double x);
-  double evalLaguerre(int n, double x);
-  double evalJacobi(int n, double x, size_t i);
-  double evalGenLaguerre(int n, double x, size_t i);
   std::vector<std::function<double(double, size_t)>> weights;
   std::vector<std::function<double(double, size_t)>> denoms;
-  std::vector<std::function<double(double, double, size_t)>> evals;
+  std::vector<Recurrence> recurrences;
+  std::vector<std::vector<int>> index;
   std::vector<std::vector<int>> multiIndex(int dimension, int order);
 
+  /*
+   * evaluates the polynomials of degree 0 to order of dimension dim at numPoints points,
+   * values[deg * numPoints + p] is the polynomial of degree deg at the p-th point
+   */
+  void evalPolynomials(size_t dim, const double* x, size_t numPoints, double* values) const;
+
+  /*
+   * evaluates the polynomials of all dimensions and degrees at the nodes (one row per node)
+   */
+  void evalPolynomials(const base::DataMatrix& nodes,
+                       std::vector<std::vector<double>>& polynomials) const;
+
+  /*
+   * evaluates the normalized integrands f * psi_j / ||psi_j|| of all entries of the multiIndex at
+   * the nodes, one column per entry
+   */
+  void evalIntegrands(const base::DataMatrix& nodes, const base::DataVector& values,
+                      base::DataMatrix& integrands) const;
+
+  /*
+   * samples the (normalized) function on a regular or adaptive sparse grid with at least n points
+   * and computes quadrature weights, such that the weighted sum of the samples of any function
+   * equals the weighted quadrature of its sparse grid interpolant
+   */
+  void sampleFunction(int n, bool use_adaptive, base::DataMatrix& nodes, base::DataVector& values,
+                      base::DataVector& quadWeights);
+
  public:
   /*
    * Constructor
    *
    * constructs a PCE using total-order expansion for the given function, expansion order and
    * underlying distributions
+   *
+   * @param func the function, it is evaluated at several points concurrently (OpenMP), so it has
+   * to be thread-safe
+   * @param order the order of the expansion
+   * @param distributions the distributions of the input variables
    */
   PolynomialChaosExpansion(std::function<double(const base::DataVector&)> func, int order,
                            sgpp::base::DistributionsVector distributions);
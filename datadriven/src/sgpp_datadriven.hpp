@@ -91,6 +91,7 @@
 #include <sgpp/datadriven/application/learnersgdeonoffparallel/RoundRobinScheduler.hpp>
 #endif /* USE_MPI */
 
+#include <sgpp/datadriven/tools/NearestNeighborIndex.hpp>
 #include <sgpp/datadriven/tools/NearestNeighbors.hpp>
 
 #include <sgpp/datadriven/operation/hash/simple/OperationRegularizationDiagonal.hpp>
@@ -0,0 +1,129 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#define BOOST_TEST_DYN_LINK
+#include <boost/test/unit_test.hpp>
+
+#include <sgpp/base/grid/Grid.hpp>
+#include <sgpp/base/grid/generation/GridGenerator.hpp>
+#include <sgpp/datadriven/DatadrivenOpFactory.hpp>
+#include <sgpp/datadriven/tools/ARFFTools.hpp>
+#include <sgpp/globaldef.hpp>
+
+#include <algorithm>
+#include <fstream>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace {
+
+template <typename T>
+std::vector<T> readValues(const std::string& fileName) {
+  std::vector<T> values;
+  std::ifstream in("datadriven/datasets/clustering_test_data/" + fileName);
+  if (!in) {
+    BOOST_THROW_EXCEPTION(std::runtime_error("clustering test data file is missing!"));
+  }
+  T value;
+  while (in >> value) values.push_back(value);
+  return values;
+}
+
+sgpp::datadriven::Dataset readDataset() {
+  return sgpp::datadriven::ARFFTools::readARFFFromFile(
+      "datadriven/datasets/clustering_test_data/clustering_testdataset_dim2.arff", false);
+}
+
+}  // namespace
+
+BOOST_AUTO_TEST_SUITE(TestClusteringCPU)
+
+BOOST_AUTO_TEST_CASE(KNNGraphCPU) {
+  std::vector<int> graph_optimal_result = readValues<int>("graph_erg_dim2_depth11.txt");
+  sgpp::datadriven::Dataset data = readDataset();
+  sgpp::base::DataMatrix& dataset = data.getData();
+
+  size_t k = 8;
+  std::unique_ptr<sgpp::datadriven::OperationCreateGraph> operation_graph(
+      sgpp::op_factory::createOperationCreateGraph(dataset, k));
+  std::vector<int> graph(dataset.getNrows() * k);
+  operation_graph->create_graph(graph);
+
+  // the OpenCL kernels do not sort the neighbors, so only the sets of neighbors are compared
+  BOOST_CHECK_EQUAL(graph.size(), graph_optimal_result.size());
+  for (size_t i = 0; i < dataset.getNrows(); ++i) {
+    std::vector<int> expected(graph_optimal_result.begin() + i * k,
+                              graph_optimal_result.begin() + (i + 1) * k);
+    std::vector<int> neighbors(graph.begin() + i * k, graph.begin() + (i + 1) * k);
+    std::sort(expected.begin(), expected.end());
+    std::sort(neighbors.begin(), neighbors.end());
+    BOOST_CHECK(expected == neighbors);
+  }
+
+  // chunks have to match the complete graph
+  std::vector<int> chunk;
+  operation_graph->create_graph(chunk, 1000, 100);
+  BOOST_CHECK(std::equal(chunk.begin(), chunk.end(), graph.begin() + 1000 * k));
+}
+
+BOOST_AUTO_TEST_CASE(KNNPruneGraphCPU) {
+  std::vector<int> graph = readValues<int>("graph_erg_dim2_depth11.txt");
+  std::vector<int> graph_optimal_result = readValues<int>("graph_pruned_erg_dim2_depth11.txt");
+  std::vector<double> alpha_values = readValues<double>("alpha_erg_dim2_depth11.txt");
+
+  std::unique_ptr<sgpp::base::Grid> grid(sgpp::base::Grid::createLinearGrid(2));
+  grid->getGenerator().regular(11);
+  BOOST_CHECK_EQUAL(alpha_values.size(), grid->getSize());
+  sgpp::base::DataVector alpha(alpha_values);
+
+  sgpp::datadriven::Dataset data = readDataset();
+  sgpp::base::DataMatrix& dataset = data.getData();
+
+  std::unique_ptr<sgpp::datadriven::OperationPruneGraph> operation_prune(
+      sgpp::op_factory::createOperationPruneGraph(*grid, alpha, dataset, 0.2, 8));
+  operation_prune->prune_graph(graph);
+  BOOST_CHECK(graph == graph_optimal_result);
+}
+
+BOOST_AUTO_TEST_CASE(KNNClusterSearchCPU) {
+  std::vector<int> graph = readValues<int>("graph_pruned_erg_dim2_depth11.txt");
+  std::vector<size_t> optimal_cluster_assignement = readValues<size_t>("cluster_erg.txt");
+
+  std::vector<size_t> cluster_assignement =
+      sgpp::datadriven::OperationCreateGraph::find_clusters(graph, 8);
+  BOOST_CHECK(optimal_cluster_assignement == cluster_assignement);
+}
+
+BOOST_AUTO_TEST_CASE(KNNClusterSearchPrunedNodesCPU) {
+  // removed nodes (-1) and nodes whose edges were all pruned (-2) are noise, like in the
+  // OpenCL version
+  std::vector<int> graph = {-2, -2, 2, -2, 1, -2, -1, -1, 3, 2};
+  std::vector<size_t> expected = {0, 1, 1, 0, 1};
+  BOOST_CHECK(sgpp::datadriven::OperationCreateGraph::find_clusters(graph, 2) == expected);
+
+  // edges pointing to a node with only pruned edges are ignored, the OpenCL version assigns
+  // 0 to the nodes reaching it instead, depending on the traversal order
+  graph = {-2, -2, 0, 2, 1, -2, 4, -2, 3, -2};
+  expected = {0, 1, 1, 2, 2};
+  BOOST_CHECK(sgpp::datadriven::OperationCreateGraph::find_clusters(graph, 2) == expected);
+}
+
+BOOST_AUTO_TEST_CASE(DensityClusteringCPU) {
+  std::vector<size_t> optimal_cluster_assignement = readValues<size_t>("cluster_erg.txt");
+
+  std::unique_ptr<sgpp::base::Grid> grid(sgpp::base::Grid::createLinearGrid(2));
+  grid->getGenerator().regular(11);
+  sgpp::datadriven::Dataset data = readDataset();
+
+  std::unique_ptr<sgpp::datadriven::OperationDensityClustering> operation_clustering(
+      sgpp::op_factory::createOperationDensityClustering());
+  std::vector<size_t> cluster_assignement =
+      operation_clustering->calculate_clusters(*grid, data.getData(), 0.001, 8, 0.2);
+  BOOST_CHECK(optimal_cluster_assignement == cluster_assignement);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
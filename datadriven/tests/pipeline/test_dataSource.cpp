@@ -12,16 +12,20 @@
 #include <sgpp/base/datatypes/DataMatrix.hpp>
 #include <sgpp/base/datatypes/DataVector.hpp>
 #include <sgpp/datadriven/datamining/modules/dataSource/ArffFileSampleProvider.hpp>
+#include <sgpp/datadriven/datamining/modules/dataSource/CSVFileSampleProvider.hpp>
 #include <sgpp/datadriven/datamining/modules/dataSource/DataSource.hpp>
 #include <sgpp/datadriven/datamining/modules/dataSource/DataSourceSplitting.hpp>
 #include <sgpp/datadriven/datamining/modules/dataSource/DataSourceConfig.hpp>
 #include <sgpp/datadriven/datamining/modules/dataSource/GzipFileSampleDecorator.hpp>
+#include <sgpp/datadriven/datamining/modules/dataSource/shuffling/DataShufflingFunctorRandom.hpp>
 #include <sgpp/datadriven/tools/Dataset.hpp>
 #include <sgpp/globaldef.hpp>
 
+#include <algorithm>
 #include <array>
 #include <memory>
 #include <string>
+#include <vector>
 
 using sgpp::datadriven::DataSource;
 using sgpp::datadriven::DataSourceSplitting;
@@ -29,6 +33,8 @@ using sgpp::datadriven::Dataset;
 using sgpp::datadriven::SampleProvider;
 using sgpp::datadriven::GzipFileSampleDecorator;
 using sgpp::datadriven::ArffFileSampleProvider;
+using sgpp::datadriven::CSVFileSampleProvider;
+using sgpp::datadriven::DataShufflingFunctorRandom;
 using sgpp::datadriven::DataSourceConfig;
 using sgpp::base::DataMatrix;
 using sgpp::base::DataVector;
@@ -113,5 +119,44 @@ BOOST_AUTO_TEST_CASE(dataSourceGetAllIteratorTest) {
   delete dataSource;
 }
 
+BOOST_AUTO_TEST_CASE(dataSourcePrefetchingTest) {
+  // collects the batches of two epochs (each preceded by a reset) with the given prefetch depth
+  auto collectBatches = [](size_t prefetchDepth) {
+    DataSourceConfig config;
+    config.filePath_ = "datadriven/datasets/dataread/simple.csv";
+    config.numBatches_ = 0;
+    config.batchSize_ = 2;
+    config.validationPortion_ = 0.2;
+    config.prefetchDepth_ = prefetchDepth;
+    DataSourceSplitting dataSource(
+        config, new CSVFileSampleProvider(new DataShufflingFunctorRandom(42)));
+
+    std::vector<DataMatrix> batches;
+    for (size_t epoch = 0; epoch < 2; epoch++) {
+      dataSource.reset();
+      BOOST_CHECK_EQUAL(1, dataSource.getValidationData()->getNumberInstances());
+      while (true) {
+        std::unique_ptr<Dataset> dataset(dataSource.getNextSamples());
+        if (dataset->getNumberInstances() == 0) {
+          break;
+        }
+        batches.push_back(dataset->getData());
+      }
+    }
+    BOOST_CHECK_EQUAL(batches.size() + 2, dataSource.getCurrentIteration());
+    return batches;
+  };
+
+  std::vector<DataMatrix> reference = collectBatches(0);
+  BOOST_CHECK_EQUAL(4, reference.size());
+  for (size_t prefetchDepth : {1, 3}) {
+    std::vector<DataMatrix> batches = collectBatches(prefetchDepth);
+    BOOST_CHECK_EQUAL(reference.size(), batches.size());
+    for (size_t i = 0; i < std::min(reference.size(), batches.size()); i++) {
+      BOOST_CHECK(reference[i] == batches[i]);
+    }
+  }
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 #endif
@@ -15,7 +15,19 @@
 #include <sgpp/datadriven/datamining/modules/dataSource/DataTransformationBuilder.hpp>
 #include <sgpp/datadriven/datamining/modules/dataSource/DataTransformationTypeParser.hpp>
 #include <sgpp/datadriven/datamining/modules/dataSource/RosenblattTransformation.hpp>
+#include <sgpp/datadriven/datamining/modules/dataSource/RosenblattTransformationTables.hpp>
+#include <sgpp/datadriven/DatadrivenOpFactory.hpp>
+#include <sgpp/datadriven/operation/hash/simple/OperationInverseRosenblattTransformation.hpp>
+#include <sgpp/datadriven/operation/hash/simple/OperationRosenblattTransformation.hpp>
+#include <sgpp/base/exception/data_exception.hpp>
+#include <sgpp/base/grid/Grid.hpp>
+#include <sgpp/base/operation/BaseOpFactory.hpp>
 
+#include <cmath>
+#include <cstdio>
+#include <fstream>
+#include <memory>
+#include <random>
 #include <vector>
 #include <string>
 
@@ -29,7 +41,10 @@ using sgpp::datadriven::DataTransformationType;
 using sgpp::datadriven::DataTransformationTypeParser;
 using sgpp::datadriven::RosenblattTransformation;
 using sgpp::datadriven::DataMiningConfigParser;
+using sgpp::base::DataMatrix;
 using sgpp::base::DataVector;
+using sgpp::base::Grid;
+using sgpp::datadriven::RosenblattTransformationTables;
 
 BOOST_AUTO_TEST_SUITE(testRosenblattTransformationInPipeline)
 
@@ -129,4 +144,131 @@ BOOST_AUTO_TEST_CASE(testDataTransformationParser) {
   }
 }
 
+BOOST_AUTO_TEST_CASE(testRosenblattModelFile) {
+  std::string modelFile = "test_rosenblattTransformation_model.txt";
+  std::remove(modelFile.c_str());
+
+  sgpp::datadriven::DataTransformationConfig config;
+  config.type_ = DataTransformationType::ROSENBLATT;
+  config.rosenblattConfig_.numSamples_ = 500;
+  config.rosenblattConfig_.modelFile_ = modelFile;
+
+  ArffFileSampleProvider arffsp = ArffFileSampleProvider();
+  arffsp.readFile("datadriven/datasets/chess/chess_5d_2000.arff", true);
+  std::unique_ptr<Dataset> dataset(arffsp.getAllSamples());
+
+  // the first initialization fits the density and stores it
+  RosenblattTransformation fitted;
+  fitted.initialize(dataset.get(), config);
+  BOOST_CHECK(std::ifstream(modelFile).good());
+  std::unique_ptr<Dataset> datasetFitted(fitted.doTransformation(dataset.get()));
+
+  // the second one loads it, even though the samples differ
+  Dataset otherSamples(1, dataset->getDimension());
+  RosenblattTransformation loaded;
+  loaded.initialize(&otherSamples, config);
+  std::unique_ptr<Dataset> datasetLoaded(loaded.doTransformation(dataset.get()));
+  std::unique_ptr<Dataset> datasetInvTr(loaded.doInverseTransformation(datasetLoaded.get()));
+
+  double tolerance = 1e-10;
+  for (size_t isample = 0; isample < dataset->getNumberInstances(); isample++) {
+    for (size_t idim = 0; idim < dataset->getDimension(); idim++) {
+      BOOST_CHECK_EQUAL(datasetFitted->getData().get(isample, idim),
+                        datasetLoaded->getData().get(isample, idim));
+      BOOST_CHECK_SMALL(
+          datasetInvTr->getData().get(isample, idim) - dataset->getData().get(isample, idim),
+          tolerance);
+    }
+  }
+
+  // a model file of another dimension is rejected instead of being applied to the data
+  Dataset lowerDimensional(10, dataset->getDimension() - 2);
+  RosenblattTransformation mismatch;
+  BOOST_CHECK_THROW(mismatch.initialize(&lowerDimensional, config),
+                    sgpp::base::data_exception);
+  std::remove(modelFile.c_str());
+}
+
+BOOST_AUTO_TEST_CASE(testRosenblattTablesMatchOperations) {
+  // the tables have to compute exactly what the operations compute, including the conditioning
+  // order and the start dimension of every sample, a round trip alone would not detect this
+  for (size_t dim : {2, 3}) {
+    std::unique_ptr<Grid> grid(Grid::createLinearGrid(dim));
+    grid->getGenerator().regular(3);
+    sgpp::base::GridStorage& storage = grid->getStorage();
+
+    // nonnegative, asymmetric function
+    DataVector alpha(grid->getSize());
+    for (size_t i = 0; i < storage.getSize(); i++) {
+      double value = 1.0;
+      for (size_t d = 0; d < dim; d++) {
+        double x = storage.getPoint(i).getStandardCoordinate(d);
+        value *= x * (1.0 - x) * (1.0 + static_cast<double>(d + 1) * x);
+      }
+      alpha[i] = value;
+    }
+    std::unique_ptr<sgpp::base::OperationHierarchisation> hierarchisation(
+        sgpp::op_factory::createOperationHierarchisation(*grid));
+    hierarchisation->doHierarchisation(alpha);
+
+    // several buckets of start dimensions
+    const size_t numSamples = 50;
+    DataMatrix samples(numSamples, dim);
+    std::mt19937 generator(7);
+    std::uniform_real_distribution<double> distribution(0.01, 0.99);
+    for (size_t i = 0; i < samples.getSize(); i++) {
+      samples[i] = distribution(generator);
+    }
+
+    RosenblattTransformationTables tables(*grid, alpha);
+    DataMatrix tablesForward(numSamples, dim);
+    DataMatrix tablesInverse(numSamples, dim);
+    tables.doTransformation(samples, tablesForward);
+    tables.doInverseTransformation(samples, tablesInverse);
+
+    std::unique_ptr<sgpp::datadriven::OperationRosenblattTransformation> opForward(
+        sgpp::op_factory::createOperationRosenblattTransformation(*grid));
+    std::unique_ptr<sgpp::datadriven::OperationInverseRosenblattTransformation> opInverse(
+        sgpp::op_factory::createOperationInverseRosenblattTransformation(*grid));
+    DataMatrix operationForward(numSamples, dim);
+    DataMatrix operationInverse(numSamples, dim);
+    opForward->doTransformation(&alpha, &samples, &operationForward);
+    opInverse->doTransformation(&alpha, &samples, &operationInverse);
+
+    for (size_t i = 0; i < samples.getSize(); i++) {
+      BOOST_CHECK_SMALL(tablesForward[i] - operationForward[i], 1e-12);
+      BOOST_CHECK_SMALL(tablesInverse[i] - operationInverse[i], 1e-12);
+    }
+  }
+}
+
+BOOST_AUTO_TEST_CASE(testRosenblattTablesVanishingDensity) {
+  // the density phi_{2,3}(x) phi_{1,1}(y) vanishes for x <= 0.5, so the conditional density of y
+  // vanishes there and the marginal CDF of x is flat on [0, 0.5]
+  std::unique_ptr<Grid> grid(Grid::createLinearGrid(2));
+  grid->getGenerator().regular(2);
+  sgpp::base::GridStorage& storage = grid->getStorage();
+  DataVector alpha(grid->getSize(), 0.0);
+  sgpp::base::GridPoint point(2);
+  point.set(0, 2, 3);
+  point.set(1, 1, 1);
+  alpha[storage.getSequenceNumber(point)] = 1.0;
+  RosenblattTransformationTables tables(*grid, alpha);
+
+  // a single sample always starts with the first dimension
+  DataMatrix sample(1, 2);
+  DataMatrix result(1, 2);
+  sample.set(0, 0, 0.25);
+  sample.set(0, 1, 0.3);
+  tables.doTransformation(sample, result);
+  BOOST_CHECK_EQUAL(result.get(0, 0), 0.0);
+  // uniform distribution without probability mass
+  BOOST_CHECK_CLOSE(result.get(0, 1), 0.3, 1e-10);
+
+  sample.set(0, 0, 0.0);
+  tables.doInverseTransformation(sample, result);
+  BOOST_CHECK_EQUAL(result.get(0, 0), 0.0);
+  BOOST_CHECK_CLOSE(result.get(0, 1), 0.3, 1e-10);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
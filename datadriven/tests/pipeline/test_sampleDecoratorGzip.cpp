@@ -10,11 +10,21 @@
 #include <sgpp/base/datatypes/DataMatrix.hpp>
 #include <sgpp/base/datatypes/DataVector.hpp>
 #include <sgpp/datadriven/datamining/modules/dataSource/ArffFileSampleProvider.hpp>
+#include <sgpp/datadriven/datamining/modules/dataSource/CSVFileSampleProvider.hpp>
 #include <sgpp/datadriven/datamining/modules/dataSource/GzipFileSampleDecorator.hpp>
+#include <sgpp/datadriven/tools/CSVTools.hpp>
 #include <sgpp/datadriven/tools/Dataset.hpp>
+#include <sgpp/datadriven/tools/GzipStreamBuffer.hpp>
 #include <sgpp/globaldef.hpp>
 
+#include <zlib.h>
+
+#include <cstdio>
+#include <fstream>
+#include <memory>
+#include <sstream>
 #include <string>
+#include <vector>
 
 BOOST_AUTO_TEST_SUITE(dataminingGzipSampleDecoratorTest)
 
@@ -23,6 +33,48 @@ using sgpp::datadriven::ArffFileSampleProvider;
 using sgpp::base::DataMatrix;
 using sgpp::base::DataVector;
 using sgpp::datadriven::Dataset;
+using sgpp::datadriven::CSVFileSampleProvider;
+using sgpp::datadriven::CSVTools;
+using sgpp::datadriven::GzipStreamBuffer;
+
+namespace {
+
+/**
+ * Writes content as a sequence of small BGZF style gzip members
+ */
+void writeBgzf(const std::string& fileName, const std::string& content, size_t memberInput) {
+  std::ofstream out(fileName, std::ios::binary);
+  for (size_t offset = 0; offset < content.size(); offset += memberInput) {
+    std::string input = content.substr(offset, memberInput);
+    std::vector<unsigned char> deflated(compressBound(static_cast<uLong>(input.size())) + 64);
+
+    z_stream stream = {};
+    deflateInit2(&stream, Z_DEFAULT_COMPRESSION, Z_DEFLATED, -MAX_WBITS, 8, Z_DEFAULT_STRATEGY);
+    stream.next_in = reinterpret_cast<Bytef*>(&input[0]);
+    stream.avail_in = static_cast<uInt>(input.size());
+    stream.next_out = deflated.data();
+    stream.avail_out = static_cast<uInt>(deflated.size());
+    deflate(&stream, Z_FINISH);
+    size_t deflatedSize = stream.total_out;
+    deflateEnd(&stream);
+
+    uLong crc = crc32(0L, reinterpret_cast<const Bytef*>(input.data()),
+                      static_cast<uInt>(input.size()));
+    size_t blockSize = 18 + deflatedSize + 8;
+    unsigned char header[18] = {0x1f, 0x8b, 8, 4, 0, 0, 0, 0, 0, 0xff, 6, 0, 'B', 'C', 2, 0,
+                                static_cast<unsigned char>((blockSize - 1) & 0xff),
+                                static_cast<unsigned char>((blockSize - 1) >> 8)};
+    out.write(reinterpret_cast<char*>(header), sizeof(header));
+    out.write(reinterpret_cast<char*>(deflated.data()), deflatedSize);
+    for (uLong value : {crc, static_cast<uLong>(input.size())}) {
+      for (size_t i = 0; i < 4; i++) {
+        out.put(static_cast<char>((value >> (8 * i)) & 0xff));
+      }
+    }
+  }
+}
+
+}  // namespace
 
 BOOST_AUTO_TEST_CASE(gzipTestReadFile) {
   double testPoints[10][3] = {{0.307143, 0.130137, 0.050000}, {0.365584, 0.105479, 0.050000},
@@ -66,5 +118,36 @@ BOOST_AUTO_TEST_CASE(gzipTestReadFile) {
   }
 }
 
+BOOST_AUTO_TEST_CASE(gzipTestReadBlockParallel) {
+  std::ostringstream content;
+  content << "x1,x2,class" << std::endl;
+  for (size_t i = 0; i < 5000; i++) {
+    content << 0.001 * static_cast<double>(i) << "," << static_cast<double>(i % 17) << ","
+            << static_cast<double>(i % 2) << std::endl;
+  }
+  const std::string fileName = "gzipTestReadBlockParallel.csv.gz";
+  writeBgzf(fileName, content.str(), 4096);
+
+  {
+    GzipStreamBuffer buffer(fileName);
+    BOOST_CHECK(buffer.isBlockParallel());
+    std::istream stream(&buffer);
+    std::ostringstream decompressed;
+    decompressed << stream.rdbuf();
+    BOOST_CHECK(decompressed.str() == content.str());
+  }
+
+  GzipFileSampleDecorator sampleProvider(new CSVFileSampleProvider());
+  sampleProvider.readFile(fileName, true);
+  std::unique_ptr<Dataset> dataset(sampleProvider.getAllSamples());
+
+  std::istringstream reference(content.str());
+  Dataset expected = CSVTools::readCSV(reference, true, true);
+  BOOST_CHECK_EQUAL(dataset->getNumberInstances(), 5000);
+  BOOST_CHECK(dataset->getData() == expected.getData());
+  BOOST_CHECK(dataset->getTargets() == expected.getTargets());
+  std::remove(fileName.c_str());
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 #endif
@@ -0,0 +1,207 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#define BOOST_TEST_DYN_LINK
+#include <boost/test/unit_test.hpp>
+
+#include <sgpp/base/datatypes/DataMatrix.hpp>
+#include <sgpp/base/datatypes/DataVector.hpp>
+#include <sgpp/base/grid/Grid.hpp>
+#include <sgpp/base/operation/BaseOpFactory.hpp>
+#include <sgpp/datadriven/algorithm/AlgorithmAdaBoostIdentity.hpp>
+#include <sgpp/datadriven/algorithm/DMWeightMatrix.hpp>
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+#include <memory>
+#include <random>
+
+using sgpp::base::DataMatrix;
+using sgpp::base::DataVector;
+using sgpp::base::Grid;
+
+namespace {
+
+/**
+ * Gives access to the shared evaluation operation
+ */
+class AccessibleAdaBoost : public sgpp::datadriven::AlgorithmAdaBoostIdentity {
+ public:
+  AccessibleAdaBoost(Grid& grid, DataMatrix& trainData, DataVector& classes, size_t numLearners,
+                     size_t searchNum)
+      : sgpp::datadriven::AlgorithmAdaBoostIdentity(
+            grid, grid.getType(), 3, trainData, classes, numLearners, 1e-3, 100, 1e-8, 100, 1e-8,
+            1.0, -1.0, 0.0, 1e-1, 1e-5, searchNum, false, 1, 1, 1, 0.5, 1) {}
+
+  using sgpp::datadriven::AlgorithmAdaBoostIdentity::getTrainEval;
+  using sgpp::datadriven::AlgorithmAdaBoostIdentity::resetEvaluations;
+};
+
+/**
+ * Two classes separated by a circle
+ */
+void createDataset(DataMatrix& data, DataVector& classes, size_t numData) {
+  std::mt19937_64 generator(17);
+  std::uniform_real_distribution<double> distribution(0.0, 1.0);
+  data.resize(numData, 2);
+  classes.resize(numData);
+
+  for (size_t i = 0; i < numData; i++) {
+    const double x = distribution(generator);
+    const double y = distribution(generator);
+    data.set(i, 0, x);
+    data.set(i, 1, y);
+    classes[i] = ((x - 0.5) * (x - 0.5) + (y - 0.5) * (y - 0.5) < 0.1) ? 1.0 : -1.0;
+  }
+}
+
+void checkEqual(const DataMatrix& result, const DataMatrix& reference, double tolerance) {
+  BOOST_REQUIRE_EQUAL(result.getSize(), reference.getSize());
+
+  for (size_t i = 0; i < result.getSize(); i++) {
+    BOOST_CHECK_SMALL(result[i] - reference[i], tolerance);
+  }
+}
+
+}  // namespace
+
+BOOST_AUTO_TEST_SUITE(TestAlgorithmAdaBoost)
+
+BOOST_AUTO_TEST_CASE(testSharedEvaluation) {
+  DataMatrix trainData;
+  DataVector classes;
+  createDataset(trainData, classes, 150);
+  std::unique_ptr<Grid> grid(Grid::createLinearGrid(2));
+  grid->getGenerator().regular(3);
+  AccessibleAdaBoost adaBoost(*grid, trainData, classes, 1, 0);
+
+  // the operation is created once and reused until it is reset
+  sgpp::base::OperationMultipleEval* trainEval = &adaBoost.getTrainEval();
+  BOOST_CHECK_EQUAL(&adaBoost.getTrainEval(), trainEval);
+  adaBoost.resetEvaluations();
+
+  DataVector alpha(grid->getSize());
+
+  for (size_t j = 0; j < alpha.getSize(); j++) {
+    alpha[j] = static_cast<double>(j % 5) - 2.0;
+  }
+
+  std::unique_ptr<sgpp::base::OperationMultipleEval> reference(
+      sgpp::op_factory::createOperationMultipleEval(*grid, trainData));
+  DataVector result(trainData.getNrows());
+  DataVector resultReference(trainData.getNrows());
+  adaBoost.getTrainEval().mult(alpha, result);
+  reference->mult(alpha, resultReference);
+
+  for (size_t i = 0; i < result.getSize(); i++) {
+    BOOST_CHECK_EQUAL(result[i], resultReference[i]);
+  }
+
+  // the system matrix on a shared operation equals the one with its own operation
+  std::unique_ptr<sgpp::base::OperationMatrix> C(sgpp::op_factory::createOperationIdentity(*grid));
+  DataVector weight(trainData.getNrows());
+
+  for (size_t i = 0; i < weight.getSize(); i++) {
+    weight[i] = 1.0 + 0.01 * static_cast<double>(i % 7);
+  }
+
+  sgpp::datadriven::DMWeightMatrix ownMatrix(*grid, trainData, *C, 1e-3, weight);
+  sgpp::datadriven::DMWeightMatrix sharedMatrix(adaBoost.getTrainEval(), *C, 1e-3, weight);
+  DataVector multOwn(grid->getSize());
+  DataVector multShared(grid->getSize());
+  ownMatrix.mult(alpha, multOwn);
+  sharedMatrix.mult(alpha, multShared);
+  DataVector bOwn(grid->getSize());
+  DataVector bShared(grid->getSize());
+  ownMatrix.generateb(classes, bOwn);
+  sharedMatrix.generateb(classes, bShared);
+
+  for (size_t j = 0; j < grid->getSize(); j++) {
+    BOOST_CHECK_EQUAL(multOwn[j], multShared[j]);
+    BOOST_CHECK_EQUAL(bOwn[j], bShared[j]);
+  }
+}
+
+BOOST_AUTO_TEST_CASE(testStackedTestEvaluation) {
+  // the weak learners are evaluated at the testing data with one multMatrix after the boosting,
+  // at the training data one after the other during the boosting, so with the training data as
+  // testing data both values have to match
+  DataMatrix trainData;
+  DataVector classes;
+  createDataset(trainData, classes, 150);
+  const size_t numLearners = 4;
+
+  for (int mode = 0; mode < 4; mode++) {
+    std::unique_ptr<Grid> grid(Grid::createLinearGrid(2));
+    grid->getGenerator().regular(3);
+    AccessibleAdaBoost adaBoost(*grid, trainData, classes, numLearners, 3);
+    DataMatrix weights(trainData.getNrows(), numLearners);
+    DataMatrix valueTrain(trainData.getNrows(), numLearners);
+    DataMatrix valueTest(trainData.getNrows(), numLearners);
+
+    if (mode == 0) {
+      DataVector hypoWeight(numLearners);
+      DataVector weightError(numLearners);
+      DataMatrix decision(trainData.getNrows(), numLearners);
+      adaBoost.doDiscreteAdaBoost(hypoWeight, weightError, weights, decision, trainData,
+                                  valueTrain, valueTest);
+    } else if (mode == 1) {
+      adaBoost.doRealAdaBoost(weights, trainData, valueTrain, valueTest);
+    } else if (mode == 2) {
+      adaBoost.doAdaBoostR2(weights, trainData, valueTrain, valueTest, "linear");
+    } else {
+      adaBoost.doAdaBoostRT(weights, trainData, valueTrain, valueTest, 0.5, "linear");
+    }
+
+    BOOST_CHECK_GT(adaBoost.getActualBL(), 0);
+    checkEqual(valueTest, valueTrain, 1e-10);
+  }
+}
+
+BOOST_AUTO_TEST_CASE(testParallelLambdaSearch) {
+  // the weak learners of the lambda search are trained concurrently, but the result does not
+  // depend on the number of threads
+  DataMatrix trainData;
+  DataVector classes;
+  createDataset(trainData, classes, 150);
+  const size_t numLearners = 3;
+  DataMatrix valueTrain[2];
+  DataVector weightError[2];
+
+#ifdef _OPENMP
+  const int maxThreads = omp_get_max_threads();
+#endif
+
+  for (int run = 0; run < 2; run++) {
+#ifdef _OPENMP
+    omp_set_num_threads((run == 0) ? 1 : 4);
+#endif
+    std::unique_ptr<Grid> grid(Grid::createLinearGrid(2));
+    grid->getGenerator().regular(3);
+    AccessibleAdaBoost adaBoost(*grid, trainData, classes, numLearners, 4);
+    DataVector hypoWeight(numLearners);
+    weightError[run].resize(numLearners);
+    DataMatrix weights(trainData.getNrows(), numLearners);
+    DataMatrix decision(trainData.getNrows(), numLearners);
+    valueTrain[run].resize(trainData.getNrows(), numLearners);
+    DataMatrix valueTest(trainData.getNrows(), numLearners);
+    adaBoost.doDiscreteAdaBoost(hypoWeight, weightError[run], weights, decision, trainData,
+                                valueTrain[run], valueTest);
+  }
+
+#ifdef _OPENMP
+  omp_set_num_threads(maxThreads);
+#endif
+
+  checkEqual(valueTrain[1], valueTrain[0], 1e-10);
+
+  for (size_t k = 0; k < numLearners; k++) {
+    BOOST_CHECK_SMALL(weightError[1][k] - weightError[0][k], 1e-12);
+  }
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,209 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#define BOOST_TEST_DYN_LINK
+#include <boost/test/unit_test.hpp>
+
+#include <sgpp/base/datatypes/DataMatrix.hpp>
+#include <sgpp/base/datatypes/DataVector.hpp>
+#include <sgpp/datadriven/datamining/modules/dataSource/CSVFileSampleProvider.hpp>
+#include <sgpp/datadriven/tools/BinaryDatasetCache.hpp>
+#include <sgpp/datadriven/tools/Dataset.hpp>
+
+#include <sys/stat.h>
+#include <utime.h>
+
+#include <cstdio>
+#include <fstream>
+#include <iterator>
+#include <memory>
+#include <string>
+#include <vector>
+
+using sgpp::base::DataMatrix;
+using sgpp::base::DataVector;
+using sgpp::datadriven::BinaryDatasetCache;
+using sgpp::datadriven::CSVFileSampleProvider;
+using sgpp::datadriven::Dataset;
+
+namespace {
+
+const char sourcePath[] = "test_BinaryDatasetCache.csv";
+
+/**
+ * Writes a small CSV file with two columns and targets
+ */
+void writeSource(size_t numRows) {
+  std::ofstream stream(sourcePath, std::ios::trunc);
+  stream << "x,y,class" << std::endl;
+  for (size_t i = 0; i < numRows; i++) {
+    stream << 0.1 * static_cast<double>(i) << "," << 0.5 << "," << static_cast<double>(i % 2)
+           << std::endl;
+  }
+}
+
+/**
+ * Reads the source file with a provider that uses the cache
+ */
+std::unique_ptr<Dataset> readWithCache(size_t readinCutoff = -1,
+                                       std::vector<size_t> readinColumns = std::vector<size_t>(),
+                                       std::vector<double> readinClasses = std::vector<double>()) {
+  CSVFileSampleProvider provider(nullptr, true);
+  provider.readFile(sourcePath, true, readinCutoff, readinColumns, readinClasses);
+  return std::unique_ptr<Dataset>(provider.getAllSamples());
+}
+
+std::string defaultOptions() {
+  return BinaryDatasetCache::describeOptions("csv", true, -1, std::vector<size_t>(),
+                                             std::vector<double>());
+}
+
+/**
+ * Replaces the cache by a dataset that differs from the source, a reader that returns it has
+ * used the cache
+ */
+void storeMarkerCache() {
+  DataMatrix data(1, 2, 42.0);
+  DataVector targets(1, 42.0);
+  BinaryDatasetCache::store(sourcePath, defaultOptions(), Dataset(std::move(data),
+                                                                  std::move(targets)));
+}
+
+bool isMarker(const Dataset& dataset) {
+  return dataset.getNumberInstances() == 1 && dataset.getData().get(0, 0) == 42.0;
+}
+
+void removeFiles() {
+  std::remove(sourcePath);
+  std::remove(BinaryDatasetCache::getCachePath(sourcePath).c_str());
+}
+
+}  // namespace
+
+BOOST_AUTO_TEST_SUITE(TestBinaryDatasetCache)
+
+BOOST_AUTO_TEST_CASE(testRoundTrip) {
+  removeFiles();
+  writeSource(20);
+
+  // the first read parses the file and stores the cache
+  std::unique_ptr<Dataset> parsed = readWithCache();
+  BOOST_CHECK(std::ifstream(BinaryDatasetCache::getCachePath(sourcePath)).good());
+
+  Dataset cached;
+  BOOST_REQUIRE(BinaryDatasetCache::load(sourcePath, defaultOptions(), cached));
+  BOOST_REQUIRE_EQUAL(cached.getNumberInstances(), parsed->getNumberInstances());
+  BOOST_REQUIRE_EQUAL(cached.getDimension(), parsed->getDimension());
+  for (size_t i = 0; i < parsed->getNumberInstances(); i++) {
+    for (size_t d = 0; d < parsed->getDimension(); d++) {
+      BOOST_CHECK_EQUAL(cached.getData().get(i, d), parsed->getData().get(i, d));
+    }
+    BOOST_CHECK_EQUAL(cached.getTargets()[i], parsed->getTargets()[i]);
+  }
+
+  // the second read loads the cache instead of parsing
+  storeMarkerCache();
+  BOOST_CHECK(isMarker(*readWithCache()));
+
+  // without the option the cache is ignored
+  CSVFileSampleProvider provider;
+  provider.readFile(sourcePath, true);
+  std::unique_ptr<Dataset> uncached(provider.getAllSamples());
+  BOOST_CHECK_EQUAL(uncached->getNumberInstances(), 20);
+  removeFiles();
+}
+
+BOOST_AUTO_TEST_CASE(testChangedSource) {
+  removeFiles();
+  writeSource(20);
+  readWithCache();
+
+  // different size
+  storeMarkerCache();
+  writeSource(21);
+  std::unique_ptr<Dataset> dataset = readWithCache();
+  BOOST_CHECK(!isMarker(*dataset));
+  BOOST_CHECK_EQUAL(dataset->getNumberInstances(), 21);
+
+  // same size, different modification time
+  storeMarkerCache();
+  struct stat status;
+  BOOST_REQUIRE_EQUAL(stat(sourcePath, &status), 0);
+  struct utimbuf times;
+  times.actime = status.st_atime;
+  times.modtime = status.st_mtime - 100;
+  BOOST_REQUIRE_EQUAL(utime(sourcePath, &times), 0);
+  dataset = readWithCache();
+  BOOST_CHECK(!isMarker(*dataset));
+  BOOST_CHECK_EQUAL(dataset->getNumberInstances(), 21);
+  removeFiles();
+}
+
+BOOST_AUTO_TEST_CASE(testChangedOptions) {
+  removeFiles();
+  writeSource(20);
+
+  // every option that changes the parsed data invalidates the cache
+  storeMarkerCache();
+  std::unique_ptr<Dataset> dataset = readWithCache(10);
+  BOOST_CHECK(!isMarker(*dataset));
+  BOOST_CHECK_EQUAL(dataset->getNumberInstances(), 10);
+
+  storeMarkerCache();
+  dataset = readWithCache(-1, std::vector<size_t>{0});
+  BOOST_CHECK(!isMarker(*dataset));
+  BOOST_CHECK_EQUAL(dataset->getDimension(), 1);
+
+  storeMarkerCache();
+  dataset = readWithCache(-1, std::vector<size_t>(), std::vector<double>{1.0});
+  BOOST_CHECK(!isMarker(*dataset));
+  BOOST_CHECK_EQUAL(dataset->getNumberInstances(), 10);
+
+  BOOST_CHECK(BinaryDatasetCache::describeOptions("csv", true, 10, std::vector<size_t>(),
+                                                  std::vector<double>()) != defaultOptions());
+  BOOST_CHECK(BinaryDatasetCache::describeOptions("arff", true, -1, std::vector<size_t>(),
+                                                  std::vector<double>()) != defaultOptions());
+  removeFiles();
+}
+
+BOOST_AUTO_TEST_CASE(testCorruptCache) {
+  removeFiles();
+  writeSource(20);
+  const std::string cachePath = BinaryDatasetCache::getCachePath(sourcePath);
+  Dataset dataset;
+
+  // truncated cache: the header is valid, but the data is incomplete
+  storeMarkerCache();
+  std::string content;
+  {
+    std::ifstream stream(cachePath, std::ios::binary);
+    content.assign(std::istreambuf_iterator<char>(stream), std::istreambuf_iterator<char>());
+  }
+  {
+    std::ofstream stream(cachePath, std::ios::binary | std::ios::trunc);
+    stream.write(content.data(), static_cast<std::streamsize>(content.size() - 4));
+  }
+  BOOST_CHECK(!BinaryDatasetCache::load(sourcePath, defaultOptions(), dataset));
+  std::unique_ptr<Dataset> parsed = readWithCache();
+  BOOST_CHECK(!isMarker(*parsed));
+  BOOST_CHECK_EQUAL(parsed->getNumberInstances(), 20);
+
+  // corrupt header
+  storeMarkerCache();
+  {
+    std::ofstream stream(cachePath, std::ios::binary | std::ios::trunc);
+    stream << "no cache";
+  }
+  BOOST_CHECK(!BinaryDatasetCache::load(sourcePath, defaultOptions(), dataset));
+  parsed = readWithCache();
+  BOOST_CHECK(!isMarker(*parsed));
+  BOOST_CHECK_EQUAL(parsed->getNumberInstances(), 20);
+
+  // parsing has written a valid cache again
+  BOOST_CHECK(BinaryDatasetCache::load(sourcePath, defaultOptions(), dataset));
+  removeFiles();
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,96 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#define BOOST_TEST_DYN_LINK
+#include <boost/test/unit_test.hpp>
+
+#include <sgpp/base/datatypes/DataMatrix.hpp>
+#include <sgpp/base/datatypes/DataVector.hpp>
+#include <sgpp/base/grid/Grid.hpp>
+#include <sgpp/base/operation/BaseOpFactory.hpp>
+#include <sgpp/datadriven/algorithm/DMSystemMatrix.hpp>
+#include <sgpp/solver/sle/BlockConjugateGradients.hpp>
+#include <sgpp/solver/sle/ConjugateGradients.hpp>
+
+#include <memory>
+#include <random>
+
+using sgpp::base::DataMatrix;
+using sgpp::base::DataVector;
+using sgpp::base::Grid;
+
+BOOST_AUTO_TEST_SUITE(TestDMSystemMatrix)
+
+BOOST_AUTO_TEST_CASE(testMultipleColumns) {
+  // multMatrix and generateb for several targets have to match mult and generateb column by
+  // column, as BlockConjugateGradients relies on them
+  const size_t numData = 150;
+  const size_t numColumns = 4;
+  std::mt19937 generator(23);
+  std::uniform_real_distribution<double> distribution(0.0, 1.0);
+
+  DataMatrix trainData(numData, 2);
+
+  for (size_t i = 0; i < trainData.getSize(); i++) {
+    trainData[i] = distribution(generator);
+  }
+
+  std::unique_ptr<Grid> grid(Grid::createLinearGrid(2));
+  grid->getGenerator().regular(4);
+  const size_t N = grid->getSize();
+  std::shared_ptr<sgpp::base::OperationMatrix> C(sgpp::op_factory::createOperationIdentity(*grid));
+  sgpp::datadriven::DMSystemMatrix system(*grid, trainData, C, 1e-3);
+
+  DataMatrix alphas(N, numColumns);
+  DataMatrix targets(numData, numColumns);
+
+  for (size_t i = 0; i < alphas.getSize(); i++) {
+    alphas[i] = distribution(generator) - 0.5;
+  }
+
+  for (size_t i = 0; i < targets.getSize(); i++) {
+    targets[i] = distribution(generator) - 0.5;
+  }
+
+  DataMatrix result(N, numColumns);
+  DataMatrix b(N, numColumns);
+  system.multMatrix(alphas, result);
+  system.generateb(targets, b);
+
+  for (size_t k = 0; k < numColumns; k++) {
+    DataVector alpha(N);
+    DataVector target(numData);
+    DataVector resultReference(N);
+    DataVector bReference(N);
+    alphas.getColumn(k, alpha);
+    targets.getColumn(k, target);
+    system.mult(alpha, resultReference);
+    system.generateb(target, bReference);
+
+    for (size_t j = 0; j < N; j++) {
+      BOOST_CHECK_SMALL(result.get(j, k) - resultReference[j], 1e-12);
+      BOOST_CHECK_SMALL(b.get(j, k) - bReference[j], 1e-12);
+    }
+  }
+
+  // the block solver gives the solutions of the single right hand sides
+  sgpp::solver::ConjugateGradients cg(200, 1e-12);
+  sgpp::solver::BlockConjugateGradients blockCG(200, 1e-12);
+  DataMatrix solutions;
+  blockCG.solve(system, solutions, b, false, false, -1.0);
+
+  for (size_t k = 0; k < numColumns; k++) {
+    DataVector alpha(N, 0.0);
+    DataVector column(N);
+    b.getColumn(k, column);
+    cg.solve(system, alpha, column, false, false, -1.0);
+
+    for (size_t j = 0; j < N; j++) {
+      BOOST_CHECK_SMALL(solutions.get(j, k) - alpha[j], 1e-8);
+    }
+  }
+}
+
+BOOST_AUTO_TEST_SUITE_END()
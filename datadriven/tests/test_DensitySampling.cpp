@@ -0,0 +1,151 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#define BOOST_TEST_DYN_LINK
+
+#include <boost/test/unit_test.hpp>
+
+#include <sgpp/base/datatypes/DataMatrix.hpp>
+#include <sgpp/base/datatypes/DataVector.hpp>
+#include <sgpp/base/grid/Grid.hpp>
+#include <sgpp/base/grid/GridStorage.hpp>
+#include <sgpp/base/tools/RandomNumberGenerator.hpp>
+#include <sgpp/datadriven/DatadrivenOpFactory.hpp>
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+#include <functional>
+#include <memory>
+
+using sgpp::base::DataMatrix;
+using sgpp::base::DataVector;
+using sgpp::base::Grid;
+using sgpp::base::RandomNumberGenerator;
+
+namespace {
+
+/**
+ * Draws samples with a fixed seed and the given number of threads
+ */
+std::unique_ptr<DataMatrix> drawSamples(const std::function<void(DataMatrix*&)>& sampling,
+                                        int numThreads) {
+#ifdef _OPENMP
+  int oldNumThreads = omp_get_max_threads();
+  omp_set_num_threads(numThreads);
+#endif
+  RandomNumberGenerator::getInstance().setSeed(1234);
+  DataMatrix* samples = nullptr;
+  sampling(samples);
+#ifdef _OPENMP
+  omp_set_num_threads(oldNumThreads);
+#endif
+  return std::unique_ptr<DataMatrix>(samples);
+}
+
+void checkReproducible(const std::function<void(DataMatrix*&)>& sampling) {
+  std::unique_ptr<DataMatrix> serial = drawSamples(sampling, 1);
+  std::unique_ptr<DataMatrix> parallel = drawSamples(sampling, 4);
+  BOOST_CHECK_EQUAL(serial->getNrows(), parallel->getNrows());
+
+  for (size_t i = 0; i < serial->getSize(); i++) {
+    BOOST_CHECK_EQUAL((*serial)[i], (*parallel)[i]);
+    BOOST_CHECK_GE((*serial)[i], 0.0);
+    BOOST_CHECK_LE((*serial)[i], 1.0);
+  }
+
+  // another call draws other samples
+  RandomNumberGenerator::getInstance().setSeed(1234);
+  DataMatrix* first = nullptr;
+  DataMatrix* second = nullptr;
+  sampling(first);
+  sampling(second);
+  BOOST_CHECK_NE(first->get(0, 0), second->get(0, 0));
+  delete first;
+  delete second;
+}
+
+}  // namespace
+
+BOOST_AUTO_TEST_SUITE(testDensitySampling)
+
+BOOST_AUTO_TEST_CASE(testSamplingIsReproducible) {
+  std::unique_ptr<Grid> grid(Grid::createLinearGrid(3));
+  grid->getGenerator().regular(3);
+  DataVector alpha(grid->getSize(), 1.0);
+
+  std::unique_ptr<sgpp::datadriven::OperationDensitySampling> opSampling(
+      sgpp::op_factory::createOperationDensitySampling(*grid));
+  checkReproducible(
+      [&](DataMatrix*& samples) { opSampling->doSampling(&alpha, samples, 301); });
+  checkReproducible(
+      [&](DataMatrix*& samples) { opSampling->doSampling(&alpha, samples, 200, 1); });
+
+  std::unique_ptr<sgpp::datadriven::OperationDensityRejectionSampling> opRejection(
+      sgpp::op_factory::createOperationDensityRejectionSampling(*grid));
+  checkReproducible(
+      [&](DataMatrix*& samples) { opRejection->doSampling(&alpha, samples, 1000, 10000); });
+}
+
+BOOST_AUTO_TEST_CASE(testSamplingDistribution) {
+  // mixture of two products of hat functions, 2 * phi_{1,1}(x) phi_{2,1}(y) + phi_{2,3}(x)
+  // phi_{1,1}(y), both products have the integral 1/8, so the weights are 2/3 and 1/3 and the
+  // conditionals of y depend on x
+  std::unique_ptr<Grid> grid(Grid::createLinearGrid(2));
+  grid->getGenerator().regular(3);
+  sgpp::base::GridStorage& storage = grid->getStorage();
+  DataVector alpha(grid->getSize(), 0.0);
+  sgpp::base::GridPoint point(2);
+  point.set(0, 1, 1);
+  point.set(1, 2, 1);
+  alpha[storage.getSequenceNumber(point)] = 2.0;
+  point.set(0, 2, 3);
+  point.set(1, 1, 1);
+  alpha[storage.getSequenceNumber(point)] = 1.0;
+
+  // the hat function of level l and index i is the triangular density on [(i-1) h, (i+1) h]
+  // with mean i h and variance h^2 / 6
+  const double mean[2] = {2.0 / 3.0 * 0.5 + 1.0 / 3.0 * 0.75, 2.0 / 3.0 * 0.25 + 1.0 / 3.0 * 0.5};
+  const double secondMoment[2] = {
+      2.0 / 3.0 * (0.25 + 0.25 / 6.0) + 1.0 / 3.0 * (0.5625 + 0.0625 / 6.0),
+      2.0 / 3.0 * (0.0625 + 0.0625 / 6.0) + 1.0 / 3.0 * (0.25 + 0.25 / 6.0)};
+  const double mixedMoment = 2.0 / 3.0 * 0.5 * 0.25 + 1.0 / 3.0 * 0.75 * 0.5;
+
+  std::unique_ptr<sgpp::datadriven::OperationDensitySampling> opSampling(
+      sgpp::op_factory::createOperationDensitySampling(*grid));
+  RandomNumberGenerator::getInstance().setSeed(4321);
+  const size_t numSamples = 20000;
+  DataMatrix* samplesPointer = nullptr;
+  opSampling->doSampling(&alpha, samplesPointer, numSamples);
+  std::unique_ptr<DataMatrix> samples(samplesPointer);
+  BOOST_REQUIRE_EQUAL(samples->getNrows(), numSamples);
+
+  double sum[2] = {0.0, 0.0};
+  double sumSquares[2] = {0.0, 0.0};
+  double sumMixed = 0.0;
+
+  for (size_t i = 0; i < numSamples; i++) {
+    for (size_t d = 0; d < 2; d++) {
+      sum[d] += samples->get(i, d);
+      sumSquares[d] += samples->get(i, d) * samples->get(i, d);
+    }
+
+    sumMixed += samples->get(i, 0) * samples->get(i, 1);
+  }
+
+  // the tolerances are about four standard deviations of the sample moments
+  const double n = static_cast<double>(numSamples);
+
+  for (size_t d = 0; d < 2; d++) {
+    const double variance = secondMoment[d] - mean[d] * mean[d];
+    BOOST_CHECK_SMALL(sum[d] / n - mean[d], 0.005);
+    BOOST_CHECK_SMALL(sumSquares[d] / n - (sum[d] / n) * (sum[d] / n) - variance, 0.002);
+  }
+
+  BOOST_CHECK_SMALL(sumMixed / n - mixedMoment, 0.003);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
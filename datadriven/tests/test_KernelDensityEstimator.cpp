@@ -0,0 +1,118 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#define BOOST_TEST_DYN_LINK
+
+#include <boost/test/unit_test.hpp>
+#include <sgpp/base/datatypes/DataMatrix.hpp>
+#include <sgpp/base/datatypes/DataVector.hpp>
+#include <sgpp/datadriven/application/KernelDensityEstimator.hpp>
+
+#include <cmath>
+#include <random>
+#include <vector>
+
+using sgpp::base::DataMatrix;
+using sgpp::base::DataVector;
+using sgpp::datadriven::KernelDensityEstimator;
+using sgpp::datadriven::KernelType;
+
+namespace {
+
+void randn(DataMatrix& samples, std::uint64_t seedValue) {
+  std::mt19937_64 generator(seedValue);
+  std::normal_distribution<double> distribution(0.5, 0.1);
+  for (size_t i = 0; i < samples.getSize(); i++) {
+    samples[i] = distribution(generator);
+  }
+}
+
+/**
+ * Straightforward evaluation of the density without the samples in skip
+ */
+double referencePdf(KernelDensityEstimator& kde, DataVector& x, size_t skip) {
+  DataVector bandwidths;
+  DataVector sample(kde.getDim());
+  kde.getBandwidths(bandwidths);
+  double res = 0.0;
+  for (size_t isample = 0; isample < kde.getNsamples(); isample++) {
+    if (isample == skip) {
+      continue;
+    }
+    kde.getSample(isample, sample);
+    double value = 1.0;
+    for (size_t idim = 0; idim < kde.getDim(); idim++) {
+      value *= kde.getKernel().norm() / bandwidths[idim] *
+               kde.getKernel().eval((x[idim] - sample[idim]) / bandwidths[idim]);
+    }
+    res += value;
+  }
+  size_t numSummands = kde.getNsamples() - (skip < kde.getNsamples() ? 1 : 0);
+  return res / static_cast<double>(numSummands);
+}
+
+}  // namespace
+
+BOOST_AUTO_TEST_SUITE(testKernelDensityEstimator)
+
+BOOST_AUTO_TEST_CASE(testBlockedEvaluation) {
+  for (KernelType kernelType : {KernelType::GAUSSIAN, KernelType::EPANECHNIKOV}) {
+    DataMatrix samples(1000, 3);
+    DataMatrix points(100, 3);
+    randn(samples, 1234);
+    randn(points, 4321);
+    KernelDensityEstimator kde(samples, kernelType);
+
+    DataVector res;
+    kde.pdf(points, res);
+    DataVector x(3);
+    for (size_t i = 0; i < points.getNrows(); i++) {
+      points.getRow(i, x);
+      double expected = referencePdf(kde, x, kde.getNsamples());
+      BOOST_CHECK_SMALL(res[i] - expected, 1e-12 * std::max(expected, 1.0));
+      BOOST_CHECK_SMALL(kde.pdf(x) - res[i], 1e-12 * std::max(expected, 1.0));
+    }
+  }
+}
+
+BOOST_AUTO_TEST_CASE(testLeaveOneOut) {
+  DataMatrix samples(500, 2);
+  randn(samples, 42);
+  KernelDensityEstimator kde(samples);
+
+  DataVector res;
+  kde.pdfLeaveOneOut(res);
+  BOOST_CHECK_EQUAL(res.getSize(), kde.getNsamples());
+
+  DataVector x(2);
+  for (size_t i = 0; i < kde.getNsamples(); i += 7) {
+    samples.getRow(i, x);
+    double expected = referencePdf(kde, x, i);
+    BOOST_CHECK_CLOSE(res[i], expected, 1e-10);
+    BOOST_CHECK_CLOSE(kde.evalSubset(x, std::vector<size_t>{i}), expected, 1e-10);
+  }
+}
+
+BOOST_AUTO_TEST_CASE(testApproximateEvaluation) {
+  DataMatrix samples(5000, 2);
+  DataMatrix points(200, 2);
+  randn(samples, 7);
+  randn(points, 8);
+  KernelDensityEstimator kde(samples);
+
+  DataVector exact;
+  kde.pdf(points, exact);
+
+  for (double tolerance : {1e-2, 1e-4}) {
+    DataVector approximated;
+    kde.setApproximationTolerance(tolerance);
+    kde.pdf(points, approximated);
+    for (size_t i = 0; i < points.getNrows(); i++) {
+      BOOST_CHECK_LE(std::fabs(approximated[i] - exact[i]), tolerance * exact[i] * (1.0 + 1e-10));
+    }
+  }
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,157 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#define BOOST_TEST_DYN_LINK
+#include <boost/test/unit_test.hpp>
+
+#include <sgpp/base/datatypes/DataMatrix.hpp>
+#include <sgpp/base/datatypes/DataVector.hpp>
+#include <sgpp/base/grid/Grid.hpp>
+#include <sgpp/base/operation/BaseOpFactory.hpp>
+#include <sgpp/base/operation/hash/OperationMultipleEval.hpp>
+#include <sgpp/datadriven/application/LearnerSGD.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <memory>
+#include <random>
+
+using sgpp::base::DataMatrix;
+using sgpp::base::DataVector;
+
+namespace {
+
+/**
+ * Gives access to the surpluses and the error measurement of the learner
+ */
+class AccessibleLearnerSGD : public sgpp::datadriven::LearnerSGD {
+ public:
+  using sgpp::datadriven::LearnerSGD::LearnerSGD;
+  using sgpp::datadriven::LearnerSGD::getError;
+
+  DataVector& getAlpha() { return alpha; }
+  DataVector& getAlphaAvg() { return alphaAvg; }
+  sgpp::base::Grid& getGrid() { return *grid; }
+};
+
+const double sgdLambda = 1e-3;
+const double sgdGamma = 0.1;
+const size_t batchSize = 10;
+
+/**
+ * Two classes separated by the diagonal of the unit square
+ */
+void createDataset(DataMatrix& data, DataVector& labels, size_t numData, std::uint64_t seed) {
+  std::mt19937_64 generator(seed);
+  std::uniform_real_distribution<double> distribution(0.0, 1.0);
+  data.resize(numData, 2);
+  labels.resize(numData);
+  for (size_t i = 0; i < numData; i++) {
+    data.set(i, 0, distribution(generator));
+    data.set(i, 1, distribution(generator));
+    labels[i] = (data.get(i, 0) + data.get(i, 1) > 1.0) ? 1.0 : -1.0;
+  }
+}
+
+/**
+ * Trains a learner without refinement and returns it
+ */
+std::unique_ptr<AccessibleLearnerSGD> train(DataMatrix& trainData, DataVector& trainLabels,
+                                            DataMatrix& testData, DataVector& testLabels,
+                                            size_t miniBatchSize, bool hogwild,
+                                            size_t maxDataPasses) {
+  sgpp::base::RegularGridConfiguration gridConfig;
+  gridConfig.type_ = sgpp::base::GridType::ModLinear;
+  gridConfig.level_ = 3;
+  sgpp::base::AdaptivityConfiguration adaptivityConfig;
+  adaptivityConfig.numRefinements_ = 0;
+
+  std::unique_ptr<AccessibleLearnerSGD> learner(new AccessibleLearnerSGD(
+      gridConfig, adaptivityConfig, trainData, trainLabels, testData, testLabels, nullptr,
+      nullptr, sgdLambda, sgdGamma, batchSize, false));
+  learner->setMiniBatchSize(miniBatchSize);
+  learner->setHogwild(hogwild);
+  learner->initialize();
+  learner->train(maxDataPasses, "predictive", "none", 0, 0.0, 0, 0);
+  return learner;
+}
+
+}  // namespace
+
+BOOST_AUTO_TEST_SUITE(TestLearnerSGD)
+
+BOOST_AUTO_TEST_CASE(testSerialMatchesPerSampleUpdates) {
+  DataMatrix trainData;
+  DataVector trainLabels;
+  DataMatrix testData;
+  DataVector testLabels;
+  createDataset(trainData, trainLabels, 200, 42);
+  createDataset(testData, testLabels, 100, 43);
+  const size_t maxDataPasses = 2;
+
+  std::unique_ptr<AccessibleLearnerSGD> learner =
+      train(trainData, trainLabels, testData, testLabels, 1, false, maxDataPasses);
+
+  // per-sample averaged SGD as it has been implemented before the mini-batches
+  sgpp::base::Grid& grid = learner->getGrid();
+  const size_t numData = trainData.getNrows();
+  DataVector alpha(grid.getSize(), 0.0);
+  DataVector alphaAvg(grid.getSize(), 0.0);
+  DataVector delta(grid.getSize());
+  DataVector singleAlpha(1, 1.0);
+  DataVector x(2);
+  double currentGamma = sgdGamma;
+  size_t processedPoints = 0;
+
+  for (size_t pass = 0; pass < maxDataPasses; pass++) {
+    for (size_t i = 0; i < numData; i++) {
+      trainData.getRow(i, x);
+      DataMatrix dm(x.getPointer(), 1, x.getSize());
+      std::unique_ptr<sgpp::base::OperationMultipleEval> multEval(
+          sgpp::op_factory::createOperationMultipleEval(grid, dm));
+      multEval->multTranspose(singleAlpha, delta);
+      double residual = delta.dotProduct(alpha) - trainLabels[i];
+
+      alpha.mult(1 - currentGamma * sgdLambda);
+      alpha.axpy(-currentGamma * residual, delta);
+
+      currentGamma = sgdGamma * std::pow((1 + sgdGamma * sgdLambda *
+                                                  (static_cast<double>(processedPoints) + 1)),
+                                         -0.75);
+      size_t t1 = (processedPoints > 2 + 1) ? processedPoints - 2 : 1;
+      size_t t2 = (processedPoints > numData + 1) ? processedPoints - numData : 1;
+      double mu = 1.0 / static_cast<double>(std::max(t1, t2));
+      alphaAvg.mult(1 - mu);
+      alphaAvg.axpy(mu, alpha);
+      processedPoints++;
+    }
+  }
+
+  for (size_t j = 0; j < alpha.getSize(); j++) {
+    BOOST_CHECK_SMALL(learner->getAlpha()[j] - alpha[j], 1e-12);
+    BOOST_CHECK_SMALL(learner->getAlphaAvg()[j] - alphaAvg[j], 1e-12);
+  }
+}
+
+BOOST_AUTO_TEST_CASE(testMiniBatches) {
+  DataMatrix trainData;
+  DataVector trainLabels;
+  DataMatrix testData;
+  DataVector testLabels;
+  createDataset(trainData, trainLabels, 500, 7);
+  createDataset(testData, testLabels, 200, 8);
+
+  for (bool hogwild : {false, true}) {
+    std::unique_ptr<AccessibleLearnerSGD> learner =
+        train(trainData, trainLabels, testData, testLabels, 8, hogwild, 20);
+
+    // the initial model is zero, so its MSE is one, the trained model separates the classes
+    BOOST_CHECK_LT(learner->getError(trainData, trainLabels, "MSE"), 0.5);
+    BOOST_CHECK_LT(learner->error, learner->avgErrors[0]);
+    BOOST_CHECK_LT(learner->error, 0.1);
+  }
+}
+
+BOOST_AUTO_TEST_SUITE_END()
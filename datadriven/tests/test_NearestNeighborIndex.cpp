@@ -0,0 +1,178 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#define BOOST_TEST_DYN_LINK
+
+#include <boost/test/unit_test.hpp>
+#include <sgpp/base/datatypes/DataMatrix.hpp>
+#include <sgpp/base/datatypes/DataVector.hpp>
+#include <sgpp/datadriven/tools/NearestNeighborIndex.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <random>
+#include <utility>
+#include <vector>
+
+using sgpp::base::DataMatrix;
+using sgpp::base::DataVector;
+using sgpp::datadriven::NearestNeighborIndex;
+
+namespace {
+
+void randu(DataMatrix& points, std::uint64_t seedValue) {
+  std::mt19937_64 generator(seedValue);
+  std::uniform_real_distribution<double> distribution(0.0, 1.0);
+  for (size_t i = 0; i < points.getSize(); i++) {
+    points[i] = distribution(generator);
+  }
+}
+
+/**
+ * Brute-force k nearest neighbors, ties are broken by the index
+ */
+std::vector<size_t> referenceNeighbors(const DataMatrix& dataset, const double* point, size_t k,
+                                       size_t exclude) {
+  std::vector<std::pair<double, size_t>> candidates;
+  for (size_t i = 0; i < dataset.getNrows(); i++) {
+    if (i == exclude) {
+      continue;
+    }
+    double dist = 0.0;
+    for (size_t d = 0; d < dataset.getNcols(); d++) {
+      double diff = point[d] - dataset.get(i, d);
+      dist += diff * diff;
+    }
+    candidates.emplace_back(dist, i);
+  }
+  std::sort(candidates.begin(), candidates.end());
+  std::vector<size_t> neighbors;
+  for (size_t i = 0; i < k; i++) {
+    neighbors.push_back(i < candidates.size() ? candidates[i].second
+                                              : NearestNeighborIndex::NO_NEIGHBOR);
+  }
+  return neighbors;
+}
+
+}  // namespace
+
+BOOST_AUTO_TEST_SUITE(testNearestNeighborIndex)
+
+BOOST_AUTO_TEST_CASE(testExactQueries) {
+  for (size_t dims : {1, 3, 10}) {
+    DataMatrix dataset(3000, dims);
+    DataMatrix queries(200, dims);
+    randu(dataset, 12 + dims);
+    randu(queries, 34 + dims);
+    // duplicates must not break the tree
+    for (size_t d = 0; d < dims; d++) {
+      dataset.set(1, d, dataset.get(0, d));
+    }
+    NearestNeighborIndex index(dataset);
+    const size_t k = 7;
+
+    std::vector<size_t> neighbors;
+    DataMatrix distances;
+    index.query(queries, k, neighbors, distances);
+    for (size_t i = 0; i < queries.getNrows(); i++) {
+      std::vector<size_t> expected =
+          referenceNeighbors(dataset, queries.getPointer() + i * dims, k, dataset.getNrows());
+      BOOST_CHECK(std::equal(expected.begin(), expected.end(), neighbors.begin() + i * k));
+      for (size_t j = 1; j < k; j++) {
+        BOOST_CHECK_LE(distances.get(i, j - 1), distances.get(i, j));
+      }
+    }
+
+    // the single query matches the batch
+    DataVector point(dims);
+    std::vector<size_t> single;
+    std::vector<double> singleDistances;
+    queries.getRow(5, point);
+    index.query(point, k, single, singleDistances);
+    BOOST_CHECK(std::equal(single.begin(), single.end(), neighbors.begin() + 5 * k));
+
+    // the neighbors in the dataset exclude the datapoint itself
+    index.queryDataset(k, 100, 50, neighbors, distances);
+    for (size_t i = 0; i < 50; i++) {
+      std::vector<size_t> expected =
+          referenceNeighbors(dataset, dataset.getPointer() + (100 + i) * dims, k, 100 + i);
+      BOOST_CHECK(std::equal(expected.begin(), expected.end(), neighbors.begin() + i * k));
+    }
+    BOOST_CHECK_EQUAL(index.estimateRecall(k, 100), 1.0);
+  }
+}
+
+BOOST_AUTO_TEST_CASE(testSmallDataset) {
+  DataMatrix dataset(3, 2);
+  randu(dataset, 1);
+  NearestNeighborIndex index(dataset);
+  std::vector<size_t> neighbors;
+  DataMatrix distances;
+  index.queryDataset(4, 0, 3, neighbors, distances);
+  for (size_t i = 0; i < 3; i++) {
+    BOOST_CHECK_EQUAL(neighbors[i * 4 + 2], NearestNeighborIndex::NO_NEIGHBOR);
+    BOOST_CHECK(std::isinf(distances.get(i, 3)));
+  }
+}
+
+BOOST_AUTO_TEST_CASE(testApproximateQueries) {
+  const size_t dims = 8;
+  const size_t k = 10;
+  DataMatrix dataset(5000, dims);
+  DataMatrix queries(100, dims);
+  randu(dataset, 5);
+  randu(queries, 6);
+  NearestNeighborIndex index(dataset);
+
+  std::vector<size_t> exactNeighbors;
+  DataMatrix exactDistances;
+  index.query(queries, k, exactNeighbors, exactDistances);
+
+  // every distance is within the approximation factor of the exact one
+  const double epsilon = 0.5;
+  index.setApproximation(epsilon);
+  std::vector<size_t> neighbors;
+  DataMatrix distances;
+  index.query(queries, k, neighbors, distances);
+  for (size_t i = 0; i < distances.getSize(); i++) {
+    BOOST_CHECK_LE(distances[i], (1.0 + epsilon) * exactDistances[i] * (1.0 + 1e-12));
+  }
+  double recall = index.estimateRecall(k, 200);
+  BOOST_CHECK_GT(recall, 0.5);
+  BOOST_CHECK_LE(recall, 1.0);
+
+  // a smaller budget of distance evaluations can only reduce the recall
+  index.setApproximation(0.0);
+  index.setMaxDistanceEvaluations(200);
+  BOOST_CHECK_LE(index.estimateRecall(k, 200), recall + 0.05);
+  index.setMaxDistanceEvaluations(0);
+}
+
+BOOST_AUTO_TEST_CASE(testSerialization) {
+  DataMatrix dataset(1000, 4);
+  DataMatrix queries(50, 4);
+  randu(dataset, 9);
+  randu(queries, 10);
+  NearestNeighborIndex index(dataset);
+  index.setApproximation(0.1);
+
+  const char* fileName = "test_NearestNeighborIndex.sgppknn";
+  index.save(fileName);
+  NearestNeighborIndex loaded(fileName);
+  std::remove(fileName);
+
+  BOOST_CHECK_EQUAL(loaded.getNumPoints(), index.getNumPoints());
+  BOOST_CHECK_EQUAL(loaded.getDimension(), index.getDimension());
+  BOOST_CHECK_EQUAL(loaded.getApproximation(), index.getApproximation());
+
+  std::vector<size_t> neighbors, loadedNeighbors;
+  DataMatrix distances, loadedDistances;
+  index.query(queries, 5, neighbors, distances);
+  loaded.query(queries, 5, loadedNeighbors, loadedDistances);
+  BOOST_CHECK(neighbors == loadedNeighbors);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,116 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#ifdef __AVX__
+
+#define BOOST_TEST_DYN_LINK
+#include <boost/test/unit_test.hpp>
+
+#include <sgpp/base/datatypes/DataMatrix.hpp>
+#include <sgpp/base/datatypes/DataVector.hpp>
+#include <sgpp/base/grid/Grid.hpp>
+#include <sgpp/base/operation/hash/OperationMultipleEval.hpp>
+#include <sgpp/datadriven/DatadrivenOpFactory.hpp>
+#include <sgpp/globaldef.hpp>
+
+#include <memory>
+#include <random>
+
+using sgpp::base::DataMatrix;
+using sgpp::base::DataVector;
+using sgpp::base::Grid;
+using sgpp::base::OperationMultipleEval;
+using sgpp::datadriven::OperationMultipleEvalConfiguration;
+using sgpp::datadriven::OperationMultipleEvalSubType;
+using sgpp::datadriven::OperationMultipleEvalType;
+
+namespace {
+
+/**
+ * Compares multMatrix and multTransposeMatrix column by column with mult and multTranspose
+ */
+void compareColumns(OperationMultipleEvalConfiguration configuration) {
+  const size_t dim = 3;
+  // not a multiple of the padding of the kernels
+  const size_t numberDataPoints = 257;
+  const size_t numVectors = 5;
+  std::mt19937 generator(42);
+  std::uniform_real_distribution<double> distribution(0.0, 1.0);
+
+  DataMatrix dataset(numberDataPoints, dim);
+
+  for (size_t i = 0; i < dataset.getSize(); i++) {
+    dataset[i] = distribution(generator);
+  }
+
+  std::unique_ptr<Grid> grid(Grid::createLinearGrid(dim));
+  grid->getGenerator().regular(4);
+  const size_t N = grid->getSize();
+
+  DataMatrix alphas(N, numVectors);
+  DataMatrix sources(numberDataPoints, numVectors);
+
+  for (size_t i = 0; i < alphas.getSize(); i++) {
+    alphas[i] = distribution(generator) - 0.5;
+  }
+
+  for (size_t i = 0; i < sources.getSize(); i++) {
+    sources[i] = distribution(generator) - 0.5;
+  }
+
+  std::unique_ptr<OperationMultipleEval> op(
+      sgpp::op_factory::createOperationMultipleEval(*grid, dataset, configuration));
+
+  DataMatrix result;
+  DataMatrix resultTranspose;
+  op->multMatrix(alphas, result);
+  op->multTransposeMatrix(sources, resultTranspose);
+  BOOST_CHECK_EQUAL(result.getNrows(), numberDataPoints);
+  BOOST_CHECK_EQUAL(result.getNcols(), numVectors);
+  BOOST_CHECK_EQUAL(resultTranspose.getNrows(), N);
+  BOOST_CHECK_EQUAL(resultTranspose.getNcols(), numVectors);
+
+  for (size_t k = 0; k < numVectors; k++) {
+    DataVector alpha(N);
+    DataVector source(numberDataPoints);
+    DataVector result_ref(numberDataPoints);
+    DataVector resultTranspose_ref(N);
+    alphas.getColumn(k, alpha);
+    sources.getColumn(k, source);
+    op->mult(alpha, result_ref);
+    op->multTranspose(source, resultTranspose_ref);
+
+    for (size_t i = 0; i < numberDataPoints; i++) {
+      BOOST_CHECK_SMALL(result.get(i, k) - result_ref[i], 1e-12);
+    }
+
+    for (size_t j = 0; j < N; j++) {
+      BOOST_CHECK_SMALL(resultTranspose.get(j, k) - resultTranspose_ref[j], 1e-12);
+    }
+  }
+}
+
+}  // namespace
+
+BOOST_AUTO_TEST_SUITE(TestOperationMultipleEvalMatrix)
+
+BOOST_AUTO_TEST_CASE(Streaming) {
+  compareColumns(OperationMultipleEvalConfiguration(OperationMultipleEvalType::STREAMING,
+                                                    OperationMultipleEvalSubType::DEFAULT));
+}
+
+BOOST_AUTO_TEST_CASE(SubspaceCombined) {
+  compareColumns(OperationMultipleEvalConfiguration(OperationMultipleEvalType::SUBSPACELINEAR,
+                                                    OperationMultipleEvalSubType::COMBINED));
+}
+
+BOOST_AUTO_TEST_CASE(SubspaceSimple) {
+  compareColumns(OperationMultipleEvalConfiguration(OperationMultipleEvalType::SUBSPACELINEAR,
+                                                    OperationMultipleEvalSubType::SIMPLE));
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+#endif
@@ -0,0 +1,78 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#define BOOST_TEST_DYN_LINK
+#include <boost/test/unit_test.hpp>
+
+#include <sgpp/base/datatypes/DataVector.hpp>
+#include <sgpp/base/tools/DistributionNormal.hpp>
+#include <sgpp/base/tools/DistributionUniform.hpp>
+#include <sgpp/base/tools/DistributionsVector.hpp>
+#include <sgpp/datadriven/tools/PolynomialChaosExpansion.hpp>
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+#include <memory>
+
+using sgpp::base::DataVector;
+
+namespace {
+
+// polynomial of total degree 3, so an expansion of order 3 is exact
+double polynomial(const DataVector& x) {
+  return 1.0 + x[0] * x[0] + x[0] * x[1] + x[1] * x[1] * x[1];
+}
+
+sgpp::base::DistributionsVector createDistributions() {
+  sgpp::base::DistributionsVector distributions;
+  distributions.push_back(std::make_shared<sgpp::base::DistributionUniform>(0.0, 1.0));
+  distributions.push_back(std::make_shared<sgpp::base::DistributionNormal>(0.5, 0.2));
+  return distributions;
+}
+
+}  // namespace
+
+BOOST_AUTO_TEST_SUITE(TestPolynomialChaosExpansion)
+
+BOOST_AUTO_TEST_CASE(testParallelCoefficients) {
+  // the function samples are evaluated in parallel, the coefficients must not depend on the
+  // number of threads
+#ifdef _OPENMP
+  const int maxThreads = omp_get_max_threads();
+#endif
+
+  for (bool useAdaptive : {false, true}) {
+    DataVector coefficients[2];
+    double mean[2];
+
+    for (int run = 0; run < 2; run++) {
+#ifdef _OPENMP
+      omp_set_num_threads((run == 0) ? 1 : 4);
+#endif
+      sgpp::datadriven::PolynomialChaosExpansion pce(polynomial, 3, createDistributions());
+      coefficients[run] = pce.calculateCoefficients(100, useAdaptive);
+      mean[run] = pce.getMean(100, useAdaptive);
+    }
+
+    BOOST_REQUIRE_EQUAL(coefficients[1].getSize(), coefficients[0].getSize());
+
+    for (size_t j = 0; j < coefficients[0].getSize(); j++) {
+      BOOST_CHECK_SMALL(coefficients[1][j] - coefficients[0][j], 1e-12);
+    }
+
+    // E[1 + x^2 + x y + y^3] with x ~ U(0, 1), y ~ N(0.5, 0.2^2)
+    const double reference = 1.0 + 1.0 / 3.0 + 0.5 * 0.5 + (0.125 + 3.0 * 0.5 * 0.04);
+    BOOST_CHECK_CLOSE(mean[0], reference, 1.0);
+    BOOST_CHECK_EQUAL(mean[1], mean[0]);
+  }
+
+#ifdef _OPENMP
+  omp_set_num_threads(maxThreads);
+#endif
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,267 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#define BOOST_TEST_DYN_LINK
+#include <boost/test/unit_test.hpp>
+
+#include <sgpp/base/datatypes/DataMatrix.hpp>
+#include <sgpp/base/datatypes/DataVector.hpp>
+#include <sgpp/base/grid/Grid.hpp>
+#include <sgpp/base/operation/BaseOpFactory.hpp>
+#include <sgpp/base/operation/hash/OperationMultipleEval.hpp>
+#include <sgpp/datadriven/application/LearnerSVM.hpp>
+#include <sgpp/datadriven/application/PrimalDualSVM.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <memory>
+#include <random>
+#include <vector>
+
+using sgpp::base::DataMatrix;
+using sgpp::base::DataVector;
+using sgpp::base::Grid;
+using sgpp::datadriven::PrimalDualSVM;
+
+namespace {
+
+/**
+ * Gives access to the grid and the support vector machine of the learner
+ */
+class AccessibleLearnerSVM : public sgpp::datadriven::LearnerSVM {
+ public:
+  using sgpp::datadriven::LearnerSVM::LearnerSVM;
+
+  Grid& getGrid() { return *grid; }
+  PrimalDualSVM& getSVM() { return *svm; }
+};
+
+/**
+ * Two classes separated by the diagonal of the unit square
+ */
+void createDataset(DataMatrix& data, DataVector& labels, size_t numData, std::uint64_t seed) {
+  std::mt19937_64 generator(seed);
+  std::uniform_real_distribution<double> distribution(0.0, 1.0);
+  data.resize(numData, 2);
+  labels.resize(numData);
+
+  for (size_t i = 0; i < numData; i++) {
+    data.set(i, 0, distribution(generator));
+    data.set(i, 1, distribution(generator));
+    labels[i] = (data.get(i, 0) + data.get(i, 1) > 1.0) ? 1.0 : -1.0;
+  }
+}
+
+/**
+ * Feature representation phi(x) of a data point, i.e., the values of all basis functions at x
+ */
+DataVector transform(Grid& grid, const DataVector& x) {
+  DataMatrix xMatrix(1, x.getSize());
+  xMatrix.setRow(0, x);
+  DataVector unitAlpha(1, 1.0);
+  DataVector xTrans(grid.getSize());
+  std::unique_ptr<sgpp::base::OperationMultipleEval> multEval(
+      sgpp::op_factory::createOperationMultipleEval(grid, xMatrix));
+  multEval->multTranspose(unitAlpha, xTrans);
+  return xTrans;
+}
+
+/**
+ * Checks that w, w2 and the norms agree with the stored support vectors and alphas
+ */
+void checkConsistency(Grid& grid, PrimalDualSVM& svm) {
+  const size_t numSVs = svm.svs.getNrows();
+  BOOST_REQUIRE_EQUAL(svm.alphas.getSize(), numSVs);
+  BOOST_REQUIRE_EQUAL(svm.norms.getSize(), numSVs);
+
+  DataVector w(grid.getSize(), 0.0);
+  DataVector w2(grid.getSize(), 0.0);
+  DataVector x(svm.svs.getNcols());
+
+  for (size_t i = 0; i < numSVs; i++) {
+    svm.svs.getRow(i, x);
+    DataVector xTrans = transform(grid, x);
+    BOOST_CHECK_SMALL(svm.norms[i] - xTrans.dotProduct(xTrans), 1e-12);
+    w.axpy(svm.alphas[i], xTrans);
+    w2.axpy(std::abs(svm.alphas[i]), xTrans);
+  }
+
+  for (size_t j = 0; j < grid.getSize(); j++) {
+    BOOST_CHECK_SMALL(svm.w[j] - w[j], 1e-10);
+    BOOST_CHECK_SMALL(svm.w2[j] - w2[j], 1e-10);
+  }
+}
+
+/**
+ * Checks that the batch prediction equals the prediction of the single data points
+ */
+void checkBatchPrediction(Grid& grid, PrimalDualSVM& svm, DataMatrix& data) {
+  DataVector raw;
+  DataVector labels;
+  svm.predictRaw(grid, data, raw);
+  svm.predict(grid, data, labels);
+  BOOST_REQUIRE_EQUAL(raw.getSize(), data.getNrows());
+  BOOST_REQUIRE_EQUAL(labels.getSize(), data.getNrows());
+  DataVector x(data.getNcols());
+
+  for (size_t i = 0; i < data.getNrows(); i++) {
+    data.getRow(i, x);
+    BOOST_CHECK_SMALL(raw[i] - svm.predictRaw(grid, x, x.getSize()), 1e-12);
+    BOOST_CHECK_EQUAL(labels[i], static_cast<double>(svm.predict(grid, x, x.getSize())));
+  }
+}
+
+}  // namespace
+
+BOOST_AUTO_TEST_SUITE(TestPrimalDualSVM)
+
+BOOST_AUTO_TEST_CASE(testBatchPrediction) {
+  DataMatrix data;
+  DataVector labels;
+  createDataset(data, labels, 60, 3);
+  std::unique_ptr<Grid> grid(Grid::createModLinearGrid(2));
+  grid->getGenerator().regular(3);
+
+  for (bool useBias : {false, true}) {
+    PrimalDualSVM svm(grid->getSize(), 2, 20, useBias);
+    DataVector x(2);
+
+    for (size_t i = 0; i < 20; i++) {
+      data.getRow(i, x);
+      svm.add(*grid, x, 0.1 * labels[i], 2);
+    }
+
+    checkBatchPrediction(*grid, svm, data);
+  }
+}
+
+BOOST_AUTO_TEST_CASE(testRemoveSupportVectors) {
+  DataMatrix data;
+  DataVector labels;
+  createDataset(data, labels, 30, 5);
+  std::unique_ptr<Grid> grid(Grid::createModLinearGrid(2));
+  grid->getGenerator().regular(3);
+  PrimalDualSVM svm(grid->getSize(), 2, 30, false);
+  DataVector x(2);
+
+  for (size_t i = 0; i < 30; i++) {
+    data.getRow(i, x);
+    svm.add(*grid, x, labels[i] * (1.0 + 0.1 * static_cast<double>(i % 7)), 2);
+  }
+
+  const DataMatrix svsBefore(svm.svs);
+  const DataVector alphasBefore(svm.alphas);
+  const DataVector normsBefore(svm.norms);
+  const size_t numRemovals = 12;
+  svm.removeSupportVectors(*grid, numRemovals);
+  BOOST_REQUIRE_EQUAL(svm.svs.getNrows(), svsBefore.getNrows() - numRemovals);
+
+  // the remaining support vectors keep their order and alphas, the removed ones have the
+  // smallest contributions
+  double maxRemovedContribution = 0.0;
+  double minKeptContribution = std::numeric_limits<double>::infinity();
+  size_t k = 0;
+
+  for (size_t i = 0; i < svsBefore.getNrows(); i++) {
+    const double contribution = std::abs(alphasBefore[i]) * std::sqrt(normsBefore[i]);
+
+    if (k < svm.svs.getNrows() && svm.svs.get(k, 0) == svsBefore.get(i, 0) &&
+        svm.svs.get(k, 1) == svsBefore.get(i, 1)) {
+      BOOST_CHECK_EQUAL(svm.alphas[k], alphasBefore[i]);
+      BOOST_CHECK_EQUAL(svm.norms[k], normsBefore[i]);
+      minKeptContribution = std::min(minKeptContribution, contribution);
+      k++;
+    } else {
+      maxRemovedContribution = std::max(maxRemovedContribution, contribution);
+    }
+  }
+
+  BOOST_CHECK_EQUAL(k, svm.svs.getNrows());
+  BOOST_CHECK_LE(maxRemovedContribution, minKeptContribution);
+  checkConsistency(*grid, svm);
+  checkBatchPrediction(*grid, svm, data);
+}
+
+BOOST_AUTO_TEST_CASE(testBudget) {
+  DataMatrix data;
+  DataVector labels;
+  createDataset(data, labels, 40, 9);
+  std::unique_ptr<Grid> grid(Grid::createModLinearGrid(2));
+  grid->getGenerator().regular(3);
+  const size_t budget = 10;
+  DataVector x(2);
+
+  // by default, new support vectors are discarded if the budget is exhausted
+  PrimalDualSVM discarding(grid->getSize(), 2, budget, false);
+
+  for (size_t i = 0; i < data.getNrows(); i++) {
+    data.getRow(i, x);
+    discarding.add(*grid, x, labels[i], 2);
+  }
+
+  BOOST_CHECK_EQUAL(discarding.svs.getNrows(), budget);
+  BOOST_CHECK_EQUAL(discarding.svs.get(budget - 1, 0), data.get(budget - 1, 0));
+  checkConsistency(*grid, discarding);
+
+  // with bulk removal, the most recent data point is always a support vector
+  PrimalDualSVM removing(grid->getSize(), 2, budget, false);
+  removing.setRemovalBatchSize(3);
+  BOOST_CHECK_EQUAL(removing.getRemovalBatchSize(), 3);
+
+  for (size_t i = 0; i < data.getNrows(); i++) {
+    data.getRow(i, x);
+    removing.add(*grid, x, labels[i] * (1.0 + 0.1 * static_cast<double>(i % 5)), 2);
+    BOOST_REQUIRE_LE(removing.svs.getNrows(), budget);
+    BOOST_CHECK_EQUAL(removing.svs.get(removing.svs.getNrows() - 1, 0), x[0]);
+  }
+
+  checkConsistency(*grid, removing);
+}
+
+BOOST_AUTO_TEST_CASE(testLearnerBudget) {
+  DataMatrix trainData;
+  DataVector trainLabels;
+  DataMatrix testData;
+  DataVector testLabels;
+  createDataset(trainData, trainLabels, 200, 11);
+  createDataset(testData, testLabels, 100, 12);
+
+  sgpp::base::RegularGridConfiguration gridConfig;
+  gridConfig.dim_ = 2;
+  gridConfig.level_ = 3;
+  gridConfig.type_ = sgpp::base::GridType::ModLinear;
+  sgpp::base::AdaptivityConfiguration adaptivityConfig;
+  adaptivityConfig.numRefinements_ = 0;
+  const size_t budget = 15;
+
+  for (size_t removalBatchSize : {0, 4}) {
+    AccessibleLearnerSVM learner(gridConfig, adaptivityConfig, trainData, trainLabels, testData,
+                                 testLabels, nullptr, nullptr);
+    learner.initialize(budget);
+    learner.getSVM().setRemovalBatchSize(removalBatchSize);
+    learner.train(2, 1e-2, 1.0, "none", "none", 0, 0.0, 0, 0);
+
+    BOOST_CHECK_LE(learner.getSVM().svs.getNrows(), budget);
+    checkConsistency(learner.getGrid(), learner.getSVM());
+
+    // the learner predicts all data points with one batch evaluation
+    DataVector predictedLabels(testData.getNrows());
+    learner.predict(testData, predictedLabels);
+    DataVector x(2);
+
+    for (size_t i = 0; i < testData.getNrows(); i++) {
+      testData.getRow(i, x);
+      BOOST_CHECK_EQUAL(predictedLabels[i],
+                        static_cast<double>(learner.getSVM().predict(learner.getGrid(), x, 2)));
+    }
+
+    BOOST_CHECK_EQUAL(learner.getAccuracy(testData, testLabels, 0.0),
+                      learner.getAccuracy(testLabels, 0.0, predictedLabels));
+    BOOST_CHECK_LT(learner.error, 0.5);
+  }
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,111 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#define BOOST_TEST_DYN_LINK
+
+#include <boost/test/unit_test.hpp>
+#include <sgpp/base/datatypes/DataMatrix.hpp>
+#include <sgpp/base/datatypes/DataVector.hpp>
+
+#include <sgpp/datadriven/datamining/modules/dataSource/MmapFileSampleProvider.hpp>
+#include <sgpp/datadriven/datamining/modules/dataSource/shuffling/DataShufflingFunctorRandom.hpp>
+#include <sgpp/datadriven/tools/BinaryTools.hpp>
+#include <sgpp/datadriven/tools/CSVTools.hpp>
+#include <sgpp/datadriven/tools/Dataset.hpp>
+
+#include <cstdio>
+#include <memory>
+#include <string>
+#include <vector>
+
+using sgpp::base::DataMatrix;
+using sgpp::base::DataVector;
+using sgpp::datadriven::BinaryTools;
+using sgpp::datadriven::CSVTools;
+using sgpp::datadriven::DataShufflingFunctorRandom;
+using sgpp::datadriven::Dataset;
+using sgpp::datadriven::MmapFileSampleProvider;
+
+BOOST_AUTO_TEST_SUITE(test_dataread_binary)
+
+BOOST_AUTO_TEST_CASE(test_roundtrip_double) {
+  std::string binaryFile = "test_dataread_binary_double.bin";
+  Dataset reference = CSVTools::readCSVFromFile("datadriven/datasets/dataread/simple.csv", true);
+  BinaryTools::writeBinaryToFile(binaryFile, reference);
+
+  Dataset d = BinaryTools::readBinaryFromFile(binaryFile);
+  BOOST_CHECK(d.getData() == reference.getData());
+  BOOST_CHECK(d.getTargets() == reference.getTargets());
+
+  // selection of columns and classes behaves like for CSV files
+  Dataset selection =
+      BinaryTools::readBinaryFromFile(binaryFile, true, -1, {4, 0}, std::vector<double>{7.0});
+  BOOST_CHECK_EQUAL(selection.getNumberInstances(), 3);
+  BOOST_CHECK_EQUAL(selection.getDimension(), 2);
+  BOOST_CHECK_EQUAL(selection.getData().get(0, 0), -7.0);
+  BOOST_CHECK_EQUAL(selection.getData().get(0, 1), 0.7);
+  BOOST_CHECK_EQUAL(selection.getData().get(2, 0), 9.0);
+  std::remove(binaryFile.c_str());
+}
+
+BOOST_AUTO_TEST_CASE(test_mmap_provider_batches) {
+  std::string binaryFile = "test_dataread_binary_single.bin";
+  Dataset reference = CSVTools::readCSVFromFile("datadriven/datasets/dataread/simple.csv", true);
+  BinaryTools::writeBinaryToFile(binaryFile, reference, true, true);
+
+  {
+    MmapFileSampleProvider provider;
+    provider.readFile(binaryFile, true);
+    BOOST_CHECK_EQUAL(provider.getNumSamples(), 5);
+    BOOST_CHECK_EQUAL(provider.getDim(), 5);
+
+    std::unique_ptr<Dataset> first(provider.getNextSamples(3));
+    std::unique_ptr<Dataset> second(provider.getNextSamples(3));
+    BOOST_CHECK_EQUAL(first->getNumberInstances(), 3);
+    BOOST_CHECK_EQUAL(second->getNumberInstances(), 2);
+    for (size_t i = 0; i < 5; i++) {
+      const Dataset& batch = i < 3 ? *first : *second;
+      size_t row = i < 3 ? i : i - 3;
+      for (size_t d = 0; d < 5; d++) {
+        BOOST_CHECK_CLOSE(batch.getData().get(row, d),
+                          static_cast<float>(reference.getData().get(i, d)), 1e-4);
+      }
+      BOOST_CHECK_CLOSE(batch.getTargets().get(row),
+                        static_cast<float>(reference.getTargets().get(i)), 1e-4);
+    }
+  }
+  std::remove(binaryFile.c_str());
+}
+
+BOOST_AUTO_TEST_CASE(test_mmap_provider_clone_shuffled) {
+  std::string binaryFile = "test_dataread_binary_clone.bin";
+  Dataset reference = CSVTools::readCSVFromFile("datadriven/datasets/dataread/simple.csv", true);
+  BinaryTools::writeBinaryToFile(binaryFile, reference);
+
+  {
+    // the clone owns a copy of the shuffling functor, both providers can be destroyed and
+    // return the same permutation
+    std::unique_ptr<MmapFileSampleProvider> provider(
+        new MmapFileSampleProvider(new DataShufflingFunctorRandom(7)));
+    provider->readFile(binaryFile, true);
+    std::unique_ptr<sgpp::datadriven::SampleProvider> clone(provider->clone());
+    std::unique_ptr<Dataset> original(provider->getAllSamples());
+    provider.reset();
+
+    MmapFileSampleProvider assigned;
+    assigned = *dynamic_cast<MmapFileSampleProvider*>(clone.get());
+    std::unique_ptr<Dataset> cloned(clone->getAllSamples());
+    clone.reset();
+    std::unique_ptr<Dataset> copied(assigned.getAllSamples());
+
+    BOOST_CHECK(cloned->getData() == original->getData());
+    BOOST_CHECK(cloned->getTargets() == original->getTargets());
+    BOOST_CHECK(copied->getData() == original->getData());
+    BOOST_CHECK(copied->getTargets() == original->getTargets());
+  }
+  std::remove(binaryFile.c_str());
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -11,8 +11,12 @@
 
 #include <sgpp/datadriven/tools/Dataset.hpp>
 #include <sgpp/datadriven/tools/CSVTools.hpp>
+#include <sgpp/datadriven/tools/ParallelDataParser.hpp>
 
+#include <cstdio>
+#include <cstdlib>
 #include <string>
+#include <sstream>
 #include <iostream>
 #include <vector>
 
@@ -175,4 +179,57 @@ BOOST_AUTO_TEST_CASE(test_read_csv_old) {
   }
 }
 
+BOOST_AUTO_TEST_CASE(test_parallel_chunks) {
+  // input spans several chunks so that it is parsed concurrently
+  const size_t numRows = 50000;
+  std::ostringstream input;
+  input << "x,y,class" << std::endl;
+  std::vector<double> values;
+  char buffer[64];
+  for (size_t i = 0; i < numRows; i++) {
+    for (size_t j = 0; j < 2; j++) {
+      const double value = (static_cast<double>(i) - 1e4) / 7.0;
+      // alternate between several number formats
+      switch ((i + j) % 4) {
+        case 0:
+          snprintf(buffer, sizeof(buffer), "%.17g", value);
+          break;
+        case 1:
+          snprintf(buffer, sizeof(buffer), "%.3f", value);
+          break;
+        case 2:
+          snprintf(buffer, sizeof(buffer), "%g", value);
+          break;
+        default:
+          snprintf(buffer, sizeof(buffer), "%.10e", value);
+          break;
+      }
+      values.push_back(strtod(buffer, nullptr));
+      input << buffer << ",";
+    }
+    input << (i % 3) << std::endl;
+  }
+  BOOST_CHECK_GT(input.str().size(), sgpp::datadriven::ParallelDataParser::minChunkSize);
+
+  std::istringstream stream(input.str());
+  Dataset d = CSVTools::readCSV(stream, true, true);
+  BOOST_CHECK_EQUAL(d.getNumberInstances(), numRows);
+  BOOST_CHECK_EQUAL(d.getDimension(), 2);
+  for (size_t i = 0; i < numRows; i++) {
+    // conversion has to match strtod exactly
+    BOOST_CHECK_EQUAL(d.getData().get(i, 0), values[2 * i]);
+    BOOST_CHECK_EQUAL(d.getData().get(i, 1), values[2 * i + 1]);
+    BOOST_CHECK_EQUAL(d.getTargets().get(i), static_cast<double>(i % 3));
+  }
+
+  // selected class and cutoff have to keep the order of the file
+  std::istringstream selectionStream(input.str());
+  Dataset selection = CSVTools::readCSV(selectionStream, true, true, 1000,
+                                        std::vector<size_t>{1}, std::vector<double>{2.0});
+  BOOST_CHECK_EQUAL(selection.getNumberInstances(), 1000);
+  for (size_t i = 0; i < selection.getNumberInstances(); i++) {
+    BOOST_CHECK_EQUAL(selection.getData().get(i, 0), values[2 * (3 * i + 2) + 1]);
+  }
+}
+
 BOOST_AUTO_TEST_SUITE_END()
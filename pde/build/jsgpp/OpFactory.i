@@ -19,3 +19,7 @@
     sgpp::base::Grid& grid);
 %newobject sgpp::op_factory::createOperationLaplaceEnhanced(
     sgpp::base::Grid& grid, sgpp::base::DataVector& coef);
+%newobject sgpp::op_factory::createOperationLaplaceStencil(
+    sgpp::base::Grid& grid);
+%newobject sgpp::op_factory::createOperationLTwoDotProductStencil(
+    sgpp::base::Grid& grid);
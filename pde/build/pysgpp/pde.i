@@ -24,8 +24,10 @@
 %include "pde/src/sgpp/pde/operation/hash/OperationParabolicPDESolverSystemDirichlet.hpp"
 
 %include "pde/src/sgpp/pde/algorithm/HeatEquationParabolicPDESolverSystem.hpp"
+%include "pde/src/sgpp/pde/algorithm/PrewaveletPreconditioner.hpp"
 
 %include "pde/src/sgpp/pde/application/PDESolver.hpp"
+%include "solver/src/sgpp/solver/ode/TimestepStatistics.hpp"
 %include "pde/src/sgpp/pde/application/ParabolicPDESolver.hpp"
 %include "pde/src/sgpp/pde/application/HeatEquationSolver.hpp"
 %include "pde/src/sgpp/pde/application/HeatEquationSolver.hpp"
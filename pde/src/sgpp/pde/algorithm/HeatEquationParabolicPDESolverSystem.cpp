@@ -20,11 +20,18 @@ HeatEquationParabolicPDESolverSystem::HeatEquationParabolicPDESolverSystem(
   this->a = a;
   this->tOperationMode = OperationMode;
   this->TimestepSize = TimestepSize;
+  this->TimestepSize_old = TimestepSize;
   this->BoundGrid = &SparseGrid;
   this->alpha_complete = &alpha;
   this->InnerGrid = nullptr;
   this->alpha_inner = nullptr;
 
+  // history of the solution, needed by the step size controls
+  this->alpha_complete_old = new sgpp::base::DataVector(*this->alpha_complete);
+  this->alpha_complete_tmp = new sgpp::base::DataVector(*this->alpha_complete);
+  this->oldGridStorage = new sgpp::base::GridStorage(SparseGrid.getStorage());
+  this->secondGridStorage = new sgpp::base::GridStorage(SparseGrid.getStorage());
+
   this->BoundaryUpdate = new sgpp::base::DirichletUpdateVector(SparseGrid.getStorage());
   this->GridConverter = new sgpp::base::DirichletGridConverter();
 
@@ -61,6 +68,11 @@ HeatEquationParabolicPDESolverSystem::~HeatEquationParabolicPDESolverSystem() {
   }
 
   delete this->rhs;
+
+  delete this->alpha_complete_old;
+  delete this->alpha_complete_tmp;
+  delete this->oldGridStorage;
+  delete this->secondGridStorage;
 }
 
 void HeatEquationParabolicPDESolverSystem::applyMassMatrixComplete(sgpp::base::DataVector& alpha,
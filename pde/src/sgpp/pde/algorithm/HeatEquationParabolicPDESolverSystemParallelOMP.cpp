@@ -7,14 +7,11 @@
 #include <sgpp/base/exception/algorithm_exception.hpp>
 
 #include <sgpp/pde/algorithm/StdUpDown.hpp>
+#include <sgpp/pde/algorithm/UpDownAccumulator.hpp>
 #include <sgpp/pde/algorithm/UpDownOneOpDim.hpp>
 
 #include <sgpp/pde/operation/PdeOpFactory.hpp>
 
-#ifdef _OPENMP
-#include <omp.h>
-#endif
-
 #include <sgpp/globaldef.hpp>
 
 #include <vector>
@@ -88,45 +85,29 @@ void HeatEquationParabolicPDESolverSystemParallelOMP::applyMassMatrixComplete(
 
 void HeatEquationParabolicPDESolverSystemParallelOMP::applyLOperatorComplete(
     sgpp::base::DataVector& alpha, sgpp::base::DataVector& result) {
-  result.setAll(0.0);
-
-  sgpp::base::DataVector temp(alpha.getSize());
-
   std::vector<size_t> algoDims = this->InnerGrid->getStorage().getAlgorithmicDimensions();
   size_t nDims = algoDims.size();
-#ifdef _OPENMP
-  omp_lock_t Mutex;
-  omp_init_lock(&Mutex);
-#endif
+  // the tasks are executed by the current team, every thread sums up its own results
+  UpDownAccumulator accumulator(result.getSize());
 
   // Apply Laplace, parallel in Dimensions
   for (size_t i = 0; i < nDims; i++) {
-#pragma omp task firstprivate(i) shared(alpha, temp, result, algoDims)
+#pragma omp task firstprivate(i) shared(alpha, accumulator, algoDims)
     {
-      sgpp::base::DataVector myResult(result.getSize());
+      sgpp::base::DataVector& myResult = accumulator.acquireScratch();
 
       /// discuss methods in order to avoid this cast
       reinterpret_cast<UpDownOneOpDim*>(this->OpLaplaceBound)
           ->multParallelBuildingBlock(alpha, myResult, algoDims[i]);
 
-// semaphore
-#ifdef _OPENMP
-      omp_set_lock(&Mutex);
-#endif
-      temp.add(myResult);
-#ifdef _OPENMP
-      omp_unset_lock(&Mutex);
-#endif
+      accumulator.add((-1.0) * this->a, myResult);
+      accumulator.releaseScratch(myResult);
     }
   }
 
 #pragma omp taskwait
 
-#ifdef _OPENMP
-  omp_destroy_lock(&Mutex);
-#endif
-
-  result.axpy((-1.0) * this->a, temp);
+  accumulator.reduce(result);
 }
 
 void HeatEquationParabolicPDESolverSystemParallelOMP::applyMassMatrixInner(
@@ -142,45 +123,29 @@ void HeatEquationParabolicPDESolverSystemParallelOMP::applyMassMatrixInner(
 
 void HeatEquationParabolicPDESolverSystemParallelOMP::applyLOperatorInner(
     sgpp::base::DataVector& alpha, sgpp::base::DataVector& result) {
-  result.setAll(0.0);
-
-  sgpp::base::DataVector temp(alpha.getSize());
-
   std::vector<size_t> algoDims = this->InnerGrid->getStorage().getAlgorithmicDimensions();
   size_t nDims = algoDims.size();
-#ifdef _OPENMP
-  omp_lock_t Mutex;
-  omp_init_lock(&Mutex);
-#endif
+  // the tasks are executed by the current team, every thread sums up its own results
+  UpDownAccumulator accumulator(result.getSize());
 
   // Apply Laplace, parallel in Dimensions
   for (size_t i = 0; i < nDims; i++) {
-#pragma omp task firstprivate(i) shared(alpha, temp, result, algoDims)
+#pragma omp task firstprivate(i) shared(alpha, accumulator, algoDims)
     {
-      sgpp::base::DataVector myResult(result.getSize());
+      sgpp::base::DataVector& myResult = accumulator.acquireScratch();
 
       /// discuss methods in order to avoid this cast
       reinterpret_cast<UpDownOneOpDim*>(this->OpLaplaceInner)
           ->multParallelBuildingBlock(alpha, myResult, algoDims[i]);
 
-// semaphore
-#ifdef _OPENMP
-      omp_set_lock(&Mutex);
-#endif
-      temp.add(myResult);
-#ifdef _OPENMP
-      omp_unset_lock(&Mutex);
-#endif
+      accumulator.add((-1.0) * this->a, myResult);
+      accumulator.releaseScratch(myResult);
     }
   }
 
 #pragma omp taskwait
 
-#ifdef _OPENMP
-  omp_destroy_lock(&Mutex);
-#endif
-
-  result.axpy((-1.0) * this->a, temp);
+  accumulator.reduce(result);
 }
 
 void HeatEquationParabolicPDESolverSystemParallelOMP::finishTimestep() {
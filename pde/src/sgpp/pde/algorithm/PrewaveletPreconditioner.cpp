@@ -0,0 +1,303 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#include <sgpp/pde/algorithm/PrewaveletPreconditioner.hpp>
+#include <sgpp/base/exception/solver_exception.hpp>
+#include <sgpp/base/grid/common/BoundingBox.hpp>
+
+#include <sgpp/globaldef.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+namespace sgpp {
+namespace pde {
+
+namespace {
+
+/**
+ * Coefficients of the prewavelet of level level >= 1 and index index in the nodal basis of
+ * level level (the prewavelets next to the boundary have 0.9 instead of 1 as central coefficient,
+ * the one of level 1 is the hat function itself)
+ */
+void getNodalCoefficients(sgpp::base::level_t level, sgpp::base::index_t index,
+                          std::vector<sgpp::base::index_t>& indices,
+                          std::vector<double>& weights) {
+  indices.clear();
+  weights.clear();
+
+  if (level == 1) {
+    indices.push_back(index);
+    weights.push_back(1.0);
+    return;
+  }
+
+  const int64_t maxIndex = (static_cast<int64_t>(1) << level) - 1;
+  const int64_t i = static_cast<int64_t>(index);
+  const double center = ((i == 1) || (i == maxIndex)) ? 0.9 : 1.0;
+  const double stencil[5] = {0.1, -0.6, center, -0.6, 0.1};
+
+  for (int64_t k = -2; k <= 2; k++) {
+    if ((i + k >= 1) && (i + k <= maxIndex)) {
+      indices.push_back(static_cast<sgpp::base::index_t>(i + k));
+      weights.push_back(stencil[k + 2]);
+    }
+  }
+}
+
+}  // namespace
+
+PrewaveletPreconditioner::PrewaveletPreconditioner(sgpp::base::GridStorage& storage,
+                                                   double massWeight, double stiffnessWeight)
+    : storage(storage), massWeight(massWeight), stiffnessWeight(stiffnessWeight) {}
+
+PrewaveletPreconditioner::~PrewaveletPreconditioner() {}
+
+void PrewaveletPreconditioner::prepare(sgpp::base::OperationMatrix& SystemMatrix, size_t size) {
+  if (inverseDiagonal.getSize() == size) {
+    return;
+  }
+
+  if (storage.getSize() != size) {
+    throw sgpp::base::solver_exception(
+        "PrewaveletPreconditioner::prepare : size of the grid does not match the system");
+  }
+
+  dims = storage.getAlgorithmicDimensions();
+  transformations.assign(dims.size(), Transformation());
+  transposedTransformations.assign(dims.size(), Transformation());
+
+  sgpp::base::DataVector mass(size, 1.0);
+  sgpp::base::DataVector stiffnessOverMass(size, 0.0);
+
+  for (size_t n = 0; n < dims.size(); n++) {
+    computeTransformation(n, mass, stiffnessOverMass);
+  }
+
+  // the dimensions without transformation are scaled as in the hierarchical basis
+  sgpp::base::BoundingBox* boundingBox = storage.getBoundingBox();
+
+  for (size_t d = 0; d < storage.getDimension(); d++) {
+    if (std::find(dims.begin(), dims.end(), d) != dims.end()) {
+      continue;
+    }
+
+    const double q = boundingBox->getIntervalWidth(d);
+
+    for (size_t i = 0; i < size; i++) {
+      const int level = static_cast<int>(storage.getPoint(i).getLevel(d));
+      const double m1d = q * ((level == 0) ? (1.0 / 3.0) : (2.0 / 3.0) * std::ldexp(1.0, -level));
+      const double s1d = ((level == 0) ? 1.0 : 2.0 * std::ldexp(1.0, level)) / q;
+      mass[i] *= m1d;
+      stiffnessOverMass[i] += s1d / m1d;
+    }
+  }
+
+  inverseDiagonal.resize(size);
+
+  for (size_t i = 0; i < size; i++) {
+    const double diagonal = massWeight * mass[i] + stiffnessWeight * mass[i] * stiffnessOverMass[i];
+    inverseDiagonal[i] = (diagonal > 0.0) ? (1.0 / diagonal) : 1.0;
+  }
+
+  temp.resize(size);
+  temp2.resize(size);
+}
+
+void PrewaveletPreconditioner::apply(sgpp::base::DataVector& r, sgpp::base::DataVector& result) {
+  const size_t size = r.getSize();
+  temp = r;
+
+  // T^T = T_1^T * ... * T_n^T
+  for (size_t n = dims.size(); n-- > 0;) {
+    transposedTransformations[n].apply(temp, temp2);
+    temp.swap(temp2);
+  }
+
+#pragma omp parallel for schedule(static)
+  for (size_t i = 0; i < size; i++) {
+    temp[i] *= inverseDiagonal[i];
+  }
+
+  // T = T_n * ... * T_1
+  for (size_t n = 0; n < dims.size(); n++) {
+    transformations[n].apply(temp, temp2);
+    temp.swap(temp2);
+  }
+
+  result = temp;
+}
+
+void PrewaveletPreconditioner::reset() {
+  inverseDiagonal.resize(0);
+  transformations.clear();
+  transposedTransformations.clear();
+}
+
+void PrewaveletPreconditioner::Transformation::apply(const sgpp::base::DataVector& alpha,
+                                                     sgpp::base::DataVector& result) const {
+  const size_t numRows = offsets.size() - 1;
+  const size_t* ptrOffsets = offsets.data();
+  const size_t* ptrColumns = columns.data();
+  const double* ptrWeights = weights.data();
+  const double* ptrAlpha = alpha.data();
+  double* ptrResult = result.getPointer();
+
+#pragma omp parallel for schedule(static)
+  for (size_t i = 0; i < numRows; i++) {
+    double sum = 0.0;
+
+    for (size_t k = ptrOffsets[i]; k < ptrOffsets[i + 1]; k++) {
+      sum += ptrWeights[k] * ptrAlpha[ptrColumns[k]];
+    }
+
+    ptrResult[i] = sum;
+  }
+}
+
+void PrewaveletPreconditioner::computeTransformation(size_t n, sgpp::base::DataVector& mass,
+                                                     sgpp::base::DataVector& stiffnessOverMass) {
+  const size_t dim = dims[n];
+  const size_t size = storage.getSize();
+  const double q = storage.getBoundingBox()->getIntervalWidth(dim);
+
+  // row i of the transposed transformation: the hierarchical hat functions the prewavelet of
+  // grid point i consists of
+  std::vector<std::vector<std::pair<size_t, double>>> rows(size);
+
+#pragma omp parallel
+  {
+    std::vector<sgpp::base::index_t> indices;
+    std::vector<double> weights;
+
+#pragma omp for schedule(static)
+    for (size_t i = 0; i < size; i++) {
+      std::vector<std::pair<size_t, double>>& row = rows[i];
+      sgpp::base::GridPoint point(storage.getPoint(i));
+      sgpp::base::level_t level;
+      sgpp::base::index_t index;
+      point.get(dim, level, index);
+
+      if (level == 0) {
+        row.emplace_back(i, 1.0);
+        mass[i] *= q / 3.0;
+        stiffnessOverMass[i] += 3.0 / (q * q);
+        continue;
+      }
+
+      getNodalCoefficients(level, index, indices, weights);
+
+      // 1D integrals of the nodal expansion, the nodal hat functions of level l have the mass
+      // integrals 2/3 h (1/6 h for neighbors) and the stiffness integrals 2/h (-1/h)
+      const double h = std::ldexp(1.0, -static_cast<int>(level));
+      double m1d = 0.0;
+      double s1d = 0.0;
+
+      for (size_t k = 0; k < indices.size(); k++) {
+        const double left = ((k > 0) && (indices[k - 1] + 1 == indices[k])) ? weights[k - 1] : 0.0;
+        const double right =
+            ((k + 1 < indices.size()) && (indices[k] + 1 == indices[k + 1])) ? weights[k + 1]
+                                                                               : 0.0;
+        m1d += weights[k] * (4.0 * weights[k] + left + right);
+        s1d += weights[k] * (2.0 * weights[k] - left - right);
+      }
+
+      m1d *= q * h / 6.0;
+      s1d /= q * h;
+      mass[i] *= m1d;
+      stiffnessOverMass[i] += s1d / m1d;
+
+      for (size_t k = 0; k < indices.size(); k++) {
+        // the nodal hat function of an odd index is the hierarchical one, the one of an even index
+        // is the hierarchical hat function of its point minus half of the hierarchical hat
+        // functions of the finer levels next to it
+        sgpp::base::level_t nodeLevel = level;
+        sgpp::base::index_t nodeIndex = indices[k];
+
+        while ((nodeIndex & 1) == 0) {
+          nodeLevel--;
+          nodeIndex >>= 1;
+        }
+
+        point.set(dim, nodeLevel, nodeIndex);
+        const size_t seq = storage.getSequenceNumber(point);
+
+        if (seq < size) {
+          row.emplace_back(seq, weights[k]);
+        }
+
+        for (sgpp::base::level_t l = nodeLevel + 1; l <= level; l++) {
+          const sgpp::base::index_t center = nodeIndex << (l - nodeLevel);
+
+          for (sgpp::base::index_t neighbor : {center - 1, center + 1}) {
+            point.set(dim, l, neighbor);
+            const size_t seqNeighbor = storage.getSequenceNumber(point);
+
+            if (seqNeighbor < size) {
+              row.emplace_back(seqNeighbor, -0.5 * weights[k]);
+            }
+          }
+        }
+      }
+
+      // merge the contributions to the same hat function
+      std::sort(row.begin(), row.end());
+      size_t numEntries = 0;
+
+      for (size_t k = 0; k < row.size(); k++) {
+        if ((numEntries > 0) && (row[numEntries - 1].first == row[k].first)) {
+          row[numEntries - 1].second += row[k].second;
+        } else {
+          row[numEntries++] = row[k];
+        }
+      }
+
+      row.resize(numEntries);
+    }
+  }
+
+  Transformation& transposed = transposedTransformations[n];
+  Transformation& forward = transformations[n];
+  transposed.offsets.assign(size + 1, 0);
+  forward.offsets.assign(size + 1, 0);
+
+  for (size_t i = 0; i < size; i++) {
+    transposed.offsets[i + 1] = transposed.offsets[i] + rows[i].size();
+
+    for (const std::pair<size_t, double>& entry : rows[i]) {
+      forward.offsets[entry.first + 1]++;
+    }
+  }
+
+  for (size_t i = 0; i < size; i++) {
+    forward.offsets[i + 1] += forward.offsets[i];
+  }
+
+  transposed.columns.resize(transposed.offsets[size]);
+  transposed.weights.resize(transposed.offsets[size]);
+  forward.columns.resize(forward.offsets[size]);
+  forward.weights.resize(forward.offsets[size]);
+  std::vector<size_t> position(forward.offsets.begin(), forward.offsets.end() - 1);
+
+  for (size_t i = 0; i < size; i++) {
+    size_t k = transposed.offsets[i];
+
+    for (const std::pair<size_t, double>& entry : rows[i]) {
+      transposed.columns[k] = entry.first;
+      transposed.weights[k] = entry.second;
+      k++;
+
+      const size_t m = position[entry.first]++;
+      forward.columns[m] = i;
+      forward.weights[m] = entry.second;
+    }
+  }
+}
+
+}  // namespace pde
+}  // namespace sgpp
@@ -0,0 +1,111 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#ifndef PREWAVELETPRECONDITIONER_HPP
+#define PREWAVELETPRECONDITIONER_HPP
+
+#include <sgpp/base/grid/GridStorage.hpp>
+#include <sgpp/base/datatypes/DataVector.hpp>
+#include <sgpp/solver/sle/preconditioner/Preconditioner.hpp>
+
+#include <sgpp/globaldef.hpp>
+
+#include <vector>
+
+namespace sgpp {
+namespace pde {
+
+/**
+ * Multilevel preconditioner for m * mass matrix + s * Laplacian on piecewise linear sparse grids
+ * (hierarchical hat functions, e.g. the inner grids of the Dirichlet solver systems).
+ *
+ * The hierarchical basis is not stable in \f$H^1\f$, its level-scaled diagonal only compensates
+ * the scaling of the levels, but not the coupling of a basis function with its hierarchical
+ * ancestors. The prewavelets
+ * \f$\psi_{l,i} = \phi_{l,i} - \frac{3}{5}(\phi_{l,i-1} + \phi_{l,i+1})
+ * + \frac{1}{10}(\phi_{l,i-2} + \phi_{l,i+2})\f$ (nodal hat functions of level l, see
+ * ConvertPrewaveletToLinear) are orthogonal to all coarser levels and form a multilevel splitting
+ * of the sparse grid space whose subspaces are almost decoupled. The preconditioner is the
+ * diagonal scaling in the prewavelet basis, i.e. an additive subspace correction
+ * \f$M^{-1} = T D^{-1} T^T\f$ with the basis change T from prewavelet to hierarchical
+ * coefficients and the diagonal D of the operator in the prewavelet basis. With it the number of
+ * CG iterations hardly grows with the level.
+ *
+ * T is the product of 1D transformations of all algorithmic dimensions, they are computed once as
+ * sparse rows (the prewavelet of a point and the hierarchical hat functions it consists of). On
+ * regular sparse grids the basis change is exact, on adaptive grids the parts of the prewavelets
+ * outside of the grid are dropped, which keeps the preconditioner symmetric positive definite.
+ * Boundary points (level 0) are kept as they are.
+ */
+class PrewaveletPreconditioner : public sgpp::solver::Preconditioner {
+ public:
+  /**
+   * Constructor
+   *
+   * @param storage the grid storage, the order of the unknowns is the order of the grid points
+   * @param massWeight weight m of the mass matrix
+   * @param stiffnessWeight weight s of the Laplacian
+   */
+  PrewaveletPreconditioner(sgpp::base::GridStorage& storage, double massWeight,
+                           double stiffnessWeight);
+
+  /**
+   * Std-Destructor
+   */
+  virtual ~PrewaveletPreconditioner();
+
+  virtual void prepare(sgpp::base::OperationMatrix& SystemMatrix, size_t size);
+
+  virtual void apply(sgpp::base::DataVector& r, sgpp::base::DataVector& result);
+
+  virtual void reset();
+
+ private:
+  /**
+   * Sparse rows of a 1D transformation, row i consists of the entries offsets[i] to
+   * offsets[i + 1] - 1
+   */
+  struct Transformation {
+    /// start of the rows
+    std::vector<size_t> offsets;
+    /// sequence numbers of the coupled grid points
+    std::vector<size_t> columns;
+    /// weights of the couplings
+    std::vector<double> weights;
+
+    /**
+     * Applies the transformation, result_i = sum_k weights_k * alpha_columns_k
+     */
+    void apply(const sgpp::base::DataVector& alpha, sgpp::base::DataVector& result) const;
+  };
+
+  /**
+   * Computes the transformations of the n-th algorithmic dimension, multiplies the 1D mass
+   * integrals of the prewavelets into mass and adds the ratios of the 1D stiffness and mass
+   * integrals to stiffnessOverMass
+   */
+  void computeTransformation(size_t n, sgpp::base::DataVector& mass,
+                             sgpp::base::DataVector& stiffnessOverMass);
+
+  sgpp::base::GridStorage& storage;
+  double massWeight;
+  double stiffnessWeight;
+  /// algorithmic dimensions the transformations have been computed for
+  std::vector<size_t> dims;
+  /// rows of the 1D transformations T_d (hierarchical coefficients of the prewavelets)
+  std::vector<Transformation> transformations;
+  /// rows of the transposed 1D transformations
+  std::vector<Transformation> transposedTransformations;
+  /// inverse of the diagonal in the prewavelet basis
+  sgpp::base::DataVector inverseDiagonal;
+  /// temporary vectors of apply()
+  sgpp::base::DataVector temp;
+  sgpp::base::DataVector temp2;
+};
+
+}  // namespace pde
+}  // namespace sgpp
+
+#endif /* PREWAVELETPRECONDITIONER_HPP */
@@ -0,0 +1,100 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#include <sgpp/pde/algorithm/UpDownAccumulator.hpp>
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+#include <sgpp/globaldef.hpp>
+
+#include <algorithm>
+#include <memory>
+#include <vector>
+
+namespace sgpp {
+namespace pde {
+
+UpDownAccumulator::UpDownAccumulator(size_t size) : size(size) {
+  size_t numThreads = 1;
+
+#ifdef _OPENMP
+  // the tasks are either executed by the current team or by a new (nested) parallel region
+  numThreads = static_cast<size_t>(std::max(omp_get_num_threads(), omp_get_max_threads()));
+#endif
+
+  buffers.resize(numThreads, sgpp::base::DataVector(0));
+}
+
+UpDownAccumulator::~UpDownAccumulator() {}
+
+void UpDownAccumulator::add(double coef, sgpp::base::DataVector& beta) {
+  size_t thread = 0;
+
+#ifdef _OPENMP
+  thread = static_cast<size_t>(omp_get_thread_num());
+#endif
+
+  sgpp::base::DataVector& buffer = buffers[thread];
+
+  if (buffer.getSize() == 0) {
+    buffer.resize(size);
+    buffer.setAll(0.0);
+  }
+
+  buffer.axpy(coef, beta);
+}
+
+sgpp::base::DataVector& UpDownAccumulator::acquireScratch() {
+  sgpp::base::DataVector* scratch = nullptr;
+
+#pragma omp critical(UpDownAccumulatorScratch)
+  {
+    if (freeScratchVectors.empty()) {
+      scratchVectors.emplace_back(new sgpp::base::DataVector(size));
+      scratch = scratchVectors.back().get();
+    } else {
+      scratch = freeScratchVectors.back();
+      freeScratchVectors.pop_back();
+    }
+  }
+
+  scratch->setAll(0.0);
+  return *scratch;
+}
+
+void UpDownAccumulator::releaseScratch(sgpp::base::DataVector& scratch) {
+#pragma omp critical(UpDownAccumulatorScratch)
+  freeScratchVectors.push_back(&scratch);
+}
+
+void UpDownAccumulator::reduce(sgpp::base::DataVector& result) {
+  std::vector<double*> used;
+
+  for (sgpp::base::DataVector& buffer : buffers) {
+    if (buffer.getSize() == size) {
+      used.push_back(buffer.getPointer());
+    }
+  }
+
+  result.resize(size);
+  double* ptrResult = result.getPointer();
+  const size_t numUsed = used.size();
+
+#pragma omp parallel for schedule(static)
+  for (size_t i = 0; i < size; i++) {
+    double sum = 0.0;
+
+    for (size_t t = 0; t < numUsed; t++) {
+      sum += used[t][i];
+    }
+
+    ptrResult[i] = sum;
+  }
+}
+
+}  // namespace pde
+}  // namespace sgpp
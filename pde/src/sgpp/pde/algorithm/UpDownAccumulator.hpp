@@ -0,0 +1,89 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#ifndef UPDOWNACCUMULATOR_HPP
+#define UPDOWNACCUMULATOR_HPP
+
+#include <sgpp/base/datatypes/DataVector.hpp>
+
+#include <sgpp/globaldef.hpp>
+
+#include <memory>
+#include <vector>
+
+namespace sgpp {
+namespace pde {
+
+/**
+ * Sums up the results of the OpenMP tasks of an Up/Down operator.
+ *
+ * Every thread of the team that executes the tasks adds into its own buffer, so no critical
+ * section is needed. The buffers are allocated when the thread adds its first result and are
+ * summed up once after all tasks have finished. The accumulator can be used for tasks of the
+ * current team as well as for tasks of a parallel region that is started afterwards.
+ *
+ * The tasks compute their results in scratch vectors of the accumulator, which are reused by
+ * later tasks. The scratch vectors can't be per thread: at the taskwaits of the recursion a
+ * thread may start another task before the suspended one has finished. Instead, only as many
+ * scratch vectors are allocated as tasks are in progress at the same time.
+ */
+class UpDownAccumulator {
+ public:
+  /**
+   * Constructor
+   *
+   * @param size size of the accumulated vectors
+   */
+  explicit UpDownAccumulator(size_t size);
+
+  /**
+   * Destructor
+   */
+  ~UpDownAccumulator();
+
+  /**
+   * Adds coef * beta to the buffer of the calling thread
+   *
+   * @param coef coefficient of beta
+   * @param beta result of one task
+   */
+  void add(double coef, sgpp::base::DataVector& beta);
+
+  /**
+   * Returns a zero initialized scratch vector of the accumulated size for the result of one task
+   *
+   * @return scratch vector, owned by the accumulator until it is released
+   */
+  sgpp::base::DataVector& acquireScratch();
+
+  /**
+   * Returns a scratch vector to the accumulator, so that it can be reused by another task
+   *
+   * @param scratch vector returned by acquireScratch()
+   */
+  void releaseScratch(sgpp::base::DataVector& scratch);
+
+  /**
+   * Stores the sum of all buffers in result, has to be called after all tasks have finished
+   *
+   * @param result vector the sum is stored in
+   */
+  void reduce(sgpp::base::DataVector& result);
+
+ private:
+  /// size of the accumulated vectors
+  size_t size;
+  /// one buffer per thread, empty if the thread has not added anything
+  std::vector<sgpp::base::DataVector> buffers;
+  /// all scratch vectors that have been allocated
+  std::vector<std::unique_ptr<sgpp::base::DataVector>> scratchVectors;
+  /// scratch vectors that are currently not used by a task
+  std::vector<sgpp::base::DataVector*> freeScratchVectors;
+};
+
+}  // namespace pde
+}  // namespace sgpp
+
+#endif /* UPDOWNACCUMULATOR_HPP */
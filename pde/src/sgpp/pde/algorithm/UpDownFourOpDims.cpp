@@ -4,9 +4,13 @@
 // sgpp.sparsegrids.org
 
 #include <sgpp/pde/algorithm/UpDownFourOpDims.hpp>
+#include <sgpp/pde/algorithm/UpDownAccumulator.hpp>
 
 #include <sgpp/globaldef.hpp>
 
+#include <array>
+#include <vector>
+
 namespace sgpp {
 namespace pde {
 
@@ -78,42 +82,45 @@ void UpDownFourOpDims::updown(sgpp::base::DataVector& alpha, sgpp::base::DataVec
 }
 
 void UpDownFourOpDims::mult(sgpp::base::DataVector& alpha, sgpp::base::DataVector& result) {
-  result.setAll(0.0);
+  // tuples of dimensions with a vanishing coefficient don't contribute, no tasks are spawned
+  // for them
+  std::vector<std::array<size_t, 4>> opDims;
+
+  for (size_t i = 0; i < this->numAlgoDims_; i++) {
+    for (size_t j = 0; j < this->numAlgoDims_; j++) {
+      for (size_t k = 0; k < this->numAlgoDims_; k++) {
+        for (size_t l = 0; l < this->numAlgoDims_; l++) {
+          if ((this->coefs == nullptr) || (this->coefs[i][j][k][l] != 0.0)) {
+            opDims.push_back({{i, j, k, l}});
+          }
+        }
+      }
+    }
+  }
 
-#pragma omp parallel
+  UpDownAccumulator accumulator(result.getSize());
+
+#pragma omp parallel shared(opDims, accumulator)
   {
-#pragma omp single nowait
+#pragma omp single
     {
-      for (size_t i = 0; i < this->numAlgoDims_; i++) {
-        for (size_t j = 0; j < this->numAlgoDims_; j++) {
-          for (size_t k = 0; k < this->numAlgoDims_; k++) {
-            for (size_t l = 0; l < this->numAlgoDims_; l++) {
-#pragma omp task firstprivate(i, j) shared(alpha, result)
-              {
-                sgpp::base::DataVector beta(result.getSize());
-
-                if (this->coefs != nullptr) {
-                  if (this->coefs[i][j][k][l] != 0.0) {
-                    this->updown(alpha, beta, this->numAlgoDims_ - 1, i, j, k, l);
-
-#pragma omp critical
-                    { result.axpy(this->coefs[i][j][k][l], beta); }
-                  }
-                } else {
-                  this->updown(alpha, beta, this->numAlgoDims_ - 1, i, j, k, l);
-
-#pragma omp critical
-                  { result.add(beta); }
-                }
-              }
-            }
-          }
+      for (const std::array<size_t, 4>& dims : opDims) {
+#pragma omp task firstprivate(dims) shared(alpha, accumulator)
+        {
+          const size_t i = dims[0];
+          const size_t j = dims[1];
+          const size_t k = dims[2];
+          const size_t l = dims[3];
+          sgpp::base::DataVector& beta = accumulator.acquireScratch();
+          this->updown(alpha, beta, this->numAlgoDims_ - 1, i, j, k, l);
+          accumulator.add((this->coefs != nullptr) ? this->coefs[i][j][k][l] : 1.0, beta);
+          accumulator.releaseScratch(beta);
         }
       }
-
-#pragma omp taskwait
     }
   }
+
+  accumulator.reduce(result);
 }
 
 void UpDownFourOpDims::specialOpX(
@@ -4,9 +4,12 @@
 // sgpp.sparsegrids.org
 
 #include <sgpp/pde/algorithm/UpDownOneOpDim.hpp>
+#include <sgpp/pde/algorithm/UpDownAccumulator.hpp>
 
 #include <sgpp/globaldef.hpp>
 
+#include <vector>
+
 namespace sgpp {
 namespace pde {
 
@@ -25,55 +28,50 @@ UpDownOneOpDim::UpDownOneOpDim(sgpp::base::GridStorage* storage)
 UpDownOneOpDim::~UpDownOneOpDim() {}
 
 void UpDownOneOpDim::mult(sgpp::base::DataVector& alpha, sgpp::base::DataVector& result) {
-  result.setAll(0.0);
+  // dimensions with a vanishing coefficient don't contribute, no tasks are spawned for them
+  std::vector<size_t> opDims;
+
+  for (size_t i = 0; i < this->numAlgoDims_; i++) {
+    if ((this->coefs == nullptr) || (this->coefs->get(i) != 0.0)) {
+      opDims.push_back(i);
+    }
+  }
 
-#pragma omp parallel
+  UpDownAccumulator accumulator(result.getSize());
+
+#pragma omp parallel shared(opDims, accumulator)
   {
-#pragma omp single nowait
+#pragma omp single
     {
-      for (size_t i = 0; i < this->numAlgoDims_; i++) {
-#pragma omp task firstprivate(i) shared(alpha, result)
+      for (size_t i : opDims) {
+#pragma omp task firstprivate(i) shared(alpha, accumulator)
         {
-          sgpp::base::DataVector beta(result.getSize());
-
-          if (this->coefs != nullptr) {
-            if (this->coefs->get(i) != 0.0) {
-              this->updown(alpha, beta, this->numAlgoDims_ - 1, i);
-
-#pragma omp critical
-              { result.axpy(this->coefs->get(i), beta); }
-            }
-          } else {
-            this->updown(alpha, beta, this->numAlgoDims_ - 1, i);
-
-#pragma omp critical
-            { result.add(beta); }
-          }
+          sgpp::base::DataVector& beta = accumulator.acquireScratch();
+          this->updown(alpha, beta, this->numAlgoDims_ - 1, i);
+          accumulator.add((this->coefs != nullptr) ? this->coefs->get(i) : 1.0, beta);
+          accumulator.releaseScratch(beta);
         }
       }
-
-#pragma omp taskwait
     }
   }
+
+  accumulator.reduce(result);
 }
 
 void UpDownOneOpDim::multParallelBuildingBlock(sgpp::base::DataVector& alpha,
                                                sgpp::base::DataVector& result,
                                                size_t operationDim) {
+  // the recursion expects a zero initialized result (some operations are empty)
   result.setAll(0.0);
 
-  sgpp::base::DataVector beta(result.getSize());
-
-  if (this->coefs != nullptr) {
-    if (this->coefs->get(operationDim) != 0.0) {
-      this->updown(alpha, beta, this->numAlgoDims_ - 1, operationDim);
+  if ((this->coefs != nullptr) && (this->coefs->get(operationDim) == 0.0)) {
+    return;
+  }
 
-      result.axpy(this->coefs->get(operationDim), beta);
-    }
-  } else {
-    this->updown(alpha, beta, this->numAlgoDims_ - 1, operationDim);
+  this->updown(alpha, result, this->numAlgoDims_ - 1, operationDim);
 
-    result.add(beta);
+  if (this->coefs != nullptr) {
+    result.mult(this->coefs->get(operationDim));
   }
 }
 
@@ -0,0 +1,321 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#include <sgpp/pde/algorithm/UpDownStencils.hpp>
+#include <sgpp/base/grid/common/BoundingBox.hpp>
+
+#include <sgpp/globaldef.hpp>
+
+#include <cmath>
+#include <vector>
+
+namespace sgpp {
+namespace pde {
+
+namespace {
+
+/**
+ * Collects the sequence numbers of the hierarchical ancestors of the grid point seq in dimension
+ * dim and the integrals \f$(\phi_a, \phi_{seq})\f$ on the unit interval
+ */
+void getAncestors(sgpp::base::GridStorage& storage, size_t seq, size_t dim, bool boundary,
+                  std::vector<size_t>& ancestors, std::vector<double>& weights) {
+  ancestors.clear();
+  weights.clear();
+
+  sgpp::base::GridPoint point(storage.getPoint(seq));
+  sgpp::base::level_t level;
+  sgpp::base::index_t index;
+  point.get(dim, level, index);
+
+  if (level == 0) {
+    // the right boundary function couples with the left one
+    if (index == 1) {
+      point.set(dim, 0, 0);
+      const size_t ancestor = storage.getSequenceNumber(point);
+
+      if (ancestor < storage.getSize()) {
+        ancestors.push_back(ancestor);
+        weights.push_back(1.0 / 6.0);
+      }
+    }
+
+    return;
+  }
+
+  const double h = 1.0 / static_cast<double>(1 << level);
+  const double x = static_cast<double>(index) * h;
+
+  // the ancestor is linear on the support, so the integral is h times its value at x
+  sgpp::base::level_t ancestorLevel = level;
+  sgpp::base::index_t ancestorIndex = index;
+
+  while (ancestorLevel > 1) {
+    ancestorLevel--;
+    ancestorIndex = (ancestorIndex >> 1) | 1;
+    point.set(dim, ancestorLevel, ancestorIndex);
+    const size_t ancestor = storage.getSequenceNumber(point);
+
+    if (ancestor < storage.getSize()) {
+      ancestors.push_back(ancestor);
+      weights.push_back(h * (1.0 - std::fabs(static_cast<double>(1 << ancestorLevel) * x -
+                                             static_cast<double>(ancestorIndex))));
+    }
+  }
+
+  if (boundary) {
+    for (sgpp::base::index_t boundaryIndex = 0; boundaryIndex < 2; boundaryIndex++) {
+      point.set(dim, 0, boundaryIndex);
+      const size_t ancestor = storage.getSequenceNumber(point);
+
+      if (ancestor < storage.getSize()) {
+        ancestors.push_back(ancestor);
+        weights.push_back(h * ((boundaryIndex == 0) ? (1.0 - x) : x));
+      }
+    }
+  }
+}
+
+}  // namespace
+
+UpDownStencils::UpDownStencils(sgpp::base::GridStorage& storage, bool boundary, bool laplace)
+    : size(storage.getSize()),
+      upStencils(storage.getDimension()),
+      downStencils(storage.getDimension()),
+      upOpDimStencils(storage.getDimension()),
+      downOpDimStencils(storage.getDimension()) {
+  for (size_t dim : storage.getAlgorithmicDimensions()) {
+    computeStencils(storage, boundary, laplace, dim);
+  }
+}
+
+UpDownStencils::~UpDownStencils() {}
+
+void UpDownStencils::up(sgpp::base::DataVector& alpha, sgpp::base::DataVector& result,
+                        size_t dim) const {
+  upStencils[dim].apply(alpha, result);
+}
+
+void UpDownStencils::down(sgpp::base::DataVector& alpha, sgpp::base::DataVector& result,
+                          size_t dim) const {
+  downStencils[dim].apply(alpha, result);
+}
+
+void UpDownStencils::upOpDim(sgpp::base::DataVector& alpha, sgpp::base::DataVector& result,
+                             size_t dim) const {
+  upOpDimStencils[dim].apply(alpha, result);
+}
+
+void UpDownStencils::downOpDim(sgpp::base::DataVector& alpha, sgpp::base::DataVector& result,
+                               size_t dim) const {
+  downOpDimStencils[dim].apply(alpha, result);
+}
+
+void UpDownStencils::Stencil::apply(sgpp::base::DataVector& alpha,
+                                    sgpp::base::DataVector& result) const {
+  const size_t numRows = offsets.size() - 1;
+  const size_t* ptrOffsets = offsets.data();
+  const size_t* ptrColumns = columns.data();
+  const double* ptrWeights = weights.data();
+  const double* ptrAlpha = alpha.getPointer();
+  double* ptrResult = result.getPointer();
+
+#pragma omp parallel for schedule(static)
+  for (size_t i = 0; i < numRows; i++) {
+    double sum = 0.0;
+
+    for (size_t k = ptrOffsets[i]; k < ptrOffsets[i + 1]; k++) {
+      sum += ptrWeights[k] * ptrAlpha[ptrColumns[k]];
+    }
+
+    ptrResult[i] = sum;
+  }
+}
+
+void UpDownStencils::computeStencils(sgpp::base::GridStorage& storage, bool boundary,
+                                     bool laplace, size_t dim) {
+  sgpp::base::BoundingBox* boundingBox = storage.getBoundingBox();
+  const double q = boundingBox->getIntervalWidth(dim);
+  const bool dirichletLeft = boundary && boundingBox->hasDirichletBoundaryLeft(dim);
+  const bool dirichletRight = boundary && boundingBox->hasDirichletBoundaryRight(dim);
+
+  // the rows of boundary points with Dirichlet boundary conditions are zero
+  std::vector<char> zeroRow(size, 0);
+
+  for (size_t i = 0; i < size; i++) {
+    sgpp::base::level_t level;
+    sgpp::base::index_t index;
+    storage.getPoint(i).get(dim, level, index);
+
+    if (level == 0) {
+      zeroRow[i] = (index == 0) ? dirichletLeft : dirichletRight;
+    }
+  }
+
+  // down: the point itself (first entry of the row) and its ancestors
+  Stencil& down = downStencils[dim];
+  down.offsets.assign(size + 1, 0);
+
+#pragma omp parallel
+  {
+    std::vector<size_t> ancestors;
+    std::vector<double> weights;
+
+#pragma omp for schedule(static)
+    for (size_t i = 0; i < size; i++) {
+      if (!zeroRow[i]) {
+        getAncestors(storage, i, dim, boundary, ancestors, weights);
+        down.offsets[i + 1] = ancestors.size() + 1;
+      }
+    }
+  }
+
+  for (size_t i = 0; i < size; i++) {
+    down.offsets[i + 1] += down.offsets[i];
+  }
+
+  down.columns.resize(down.offsets[size]);
+  down.weights.resize(down.offsets[size]);
+
+#pragma omp parallel
+  {
+    std::vector<size_t> ancestors;
+    std::vector<double> weights;
+
+#pragma omp for schedule(static)
+    for (size_t i = 0; i < size; i++) {
+      if (zeroRow[i]) {
+        continue;
+      }
+
+      sgpp::base::level_t level;
+      sgpp::base::index_t index;
+      storage.getPoint(i).get(dim, level, index);
+
+      size_t k = down.offsets[i];
+      down.columns[k] = i;
+      down.weights[k] =
+          q * ((level == 0) ? (1.0 / 3.0) : ((2.0 / 3.0) / static_cast<double>(1 << level)));
+
+      getAncestors(storage, i, dim, boundary, ancestors, weights);
+
+      for (size_t j = 0; j < ancestors.size(); j++) {
+        k++;
+        down.columns[k] = ancestors[j];
+        down.weights[k] = q * weights[j];
+      }
+    }
+  }
+
+  // up: the transposed couplings of the descendants
+  Stencil& up = upStencils[dim];
+  up.offsets.assign(size + 1, 0);
+
+  std::vector<size_t> ancestors;
+  std::vector<double> weights;
+
+  for (size_t i = 0; i < size; i++) {
+    getAncestors(storage, i, dim, boundary, ancestors, weights);
+
+    for (size_t ancestor : ancestors) {
+      if (!zeroRow[ancestor]) {
+        up.offsets[ancestor + 1]++;
+      }
+    }
+  }
+
+  for (size_t i = 0; i < size; i++) {
+    up.offsets[i + 1] += up.offsets[i];
+  }
+
+  up.columns.resize(up.offsets[size]);
+  up.weights.resize(up.offsets[size]);
+  std::vector<size_t> position(up.offsets.begin(), up.offsets.end() - 1);
+
+  for (size_t i = 0; i < size; i++) {
+    getAncestors(storage, i, dim, boundary, ancestors, weights);
+
+    for (size_t j = 0; j < ancestors.size(); j++) {
+      if (!zeroRow[ancestors[j]]) {
+        const size_t k = position[ancestors[j]]++;
+        up.columns[k] = i;
+        up.weights[k] = q * weights[j];
+      }
+    }
+  }
+
+  if (!laplace) {
+    return;
+  }
+
+  // the derivatives of the hierarchical basis functions are orthogonal, only the boundary
+  // functions couple with each other
+  Stencil& downOpDim = downOpDimStencils[dim];
+  Stencil& upOpDim = upOpDimStencils[dim];
+  downOpDim.offsets.assign(size + 1, 0);
+  upOpDim.offsets.assign(size + 1, 0);
+  // sequence number of the opposite boundary point of a boundary point
+  std::vector<size_t> opposite(size, size);
+
+  for (size_t i = 0; i < size; i++) {
+    sgpp::base::level_t level;
+    sgpp::base::index_t index;
+    storage.getPoint(i).get(dim, level, index);
+
+    if (!zeroRow[i]) {
+      downOpDim.offsets[i + 1] = 1;
+
+      if (level == 0) {
+        sgpp::base::GridPoint point(storage.getPoint(i));
+        point.set(dim, 0, 1 - index);
+        opposite[i] = storage.getSequenceNumber(point);
+
+        if (opposite[i] < size) {
+          // the right row couples with the left boundary, the left one with the right boundary
+          if (index == 1) {
+            downOpDim.offsets[i + 1] += dirichletLeft ? 0 : 1;
+          } else {
+            upOpDim.offsets[i + 1] = 1;
+          }
+        }
+      }
+    }
+
+    downOpDim.offsets[i + 1] += downOpDim.offsets[i];
+    upOpDim.offsets[i + 1] += upOpDim.offsets[i];
+  }
+
+  downOpDim.columns.resize(downOpDim.offsets[size]);
+  downOpDim.weights.resize(downOpDim.offsets[size]);
+  upOpDim.columns.resize(upOpDim.offsets[size]);
+  upOpDim.weights.resize(upOpDim.offsets[size]);
+
+  for (size_t i = 0; i < size; i++) {
+    if (zeroRow[i]) {
+      continue;
+    }
+
+    sgpp::base::level_t level;
+    sgpp::base::index_t index;
+    storage.getPoint(i).get(dim, level, index);
+
+    const size_t k = downOpDim.offsets[i];
+    downOpDim.columns[k] = i;
+    downOpDim.weights[k] = ((level == 0) ? 1.0 : static_cast<double>(1 << (level + 1))) / q;
+
+    if (k + 1 < downOpDim.offsets[i + 1]) {
+      downOpDim.columns[k + 1] = opposite[i];
+      downOpDim.weights[k + 1] = -1.0 / q;
+    }
+
+    if (upOpDim.offsets[i] < upOpDim.offsets[i + 1]) {
+      upOpDim.columns[upOpDim.offsets[i]] = opposite[i];
+      upOpDim.weights[upOpDim.offsets[i]] = -1.0 / q;
+    }
+  }
+}
+
+}  // namespace pde
+}  // namespace sgpp
@@ -0,0 +1,128 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#ifndef UPDOWNSTENCILS_HPP
+#define UPDOWNSTENCILS_HPP
+
+#include <sgpp/base/grid/GridStorage.hpp>
+#include <sgpp/base/datatypes/DataVector.hpp>
+
+#include <sgpp/globaldef.hpp>
+
+#include <vector>
+
+namespace sgpp {
+namespace pde {
+
+/**
+ * Precomputed 1D stencils of the up/down sweeps of the L2 dot product and the Laplace operator
+ * for piecewise linear basis functions (with or without boundary).
+ *
+ * The 1D operations of the sweeps only couple hierarchical ancestors and descendants of the same
+ * pole: down(alpha)_i is the sum over the ancestors a of i (and i itself) of
+ * \f$(\phi_a, \phi_i) \alpha_a\f$, up(alpha)_i is the sum over the descendants. For every
+ * algorithmic dimension these couplings are computed once and stored as flat sparse rows
+ * (offsets, sequence numbers and weights), so an application is a parallel sweep over the rows
+ * instead of a recursive traversal of the grid. The results match the ones of PhiPhiUpBBLinear,
+ * PhiPhiDownBBLinear, DowndPhidPhiBBIterativeLinear and their boundary versions.
+ *
+ * The stencils are only valid for the grid they have been computed for, they have to be recomputed
+ * if the grid changes. As the sweeps, they require all hierarchical ancestors of the grid points.
+ */
+class UpDownStencils {
+ public:
+  /**
+   * Constructor, computes the stencils of all algorithmic dimensions
+   *
+   * @param storage the grid's storage
+   * @param boundary true if the grid has boundary points (level 0)
+   * @param laplace true if the stencils of the operation dimension of the Laplace operator
+   * (upOpDim(), downOpDim()) are needed
+   */
+  UpDownStencils(sgpp::base::GridStorage& storage, bool boundary, bool laplace);
+
+  /**
+   * Destructor
+   */
+  ~UpDownStencils();
+
+  /**
+   * Up of \f$(\phi, \phi)\f$ in dimension dim
+   *
+   * @param alpha the coefficients
+   * @param result the result
+   * @param dim the dimension
+   */
+  void up(sgpp::base::DataVector& alpha, sgpp::base::DataVector& result, size_t dim) const;
+
+  /**
+   * Down of \f$(\phi, \phi)\f$ in dimension dim
+   *
+   * @param alpha the coefficients
+   * @param result the result
+   * @param dim the dimension
+   */
+  void down(sgpp::base::DataVector& alpha, sgpp::base::DataVector& result, size_t dim) const;
+
+  /**
+   * Up of \f$(\phi', \phi')\f$ in dimension dim
+   *
+   * @param alpha the coefficients
+   * @param result the result
+   * @param dim the dimension
+   */
+  void upOpDim(sgpp::base::DataVector& alpha, sgpp::base::DataVector& result, size_t dim) const;
+
+  /**
+   * Down of \f$(\phi', \phi')\f$ in dimension dim
+   *
+   * @param alpha the coefficients
+   * @param result the result
+   * @param dim the dimension
+   */
+  void downOpDim(sgpp::base::DataVector& alpha, sgpp::base::DataVector& result, size_t dim) const;
+
+  /**
+   * @return the number of grid points the stencils have been computed for
+   */
+  size_t getSize() const { return size; }
+
+ private:
+  /**
+   * Sparse rows of a 1D operation, row i consists of the entries offsets[i] to offsets[i + 1] - 1
+   */
+  struct Stencil {
+    /// start of the rows
+    std::vector<size_t> offsets;
+    /// sequence numbers of the coupled grid points
+    std::vector<size_t> columns;
+    /// weights of the couplings
+    std::vector<double> weights;
+
+    /**
+     * Applies the stencil, result_i = sum_k weights_k * alpha_columns_k
+     */
+    void apply(sgpp::base::DataVector& alpha, sgpp::base::DataVector& result) const;
+  };
+
+  /**
+   * Computes the stencils of dimension dim
+   */
+  void computeStencils(sgpp::base::GridStorage& storage, bool boundary, bool laplace,
+                       size_t dim);
+
+  /// number of grid points
+  size_t size;
+  /// stencils of up, down, upOpDim and downOpDim for every dimension
+  std::vector<Stencil> upStencils;
+  std::vector<Stencil> downStencils;
+  std::vector<Stencil> upOpDimStencils;
+  std::vector<Stencil> downOpDimStencils;
+};
+
+}  // namespace pde
+}  // namespace sgpp
+
+#endif /* UPDOWNSTENCILS_HPP */
@@ -4,9 +4,13 @@
 // sgpp.sparsegrids.org
 
 #include <sgpp/pde/algorithm/UpDownTwoOpDims.hpp>
+#include <sgpp/pde/algorithm/UpDownAccumulator.hpp>
 
 #include <sgpp/globaldef.hpp>
 
+#include <utility>
+#include <vector>
+
 namespace sgpp {
 namespace pde {
 
@@ -25,60 +29,62 @@ UpDownTwoOpDims::UpDownTwoOpDims(sgpp::base::GridStorage* storage)
 UpDownTwoOpDims::~UpDownTwoOpDims() {}
 
 void UpDownTwoOpDims::mult(sgpp::base::DataVector& alpha, sgpp::base::DataVector& result) {
-  result.setAll(0.0);
+  // pairs of dimensions with a vanishing coefficient don't contribute, no tasks are spawned
+  // for them; use the operator's symmetry
+  std::vector<std::pair<size_t, size_t>> opDims;
+
+  for (size_t i = 0; i < this->numAlgoDims_; i++) {
+    for (size_t j = 0; j <= i; j++) {
+      if ((this->coefs == nullptr) || (this->coefs->get(i, j) != 0.0)) {
+        opDims.push_back(std::make_pair(i, j));
+      }
+    }
+  }
+
+  UpDownAccumulator accumulator(result.getSize());
 
-#pragma omp parallel
+#pragma omp parallel shared(opDims, accumulator)
   {
-#pragma omp single nowait
+#pragma omp single
     {
-      for (size_t i = 0; i < this->numAlgoDims_; i++) {
-        for (size_t j = 0; j < this->numAlgoDims_; j++) {
-          // use the operator's symmetry
-          if (j <= i) {
-#pragma omp task firstprivate(i, j) shared(alpha, result)
-            {
-              sgpp::base::DataVector beta(result.getSize());
-
-              if (this->coefs != nullptr) {
-                if (this->coefs->get(i, j) != 0.0) {
-                  this->updown(alpha, beta, this->numAlgoDims_ - 1, i, j);
-
-#pragma omp critical
-                  { result.axpy(this->coefs->get(i, j), beta); }
-                }
-              } else {
-                this->updown(alpha, beta, this->numAlgoDims_ - 1, i, j);
-
-#pragma omp critical
-                { result.add(beta); }
-              }
-            }
-          }
+      for (const std::pair<size_t, size_t>& dims : opDims) {
+        const size_t i = dims.first;
+        const size_t j = dims.second;
+
+#pragma omp task firstprivate(i, j) shared(alpha, accumulator)
+        {
+          sgpp::base::DataVector& beta = accumulator.acquireScratch();
+          this->updown(alpha, beta, this->numAlgoDims_ - 1, i, j);
+          accumulator.add((this->coefs != nullptr) ? this->coefs->get(i, j) : 1.0, beta);
+          accumulator.releaseScratch(beta);
         }
       }
-
-#pragma omp taskwait
     }
   }
+
+  accumulator.reduce(result);
 }
 
 void UpDownTwoOpDims::multParallelBuildingBlock(sgpp::base::DataVector& alpha,
                                                 sgpp::base::DataVector& result,
                                                 size_t operationDimOne, size_t operationDimTwo) {
+  // the recursion expects a zero initialized result (some operations are empty)
   result.setAll(0.0);
-  sgpp::base::DataVector beta(result.getSize());
 
   // use the operator's symmetry
-  if (operationDimTwo <= operationDimOne) {
-    if (this->coefs != nullptr) {
-      if (this->coefs->get(operationDimOne, operationDimTwo) != 0.0) {
-        this->updown(alpha, beta, this->numAlgoDims_ - 1, operationDimOne, operationDimTwo);
-        result.axpy(this->coefs->get(operationDimOne, operationDimTwo), beta);
-      }
-    } else {
-      this->updown(alpha, beta, this->numAlgoDims_ - 1, operationDimOne, operationDimTwo);
-      result.add(beta);
+  if (operationDimTwo > operationDimOne) {
+    return;
+  }
+
+  if (this->coefs != nullptr) {
+    const double coef = this->coefs->get(operationDimOne, operationDimTwo);
+
+    if (coef != 0.0) {
+      this->updown(alpha, result, this->numAlgoDims_ - 1, operationDimOne, operationDimTwo);
+      result.mult(coef);
     }
+  } else {
+    this->updown(alpha, result, this->numAlgoDims_ - 1, operationDimOne, operationDimTwo);
   }
 }
 
@@ -5,6 +5,7 @@
 
 #include <sgpp/pde/algorithm/HeatEquationParabolicPDESolverSystem.hpp>
 #include <sgpp/pde/algorithm/HeatEquationParabolicPDESolverSystemParallelOMP.hpp>
+#include <sgpp/pde/algorithm/PrewaveletPreconditioner.hpp>
 #include <sgpp/pde/application/HeatEquationSolver.hpp>
 #include <sgpp/solver/ode/Euler.hpp>
 #include <sgpp/solver/ode/CrankNicolson.hpp>
@@ -55,7 +56,10 @@ void HeatEquationSolver::solveExplicitEuler(size_t numTimesteps, double timestep
                                             base::DataVector& alpha, bool verbose,
                                             bool generateAnimation) {
   if (this->bGridConstructed) {
-    this->myScreen->writeStartSolve("Multidimensional Heat Equation Solver");
+    if (this->myScreen != nullptr) {
+      this->myScreen->writeStartSolve("Multidimensional Heat Equation Solver");
+    }
+
     double dNeededTime;
     solver::Euler* myEuler = new solver::Euler(
         "ExEul", numTimesteps, timestepsize, generateAnimation, this->myScreen);
@@ -68,6 +72,9 @@ void HeatEquationSolver::solveExplicitEuler(size_t numTimesteps, double timestep
     HeatEquationParabolicPDESolverSystem* myHESolver = new HeatEquationParabolicPDESolverSystem(
         *this->myGrid, alpha, this->a, timestepsize, "ExEul");
 #endif
+    // the system matrix is the mass matrix of the inner grid
+    PrewaveletPreconditioner myPreconditioner(myHESolver->getInnerGridStorage(), 1.0, 0.0);
+    myCG->setPreconditioner(&myPreconditioner);
     base::SGppStopwatch* myStopwatch = new base::SGppStopwatch();
 
     myStopwatch->start();
@@ -93,7 +100,10 @@ void HeatEquationSolver::solveImplicitEuler(size_t numTimesteps, double timestep
                                             base::DataVector& alpha, bool verbose,
                                             bool generateAnimation) {
   if (this->bGridConstructed) {
-    this->myScreen->writeStartSolve("Multidimensional Heat Equation Solver");
+    if (this->myScreen != nullptr) {
+      this->myScreen->writeStartSolve("Multidimensional Heat Equation Solver");
+    }
+
     double dNeededTime;
     solver::Euler* myEuler = new solver::Euler(
         "ImEul", numTimesteps, timestepsize, generateAnimation, this->myScreen);
@@ -106,6 +116,10 @@ void HeatEquationSolver::solveImplicitEuler(size_t numTimesteps, double timestep
     HeatEquationParabolicPDESolverSystem* myHESolver = new HeatEquationParabolicPDESolverSystem(
         *this->myGrid, alpha, this->a, timestepsize, "ImEul");
 #endif
+    // the system matrix is mass matrix + timestepsize * a * Laplacian of the inner grid
+    PrewaveletPreconditioner myPreconditioner(myHESolver->getInnerGridStorage(), 1.0,
+                                              timestepsize * this->a);
+    myCG->setPreconditioner(&myPreconditioner);
     base::SGppStopwatch* myStopwatch = new base::SGppStopwatch();
 
     myStopwatch->start();
@@ -131,7 +145,10 @@ void HeatEquationSolver::solveCrankNicolson(size_t numTimesteps, double timestep
                                             size_t maxCGIterations, double epsilonCG,
                                             base::DataVector& alpha, size_t NumImEul) {
   if (this->bGridConstructed) {
-    this->myScreen->writeStartSolve("Multidimensional Heat Equation Solver");
+    if (this->myScreen != nullptr) {
+      this->myScreen->writeStartSolve("Multidimensional Heat Equation Solver");
+    }
+
     double dNeededTime;
     solver::ConjugateGradients* myCG = new solver::ConjugateGradients(maxCGIterations, epsilonCG);
 #ifdef _OPENMP
@@ -159,12 +176,20 @@ void HeatEquationSolver::solveCrankNicolson(size_t numTimesteps, double timestep
         new solver::Euler("ImEul", numIESteps, timestepsize, false, this->myScreen);
     solver::CrankNicolson* myCN = new solver::CrankNicolson(numCNSteps, timestepsize);
 
+    // the system matrices are mass matrix + theta * timestepsize * a * Laplacian of the inner grid
+    PrewaveletPreconditioner myPreconditionerIE(myHESolver->getInnerGridStorage(), 1.0,
+                                                timestepsize * this->a);
+    PrewaveletPreconditioner myPreconditionerCN(myHESolver->getInnerGridStorage(), 1.0,
+                                                0.5 * timestepsize * this->a);
+
     myStopwatch->start();
 
     if (numIESteps > 0) {
+      myCG->setPreconditioner(&myPreconditionerIE);
       myEuler->solve(*myCG, *myHESolver, false);
     }
 
+    myCG->setPreconditioner(&myPreconditionerCN);
     myCN->solve(*myCG, *myHESolver, false);
     dNeededTime = myStopwatch->stop();
 
@@ -184,6 +209,45 @@ void HeatEquationSolver::solveCrankNicolson(size_t numTimesteps, double timestep
   }
 }
 
+void HeatEquationSolver::solveAdaptive(std::string method, size_t numTimesteps,
+                                       double timestepsize, double epsilon,
+                                       size_t maxCGIterations, double epsilonCG,
+                                       base::DataVector& alpha, bool verbose) {
+  if (this->bGridConstructed) {
+    if (this->myScreen != nullptr) {
+      this->myScreen->writeStartSolve("Multidimensional Heat Equation Solver");
+    }
+
+    HeatEquationParabolicPDESolverSystem myHESolver(*this->myGrid, alpha, this->a, timestepsize,
+                                                    "CrNic");
+
+    this->solveWithStepsizeControl(myHESolver, method, numTimesteps, timestepsize, epsilon,
+                                   maxCGIterations, epsilonCG, this->myScreen, verbose);
+
+    if (this->myScreen != nullptr) {
+      std::cout << "Time to solve: " << this->timestepStatistics.duration << " seconds ("
+                << this->timestepStatistics.numAcceptedTimesteps << " accepted, "
+                << this->timestepStatistics.numRejectedTimesteps << " rejected timesteps)"
+                << std::endl;
+      this->myScreen->writeEmptyLines(2);
+    }
+  } else {
+    throw base::application_exception(
+        "HeatEquationSolver::solveAdaptive : A grid wasn't constructed before!");
+  }
+}
+
+sgpp::solver::OperationParabolicPDESolverSystem* HeatEquationSolver::createParabolicPDESolverSystem(
+    base::DataVector& alpha, double timestepsize, std::string operationMode) {
+#ifdef _OPENMP
+  return new HeatEquationParabolicPDESolverSystemParallelOMP(*this->myGrid, alpha, this->a,
+                                                             timestepsize, operationMode);
+#else
+  return new HeatEquationParabolicPDESolverSystem(*this->myGrid, alpha, this->a, timestepsize,
+                                                  operationMode);
+#endif
+}
+
 void HeatEquationSolver::initGridWithSmoothHeat(base::DataVector& alpha, double mu, double sigma,
                                                 double factor) {
   if (this->bGridConstructed) {
@@ -267,6 +331,9 @@ void HeatEquationSolver::storeInnerSolution(base::DataVector& alpha, size_t numT
     solver::ConjugateGradients* myCG = new solver::ConjugateGradients(maxCGIterations, epsilonCG);
     HeatEquationParabolicPDESolverSystem* myHESolver = new HeatEquationParabolicPDESolverSystem(
         *this->myGrid, alpha, this->a, timestepsize, "ImEul");
+    PrewaveletPreconditioner myPreconditioner(myHESolver->getInnerGridStorage(), 1.0,
+                                              timestepsize * this->a);
+    myCG->setPreconditioner(&myPreconditioner);
     base::SGppStopwatch* myStopwatch = new base::SGppStopwatch();
 
     myStopwatch->start();
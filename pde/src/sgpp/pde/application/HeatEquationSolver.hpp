@@ -43,6 +43,18 @@ class HeatEquationSolver : public ParabolicPDESolver {
   /// screen object used in this solver
   sgpp::base::ScreenOutput* myScreen;
 
+  /**
+   * Creates a HeatEquationParabolicPDESolverSystem, see
+   * ParabolicPDESolver::createParabolicPDESolverSystem().
+   *
+   * @param alpha the coefficients the system works on, the system keeps a reference to them
+   * @param timestepsize the size of one timestep
+   * @param operationMode the ODE solver the system is used with, "ImEul" or "CrNic"
+   * @return the system, the caller takes ownership and has to delete it
+   */
+  virtual sgpp::solver::OperationParabolicPDESolverSystem* createParabolicPDESolverSystem(
+      sgpp::base::DataVector& alpha, double timestepsize, std::string operationMode);
+
  public:
   /**
    * Std-Constructor of the solver
@@ -68,6 +80,16 @@ class HeatEquationSolver : public ParabolicPDESolver {
                                   double epsilonCG, sgpp::base::DataVector& alpha,
                                   size_t NumImEul = 0);
 
+  /**
+   * Solves the heat equation with adaptive timestep sizes, see
+   * ParabolicPDESolver::solveAdaptive(). The predictors of the step size controls need the
+   * operation modes of OperationParabolicPDESolverSystemDirichlet, therefore the system of
+   * HeatEquationParabolicPDESolverSystem is used, also if OpenMP is available.
+   */
+  virtual void solveAdaptive(std::string method, size_t numTimesteps, double timestepsize,
+                             double epsilon, size_t maxCGIterations, double epsilonCG,
+                             sgpp::base::DataVector& alpha, bool verbose = false);
+
   /**
    * This method sets the heat coefficient of the regarded material
    *
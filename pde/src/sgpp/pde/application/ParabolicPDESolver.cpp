@@ -4,14 +4,217 @@
 // sgpp.sparsegrids.org
 
 #include <sgpp/pde/application/ParabolicPDESolver.hpp>
+#include <sgpp/solver/ode/StepsizeControlEJ.hpp>
+#include <sgpp/solver/ode/StepsizeControlH.hpp>
+#include <sgpp/solver/ode/StepsizeControlMC.hpp>
+#include <sgpp/solver/ode/StepsizeControlBDF.hpp>
+#include <sgpp/solver/ode/VarTimestep.hpp>
+#include <sgpp/solver/ode/Euler.hpp>
+#include <sgpp/solver/ode/CrankNicolson.hpp>
+#include <sgpp/solver/sle/ConjugateGradients.hpp>
+#include <sgpp/base/exception/application_exception.hpp>
 
 #include <sgpp/globaldef.hpp>
 
+#include <algorithm>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <vector>
+
 namespace sgpp {
 namespace pde {
 
-ParabolicPDESolver::ParabolicPDESolver() : PDESolver() {}
+namespace {
+
+/**
+ * Propagates start over numTimesteps timesteps with implicit Euler ("ImEul") or Crank-Nicolson
+ * ("CrNic"), alpha is the vector the system works on and contains the result afterwards
+ */
+void propagate(sgpp::solver::OperationParabolicPDESolverSystem& System,
+               sgpp::base::DataVector& alpha, const sgpp::base::DataVector& start,
+               size_t numTimesteps, double timestepsize, std::string operationMode,
+               size_t maxCGIterations, double epsilonCG) {
+  alpha = start;
+  System.setTimestepSize(timestepsize);
+
+  sgpp::solver::ConjugateGradients myCG(maxCGIterations, epsilonCG);
+
+  if (operationMode == "CrNic") {
+    sgpp::solver::CrankNicolson myCN(numTimesteps, timestepsize);
+    myCN.solve(myCG, System, false, false);
+  } else {
+    sgpp::solver::Euler myEuler(operationMode, numTimesteps, timestepsize, false, nullptr);
+    myEuler.solve(myCG, System, false, false);
+  }
+}
+
+}  // namespace
+
+ParabolicPDESolver::ParabolicPDESolver() : PDESolver(), pararealIterations(0) {}
 
 ParabolicPDESolver::~ParabolicPDESolver() {}
+
+void ParabolicPDESolver::solveAdaptive(std::string method, size_t numTimesteps,
+                                       double timestepsize, double epsilon,
+                                       size_t maxCGIterations, double epsilonCG,
+                                       sgpp::base::DataVector& alpha, bool verbose) {
+  throw sgpp::base::application_exception(
+      "ParabolicPDESolver::solveAdaptive : adaptive timestep sizes aren't supported by this "
+      "solver!");
+}
+
+sgpp::solver::OperationParabolicPDESolverSystem*
+ParabolicPDESolver::createParabolicPDESolverSystem(sgpp::base::DataVector& alpha,
+                                                   double timestepsize,
+                                                   std::string operationMode) {
+  throw sgpp::base::application_exception(
+      "ParabolicPDESolver::createParabolicPDESolverSystem : not supported by this solver!");
+}
+
+void ParabolicPDESolver::solveWithStepsizeControl(
+    sgpp::solver::OperationParabolicPDESolverSystem& System, std::string method,
+    size_t numTimesteps, double timestepsize, double epsilon, size_t maxCGIterations,
+    double epsilonCG, sgpp::base::ScreenOutput* screen, bool verbose) {
+  std::unique_ptr<sgpp::solver::StepsizeControl> myStepsizeControl;
+
+  if (method == "SCH") {
+    myStepsizeControl.reset(
+        new sgpp::solver::StepsizeControlH("CrNic", numTimesteps, timestepsize, epsilon, screen));
+  } else if (method == "SCEJ") {
+    myStepsizeControl.reset(new sgpp::solver::StepsizeControlEJ("CrNic", numTimesteps,
+                                                                timestepsize, epsilon, 1.0,
+                                                                screen));
+  } else if (method == "SCAC") {
+    myStepsizeControl.reset(new sgpp::solver::VarTimestep("AdBas", "CrNic", numTimesteps,
+                                                          timestepsize, epsilon, screen));
+  } else if (method == "SCMC") {
+    myStepsizeControl.reset(
+        new sgpp::solver::StepsizeControlMC(numTimesteps, timestepsize, epsilon, screen));
+  } else if (method == "SCBDF") {
+    myStepsizeControl.reset(
+        new sgpp::solver::StepsizeControlBDF(numTimesteps, timestepsize, epsilon, screen));
+  } else {
+    throw sgpp::base::application_exception(
+        "ParabolicPDESolver::solveWithStepsizeControl : unknown step size control!");
+  }
+
+  // the step size controls solve with reuse = true, i.e. every solve starts from the solution of
+  // the previous (or the aborted) timestep
+  sgpp::solver::ConjugateGradients myCG(maxCGIterations, epsilonCG);
+
+  myStepsizeControl->solve(myCG, System, false, verbose);
+  this->timestepStatistics = myStepsizeControl->getTimestepStatistics();
+}
+
+void ParabolicPDESolver::solveParareal(size_t numTimesteps, double timestepsize,
+                                       size_t numSlices, size_t numCoarseTimesteps,
+                                       size_t maxIterations, double epsilon,
+                                       size_t maxCGIterations, double epsilonCG,
+                                       sgpp::base::DataVector& alpha, bool verbose) {
+  if (!this->bGridConstructed) {
+    throw sgpp::base::application_exception(
+        "ParabolicPDESolver::solveParareal : A grid wasn't constructed before!");
+  }
+
+  if ((numSlices == 0) || (numSlices > numTimesteps) || (numCoarseTimesteps == 0)) {
+    throw sgpp::base::application_exception(
+        "ParabolicPDESolver::solveParareal : invalid number of time slices or coarse timesteps!");
+  }
+
+  // fine timesteps of the time slices, the first slices take the remainder
+  std::vector<size_t> numFineTimesteps(numSlices, numTimesteps / numSlices);
+
+  for (size_t n = 0; n < numTimesteps % numSlices; n++) {
+    numFineTimesteps[n]++;
+  }
+
+  // states at the boundaries of the time slices
+  std::vector<sgpp::base::DataVector> states(numSlices + 1, alpha);
+  // coarse propagations of the states of the previous iteration
+  std::vector<sgpp::base::DataVector> coarse(numSlices, alpha);
+  // coefficients of the systems
+  std::vector<sgpp::base::DataVector> fine(numSlices, alpha);
+  sgpp::base::DataVector coarseAlpha(alpha);
+
+  std::vector<std::unique_ptr<sgpp::solver::OperationParabolicPDESolverSystem>> fineSystems(
+      numSlices);
+
+  for (size_t n = 0; n < numSlices; n++) {
+    fineSystems[n].reset(createParabolicPDESolverSystem(fine[n], timestepsize, "CrNic"));
+  }
+
+  std::unique_ptr<sgpp::solver::OperationParabolicPDESolverSystem> coarseSystem(
+      createParabolicPDESolverSystem(coarseAlpha, timestepsize, "ImEul"));
+
+  std::vector<double> coarseTimestepsize(numSlices);
+
+  for (size_t n = 0; n < numSlices; n++) {
+    coarseTimestepsize[n] = static_cast<double>(numFineTimesteps[n]) * timestepsize /
+                            static_cast<double>(numCoarseTimesteps);
+  }
+
+  // initial states by the coarse propagator
+  for (size_t n = 0; n < numSlices; n++) {
+    propagate(*coarseSystem, coarseAlpha, states[n], numCoarseTimesteps, coarseTimestepsize[n],
+              "ImEul", maxCGIterations, epsilonCG);
+    coarse[n] = coarseAlpha;
+    states[n + 1] = coarseAlpha;
+  }
+
+  this->pararealIterations = 0;
+  this->pararealCorrections.clear();
+
+  // after k iterations the states up to slice k are the ones of the sequential fine solve
+  for (size_t k = 0; k < std::min(maxIterations, numSlices); k++) {
+#pragma omp parallel for schedule(dynamic)
+    for (size_t n = k; n < numSlices; n++) {
+      propagate(*fineSystems[n], fine[n], states[n], numFineTimesteps[n], timestepsize, "CrNic",
+                maxCGIterations, epsilonCG);
+    }
+
+    // sequential correction U_{n+1} = G(U_n) + F(U_n^old) - G(U_n^old)
+    double correction = 0.0;
+
+    for (size_t n = k; n < numSlices; n++) {
+      sgpp::base::DataVector next(fine[n]);
+
+      // the state of slice k hasn't changed, so G(U_k) = G(U_k^old)
+      if (n > k) {
+        propagate(*coarseSystem, coarseAlpha, states[n], numCoarseTimesteps,
+                  coarseTimestepsize[n], "ImEul", maxCGIterations, epsilonCG);
+        next.add(coarseAlpha);
+        next.sub(coarse[n]);
+        coarse[n] = coarseAlpha;
+      }
+
+      sgpp::base::DataVector change(next);
+      change.sub(states[n + 1]);
+
+      const double norm = next.l2Norm();
+
+      if (norm > 0.0) {
+        correction = std::max(correction, change.l2Norm() / norm);
+      }
+
+      states[n + 1] = next;
+    }
+
+    this->pararealIterations++;
+    this->pararealCorrections.push_back(correction);
+
+    if (verbose) {
+      std::cout << "Parareal iteration " << this->pararealIterations
+                << ", relative correction: " << correction << std::endl;
+    }
+
+    if (correction <= epsilon) {
+      break;
+    }
+  }
+
+  alpha = states[numSlices];
+}
+
 }  // namespace pde
 }  // namespace sgpp
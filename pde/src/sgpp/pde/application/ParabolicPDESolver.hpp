@@ -7,9 +7,15 @@
 #define PARABOLICPDESOLVER_HPP
 
 #include <sgpp/pde/application/PDESolver.hpp>
+#include <sgpp/base/application/ScreenOutput.hpp>
+#include <sgpp/solver/ode/TimestepStatistics.hpp>
+#include <sgpp/solver/operation/hash/OperationParabolicPDESolverSystem.hpp>
 
 #include <sgpp/globaldef.hpp>
 
+#include <string>
+#include <vector>
+
 namespace sgpp {
 namespace pde {
 
@@ -24,6 +30,48 @@ class ParabolicPDESolver : public PDESolver {
   // double timestepSize;
   /// The number of timesteps that are executed during solving
   // size_t nTimesteps;
+  /// statistics of the last solve with adaptive timestep sizes
+  sgpp::solver::TimestepStatistics timestepStatistics;
+
+  /**
+   * Solves the parabolic PDE described by a system with one of the step size controls of the
+   * solver module and stores the statistics of the solve. The systems of linear equations are
+   * solved with conjugate gradients, which start from the solution of the previous timestep.
+   *
+   * @param System the system of the parabolic PDE, has to support the operation modes of the
+   * step size control and to provide the history of the solution
+   * @param method the step size control, see solveAdaptive()
+   * @param numTimesteps the time interval is [0, numTimesteps * timestepsize]
+   * @param timestepsize the size of the first timestep
+   * @param epsilon the tolerance of the step size control
+   * @param maxCGIterations the maximum of interation in the CG solver
+   * @param epsilonCG the epsilon used in the CG
+   * @param screen possible pointer to a sgpp::base::ScreenOutput object
+   * @param verbose enables verbose output during solving
+   */
+  void solveWithStepsizeControl(sgpp::solver::OperationParabolicPDESolverSystem& System,
+                                std::string method, size_t numTimesteps, double timestepsize,
+                                double epsilon, size_t maxCGIterations, double epsilonCG,
+                                sgpp::base::ScreenOutput* screen, bool verbose);
+
+  /// number of iterations of the last Parareal solve
+  size_t pararealIterations;
+  /// maximal relative change of the states at the time slice boundaries in every Parareal
+  /// iteration
+  std::vector<double> pararealCorrections;
+
+  /**
+   * Creates a system of the parabolic PDE on the grid of the solver, used by solveParareal() to
+   * create independent systems for the time slices. The default implementation throws an
+   * application_exception.
+   *
+   * @param alpha the coefficients the system works on, the system keeps a reference to them
+   * @param timestepsize the size of one timestep
+   * @param operationMode the ODE solver the system is used with, "ImEul" or "CrNic"
+   * @return the system, has to be deleted by the caller
+   */
+  virtual sgpp::solver::OperationParabolicPDESolverSystem* createParabolicPDESolverSystem(
+      sgpp::base::DataVector& alpha, double timestepsize, std::string operationMode);
 
  public:
   /**
@@ -82,6 +130,78 @@ class ParabolicPDESolver : public PDESolver {
   virtual void solveCrankNicolson(size_t numTimesteps, double timestepsize, size_t maxCGIterations,
                                   double epsilonCG, sgpp::base::DataVector& alpha,
                                   size_t NumImEul = 0) = 0;
+
+  /**
+   * Call this routine to solve the parabolic PDE with adaptive timestep sizes. The timestep size
+   * is chosen by an estimate of the local error, timesteps whose error exceeds epsilon are
+   * repeated with a smaller timestep size. The default implementation throws an
+   * application_exception.
+   *
+   * Available methods:
+   * - "SCH": Crank-Nicolson, error estimate by step doubling (StepsizeControlH)
+   * - "SCEJ": Crank-Nicolson, timestep size from the relative change of the solution in the
+   *   maximum norm (StepsizeControlEJ)
+   * - "SCAC", "SCMC", "SCBDF": Adams-Bashforth predictor and Crank-Nicolson corrector with the
+   *   timestep size updates of VarTimestep, StepsizeControlMC and StepsizeControlBDF
+   *
+   * @param method the step size control
+   * @param numTimesteps the time interval is [0, numTimesteps * timestepsize]
+   * @param timestepsize the size of the first timestep
+   * @param epsilon the tolerance of the step size control
+   * @param maxCGIterations the maximum of interation in the CG solver
+   * @param epsilonCG the epsilon used in the CG
+   * @param alpha the coefficients of the Sparse Gird's basis functions
+   * @param verbose enables verbose output during solving
+   */
+  virtual void solveAdaptive(std::string method, size_t numTimesteps, double timestepsize,
+                             double epsilon, size_t maxCGIterations, double epsilonCG,
+                             sgpp::base::DataVector& alpha, bool verbose = false);
+
+  /**
+   * @return the statistics of the last call of solveAdaptive(), e.g. the number of accepted and
+   * rejected timesteps, the range of the timestep sizes and the number of CG iterations
+   */
+  const sgpp::solver::TimestepStatistics& getTimestepStatistics() const {
+    return timestepStatistics;
+  }
+
+  /**
+   * Call this routine to solve the parabolic PDE with the parallel-in-time Parareal algorithm
+   * (Lions, Maday and Turinici, 2001) instead of one sequential Crank-Nicolson solve.
+   *
+   * The time interval is split into numSlices time slices. A cheap coarse propagator (implicit
+   * Euler with numCoarseTimesteps timesteps per slice) is applied sequentially, the expensive fine
+   * propagator (Crank-Nicolson with the given timestep size) is applied to all slices in parallel.
+   * The states at the slice boundaries are corrected until their relative change is below
+   * epsilon. After numSlices iterations the result equals the sequential Crank-Nicolson solve.
+   * The OpenMP threads are used for the slices, the operators of the systems run sequentially.
+   *
+   * @param numTimesteps the number of (fine) timesteps that should be executed
+   * @param timestepsize the size of the interval one (fine) timestep moves forward
+   * @param numSlices the number of time slices, at most numTimesteps
+   * @param numCoarseTimesteps the number of implicit Euler timesteps per time slice
+   * @param maxIterations the maximal number of Parareal iterations
+   * @param epsilon the tolerance of the relative change of the states at the slice boundaries
+   * @param maxCGIterations the maximum of interation in the CG solver
+   * @param epsilonCG the epsilon used in the CG
+   * @param alpha the coefficients of the Sparse Gird's basis functions
+   * @param verbose enables verbose output during solving
+   */
+  void solveParareal(size_t numTimesteps, double timestepsize, size_t numSlices,
+                     size_t numCoarseTimesteps, size_t maxIterations, double epsilon,
+                     size_t maxCGIterations, double epsilonCG, sgpp::base::DataVector& alpha,
+                     bool verbose = false);
+
+  /**
+   * @return the number of iterations of the last call of solveParareal()
+   */
+  size_t getNumberPararealIterations() const { return pararealIterations; }
+
+  /**
+   * @return the maximal relative change of the states at the time slice boundaries in every
+   * iteration of the last call of solveParareal()
+   */
+  const std::vector<double>& getPararealCorrections() const { return pararealCorrections; }
 };
 }  // namespace pde
 }  // namespace sgpp
@@ -5,6 +5,7 @@
 
 #include <sgpp/pde/application/PoissonEquationSolver.hpp>
 #include <sgpp/pde/algorithm/PoissonEquationEllipticPDESolverSystemDirichlet.hpp>
+#include <sgpp/pde/algorithm/PrewaveletPreconditioner.hpp>
 #include <sgpp/solver/sle/ConjugateGradients.hpp>
 #include <sgpp/base/grid/Grid.hpp>
 #include <sgpp/base/exception/application_exception.hpp>
@@ -73,6 +74,11 @@ void PoissonEquationSolver::solvePDE(base::DataVector& alpha, base::DataVector&
             << std::endl
             << std::endl;
 
+  // multilevel preconditioner of the Laplacian on the inner (linear) grid, the number of
+  // iterations hardly depends on the level
+  PrewaveletPreconditioner myPreconditioner(mySystem->getInnerGridStorage(), 0.0, 1.0);
+  myCG->setPreconditioner(&myPreconditioner);
+
   myStopwatch->start();
   myCG->solve(*mySystem, *alpha_solve, *rhs_solve, true, verbose, 0.0);
 
@@ -90,7 +96,10 @@ void PoissonEquationSolver::solvePDE(base::DataVector& alpha, base::DataVector&
   std::cout << "------------------------------------" << std::endl;
   std::cout << "Time for creating CG coeffs: " << dTimeAlpha << std::endl;
   std::cout << "Time for creating RHS: " << dTimeRHS << std::endl;
-  std::cout << "Time for solving: " << dTimeSolver << std::endl << std::endl;
+  std::cout << "Time for solving: " << dTimeSolver << std::endl;
+  std::cout << "Iterations of the (preconditioned) CG: " << myCG->getNumberIterations()
+            << std::endl
+            << std::endl;
   std::cout << "Time: " << dTimeAlpha + dTimeRHS + dTimeSolver << std::endl
             << std::endl
             << std::endl;
@@ -321,6 +330,8 @@ void PoissonEquationSolver::storeInnerSolution(base::DataVector& alpha, size_t m
   base::DataVector* alpha_solve = mySystem->getGridCoefficientsForCG();
   base::DataVector* rhs_solve = mySystem->generateRHS();
 
+  PrewaveletPreconditioner myPreconditioner(mySystem->getInnerGridStorage(), 0.0, 1.0);
+  myCG->setPreconditioner(&myPreconditioner);
   myCG->solve(*mySystem, *alpha_solve, *rhs_solve, true, false, 0.0);
 
   size_t nCoefs = alpha_solve->getSize();
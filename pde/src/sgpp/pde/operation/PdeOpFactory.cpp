@@ -296,5 +296,40 @@ base::OperationMatrix* createOperationLaplaceEnhanced(base::Grid& grid,
         "OperationLaplaceEnhanced is not implemented for this grid type.");
   }
 }
+
+base::OperationMatrix* createOperationLaplaceStencil(base::Grid& grid) {
+  if (grid.getType() == base::GridType::Linear) {
+    pde::OperationLaplaceLinear* op = new pde::OperationLaplaceLinear(&grid.getStorage());
+    op->precomputeStencils();
+    return op;
+  } else if (grid.getType() == base::GridType::LinearL0Boundary ||
+             grid.getType() == base::GridType::LinearBoundary) {
+    pde::OperationLaplaceLinearBoundary* op =
+        new pde::OperationLaplaceLinearBoundary(&grid.getStorage());
+    op->precomputeStencils();
+    return op;
+  } else {
+    throw base::factory_exception(
+        "OperationLaplaceStencil is not implemented for this grid type.");
+  }
+}
+
+base::OperationMatrix* createOperationLTwoDotProductStencil(base::Grid& grid) {
+  if (grid.getType() == base::GridType::Linear) {
+    pde::OperationLTwoDotProductLinear* op =
+        new pde::OperationLTwoDotProductLinear(&grid.getStorage());
+    op->precomputeStencils();
+    return op;
+  } else if (grid.getType() == base::GridType::LinearL0Boundary ||
+             grid.getType() == base::GridType::LinearBoundary) {
+    pde::OperationLTwoDotProductLinearBoundary* op =
+        new pde::OperationLTwoDotProductLinearBoundary(&grid.getStorage());
+    op->precomputeStencils();
+    return op;
+  } else {
+    throw base::factory_exception(
+        "OperationLTwoDotProductStencil is not implemented for this grid type.");
+  }
+}
 }  // namespace op_factory
 }  // namespace sgpp
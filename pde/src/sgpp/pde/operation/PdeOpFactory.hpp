@@ -112,6 +112,31 @@ base::OperationMatrix* createOperationLaplaceEnhanced(base::Grid& grid);
  */
 base::OperationMatrix* createOperationLaplaceEnhanced(
     base::Grid& grid, sgpp::base::DataVector& coef);
+
+/**
+ * Factory method, returning an OperationLaplace (OperationMatrix) for the grid at hand.
+ * Note: object has to be freed after use.
+ *
+ * The 1D stencils of the sweeps are precomputed for the current grid, which pays off if the
+ * operator is applied many times (e.g. in time stepping). The operator falls back to the sweeps
+ * if the number of grid points changes.
+ *
+ * @param grid Grid which is to be used
+ * @return Pointer to the new OperationMatrix object for the Grid grid
+ */
+base::OperationMatrix* createOperationLaplaceStencil(base::Grid& grid);
+
+/**
+ * Factory method, returning an OperationLTwoDotProduct (OperationMatrix) for the grid at hand.
+ * Note: object has to be freed after use.
+ *
+ * The 1D stencils of the sweeps are precomputed for the current grid, see
+ * createOperationLaplaceStencil.
+ *
+ * @param grid Grid which is to be used
+ * @return Pointer to the new OperationMatrix object for the Grid grid
+ */
+base::OperationMatrix* createOperationLTwoDotProductStencil(base::Grid& grid);
 }  // namespace op_factory
 }  // namespace sgpp
 
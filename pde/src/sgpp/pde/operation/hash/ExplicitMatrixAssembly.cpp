@@ -0,0 +1,312 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#include <sgpp/pde/operation/hash/ExplicitMatrixAssembly.hpp>
+#include <sgpp/base/datatypes/DataVector.hpp>
+#include <sgpp/base/tools/GaussLegendreQuadRule1D.hpp>
+
+#include <sgpp/globaldef.hpp>
+
+#include <algorithm>
+#include <cstdint>
+#include <vector>
+
+namespace sgpp {
+namespace pde {
+
+ExplicitMatrixAssembly::ExplicitMatrixAssembly(sgpp::base::GridStorage& storage,
+                                               sgpp::base::SBasis& basis, size_t supportRadius,
+                                               size_t quadOrder, bool laplace)
+    : numPoints(storage.getSize()),
+      numDims(storage.getDimension()),
+      laplace(laplace),
+      pointIds(numPoints * numDims) {
+  // distinct 1D basis functions of all dimensions, (level, index) encoded as one key
+  std::vector<uint64_t> keys(numPoints * numDims);
+
+  for (size_t i = 0; i < numPoints; i++) {
+    for (size_t k = 0; k < numDims; k++) {
+      keys[i * numDims + k] = (static_cast<uint64_t>(storage[i].getLevel(k)) << 32) |
+                              static_cast<uint64_t>(storage[i].getIndex(k));
+    }
+  }
+
+  std::vector<uint64_t> functions(keys);
+  std::sort(functions.begin(), functions.end());
+  functions.erase(std::unique(functions.begin(), functions.end()), functions.end());
+  const size_t numFunctions = functions.size();
+
+  for (size_t n = 0; n < keys.size(); n++) {
+    pointIds[n] = std::lower_bound(functions.begin(), functions.end(), keys[n]) - functions.begin();
+  }
+
+  std::vector<sgpp::base::level_t> levels(numFunctions);
+  std::vector<sgpp::base::index_t> indices(numFunctions);
+  std::vector<double> lefts(numFunctions);
+  std::vector<double> rights(numFunctions);
+  const double r = static_cast<double>(supportRadius);
+
+  for (size_t a = 0; a < numFunctions; a++) {
+    levels[a] = static_cast<sgpp::base::level_t>(functions[a] >> 32);
+    indices[a] = static_cast<sgpp::base::index_t>(functions[a] & 0xFFFFFFFF);
+    const double h = 1.0 / static_cast<double>(static_cast<uint64_t>(1) << levels[a]);
+    lefts[a] = (static_cast<double>(indices[a]) - r) * h;
+    rights[a] = (static_cast<double>(indices[a]) + r) * h;
+  }
+
+  sgpp::base::DataVector coordinates;
+  sgpp::base::DataVector weights;
+  sgpp::base::GaussLegendreQuadRule1D gauss;
+  gauss.getLevelPointsAndWeightsNormalized(quadOrder, coordinates, weights);
+
+  // table of the 1D integrals, the table is small compared to the matrix, so both (a, b) and
+  // (b, a) are computed to avoid the transposition
+  std::vector<std::vector<size_t>> rowNeighbors(numFunctions);
+  std::vector<std::vector<double>> rowIntegrals(numFunctions);
+  std::vector<std::vector<double>> rowIntegralsDx(numFunctions);
+
+#pragma omp parallel for schedule(dynamic)
+  for (size_t a = 0; a < numFunctions; a++) {
+    for (size_t b = 0; b < numFunctions; b++) {
+      if (std::max(lefts[a], lefts[b]) >= std::min(rights[a], rights[b])) {
+        continue;
+      }
+
+      // integrate over the cells of the support of the finer function inside [0, 1]
+      const size_t fine = (levels[a] >= levels[b]) ? a : b;
+      const size_t hInv = static_cast<size_t>(1) << levels[fine];
+      const size_t index = indices[fine];
+      const double h = 1.0 / static_cast<double>(hInv);
+      const size_t start = (index > supportRadius) ? 0 : (supportRadius - index);
+      const size_t stop = std::min(2 * supportRadius - 1, hInv + supportRadius - index - 1);
+      double integral = 0.0;
+      double integralDx = 0.0;
+
+      for (size_t n = start; n <= stop; n++) {
+        for (size_t c = 0; c < quadOrder; c++) {
+          const double x = lefts[fine] + h * (coordinates[c] + static_cast<double>(n));
+          integral += weights[c] * basis.eval(levels[a], indices[a], x) *
+                      basis.eval(levels[b], indices[b], x);
+
+          if (laplace) {
+            integralDx += weights[c] * basis.evalDx(levels[a], indices[a], x) *
+                          basis.evalDx(levels[b], indices[b], x);
+          }
+        }
+      }
+
+      rowNeighbors[a].push_back(b);
+      rowIntegrals[a].push_back(h * integral);
+      rowIntegralsDx[a].push_back(h * integralDx);
+    }
+  }
+
+  offsets.assign(numFunctions + 1, 0);
+
+  for (size_t a = 0; a < numFunctions; a++) {
+    offsets[a + 1] = offsets[a] + rowNeighbors[a].size();
+  }
+
+  neighbors.reserve(offsets[numFunctions]);
+  integrals.reserve(offsets[numFunctions]);
+
+  for (size_t a = 0; a < numFunctions; a++) {
+    neighbors.insert(neighbors.end(), rowNeighbors[a].begin(), rowNeighbors[a].end());
+    integrals.insert(integrals.end(), rowIntegrals[a].begin(), rowIntegrals[a].end());
+
+    if (laplace) {
+      integralsDx.insert(integralsDx.end(), rowIntegralsDx[a].begin(), rowIntegralsDx[a].end());
+    }
+  }
+
+  // buckets of the grid points by their 1D basis function in the first dimension
+  bucketOffsets.assign(numFunctions + 1, 0);
+  bucketPoints.resize(numPoints);
+
+  if (numDims > 0) {
+    for (size_t i = 0; i < numPoints; i++) {
+      bucketOffsets[pointIds[i * numDims] + 1]++;
+    }
+
+    for (size_t a = 0; a < numFunctions; a++) {
+      bucketOffsets[a + 1] += bucketOffsets[a];
+    }
+
+    std::vector<size_t> position(bucketOffsets.begin(), bucketOffsets.end() - 1);
+
+    for (size_t i = 0; i < numPoints; i++) {
+      bucketPoints[position[pointIds[i * numDims]]++] = i;
+    }
+  }
+}
+
+ExplicitMatrixAssembly::~ExplicitMatrixAssembly() {}
+
+void ExplicitMatrixAssembly::computeRow(size_t i, std::vector<size_t>& columns,
+                                        std::vector<double>& values) const {
+  columns.clear();
+  values.clear();
+
+  if (numDims == 0) {
+    return;
+  }
+
+  // candidates: grid points overlapping in the first dimension
+  const size_t a0 = pointIds[i * numDims];
+
+  for (size_t n = offsets[a0]; n < offsets[a0 + 1]; n++) {
+    const size_t b0 = neighbors[n];
+
+    for (size_t m = bucketOffsets[b0]; m < bucketOffsets[b0 + 1]; m++) {
+      if (bucketPoints[m] >= i) {
+        columns.push_back(bucketPoints[m]);
+      }
+    }
+  }
+
+  std::sort(columns.begin(), columns.end());
+
+  std::vector<double> integrals1D(numDims);
+  std::vector<double> integralsDx1D(numDims);
+  size_t numEntries = 0;
+
+  for (size_t j : columns) {
+    bool overlap = true;
+
+    for (size_t k = 0; k < numDims; k++) {
+      const size_t a = pointIds[i * numDims + k];
+      const size_t b = pointIds[j * numDims + k];
+      const auto first = neighbors.begin() + offsets[a];
+      const auto last = neighbors.begin() + offsets[a + 1];
+      const auto it = std::lower_bound(first, last, b);
+
+      if ((it == last) || (*it != b)) {
+        overlap = false;
+        break;
+      }
+
+      const size_t n = it - neighbors.begin();
+      integrals1D[k] = integrals[n];
+
+      if (laplace) {
+        integralsDx1D[k] = integralsDx[n];
+      }
+    }
+
+    if (!overlap) {
+      continue;
+    }
+
+    double res;
+
+    if (laplace) {
+      /**
+       * int nabla phi_i(x) * nabla phi_j(x) dx
+       * = sum_k int (phi'_{i_k}(x_k) * phi'_{j_k}(x_k)) dx_k *
+       *         prod_{l!=k} int (phi_{i_l}(x_l) * phi_{j_l}(x_l)) dx_l
+       */
+      res = 0.0;
+
+      for (size_t k = 0; k < numDims; k++) {
+        double temp_res = integralsDx1D[k];
+
+        for (size_t l = 0; (l < numDims) && (temp_res != 0.0); l++) {
+          if (l != k) {
+            temp_res *= integrals1D[l];
+          }
+        }
+
+        res += temp_res;
+      }
+    } else {
+      res = 1.0;
+
+      for (size_t k = 0; k < numDims; k++) {
+        res *= integrals1D[k];
+      }
+    }
+
+    columns[numEntries] = j;
+    values.push_back(res);
+    numEntries++;
+  }
+
+  columns.resize(numEntries);
+}
+
+void ExplicitMatrixAssembly::assemble(sgpp::base::DataMatrix& matrix) {
+  matrix.setAll(0.0);
+  double* data = matrix.getPointer();
+  const size_t ncols = matrix.getNcols();
+
+#pragma omp parallel
+  {
+    std::vector<size_t> columns;
+    std::vector<double> values;
+
+    // every pair (i, j) is written by exactly one thread
+#pragma omp for schedule(dynamic)
+    for (size_t i = 0; i < numPoints; i++) {
+      computeRow(i, columns, values);
+
+      for (size_t n = 0; n < columns.size(); n++) {
+        data[i * ncols + columns[n]] = values[n];
+        data[columns[n] * ncols + i] = values[n];
+      }
+    }
+  }
+}
+
+void ExplicitMatrixAssembly::assemble(std::vector<size_t>& rowOffsets,
+                                      std::vector<size_t>& columns, std::vector<double>& values) {
+  std::vector<std::vector<size_t>> upperColumns(numPoints);
+  std::vector<std::vector<double>> upperValues(numPoints);
+
+#pragma omp parallel for schedule(dynamic)
+  for (size_t i = 0; i < numPoints; i++) {
+    computeRow(i, upperColumns[i], upperValues[i]);
+  }
+
+  // row i consists of the mirrored entries (j, i), j < i, and the upper entries (i, j), j >= i
+  rowOffsets.assign(numPoints + 1, 0);
+
+  for (size_t i = 0; i < numPoints; i++) {
+    rowOffsets[i + 1] += upperColumns[i].size();
+
+    for (size_t j : upperColumns[i]) {
+      if (j > i) {
+        rowOffsets[j + 1]++;
+      }
+    }
+  }
+
+  for (size_t i = 0; i < numPoints; i++) {
+    rowOffsets[i + 1] += rowOffsets[i];
+  }
+
+  columns.resize(rowOffsets[numPoints]);
+  values.resize(rowOffsets[numPoints]);
+  std::vector<size_t> position(rowOffsets.begin(), rowOffsets.end() - 1);
+
+  // the mirrored entries of row j arrive with increasing i < j before the upper ones
+  for (size_t i = 0; i < numPoints; i++) {
+    for (size_t n = 0; n < upperColumns[i].size(); n++) {
+      const size_t j = upperColumns[i][n];
+
+      if (j > i) {
+        columns[position[j]] = i;
+        values[position[j]] = upperValues[i][n];
+        position[j]++;
+      }
+    }
+
+    std::copy(upperColumns[i].begin(), upperColumns[i].end(), columns.begin() + position[i]);
+    std::copy(upperValues[i].begin(), upperValues[i].end(), values.begin() + position[i]);
+    position[i] += upperColumns[i].size();
+  }
+}
+
+}  // namespace pde
+}  // namespace sgpp
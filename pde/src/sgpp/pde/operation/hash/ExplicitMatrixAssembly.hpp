@@ -0,0 +1,102 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#pragma once
+
+#include <sgpp/base/datatypes/DataMatrix.hpp>
+#include <sgpp/base/grid/GridStorage.hpp>
+#include <sgpp/base/operation/hash/common/basis/Basis.hpp>
+
+#include <sgpp/globaldef.hpp>
+
+#include <vector>
+
+namespace sgpp {
+namespace pde {
+
+/**
+ * Assembly of the mass matrix \f$(\Phi_i, \Phi_j)_{L_2}\f$ or the stiffness matrix
+ * \f$(\nabla \Phi_i, \nabla \Phi_j)_{L_2}\f$ of tensor product basis functions whose 1D supports
+ * are \f$[(i - r) h_l, (i + r) h_l] \cap [0, 1]\f$ (B-splines, polynomials).
+ *
+ * The 1D integrals only depend on the levels and indices of the two 1D basis functions. They are
+ * computed once with Gauss-Legendre quadrature on the cells of the finer function for all pairs of
+ * 1D basis functions of the grid with overlapping supports and shared by all dimensions. The
+ * matrix entries are then products (sums of products) of table lookups. Only pairs of grid points
+ * whose supports overlap in the first dimension are enumerated, the upper triangle is computed in
+ * parallel and mirrored.
+ */
+class ExplicitMatrixAssembly {
+ public:
+  /**
+   * Constructor, computes the table of the 1D integrals
+   *
+   * @param storage the grid's storage
+   * @param basis the 1D basis (the same in all dimensions)
+   * @param supportRadius r, half width of the supports in multiples of the mesh width
+   * @param quadOrder number of Gauss-Legendre points per cell, exact for polynomials of degree
+   * 2 * quadOrder - 1
+   * @param laplace true for the stiffness matrix, false for the mass matrix
+   */
+  ExplicitMatrixAssembly(sgpp::base::GridStorage& storage, sgpp::base::SBasis& basis,
+                         size_t supportRadius, size_t quadOrder, bool laplace);
+
+  /**
+   * Destructor
+   */
+  ~ExplicitMatrixAssembly();
+
+  /**
+   * Assembles the dense matrix
+   *
+   * @param matrix the matrix of size (number of grid points) x (number of grid points), all
+   * entries are overwritten
+   */
+  void assemble(sgpp::base::DataMatrix& matrix);
+
+  /**
+   * Assembles the matrix in compressed sparse row format, row i consists of the entries
+   * rowOffsets[i] to rowOffsets[i + 1] - 1 with sorted column indices
+   *
+   * @param rowOffsets start of the rows, size (number of grid points) + 1
+   * @param columns column indices of the entries
+   * @param values values of the entries
+   */
+  void assemble(std::vector<size_t>& rowOffsets, std::vector<size_t>& columns,
+                std::vector<double>& values);
+
+ private:
+  /**
+   * Computes the entries (i, j) with j >= i of the upper triangle
+   *
+   * @param i row
+   * @param columns sorted columns j of the overlapping grid points
+   * @param values the entries
+   */
+  void computeRow(size_t i, std::vector<size_t>& columns, std::vector<double>& values) const;
+
+  /// number of grid points
+  size_t numPoints;
+  /// dimensionality
+  size_t numDims;
+  /// true for the stiffness matrix
+  bool laplace;
+  /// pointIds[i * numDims + k] is the 1D basis function of grid point i in dimension k
+  std::vector<size_t> pointIds;
+  /// the overlapping 1D basis functions of a are neighbors[offsets[a]] to
+  /// neighbors[offsets[a + 1] - 1] (sorted)
+  std::vector<size_t> offsets;
+  std::vector<size_t> neighbors;
+  /// 1D integrals of the products of the basis functions and of their derivatives
+  std::vector<double> integrals;
+  std::vector<double> integralsDx;
+  /// grid points sorted by their 1D basis function in the first dimension, the ones of a are
+  /// bucketPoints[bucketOffsets[a]] to bucketPoints[bucketOffsets[a + 1] - 1]
+  std::vector<size_t> bucketOffsets;
+  std::vector<size_t> bucketPoints;
+};
+
+}  // namespace pde
+}  // namespace sgpp
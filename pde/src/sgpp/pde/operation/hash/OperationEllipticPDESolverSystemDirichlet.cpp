@@ -80,5 +80,14 @@ void OperationEllipticPDESolverSystemDirichlet::getSolutionBoundGrid(
   Solution = *(this->rhs);
   this->GridConverter->updateBoundaryCoefs(Solution, SolutionInner);
 }
+
+sgpp::base::GridStorage& OperationEllipticPDESolverSystemDirichlet::getInnerGridStorage() {
+  if (this->InnerGrid == nullptr) {
+    throw sgpp::base::algorithm_exception(
+        "OperationEllipticPDESolverSystemDirichlet::getInnerGridStorage : No inner grid exists!");
+  }
+
+  return this->InnerGrid->getStorage();
+}
 }  // namespace pde
 }  // namespace sgpp
@@ -102,6 +102,14 @@ class OperationEllipticPDESolverSystemDirichlet : public OperationEllipticPDESol
    */
   virtual void getSolutionBoundGrid(sgpp::base::DataVector& Solution,
                                     sgpp::base::DataVector& SolutionInner);
+
+  /**
+   * Gets the storage of the inner grid, its grid points are the unknowns of the system
+   * (e.g. for preconditioners)
+   *
+   * @return storage of the inner grid
+   */
+  sgpp::base::GridStorage& getInnerGridStorage();
 };
 }  // namespace pde
 }  // namespace sgpp
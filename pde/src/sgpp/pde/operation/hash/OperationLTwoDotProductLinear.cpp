@@ -20,22 +20,34 @@ OperationLTwoDotProductLinear::OperationLTwoDotProductLinear(sgpp::base::GridSto
 
 OperationLTwoDotProductLinear::~OperationLTwoDotProductLinear() {}
 
+void OperationLTwoDotProductLinear::precomputeStencils() {
+  stencils.reset(new UpDownStencils(*this->storage, false, false));
+}
+
 void OperationLTwoDotProductLinear::up(sgpp::base::DataVector& alpha,
                                        sgpp::base::DataVector& result, size_t dim) {
-  // phi * phi
-  PhiPhiUpBBLinear func(this->storage);
-  sgpp::base::sweep<PhiPhiUpBBLinear> s(func, *this->storage);
-
-  s.sweep1D(alpha, result, dim);
+  if (stencils && (stencils->getSize() == this->storage->getSize())) {
+    stencils->up(alpha, result, dim);
+  } else {
+    // phi * phi
+    PhiPhiUpBBLinear func(this->storage);
+    sgpp::base::sweep<PhiPhiUpBBLinear> s(func, *this->storage);
+
+    s.sweep1D(alpha, result, dim);
+  }
 }
 
 void OperationLTwoDotProductLinear::down(sgpp::base::DataVector& alpha,
                                          sgpp::base::DataVector& result, size_t dim) {
-  // phi * phi
-  PhiPhiDownBBLinear func(this->storage);
-  sgpp::base::sweep<PhiPhiDownBBLinear> s(func, *this->storage);
-
-  s.sweep1D(alpha, result, dim);
+  if (stencils && (stencils->getSize() == this->storage->getSize())) {
+    stencils->down(alpha, result, dim);
+  } else {
+    // phi * phi
+    PhiPhiDownBBLinear func(this->storage);
+    sgpp::base::sweep<PhiPhiDownBBLinear> s(func, *this->storage);
+
+    s.sweep1D(alpha, result, dim);
+  }
 }
 }  // namespace pde
 }  // namespace sgpp
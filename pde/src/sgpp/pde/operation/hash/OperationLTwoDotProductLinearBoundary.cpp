@@ -21,22 +21,34 @@ OperationLTwoDotProductLinearBoundary::OperationLTwoDotProductLinearBoundary(
 
 OperationLTwoDotProductLinearBoundary::~OperationLTwoDotProductLinearBoundary() {}
 
+void OperationLTwoDotProductLinearBoundary::precomputeStencils() {
+  stencils.reset(new UpDownStencils(*this->storage, true, false));
+}
+
 void OperationLTwoDotProductLinearBoundary::up(sgpp::base::DataVector& alpha,
                                                sgpp::base::DataVector& result, size_t dim) {
-  // phi * phi
-  PhiPhiUpBBLinearBoundary func(this->storage);
-  sgpp::base::sweep<PhiPhiUpBBLinearBoundary> s(func, *this->storage);
-
-  s.sweep1D_Boundary(alpha, result, dim);
+  if (stencils && (stencils->getSize() == this->storage->getSize())) {
+    stencils->up(alpha, result, dim);
+  } else {
+    // phi * phi
+    PhiPhiUpBBLinearBoundary func(this->storage);
+    sgpp::base::sweep<PhiPhiUpBBLinearBoundary> s(func, *this->storage);
+
+    s.sweep1D_Boundary(alpha, result, dim);
+  }
 }
 
 void OperationLTwoDotProductLinearBoundary::down(sgpp::base::DataVector& alpha,
                                                  sgpp::base::DataVector& result, size_t dim) {
-  // phi * phi
-  PhiPhiDownBBLinearBoundary func(this->storage);
-  sgpp::base::sweep<PhiPhiDownBBLinearBoundary> s(func, *this->storage);
-
-  s.sweep1D_Boundary(alpha, result, dim);
+  if (stencils && (stencils->getSize() == this->storage->getSize())) {
+    stencils->down(alpha, result, dim);
+  } else {
+    // phi * phi
+    PhiPhiDownBBLinearBoundary func(this->storage);
+    sgpp::base::sweep<PhiPhiDownBBLinearBoundary> s(func, *this->storage);
+
+    s.sweep1D_Boundary(alpha, result, dim);
+  }
 }
 }  // namespace pde
 }  // namespace sgpp
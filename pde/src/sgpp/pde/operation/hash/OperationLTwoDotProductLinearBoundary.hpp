@@ -7,9 +7,12 @@
 #define OPERATIONLTWODOTPRODUCTLINEARBOUNDARY_HPP
 
 #include <sgpp/pde/algorithm/StdUpDown.hpp>
+#include <sgpp/pde/algorithm/UpDownStencils.hpp>
 
 #include <sgpp/globaldef.hpp>
 
+#include <memory>
+
 namespace sgpp {
 namespace pde {
 
@@ -31,6 +34,14 @@ class OperationLTwoDotProductLinearBoundary : public StdUpDown {
    */
   virtual ~OperationLTwoDotProductLinearBoundary();
 
+  /**
+   * Precomputes the 1D stencils of the up/down sweeps of the grid (see UpDownStencils), the
+   * following applications use them instead of traversing the grid. They are ignored (the sweeps
+   * are used again) if the number of grid points has changed since, call this method again after
+   * modifying the grid.
+   */
+  void precomputeStencils();
+
  protected:
   /**
    * Up-step in dimension <i>dim</i> for \f$(\phi_i(x),\phi_j(x))_{L_2}\f$.
@@ -53,6 +64,9 @@ class OperationLTwoDotProductLinearBoundary : public StdUpDown {
    * @param result vector to store the results in
    */
   virtual void down(sgpp::base::DataVector& alpha, sgpp::base::DataVector& result, size_t dim);
+
+  /// precomputed stencils, nullptr if the sweeps are used
+  std::unique_ptr<UpDownStencils> stencils;
 };
 }  // namespace pde
 }  // namespace sgpp
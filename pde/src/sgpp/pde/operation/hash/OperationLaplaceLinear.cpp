@@ -26,6 +26,10 @@ OperationLaplaceLinear::OperationLaplaceLinear(sgpp::base::GridStorage* storage,
 
 OperationLaplaceLinear::~OperationLaplaceLinear() {}
 
+void OperationLaplaceLinear::precomputeStencils() {
+  stencils.reset(new UpDownStencils(*this->storage, false, true));
+}
+
 void OperationLaplaceLinear::specialOP(sgpp::base::DataVector& alpha,
                                        sgpp::base::DataVector& result, size_t dim,
                                        size_t gradient_dim) {
@@ -43,22 +47,34 @@ void OperationLaplaceLinear::specialOP(sgpp::base::DataVector& alpha,
 
 void OperationLaplaceLinear::up(sgpp::base::DataVector& alpha, sgpp::base::DataVector& result,
                                 size_t dim) {
-  PhiPhiUpBBLinear func(this->storage);
-  sgpp::base::sweep<PhiPhiUpBBLinear> s(func, *this->storage);
-  s.sweep1D(alpha, result, dim);
+  if (stencils && (stencils->getSize() == this->storage->getSize())) {
+    stencils->up(alpha, result, dim);
+  } else {
+    PhiPhiUpBBLinear func(this->storage);
+    sgpp::base::sweep<PhiPhiUpBBLinear> s(func, *this->storage);
+    s.sweep1D(alpha, result, dim);
+  }
 }
 
 void OperationLaplaceLinear::down(sgpp::base::DataVector& alpha, sgpp::base::DataVector& result,
                                   size_t dim) {
-  PhiPhiDownBBLinear func(this->storage);
-  sgpp::base::sweep<PhiPhiDownBBLinear> s(func, *this->storage);
-  s.sweep1D(alpha, result, dim);
+  if (stencils && (stencils->getSize() == this->storage->getSize())) {
+    stencils->down(alpha, result, dim);
+  } else {
+    PhiPhiDownBBLinear func(this->storage);
+    sgpp::base::sweep<PhiPhiDownBBLinear> s(func, *this->storage);
+    s.sweep1D(alpha, result, dim);
+  }
 }
 
 void OperationLaplaceLinear::downOpDim(sgpp::base::DataVector& alpha,
                                        sgpp::base::DataVector& result, size_t dim) {
-  DowndPhidPhiBBIterativeLinear myDown(this->storage);
-  myDown(alpha, result, dim);
+  if (stencils && (stencils->getSize() == this->storage->getSize())) {
+    stencils->downOpDim(alpha, result, dim);
+  } else {
+    DowndPhidPhiBBIterativeLinear myDown(this->storage);
+    myDown(alpha, result, dim);
+  }
 }
 
 void OperationLaplaceLinear::upOpDim(sgpp::base::DataVector& alpha, sgpp::base::DataVector& result,
@@ -7,9 +7,12 @@
 #define OPERATIONLAPLACELINEAR_HPP
 
 #include <sgpp/pde/algorithm/UpDownOneOpDim.hpp>
+#include <sgpp/pde/algorithm/UpDownStencils.hpp>
 
 #include <sgpp/globaldef.hpp>
 
+#include <memory>
+
 namespace sgpp {
 namespace pde {
 
@@ -40,6 +43,14 @@ class OperationLaplaceLinear : public UpDownOneOpDim {
    */
   virtual ~OperationLaplaceLinear();
 
+  /**
+   * Precomputes the 1D stencils of the up/down sweeps of the grid (see UpDownStencils), the
+   * following applications use them instead of traversing the grid. They are ignored (the sweeps
+   * are used again) if the number of grid points has changed since, call this method again after
+   * modifying the grid.
+   */
+  void precomputeStencils();
+
   virtual void specialOP(sgpp::base::DataVector& alpha, sgpp::base::DataVector& result, size_t dim,
                          size_t gradient_dim);
 
@@ -50,6 +61,10 @@ class OperationLaplaceLinear : public UpDownOneOpDim {
   virtual void downOpDim(sgpp::base::DataVector& alpha, sgpp::base::DataVector& result, size_t dim);
 
   virtual void upOpDim(sgpp::base::DataVector& alpha, sgpp::base::DataVector& result, size_t dim);
+
+ protected:
+  /// precomputed stencils, nullptr if the sweeps are used
+  std::unique_ptr<UpDownStencils> stencils;
 };
 }  // namespace pde
 }  // namespace sgpp
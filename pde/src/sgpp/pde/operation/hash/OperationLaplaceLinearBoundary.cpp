@@ -29,30 +29,50 @@ OperationLaplaceLinearBoundary::OperationLaplaceLinearBoundary(sgpp::base::GridS
 
 OperationLaplaceLinearBoundary::~OperationLaplaceLinearBoundary() {}
 
+void OperationLaplaceLinearBoundary::precomputeStencils() {
+  stencils.reset(new UpDownStencils(*this->storage, true, true));
+}
+
 void OperationLaplaceLinearBoundary::up(sgpp::base::DataVector& alpha,
                                         sgpp::base::DataVector& result, size_t dim) {
-  PhiPhiUpBBLinearBoundary func(this->storage);
-  sgpp::base::sweep<PhiPhiUpBBLinearBoundary> s(func, *this->storage);
-  s.sweep1D_Boundary(alpha, result, dim);
+  if (stencils && (stencils->getSize() == this->storage->getSize())) {
+    stencils->up(alpha, result, dim);
+  } else {
+    PhiPhiUpBBLinearBoundary func(this->storage);
+    sgpp::base::sweep<PhiPhiUpBBLinearBoundary> s(func, *this->storage);
+    s.sweep1D_Boundary(alpha, result, dim);
+  }
 }
 
 void OperationLaplaceLinearBoundary::down(sgpp::base::DataVector& alpha,
                                           sgpp::base::DataVector& result, size_t dim) {
-  PhiPhiDownBBLinearBoundary func(this->storage);
-  sgpp::base::sweep<PhiPhiDownBBLinearBoundary> s(func, *this->storage);
-  s.sweep1D_Boundary(alpha, result, dim);
+  if (stencils && (stencils->getSize() == this->storage->getSize())) {
+    stencils->down(alpha, result, dim);
+  } else {
+    PhiPhiDownBBLinearBoundary func(this->storage);
+    sgpp::base::sweep<PhiPhiDownBBLinearBoundary> s(func, *this->storage);
+    s.sweep1D_Boundary(alpha, result, dim);
+  }
 }
 
 void OperationLaplaceLinearBoundary::downOpDim(sgpp::base::DataVector& alpha,
                                                sgpp::base::DataVector& result, size_t dim) {
-  DowndPhidPhiBBIterativeLinearBoundary myDown(this->storage);
-  myDown(alpha, result, dim);
+  if (stencils && (stencils->getSize() == this->storage->getSize())) {
+    stencils->downOpDim(alpha, result, dim);
+  } else {
+    DowndPhidPhiBBIterativeLinearBoundary myDown(this->storage);
+    myDown(alpha, result, dim);
+  }
 }
 
 void OperationLaplaceLinearBoundary::upOpDim(sgpp::base::DataVector& alpha,
                                              sgpp::base::DataVector& result, size_t dim) {
-  UpdPhidPhiBBIterativeLinearBoundary myUp(this->storage);
-  myUp(alpha, result, dim);
+  if (stencils && (stencils->getSize() == this->storage->getSize())) {
+    stencils->upOpDim(alpha, result, dim);
+  } else {
+    UpdPhidPhiBBIterativeLinearBoundary myUp(this->storage);
+    myUp(alpha, result, dim);
+  }
 }
 }  // namespace pde
 }  // namespace sgpp
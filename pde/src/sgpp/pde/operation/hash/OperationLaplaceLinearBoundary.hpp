@@ -7,9 +7,12 @@
 #define OPERATIONLAPLACELINEARBOUNDARY_HPP
 
 #include <sgpp/pde/algorithm/UpDownOneOpDim.hpp>
+#include <sgpp/pde/algorithm/UpDownStencils.hpp>
 
 #include <sgpp/globaldef.hpp>
 
+#include <memory>
+
 namespace sgpp {
 namespace pde {
 
@@ -40,6 +43,14 @@ class OperationLaplaceLinearBoundary : public UpDownOneOpDim {
    */
   virtual ~OperationLaplaceLinearBoundary();
 
+  /**
+   * Precomputes the 1D stencils of the up/down sweeps of the grid (see UpDownStencils), the
+   * following applications use them instead of traversing the grid. They are ignored (the sweeps
+   * are used again) if the number of grid points has changed since, call this method again after
+   * modifying the grid.
+   */
+  void precomputeStencils();
+
  protected:
   virtual void up(sgpp::base::DataVector& alpha, sgpp::base::DataVector& result, size_t dim);
 
@@ -48,6 +59,9 @@ class OperationLaplaceLinearBoundary : public UpDownOneOpDim {
   virtual void downOpDim(sgpp::base::DataVector& alpha, sgpp::base::DataVector& result, size_t dim);
 
   virtual void upOpDim(sgpp::base::DataVector& alpha, sgpp::base::DataVector& result, size_t dim);
+
+  /// precomputed stencils, nullptr if the sweeps are used
+  std::unique_ptr<UpDownStencils> stencils;
 };
 }  // namespace pde
 }  // namespace sgpp
@@ -4,9 +4,9 @@
 // sgpp.sparsegrids.org
 
 #include <sgpp/pde/operation/hash/OperationMatrixLTwoDotExplicitBspline.hpp>
+#include <sgpp/pde/operation/hash/ExplicitMatrixAssembly.hpp>
 #include <sgpp/base/exception/data_exception.hpp>
 #include <sgpp/base/grid/type/BsplineGrid.hpp>
-#include <sgpp/base/tools/GaussLegendreQuadRule1D.hpp>
 #include <sgpp/base/grid/Grid.hpp>
 
 #include <sgpp/globaldef.hpp>
@@ -33,76 +33,10 @@ OperationMatrixLTwoDotExplicitBspline::OperationMatrixLTwoDotExplicitBspline(sgp
 }
 
 void OperationMatrixLTwoDotExplicitBspline::buildMatrix(sgpp::base::Grid* grid) {
-  size_t gridSize = grid->getSize();
-  size_t gridDim = grid->getDimension();
   const size_t p = dynamic_cast<sgpp::base::BsplineGrid*>(grid)->getDegree();
-  const size_t pp1h = (p + 1) >> 1;  // (p + 1) / 2
-  const double pp1hDbl = static_cast<double>(pp1h);
-  const size_t quadOrder = p + 1;
-  base::SBasis& basis = const_cast<base::SBasis&>(grid->getBasis());
-  sgpp::base::GridStorage& storage = grid->getStorage();
-
-  sgpp::base::DataVector coordinates;
-  sgpp::base::DataVector weights;
-  sgpp::base::GaussLegendreQuadRule1D& gauss = sgpp::base::GaussLegendreQuadRule1D::getInstance();
-  gauss.getLevelPointsAndWeightsNormalized(quadOrder, coordinates, weights);
-
-  for (size_t i = 0; i < gridSize; i++) {
-    for (size_t j = i; j < gridSize; j++) {
-      double res = 1.;
-
-      for (size_t k = 0; k < gridDim; k++) {
-        const sgpp::base::level_t lik = storage[i].getLevel(k);
-        const sgpp::base::level_t ljk = storage[j].getLevel(k);
-        const sgpp::base::index_t iik = storage[i].getIndex(k);
-        const sgpp::base::index_t ijk = storage[j].getIndex(k);
-        const sgpp::base::index_t hInvik = 1 << lik;
-        const sgpp::base::index_t hInvjk = 1 << ljk;
-        const double hik = 1.0 / static_cast<double>(hInvik);
-        const double hjk = 1.0 / static_cast<double>(hInvjk);
-
-        if (std::max((static_cast<double>(iik) - pp1hDbl) * hik,
-                     (static_cast<double>(ijk) - pp1hDbl) * hjk) >=
-            std::min((static_cast<double>(iik) + pp1hDbl) * hik,
-                     (static_cast<double>(ijk) + pp1hDbl) * hjk)) {
-          // Ansatz functions do not not overlap:
-          res = 0.;
-          break;
-        } else {
-          double temp_res = 0.0;
-
-          // Use formula for different overlapping ansatz functions:
-          double offset;
-          double scaling;
-          size_t start;
-          size_t stop;
-
-          if (lik >= ljk) {
-            offset = (static_cast<double>(iik) - pp1hDbl) * hik;
-            scaling = hik;
-            start = ((iik > pp1h) ? 0 : (pp1h - iik));
-            stop = std::min(p, hInvik + pp1h - iik - 1);
-          } else {
-            offset = (static_cast<double>(ijk) - pp1hDbl) * hjk;
-            scaling = hjk;
-            start = ((ijk > pp1h) ? 0 : (pp1h - ijk));
-            stop = std::min(p, hInvjk + pp1h - ijk - 1);
-          }
-
-          for (size_t n = start; n <= stop; n++) {
-            for (size_t c = 0; c < quadOrder; c++) {
-              const double x = offset + scaling * (coordinates[c] + static_cast<double>(n));
-              temp_res += weights[c] * basis.eval(lik, iik, x) * basis.eval(ljk, ijk, x);
-            }
-          }
-          res *= scaling * temp_res;
-        }
-      }
-
-      m_->set(i, j, res);
-      m_->set(j, i, res);
-    }
-  }
+  // 1D supports [(i - (p + 1) / 2) h, (i + (p + 1) / 2) h], p + 1 Gauss-Legendre points per cell
+  ExplicitMatrixAssembly assembly(grid->getStorage(), grid->getBasis(), (p + 1) / 2, p + 1, false);
+  assembly.assemble(*m_);
 }
 
 OperationMatrixLTwoDotExplicitBspline::~OperationMatrixLTwoDotExplicitBspline() {
@@ -4,9 +4,9 @@
 // sgpp.sparsegrids.org
 
 #include <sgpp/pde/operation/hash/OperationMatrixLTwoDotExplicitModPoly.hpp>
+#include <sgpp/pde/operation/hash/ExplicitMatrixAssembly.hpp>
 #include <sgpp/base/exception/data_exception.hpp>
 #include <sgpp/base/grid/type/ModPolyGrid.hpp>
-#include <sgpp/base/tools/GaussLegendreQuadRule1D.hpp>
 #include <sgpp/base/grid/Grid.hpp>
 
 #include <sgpp/globaldef.hpp>
@@ -33,55 +33,10 @@ OperationMatrixLTwoDotExplicitModPoly::OperationMatrixLTwoDotExplicitModPoly(sgp
 }
 
 void OperationMatrixLTwoDotExplicitModPoly::buildMatrix(sgpp::base::Grid* grid) {
-  size_t gridSize = grid->getSize();
-  size_t gridDim = grid->getDimension();
   const size_t p = dynamic_cast<sgpp::base::ModPolyGrid*>(grid)->getDegree();
-  // const double pp1hDbl = static_cast<double>(pp1h);
-  const size_t quadOrder = p + 1;
-  // clenshawCurtisPoint Method does not leave base const so we cast const'ness away
-  base::SPolyModifiedBase& basis =
-    const_cast<base::SPolyModifiedBase&>(
-      dynamic_cast<const base::SPolyModifiedBase&>(grid->getBasis()));
-  base::GridStorage& storage = grid->getStorage();
-  base::DataVector coordinates;
-  base::DataVector weights;
-  base::GaussLegendreQuadRule1D gauss;
-  gauss.getLevelPointsAndWeightsNormalized(quadOrder, coordinates, weights);
-  for (size_t i = 0; i < gridSize; i++) {
-    for (size_t j = i; j < gridSize; j++) {
-      double res = 1.0;
-      for (size_t k = 0; k < gridDim; k++) {
-        const base::level_t lik = storage[i].getLevel(k);
-        const base::level_t ljk = storage[j].getLevel(k);
-        const base::index_t iik = storage[i].getIndex(k);
-        const base::index_t ijk = storage[j].getIndex(k);
-        if (lik == 1 && ljk == 1)
-          continue;
-        const double left_i = 1.0/(1 << lik) * (iik - 1);
-        const double left_j = 1.0/(1 << ljk) * (ijk - 1);
-        const double right_i = 1.0/(1 << lik) * (iik + 1);
-        const double right_j = 1.0/(1 << ljk) * (ijk + 1);
-
-        if (left_j >= right_i || left_i >= right_j) {
-          // Ansatz functions do not not overlap:
-          res = 0.0;
-          break;
-        } else {
-          const double left = std::max(left_i, left_j);
-          const double right = std::min(right_i, right_j);
-          const double scaling = right - left;
-          double temp_res = 0.0;
-          for (size_t c = 0; c < quadOrder; c++) {
-            const double x = left + scaling * coordinates[c];
-            temp_res += weights[c] * basis.eval(lik, iik, x) * basis.eval(ljk, ijk, x);
-          }
-          res *= scaling*temp_res;
-        }
-      }
-      m_->set(i, j, res);
-      m_->set(j, i, res);
-    }
-  }
+  // 1D supports [(i - 1) h, (i + 1) h], p + 1 Gauss-Legendre points per cell
+  ExplicitMatrixAssembly assembly(grid->getStorage(), grid->getBasis(), 1, p + 1, false);
+  assembly.assemble(*m_);
 }
 
 OperationMatrixLTwoDotExplicitModPoly::~OperationMatrixLTwoDotExplicitModPoly() {
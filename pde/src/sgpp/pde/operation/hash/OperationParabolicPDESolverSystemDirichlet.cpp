@@ -163,6 +163,7 @@ sgpp::base::DataVector* OperationParabolicPDESolverSystemDirichlet::generateRHS(
     sgpp::base::DataVector myOldAlpha(*this->alpha_complete_old);
 
     applyMassMatrixComplete(*this->alpha_complete, temp);
+    rhs_complete.add(temp);
 
 #pragma omp parallel shared(myAlpha, temp)
     {
@@ -175,7 +176,6 @@ sgpp::base::DataVector* OperationParabolicPDESolverSystemDirichlet::generateRHS(
       }
     }
 
-    rhs_complete.add(temp);
     temp.mult((2.0) + this->TimestepSize / this->TimestepSize_old);
 
     sgpp::base::DataVector temp_old(this->alpha_complete->getSize());
@@ -448,5 +448,14 @@ sgpp::base::DataVector* OperationParabolicPDESolverSystemDirichlet::getGridCoeff
 
   return this->alpha_inner;
 }
+
+sgpp::base::GridStorage& OperationParabolicPDESolverSystemDirichlet::getInnerGridStorage() {
+  if (this->InnerGrid == nullptr) {
+    throw sgpp::base::algorithm_exception(
+        "OperationParabolicPDESolverSystemDirichlet::getInnerGridStorage : No inner grid exists!");
+  }
+
+  return this->InnerGrid->getStorage();
+}
 }  // namespace pde
 }  // namespace sgpp
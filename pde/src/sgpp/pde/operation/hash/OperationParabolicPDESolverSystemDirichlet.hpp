@@ -110,6 +110,14 @@ class OperationParabolicPDESolverSystemDirichlet
   virtual sgpp::base::DataVector* generateRHS();
 
   virtual sgpp::base::DataVector* getGridCoefficientsForCG();
+
+  /**
+   * Gets the storage of the inner grid, its grid points are the unknowns of the system
+   * (e.g. for preconditioners)
+   *
+   * @return storage of the inner grid
+   */
+  sgpp::base::GridStorage& getInnerGridStorage();
 };
 }  // namespace pde
 }  // namespace sgpp
@@ -8,6 +8,7 @@
 
 #include <sgpp/pde/algorithm/HeatEquationParabolicPDESolverSystem.hpp>
 #include <sgpp/pde/algorithm/PoissonEquationEllipticPDESolverSystemDirichlet.hpp>
+#include <sgpp/pde/algorithm/PrewaveletPreconditioner.hpp>
 #include <sgpp/pde/application/HeatEquationSolver.hpp>
 #include <sgpp/pde/application/HeatEquationSolverWithStretching.hpp>
 #include <sgpp/pde/application/PoissonEquationSolver.hpp>
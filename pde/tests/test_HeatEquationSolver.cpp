@@ -0,0 +1,135 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#define BOOST_TEST_DYN_LINK
+#include <boost/test/unit_test.hpp>
+
+#include <sgpp_base.hpp>
+#include <sgpp/base/exception/application_exception.hpp>
+#include <sgpp/pde/application/HeatEquationSolver.hpp>
+
+#include <sgpp/globaldef.hpp>
+
+#include <cmath>
+#include <memory>
+#include <string>
+
+BOOST_AUTO_TEST_SUITE(TestHeatEquationSolver)
+
+BOOST_AUTO_TEST_CASE(testSolveAdaptive) {
+  const size_t level = 4;
+  const double a = 0.1;
+  const double timestepsize = 0.001;
+  const size_t numTimesteps = 10;
+  const double t = static_cast<double>(numTimesteps) * timestepsize;
+
+  // sin(pi x) sin(pi y) decays with exp(-2 pi^2 a t)
+  const double pi = 3.141592653589793;
+  const double reference = std::exp(-2.0 * pi * pi * a * t);
+
+  sgpp::base::DataVector center(2, 0.5);
+
+  for (std::string method : {"SCH", "SCEJ", "SCAC", "SCMC", "SCBDF"}) {
+    sgpp::base::BoundingBox boundingBox(2);
+    sgpp::pde::HeatEquationSolver solver;
+    solver.constructGrid(boundingBox, level);
+    solver.setHeatCoefficient(a);
+
+    // the grid of the solver has the same points in the same order
+    std::unique_ptr<sgpp::base::Grid> grid(sgpp::base::Grid::createLinearBoundaryGrid(2));
+    grid->getGenerator().regular(level);
+    sgpp::base::GridStorage& storage = grid->getStorage();
+    sgpp::base::DataVector alpha(storage.getSize());
+
+    for (size_t i = 0; i < storage.getSize(); i++) {
+      alpha[i] = std::sin(pi * storage.getPoint(i).getStandardCoordinate(0)) *
+                 std::sin(pi * storage.getPoint(i).getStandardCoordinate(1));
+    }
+
+    std::unique_ptr<sgpp::base::OperationHierarchisation> hierarchisation(
+        sgpp::op_factory::createOperationHierarchisation(*grid));
+    hierarchisation->doHierarchisation(alpha);
+
+    solver.solveAdaptive(method, numTimesteps, timestepsize, 1e-3, 400, 1e-8, alpha);
+
+    BOOST_CHECK_CLOSE(solver.evaluatePoint(center, alpha), reference, 1.0);
+
+    const sgpp::solver::TimestepStatistics& statistics = solver.getTimestepStatistics();
+    BOOST_CHECK_GT(statistics.numAcceptedTimesteps, 0);
+    BOOST_CHECK_GT(statistics.numSLEIterations, 0);
+    BOOST_CHECK_LE(statistics.minTimestepSize, statistics.maxTimestepSize);
+    // the accepted timesteps cover the time interval
+    const double numSteps = static_cast<double>(statistics.numAcceptedTimesteps);
+    BOOST_CHECK_LE(statistics.minTimestepSize * numSteps, t + 1e-12);
+    BOOST_CHECK_GE(statistics.maxTimestepSize * numSteps, t - 1e-12);
+  }
+
+  sgpp::base::BoundingBox boundingBox(2);
+  sgpp::pde::HeatEquationSolver solver;
+  solver.constructGrid(boundingBox, level);
+  sgpp::base::DataVector alpha(solver.getNumberGridPoints(), 0.0);
+  BOOST_CHECK_THROW(solver.solveAdaptive("unknown", numTimesteps, timestepsize, 1e-3, 400, 1e-8,
+                                         alpha),
+                    sgpp::base::application_exception);
+}
+
+BOOST_AUTO_TEST_CASE(testSolveParareal) {
+  const size_t level = 3;
+  const size_t numTimesteps = 40;
+  const double timestepsize = 0.001;
+  const size_t numSlices = 4;
+  const double pi = 3.141592653589793;
+
+  sgpp::base::BoundingBox boundingBox(2);
+  sgpp::pde::HeatEquationSolver solver;
+  solver.constructGrid(boundingBox, level);
+  solver.setHeatCoefficient(0.1);
+
+  std::unique_ptr<sgpp::base::Grid> grid(sgpp::base::Grid::createLinearBoundaryGrid(2));
+  grid->getGenerator().regular(level);
+  sgpp::base::GridStorage& storage = grid->getStorage();
+  sgpp::base::DataVector initial(storage.getSize());
+
+  for (size_t i = 0; i < storage.getSize(); i++) {
+    const double x = storage.getPoint(i).getStandardCoordinate(0);
+    const double y = storage.getPoint(i).getStandardCoordinate(1);
+    initial[i] =
+        std::sin(pi * x) * std::sin(2.0 * pi * y) + std::sin(3.0 * pi * x) * std::sin(pi * y);
+  }
+
+  std::unique_ptr<sgpp::base::OperationHierarchisation> hierarchisation(
+      sgpp::op_factory::createOperationHierarchisation(*grid));
+  hierarchisation->doHierarchisation(initial);
+
+  sgpp::base::DataVector reference(initial);
+  solver.solveCrankNicolson(numTimesteps, timestepsize, 400, 1e-10, reference);
+
+  // a few iterations approximate the sequential solve
+  sgpp::base::DataVector alpha(initial);
+  solver.solveParareal(numTimesteps, timestepsize, numSlices, 2, 2, 0.0, 400, 1e-10, alpha);
+  BOOST_CHECK_EQUAL(solver.getNumberPararealIterations(), 2);
+  BOOST_CHECK_EQUAL(solver.getPararealCorrections().size(), 2);
+  BOOST_CHECK_LT(solver.getPararealCorrections()[1], solver.getPararealCorrections()[0]);
+
+  sgpp::base::DataVector error(alpha);
+  error.sub(reference);
+  BOOST_CHECK_LT(error.l2Norm(), 1e-3 * reference.l2Norm());
+
+  // numSlices iterations reproduce the sequential solve
+  alpha = initial;
+  solver.solveParareal(numTimesteps, timestepsize, numSlices, 2, numSlices, 0.0, 400, 1e-10,
+                       alpha);
+  BOOST_CHECK_EQUAL(solver.getNumberPararealIterations(), numSlices);
+
+  for (size_t i = 0; i < alpha.getSize(); i++) {
+    BOOST_CHECK_SMALL(alpha[i] - reference[i], 1e-8);
+  }
+
+  BOOST_CHECK_THROW(solver.solveParareal(numTimesteps, timestepsize, numTimesteps + 1, 1, 1, 0.0,
+                                         400, 1e-10, alpha),
+                    sgpp::base::application_exception);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
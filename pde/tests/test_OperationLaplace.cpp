@@ -9,8 +9,14 @@
 
 #include <sgpp_base.hpp>
 #include <sgpp_pde.hpp>
+#include <sgpp/base/exception/factory_exception.hpp>
 #include <sgpp/pde/operation/PdeOpFactory.hpp>
 #include <sgpp/globaldef.hpp>
+
+#include <cmath>
+#include <memory>
+#include <vector>
+
 namespace sgpp {
 namespace pde {
   /*
@@ -398,6 +404,115 @@ namespace pde {
     }
   }
 
+  BOOST_AUTO_TEST_CASE(testOperationLaplaceLinearCoefficients) {
+    const size_t d = 4;
+    const size_t l = 4;
+    std::unique_ptr<sgpp::base::Grid> grid(sgpp::base::Grid::createLinearGrid(d));
+    grid->getGenerator().regular(l);
+
+    // the dimension with a zero coefficient must not contribute
+    sgpp::base::DataVector coef(d);
+    coef[0] = 2.0;
+    coef[1] = 0.0;
+    coef[2] = -0.5;
+    coef[3] = 1.0;
+
+    sgpp::base::DataVector alpha(grid->getSize());
+
+    for (size_t i = 0; i < grid->getSize(); i++) {
+      alpha[i] = std::sin(static_cast<double>(i));
+    }
+
+    std::unique_ptr<sgpp::base::OperationMatrix> op(
+      sgpp::op_factory::createOperationLaplace(*grid, coef));
+    sgpp::base::DataVector result(grid->getSize());
+    op->mult(alpha, result);
+
+    // sum of the operators of the single dimensions
+    sgpp::base::DataVector resultSum(grid->getSize(), 0.0);
+
+    for (size_t t = 0; t < d; t++) {
+      sgpp::base::DataVector unitCoef(d, 0.0);
+      unitCoef[t] = 1.0;
+      std::unique_ptr<sgpp::base::OperationMatrix> opDim(
+        sgpp::op_factory::createOperationLaplace(*grid, unitCoef));
+      sgpp::base::DataVector resultDim(grid->getSize());
+      opDim->mult(alpha, resultDim);
+      resultSum.axpy(coef[t], resultDim);
+    }
+
+    for (size_t i = 0; i < grid->getSize(); i++) {
+      BOOST_CHECK_SMALL(result.get(i) - resultSum.get(i), 1e-12);
+    }
+  }
+
+  BOOST_AUTO_TEST_CASE(testOperationStencilLinear) {
+    const size_t d = 3;
+    const size_t l = 4;
+
+    // bounding box with different widths and Dirichlet boundaries on some sides
+    std::vector<sgpp::base::BoundingBox1D> boundingBox1Ds;
+    boundingBox1Ds.push_back(sgpp::base::BoundingBox1D(-1.0, 2.0, false, false));
+    boundingBox1Ds.push_back(sgpp::base::BoundingBox1D(0.0, 0.5, true, false));
+    boundingBox1Ds.push_back(sgpp::base::BoundingBox1D(0.0, 1.0, true, true));
+    sgpp::base::BoundingBox boundingBox(boundingBox1Ds);
+
+    std::vector<std::unique_ptr<sgpp::base::Grid>> grids;
+    grids.emplace_back(sgpp::base::Grid::createLinearGrid(d));
+    grids.emplace_back(sgpp::base::Grid::createLinearBoundaryGrid(d));
+    grids.emplace_back(sgpp::base::Grid::createLinearBoundaryGrid(d, 0));
+
+    for (std::unique_ptr<sgpp::base::Grid>& grid : grids) {
+      grid->getGenerator().regular(l);
+      grid->setBoundingBox(boundingBox);
+
+      for (int refinement = 0; refinement < 2; refinement++) {
+        sgpp::base::DataVector alpha(grid->getSize());
+
+        for (size_t i = 0; i < grid->getSize(); i++) {
+          alpha[i] = std::sin(static_cast<double>(i));
+        }
+
+        std::unique_ptr<sgpp::base::OperationMatrix> laplace(
+          sgpp::op_factory::createOperationLaplace(*grid));
+        std::unique_ptr<sgpp::base::OperationMatrix> laplaceStencil(
+          sgpp::op_factory::createOperationLaplaceStencil(*grid));
+        std::unique_ptr<sgpp::base::OperationMatrix> lTwo(
+          sgpp::op_factory::createOperationLTwoDotProduct(*grid));
+        std::unique_ptr<sgpp::base::OperationMatrix> lTwoStencil(
+          sgpp::op_factory::createOperationLTwoDotProductStencil(*grid));
+
+        sgpp::base::DataVector result(grid->getSize());
+        sgpp::base::DataVector resultStencil(grid->getSize());
+
+        laplace->mult(alpha, result);
+        laplaceStencil->mult(alpha, resultStencil);
+
+        for (size_t i = 0; i < grid->getSize(); i++) {
+          BOOST_CHECK_SMALL(resultStencil[i] - result[i], 1e-10);
+        }
+
+        lTwo->mult(alpha, result);
+        lTwoStencil->mult(alpha, resultStencil);
+
+        for (size_t i = 0; i < grid->getSize(); i++) {
+          BOOST_CHECK_SMALL(resultStencil[i] - result[i], 1e-12);
+        }
+
+        // adaptive grid for the next run
+        sgpp::base::DataVector surplus(grid->getSize(), 0.0);
+        surplus[grid->getSize() / 2] = 1.0;
+        surplus[grid->getSize() - 1] = 1.0;
+        sgpp::base::SurplusRefinementFunctor functor(surplus, 2);
+        grid->getGenerator().refine(functor);
+      }
+    }
+
+    std::unique_ptr<sgpp::base::Grid> grid(sgpp::base::Grid::createModLinearGrid(d));
+    BOOST_CHECK_THROW(sgpp::op_factory::createOperationLaplaceStencil(*grid),
+                      sgpp::base::factory_exception);
+  }
+
 BOOST_AUTO_TEST_SUITE_END()
 }  // namespace pde
 }  // namespace sgpp
@@ -9,7 +9,11 @@
 #include <sgpp_base.hpp>
 #include <sgpp_pde.hpp>
 #include <sgpp/pde/operation/PdeOpFactory.hpp>
+#include <sgpp/pde/operation/hash/ExplicitMatrixAssembly.hpp>
 #include <sgpp/globaldef.hpp>
+
+#include <vector>
+
 namespace sgpp {
 namespace pde {
 
@@ -502,6 +506,51 @@ BOOST_AUTO_TEST_CASE(testOperationMatrixLTwoDotExplicitBsplineClenshawCurtis) {
   delete opExplicit;
 }
 
+BOOST_AUTO_TEST_CASE(testExplicitMatrixAssemblySparse) {
+  const size_t d = 3;
+  const size_t l = 4;
+  const size_t p = 3;
+  sgpp::base::Grid* grid(sgpp::base::Grid::createBsplineGrid(d, p));
+  grid->getGenerator().regular(l);
+  const size_t n = grid->getSize();
+
+  for (bool laplace : {false, true}) {
+    ExplicitMatrixAssembly assembly(grid->getStorage(), grid->getBasis(), (p + 1) / 2, p + 1,
+                                    laplace);
+    sgpp::base::DataMatrix m(n, n, 1.0);
+    assembly.assemble(m);
+
+    std::vector<size_t> rowOffsets;
+    std::vector<size_t> columns;
+    std::vector<double> values;
+    assembly.assemble(rowOffsets, columns, values);
+    BOOST_CHECK_EQUAL(rowOffsets.size(), n + 1);
+    BOOST_CHECK_LT(values.size(), n * n);
+
+    // the sparse rows contain the nonzero entries of the dense matrix (sorted)
+    sgpp::base::DataMatrix sparse(n, n, 0.0);
+
+    for (size_t i = 0; i < n; i++) {
+      for (size_t k = rowOffsets[i]; k < rowOffsets[i + 1]; k++) {
+        if (k > rowOffsets[i]) {
+          BOOST_CHECK_LT(columns[k - 1], columns[k]);
+        }
+
+        sparse.set(i, columns[k], values[k]);
+      }
+    }
+
+    for (size_t i = 0; i < n; i++) {
+      for (size_t j = 0; j < n; j++) {
+        BOOST_CHECK_EQUAL(sparse.get(i, j), m.get(i, j));
+        BOOST_CHECK_EQUAL(m.get(i, j), m.get(j, i));
+      }
+    }
+  }
+
+  delete grid;
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 }  // namespace pde
 }  // namespace sgpp
@@ -0,0 +1,156 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#define BOOST_TEST_DYN_LINK
+#include <boost/test/unit_test.hpp>
+
+#include <sgpp_base.hpp>
+#include <sgpp/base/exception/solver_exception.hpp>
+#include <sgpp/pde/algorithm/PrewaveletPreconditioner.hpp>
+#include <sgpp/pde/operation/PdeOpFactory.hpp>
+#include <sgpp/solver/sle/ConjugateGradients.hpp>
+
+#include <sgpp/globaldef.hpp>
+
+#include <cmath>
+#include <memory>
+#include <vector>
+
+namespace {
+
+/**
+ * m * mass matrix + s * Laplacian of a grid
+ */
+class HelmholtzMatrix : public sgpp::base::OperationMatrix {
+ public:
+  HelmholtzMatrix(sgpp::base::Grid& grid, double massWeight, double stiffnessWeight)
+      : laplace(sgpp::op_factory::createOperationLaplace(grid)),
+        mass(sgpp::op_factory::createOperationLTwoDotProduct(grid)),
+        massWeight(massWeight),
+        stiffnessWeight(stiffnessWeight) {}
+
+  void mult(sgpp::base::DataVector& alpha, sgpp::base::DataVector& result) override {
+    sgpp::base::DataVector temp(alpha.getSize());
+    laplace->mult(alpha, result);
+    result.mult(stiffnessWeight);
+    mass->mult(alpha, temp);
+    result.axpy(massWeight, temp);
+  }
+
+ private:
+  std::unique_ptr<sgpp::base::OperationMatrix> laplace;
+  std::unique_ptr<sgpp::base::OperationMatrix> mass;
+  double massWeight;
+  double stiffnessWeight;
+};
+
+/**
+ * Solves the system of m * mass matrix + s * Laplacian on a regular grid of the given level with
+ * (preconditioned) CG and returns the number of iterations
+ */
+size_t solve(sgpp::base::Grid& grid, size_t level, double massWeight, double stiffnessWeight,
+             bool precondition) {
+  grid.getStorage().clear();
+  grid.getGenerator().regular(level);
+  sgpp::base::GridStorage& storage = grid.getStorage();
+  HelmholtzMatrix systemMatrix(grid, massWeight, stiffnessWeight);
+
+  sgpp::base::DataVector solution(storage.getSize());
+
+  for (size_t i = 0; i < storage.getSize(); i++) {
+    solution[i] = std::sin(static_cast<double>(i));
+  }
+
+  sgpp::base::DataVector rhs(storage.getSize());
+  systemMatrix.mult(solution, rhs);
+
+  sgpp::solver::ConjugateGradients cg(1000, 1e-10);
+  sgpp::pde::PrewaveletPreconditioner preconditioner(storage, massWeight, stiffnessWeight);
+
+  if (precondition) {
+    cg.setPreconditioner(&preconditioner);
+  }
+
+  sgpp::base::DataVector alpha(storage.getSize(), 0.0);
+  cg.solve(systemMatrix, alpha, rhs, false, false, 0.0);
+
+  alpha.sub(solution);
+  BOOST_CHECK_SMALL(alpha.maxNorm(), 1e-6);
+
+  return cg.getNumberIterations();
+}
+
+}  // namespace
+
+BOOST_AUTO_TEST_SUITE(TestPrewaveletPreconditioner)
+
+BOOST_AUTO_TEST_CASE(testLevelIndependence) {
+  // Poisson and the implicit heat steps
+  for (double stiffnessWeight : {1.0, 1e-3}) {
+    const double massWeight = (stiffnessWeight == 1.0) ? 0.0 : 1.0;
+
+    for (size_t dim : {2, 3}) {
+      std::unique_ptr<sgpp::base::Grid> grid(sgpp::base::Grid::createLinearGrid(dim));
+      std::vector<size_t> iterations;
+
+      for (size_t level = 4; level <= 6; level++) {
+        iterations.push_back(solve(*grid, level, massWeight, stiffnessWeight, true));
+      }
+
+      const size_t unpreconditioned = solve(*grid, 6, massWeight, stiffnessWeight, false);
+
+      // the iterations hardly grow with the level and are less than without preconditioner
+      BOOST_CHECK_LE(iterations[2], iterations[0] + 20);
+      BOOST_CHECK_LT(iterations[2], unpreconditioned);
+    }
+  }
+}
+
+BOOST_AUTO_TEST_CASE(testBoundaryAndSize) {
+  // the boundary points are scaled as in the hierarchical basis
+  std::unique_ptr<sgpp::base::Grid> grid(sgpp::base::Grid::createLinearBoundaryGrid(2));
+  grid->getGenerator().regular(4);
+  sgpp::base::GridStorage& storage = grid->getStorage();
+  HelmholtzMatrix systemMatrix(*grid, 1.0, 0.1);
+
+  sgpp::base::DataVector solution(storage.getSize());
+
+  for (size_t i = 0; i < storage.getSize(); i++) {
+    solution[i] = std::cos(static_cast<double>(i));
+  }
+
+  sgpp::base::DataVector rhs(storage.getSize());
+  systemMatrix.mult(solution, rhs);
+
+  sgpp::solver::ConjugateGradients cg(1000, 1e-10);
+  sgpp::pde::PrewaveletPreconditioner preconditioner(storage, 1.0, 0.1);
+  cg.setPreconditioner(&preconditioner);
+  sgpp::base::DataVector alpha(storage.getSize(), 0.0);
+  cg.solve(systemMatrix, alpha, rhs, false, false, 0.0);
+
+  alpha.sub(solution);
+  BOOST_CHECK_SMALL(alpha.maxNorm(), 1e-6);
+
+  // the preconditioner is symmetric
+  sgpp::base::DataVector x(storage.getSize());
+  sgpp::base::DataVector y(storage.getSize());
+
+  for (size_t i = 0; i < storage.getSize(); i++) {
+    x[i] = std::sin(1.3 * static_cast<double>(i));
+    y[i] = std::cos(0.7 * static_cast<double>(i));
+  }
+
+  sgpp::base::DataVector px(storage.getSize());
+  sgpp::base::DataVector py(storage.getSize());
+  preconditioner.apply(x, px);
+  preconditioner.apply(y, py);
+  BOOST_CHECK_CLOSE(px.dotProduct(y), py.dotProduct(x), 1e-8);
+
+  preconditioner.reset();
+  BOOST_CHECK_THROW(preconditioner.prepare(systemMatrix, storage.getSize() + 1),
+                    sgpp::base::solver_exception);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
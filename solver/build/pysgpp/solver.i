@@ -8,11 +8,17 @@
 
 // The Good, i.e. without any modifications
 %include "solver/src/sgpp/solver/SGSolver.hpp"
+%include "solver/src/sgpp/solver/sle/preconditioner/Preconditioner.hpp"
 %include "solver/src/sgpp/solver/SLESolver.hpp"
 %include "solver/src/sgpp/solver/ODESolver.hpp"
 %feature("director") ConjugateGradients;
 %include "solver/src/sgpp/solver/sle/ConjugateGradients.hpp"
 %include "solver/src/sgpp/solver/sle/BiCGStab.hpp"
+%include "solver/src/sgpp/solver/sle/PipelinedConjugateGradients.hpp"
+%include "solver/src/sgpp/solver/sle/BlockConjugateGradients.hpp"
+%include "solver/src/sgpp/solver/sle/preconditioner/JacobiPreconditioner.hpp"
+%include "solver/src/sgpp/solver/sle/preconditioner/LevelScaledPreconditioner.hpp"
+%include "solver/src/sgpp/solver/sle/preconditioner/SubspaceBlockPreconditioner.hpp"
 %include "solver/src/sgpp/solver/ode/Euler.hpp"
 %include "solver/src/sgpp/solver/ode/CrankNicolson.hpp"
 %include "solver/src/sgpp/solver/TypesSolver.hpp"
@@ -10,6 +10,7 @@
 #include <sgpp/base/operation/hash/OperationMatrix.hpp>
 
 #include <sgpp/solver/SGSolver.hpp>
+#include <sgpp/solver/sle/preconditioner/Preconditioner.hpp>
 
 #ifndef DEFAULT_RES_THRESHOLD
 #define DEFAULT_RES_THRESHOLD -1.0
@@ -28,7 +29,8 @@ class SLESolver : public SGSolver {
    * @param imax number of maximum executed iterations
    * @param epsilon the final error in the iterative solver
    */
-  SLESolver(size_t imax, double epsilon) : SGSolver(imax, epsilon) {}
+  SLESolver(size_t imax, double epsilon)
+      : SGSolver(imax, epsilon), preconditioner(nullptr), duration(0.0) {}
 
   /**
    * Std-Destructor
@@ -49,6 +51,31 @@ class SLESolver : public SGSolver {
   virtual void solve(sgpp::base::OperationMatrix& SystemMatrix, sgpp::base::DataVector& alpha,
                      sgpp::base::DataVector& b, bool reuse = false, bool verbose = false,
                      double max_threshold = DEFAULT_RES_THRESHOLD) = 0;
+
+  /**
+   * Sets the preconditioner of the following solves (solvers without support for
+   * preconditioning ignore it). The preconditioner is not owned by the solver.
+   *
+   * @param preconditioner the preconditioner, nullptr for none
+   */
+  void setPreconditioner(Preconditioner* preconditioner) { this->preconditioner = preconditioner; }
+
+  /**
+   * @return the preconditioner, nullptr if there is none
+   */
+  Preconditioner* getPreconditioner() { return preconditioner; }
+
+  /**
+   * @return the wall clock time of the last solve in seconds (including the preparation of the
+   * preconditioner)
+   */
+  double getDuration() { return duration; }
+
+ protected:
+  /// preconditioner, nullptr if there is none
+  Preconditioner* preconditioner;
+  /// duration of the last solve
+  double duration;
 };
 
 }  // namespace solver
@@ -8,6 +8,7 @@
 #include <sgpp/base/operation/hash/OperationEval.hpp>
 #include <sgpp/base/tools/GridPrinter.hpp>
 #include <sgpp/base/exception/solver_exception.hpp>
+#include <sgpp/base/tools/SGppStopwatch.hpp>
 #include <sgpp/globaldef.hpp>
 
 #include <iostream>
@@ -19,6 +20,34 @@
 namespace sgpp {
 namespace solver {
 
+namespace {
+
+/**
+ * Forwards the solves to another solver and accumulates their iterations and durations, the
+ * predictors and correctors may solve several systems per timestep
+ */
+class CountingSLESolver : public SLESolver {
+ public:
+  CountingSLESolver(SLESolver& solver, TimestepStatistics& statistics)
+      : SLESolver(0, 0.0), solver(solver), statistics(statistics) {}
+
+  void solve(sgpp::base::OperationMatrix& SystemMatrix, sgpp::base::DataVector& alpha,
+             sgpp::base::DataVector& b, bool reuse, bool verbose, double max_threshold) override {
+    solver.solve(SystemMatrix, alpha, b, reuse, verbose, max_threshold);
+    this->nIterations = solver.getNumberIterations();
+    this->residuum = solver.getResiduum();
+    this->duration = solver.getDuration();
+    statistics.numSLEIterations += this->nIterations;
+    statistics.sleDuration += this->duration;
+  }
+
+ private:
+  SLESolver& solver;
+  TimestepStatistics& statistics;
+};
+
+}  // namespace
+
 StepsizeControl::StepsizeControl(size_t imax, double timestepSize, double eps, double sc,
                                  sgpp::base::ScreenOutput* screen, double gamma)
     : ODESolver(imax, timestepSize), myScreen(screen), _gamma(gamma) {
@@ -94,7 +123,14 @@ double StepsizeControl::maxNorm(sgpp::solver::OperationParabolicPDESolverSystem&
 void StepsizeControl::solve(SLESolver& LinearSystemSolver,
                             sgpp::solver::OperationParabolicPDESolverSystem& System,
                             bool bIdentifyLastStep, bool verbose) {
-  size_t allIter = 0;
+  sgpp::base::SGppStopwatch stopwatch;
+  stopwatch.start();
+
+  statistics = TimestepStatistics();
+  this->nIterations = 0;
+
+  CountingSLESolver CountingSolver(LinearSystemSolver, statistics);
+
   sgpp::base::DataVector* rhs;
   sgpp::base::DataVector YkAdBas(System.getGridCoefficients()->getSize());
   sgpp::base::DataVector YkImEul(System.getGridCoefficients()->getSize());
@@ -125,9 +161,9 @@ void StepsizeControl::solve(SLESolver& LinearSystemSolver,
 
     YkImEul.resize(System.getGridCoefficients()->getSize());
 
-    predictor(LinearSystemSolver, System, tmp_timestepsize, YkAdBas, YkImEul, rhs);
+    predictor(CountingSolver, System, tmp_timestepsize, YkAdBas, YkImEul, rhs);
 
-    corrector(LinearSystemSolver, System, tmp_timestepsize, YkImEul, rhs);
+    corrector(CountingSolver, System, tmp_timestepsize, YkImEul, rhs);
 
     double tmp = norm(System, YkImEul, YkAdBas);
 
@@ -140,19 +176,29 @@ void StepsizeControl::solve(SLESolver& LinearSystemSolver,
         tmp_timestepsize = _gamma * tmp_timestepsize;
 
       System.abortTimestep();
-      allIter += LinearSystemSolver.getNumberIterations();
+      statistics.numRejectedTimesteps++;
 
     } else {
       fileout << i << " " << (tmp_timestepsize_new - tmp_timestepsize) << " " << time << " "
               << tmp_timestepsize << std::endl;
       time += tmp_timestepsize;
-      allIter += LinearSystemSolver.getNumberIterations();
+
+      if (statistics.numAcceptedTimesteps == 0) {
+        statistics.minTimestepSize = tmp_timestepsize;
+        statistics.maxTimestepSize = tmp_timestepsize;
+      } else {
+        statistics.minTimestepSize = std::min(statistics.minTimestepSize, tmp_timestepsize);
+        statistics.maxTimestepSize = std::max(statistics.maxTimestepSize, tmp_timestepsize);
+      }
+
+      statistics.numAcceptedTimesteps++;
 
       if (verbose == true) {
         if (myScreen == nullptr) {
           std::cout << "Final residuum " << LinearSystemSolver.getResiduum() << "; with "
                     << LinearSystemSolver.getNumberIterations()
-                    << " Iterations (Total Iter.: " << allIter << ")" << std::endl;
+                    << " Iterations (Total Iter.: " << statistics.numSLEIterations << ")"
+                    << std::endl;
         }
       }
 
@@ -161,7 +207,7 @@ void StepsizeControl::solve(SLESolver& LinearSystemSolver,
 
         soutput << " Final residuum " << LinearSystemSolver.getResiduum() << "; with "
                 << LinearSystemSolver.getNumberIterations()
-                << " Iterations (Total Iter.: " << allIter << ")";
+                << " Iterations (Total Iter.: " << statistics.numSLEIterations << ")";
 
         if (i < this->nMaxIterations - 1) {
           myScreen->update(static_cast<size_t>((static_cast<double>(i + 1) * 100.0) /
@@ -199,6 +245,9 @@ void StepsizeControl::solve(SLESolver& LinearSystemSolver,
 
   fileout.close();
 
+  this->nIterations = statistics.numAcceptedTimesteps;
+  statistics.duration = stopwatch.stop();
+
   // write some empty lines to console
   if (myScreen != nullptr) {
     myScreen->writeEmptyLines(2);
@@ -8,6 +8,7 @@
 
 #include <sgpp/base/application/ScreenOutput.hpp>
 #include <sgpp/solver/ODESolver.hpp>
+#include <sgpp/solver/ode/TimestepStatistics.hpp>
 #include <sgpp/solver/operation/hash/OperationParabolicPDESolverSystem.hpp>
 
 #include <sgpp/globaldef.hpp>
@@ -63,6 +64,9 @@ class StepsizeControl : public ODESolver {
   /// damping factor
   double _gamma;
 
+  /// statistics of the last solve
+  TimestepStatistics statistics;
+
  public:
   /**
    * Std-Constructer
@@ -82,8 +86,20 @@ class StepsizeControl : public ODESolver {
    */
   virtual ~StepsizeControl();
 
+  /**
+   * Solves the ODE with adaptive timestep sizes in the time interval
+   * [0, imax * timestepSize]. The number of accepted timesteps is available via
+   * getNumberIterations() afterwards.
+   *
+   * The systems of linear equations are solved with the previous solution as initial guess.
+   */
   void solve(SLESolver& LinearSystemSolver, sgpp::solver::OperationParabolicPDESolverSystem& System,
              bool bIdentifyLastStep = false, bool verbose = false);
+
+  /**
+   * @return the statistics of the last solve
+   */
+  const TimestepStatistics& getTimestepStatistics() const { return statistics; }
 };
 
 }  // namespace solver
@@ -0,0 +1,39 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#ifndef TIMESTEPSTATISTICS_HPP
+#define TIMESTEPSTATISTICS_HPP
+
+#include <sgpp/globaldef.hpp>
+
+#include <cstddef>
+
+namespace sgpp {
+namespace solver {
+
+/**
+ * Statistics of a solve with adaptive timestep sizes
+ */
+struct TimestepStatistics {
+  /// number of accepted timesteps
+  size_t numAcceptedTimesteps = 0;
+  /// number of rejected timesteps, which have been repeated with a smaller timestep size
+  size_t numRejectedTimesteps = 0;
+  /// smallest accepted timestep size
+  double minTimestepSize = 0.0;
+  /// largest accepted timestep size
+  double maxTimestepSize = 0.0;
+  /// iterations of all solves of systems of linear equations (including rejected timesteps)
+  size_t numSLEIterations = 0;
+  /// wall clock time of all solves of systems of linear equations in seconds
+  double sleDuration = 0.0;
+  /// wall clock time of the whole solve in seconds
+  double duration = 0.0;
+};
+
+}  // namespace solver
+}  // namespace sgpp
+
+#endif /* TIMESTEPSTATISTICS_HPP */
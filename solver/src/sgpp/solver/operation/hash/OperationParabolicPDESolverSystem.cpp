@@ -18,6 +18,11 @@ OperationParabolicPDESolverSystem::OperationParabolicPDESolverSystem() {
   this->numSumGridpointsInner = 0;
   this->numSumGridpointsComplete = 0;
   this->bnewODESolver = false;
+  // the history is only needed for step size controls and allocated by the derived systems
+  this->alpha_complete_old = nullptr;
+  this->alpha_complete_tmp = nullptr;
+  this->oldGridStorage = nullptr;
+  this->secondGridStorage = nullptr;
 }
 
 OperationParabolicPDESolverSystem::~OperationParabolicPDESolverSystem() {}
@@ -4,6 +4,7 @@
 // sgpp.sparsegrids.org
 
 #include <sgpp/solver/sle/BiCGStab.hpp>
+#include <sgpp/base/tools/SGppStopwatch.hpp>
 #include <sgpp/globaldef.hpp>
 
 #include <cmath>
@@ -17,6 +18,9 @@ BiCGStab::~BiCGStab() {}
 
 void BiCGStab::solve(sgpp::base::OperationMatrix& SystemMatrix, sgpp::base::DataVector& alpha,
                      sgpp::base::DataVector& b, bool reuse, bool verbose, double max_threshold) {
+  sgpp::base::SGppStopwatch stopwatch;
+  stopwatch.start();
+
   this->nIterations = 1;
   double epsilonSqd = this->myEpsilon * this->myEpsilon;
 
@@ -53,9 +57,28 @@ void BiCGStab::solve(sgpp::base::OperationMatrix& SystemMatrix, sgpp::base::Data
   sgpp::base::DataVector v(alpha.getSize());
   sgpp::base::DataVector w(alpha.getSize());
 
+  // right preconditioning: pHat = M^{-1} p and wHat = M^{-1} w,
+  // without preconditioner these are p and w themselves
+  sgpp::base::DataVector pPreconditioned(0);
+  sgpp::base::DataVector wPreconditioned(0);
+  sgpp::base::DataVector* pHat = &p;
+  sgpp::base::DataVector* wHat = &w;
+
+  if (this->preconditioner != nullptr) {
+    this->preconditioner->prepare(SystemMatrix, alpha.getSize());
+    pPreconditioned.resize(alpha.getSize());
+    wPreconditioned.resize(alpha.getSize());
+    pHat = &pPreconditioned;
+    wHat = &wPreconditioned;
+  }
+
   while (this->nIterations < this->nMaxIterations) {
-    // s  = Ap
-    SystemMatrix.mult(p, s);
+    if (this->preconditioner != nullptr) {
+      this->preconditioner->apply(p, *pHat);
+    }
+
+    // s  = A pHat
+    SystemMatrix.mult(*pHat, s);
 
     // std::cout << "s " << s.get(0) << " " << s.get(1)  << std::endl;
 
@@ -71,16 +94,20 @@ void BiCGStab::solve(sgpp::base::OperationMatrix& SystemMatrix, sgpp::base::Data
     w = r;
     w.axpy((-1.0) * a, s);
 
-    // v = Aw
-    SystemMatrix.mult(w, v);
+    if (this->preconditioner != nullptr) {
+      this->preconditioner->apply(w, *wHat);
+    }
+
+    // v = A wHat
+    SystemMatrix.mult(*wHat, v);
 
     // std::cout << "v " << v.get(0) << " " << v.get(1)  << std::endl;
 
     omega = (v.dotProduct(w)) / (v.dotProduct(v));
 
-    // x = x - a*p - omega*w
-    alpha.axpy((-1.0) * a, p);
-    alpha.axpy((-1.0) * omega, w);
+    // x = x - a*pHat - omega*wHat
+    alpha.axpy((-1.0) * a, *pHat);
+    alpha.axpy((-1.0) * omega, *wHat);
 
     // r = r - a*s - omega*v
     r.axpy((-1.0) * a, s);
@@ -111,6 +138,8 @@ void BiCGStab::solve(sgpp::base::OperationMatrix& SystemMatrix, sgpp::base::Data
 
     this->nIterations++;
   }
+
+  this->duration = stopwatch.stop();
 }
 
 }  // namespace solver
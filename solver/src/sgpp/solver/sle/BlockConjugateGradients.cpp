@@ -0,0 +1,357 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#include <sgpp/solver/sle/BlockConjugateGradients.hpp>
+#include <sgpp/base/exception/solver_exception.hpp>
+#include <sgpp/base/tools/SGppStopwatch.hpp>
+
+#include <sgpp/globaldef.hpp>
+
+#include <algorithm>
+#include <iostream>
+#include <utility>
+#include <vector>
+
+namespace sgpp {
+namespace solver {
+
+namespace {
+
+/**
+ * Copies the given columns of source into result
+ */
+void gatherColumns(const sgpp::base::DataMatrix& source, const std::vector<size_t>& columns,
+                   sgpp::base::DataMatrix& result) {
+  const size_t rows = source.getNrows();
+  const size_t sourceColumns = source.getNcols();
+  const size_t numColumns = columns.size();
+  result.resizeRowsCols(rows, numColumns);
+
+  const double* ptrSource = source.getPointer();
+  double* ptrResult = result.getPointer();
+
+#pragma omp parallel for schedule(static)
+  for (size_t i = 0; i < rows; i++) {
+    for (size_t j = 0; j < numColumns; j++) {
+      ptrResult[i * numColumns + j] = ptrSource[i * sourceColumns + columns[j]];
+    }
+  }
+}
+
+/**
+ * Removes all columns of matrix except the given ones
+ */
+void keepColumns(sgpp::base::DataMatrix& matrix, const std::vector<size_t>& columns) {
+  sgpp::base::DataMatrix compacted;
+  gatherColumns(matrix, columns, compacted);
+  matrix = std::move(compacted);
+}
+
+/**
+ * Computes the inner products of the corresponding columns of a and b
+ */
+void columnDotProducts(const sgpp::base::DataMatrix& a, const sgpp::base::DataMatrix& b,
+                       std::vector<double>& result) {
+  const size_t rows = a.getNrows();
+  const size_t numColumns = a.getNcols();
+  const double* ptrA = a.getPointer();
+  const double* ptrB = b.getPointer();
+  result.assign(numColumns, 0.0);
+
+#pragma omp parallel
+  {
+    std::vector<double> localResult(numColumns, 0.0);
+
+#pragma omp for schedule(static)
+    for (size_t i = 0; i < rows; i++) {
+      for (size_t j = 0; j < numColumns; j++) {
+        localResult[j] += ptrA[i * numColumns + j] * ptrB[i * numColumns + j];
+      }
+    }
+
+#pragma omp critical
+    {
+      for (size_t j = 0; j < numColumns; j++) {
+        result[j] += localResult[j];
+      }
+    }
+  }
+}
+
+}  // namespace
+
+BlockConjugateGradients::BlockConjugateGradients(size_t imax, double epsilon)
+    : SLESolver(imax, epsilon) {}
+
+BlockConjugateGradients::~BlockConjugateGradients() {}
+
+void BlockConjugateGradients::solve(sgpp::base::OperationMatrix& SystemMatrix,
+                                    sgpp::base::DataVector& alpha, sgpp::base::DataVector& b,
+                                    bool reuse, bool verbose, double max_threshold) {
+  sgpp::base::DataMatrix alphas(alpha.getSize(), 1);
+  sgpp::base::DataMatrix bs(b.getSize(), 1);
+  alphas.setColumn(0, alpha);
+  bs.setColumn(0, b);
+
+  solve(SystemMatrix, alphas, bs, reuse, verbose, max_threshold);
+
+  alphas.getColumn(0, alpha);
+}
+
+void BlockConjugateGradients::solve(sgpp::base::OperationMatrix& SystemMatrix,
+                                    sgpp::base::DataMatrix& alphas, sgpp::base::DataMatrix& b,
+                                    bool reuse, bool verbose, double max_threshold) {
+  sgpp::base::SGppStopwatch stopwatch;
+  stopwatch.start();
+
+  const size_t size = b.getNrows();
+  const size_t numColumns = b.getNcols();
+  const bool preconditioned = (this->preconditioner != nullptr);
+
+  if (verbose == true) {
+    std::cout << "Starting Block Conjugated Gradients for " << numColumns << " right hand sides";
+
+    if (preconditioned) {
+      std::cout << " (preconditioned)";
+    }
+
+    std::cout << std::endl;
+  }
+
+  if (reuse == true) {
+    if ((alphas.getNrows() != size) || (alphas.getNcols() != numColumns)) {
+      throw sgpp::base::solver_exception(
+          "BlockConjugateGradients::solve : dimensions of alphas and b don't match");
+    }
+  } else {
+    alphas.resizeRowsCols(size, numColumns);
+    alphas.setAll(0.0);
+  }
+
+  if (preconditioned) {
+    this->preconditioner->prepare(SystemMatrix, size);
+  }
+
+  this->nIterations = 0;
+  columnIterations.assign(numColumns, 0);
+  columnResiduums.assign(numColumns, 0.0);
+
+  // the work matrices only contain the columns which are still iterated,
+  // active[j] is the column of alphas and b that belongs to column j of the work matrices
+  std::vector<size_t> active(numColumns);
+
+  for (size_t k = 0; k < numColumns; k++) {
+    active[k] = k;
+  }
+
+  // same stopping criterion as ConjugateGradients: |r|^2 <= epsilon^2 |b|^2
+  std::vector<double> delta_0;
+  columnDotProducts(b, b, delta_0);
+
+  for (double& delta : delta_0) {
+    delta *= this->myEpsilon * this->myEpsilon;
+  }
+
+  // r = b - A x
+  sgpp::base::DataMatrix r;
+  SystemMatrix.multMatrix(alphas, r);
+  r.mult(-1.0);
+  r.add(b);
+
+  // preconditioned residual z = M^{-1} r, without preconditioner z is r itself
+  sgpp::base::DataMatrix zPreconditioned;
+  sgpp::base::DataMatrix* z = &r;
+  sgpp::base::DataVector rColumn(size);
+  sgpp::base::DataVector zColumn(size);
+
+  auto precondition = [&]() {
+    if (preconditioned) {
+      zPreconditioned.resizeRowsCols(size, r.getNcols());
+
+      for (size_t j = 0; j < r.getNcols(); j++) {
+        r.getColumn(j, rColumn);
+        this->preconditioner->apply(rColumn, zColumn);
+        zPreconditioned.setColumn(j, zColumn);
+      }
+
+      z = &zPreconditioned;
+    }
+  };
+
+  precondition();
+
+  sgpp::base::DataMatrix d(*z);
+  sgpp::base::DataMatrix q;
+  sgpp::base::DataMatrix temp;
+
+  std::vector<double> delta_new;
+  std::vector<double> rho_new;
+  std::vector<double> dq;
+  columnDotProducts(r, r, delta_new);
+
+  if (preconditioned) {
+    columnDotProducts(r, *z, rho_new);
+  } else {
+    rho_new = delta_new;
+  }
+
+  std::vector<double> a;
+  std::vector<double> beta;
+  // columns with zero curvature d^T A d cannot make progress anymore and are stopped
+  std::vector<bool> stalled(numColumns, false);
+
+  if (verbose == true) {
+    std::cout << "Starting norms of residuum and target norms:" << std::endl;
+
+    for (size_t k = 0; k < numColumns; k++) {
+      std::cout << k << ": " << delta_new[k] << ", " << delta_0[k] << std::endl;
+    }
+  }
+
+  while (true) {
+    // remove the converged columns
+    std::vector<size_t> keep;
+
+    for (size_t j = 0; j < active.size(); j++) {
+      const size_t k = active[j];
+      columnResiduums[k] = delta_new[j];
+
+      if ((delta_new[j] > delta_0[k]) && (delta_new[j] > max_threshold) && !stalled[j]) {
+        keep.push_back(j);
+      } else {
+        columnIterations[k] = this->nIterations;
+      }
+    }
+
+    if (keep.size() < active.size()) {
+      std::vector<size_t> activeNew(keep.size());
+
+      for (size_t j = 0; j < keep.size(); j++) {
+        activeNew[j] = active[keep[j]];
+        delta_new[j] = delta_new[keep[j]];
+        rho_new[j] = rho_new[keep[j]];
+      }
+
+      active = std::move(activeNew);
+      delta_new.resize(active.size());
+      rho_new.resize(active.size());
+      stalled.assign(active.size(), false);
+
+      keepColumns(r, keep);
+      keepColumns(d, keep);
+
+      if (preconditioned) {
+        keepColumns(zPreconditioned, keep);
+      }
+    }
+
+    if (active.empty()) {
+      break;
+    }
+
+    if (this->nIterations >= this->nMaxIterations) {
+      for (size_t j = 0; j < active.size(); j++) {
+        columnIterations[active[j]] = this->nIterations;
+      }
+
+      break;
+    }
+
+    const size_t numActive = active.size();
+    const size_t numAlphaColumns = alphas.getNcols();
+
+    // q = A d for all active columns at once
+    SystemMatrix.multMatrix(d, q);
+    columnDotProducts(d, q, dq);
+
+    a.resize(numActive);
+
+    for (size_t j = 0; j < numActive; j++) {
+      stalled[j] = (dq[j] == 0.0);
+      a[j] = stalled[j] ? 0.0 : (rho_new[j] / dq[j]);
+    }
+
+    // x = x + a d
+    double* ptrX = alphas.getPointer();
+    const double* ptrD = d.getPointer();
+
+#pragma omp parallel for schedule(static)
+    for (size_t i = 0; i < size; i++) {
+      for (size_t j = 0; j < numActive; j++) {
+        ptrX[i * numAlphaColumns + active[j]] += a[j] * ptrD[i * numActive + j];
+      }
+    }
+
+    if ((this->nIterations % 50) == 0 && this->nIterations > 0) {
+      // r = b - A x
+      gatherColumns(alphas, active, temp);
+      SystemMatrix.multMatrix(temp, r);
+      gatherColumns(b, active, temp);
+      r.mult(-1.0);
+      r.add(temp);
+    } else {
+      // r = r - a q
+      double* ptrR = r.getPointer();
+      const double* ptrQ = q.getPointer();
+
+#pragma omp parallel for schedule(static)
+      for (size_t i = 0; i < size; i++) {
+        for (size_t j = 0; j < numActive; j++) {
+          ptrR[i * numActive + j] -= a[j] * ptrQ[i * numActive + j];
+        }
+      }
+    }
+
+    std::vector<double> rho_old(rho_new);
+    columnDotProducts(r, r, delta_new);
+    precondition();
+
+    if (preconditioned) {
+      columnDotProducts(r, *z, rho_new);
+    } else {
+      rho_new = delta_new;
+    }
+
+    beta.resize(numActive);
+
+    for (size_t j = 0; j < numActive; j++) {
+      beta[j] = rho_new[j] / rho_old[j];
+    }
+
+    // d = z + beta d
+    double* ptrDNew = d.getPointer();
+    const double* ptrZ = z->getPointer();
+
+#pragma omp parallel for schedule(static)
+    for (size_t i = 0; i < size; i++) {
+      for (size_t j = 0; j < numActive; j++) {
+        const size_t index = i * numActive + j;
+        ptrDNew[index] = ptrZ[index] + beta[j] * ptrDNew[index];
+      }
+    }
+
+    this->nIterations++;
+
+    if (verbose == true) {
+      std::cout << "active right hand sides: " << numActive << ", max. delta: "
+                << *std::max_element(delta_new.begin(), delta_new.end()) << std::endl;
+    }
+  }
+
+  this->residuum = (numColumns > 0)
+                       ? *std::max_element(columnResiduums.begin(), columnResiduums.end())
+                       : 0.0;
+  this->duration = stopwatch.stop();
+
+  if (verbose == true) {
+    std::cout << "Number of iterations: " << this->nIterations << " (max. " << this->nMaxIterations
+              << ")" << std::endl;
+    std::cout << "Final max. norm of residuum: " << this->residuum << std::endl;
+    std::cout << "Time: " << this->duration << " s" << std::endl;
+  }
+}
+
+}  // namespace solver
+}  // namespace sgpp
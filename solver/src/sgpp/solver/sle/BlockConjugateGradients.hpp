@@ -0,0 +1,89 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#ifndef BLOCKCONJUGATEGRADIENTS_HPP
+#define BLOCKCONJUGATEGRADIENTS_HPP
+
+#include <sgpp/solver/SLESolver.hpp>
+#include <sgpp/base/operation/hash/OperationMatrix.hpp>
+#include <sgpp/base/datatypes/DataMatrix.hpp>
+#include <sgpp/base/datatypes/DataVector.hpp>
+
+#include <sgpp/globaldef.hpp>
+
+#include <vector>
+
+namespace sgpp {
+namespace solver {
+
+/**
+ * Conjugate gradients for several right hand sides with the same system matrix.
+ *
+ * The right hand sides are the columns of a DataMatrix. All columns are iterated in lockstep,
+ * every column keeps its own step sizes, so its iterates are the same as the ones of
+ * ConjugateGradients. The products with the system matrix of all columns that have not
+ * converged yet are computed by a single call of OperationMatrix::multMatrix, which lets
+ * operators like DMSystemMatrix traverse the data once for all right hand sides. Converged
+ * columns are removed from the iteration.
+ */
+class BlockConjugateGradients : public SLESolver {
+ public:
+  /**
+   * Std-Constructor
+   *
+   * @param imax number of maximum executed iterations
+   * @param epsilon the final error in the iterative solver
+   */
+  BlockConjugateGradients(size_t imax, double epsilon);
+
+  /**
+   * Std-Destructor
+   */
+  ~BlockConjugateGradients() override;
+
+  /**
+   * Solves the system for a single right hand side
+   */
+  void solve(sgpp::base::OperationMatrix& SystemMatrix, sgpp::base::DataVector& alpha,
+             sgpp::base::DataVector& b, bool reuse = false, bool verbose = false,
+             double max_threshold = DEFAULT_RES_THRESHOLD) override;
+
+  /**
+   * Solves the system for all columns of b
+   *
+   * @param SystemMatrix reference to an OperationMatrix Object that implements the
+   *        matrix vector multiplication
+   * @param alphas the sparse grid's coefficients, one column per right hand side; resized to
+   *        the size of b if reuse is false
+   * @param b the right hand sides of the system of linear equations, one per column
+   * @param reuse identifies if the alphas, stored in alphas at calling time, should be reused
+   * @param verbose prints information during execution of the solver
+   * @param max_threshold additional abort criterion for solver
+   */
+  void solve(sgpp::base::OperationMatrix& SystemMatrix, sgpp::base::DataMatrix& alphas,
+             sgpp::base::DataMatrix& b, bool reuse = false, bool verbose = false,
+             double max_threshold = DEFAULT_RES_THRESHOLD);
+
+  /**
+   * @return the number of iterations of every column of the last solve
+   */
+  const std::vector<size_t>& getColumnIterations() const { return columnIterations; }
+
+  /**
+   * @return the final residuum of every column of the last solve
+   */
+  const std::vector<double>& getColumnResiduums() const { return columnResiduums; }
+
+ private:
+  /// iterations of every column
+  std::vector<size_t> columnIterations;
+  /// final residuum of every column
+  std::vector<double> columnResiduums;
+};
+
+}  // namespace solver
+}  // namespace sgpp
+
+#endif /* BLOCKCONJUGATEGRADIENTS_HPP */
@@ -7,6 +7,7 @@
 #include <mpi.h>
 #endif
 #include <sgpp/solver/sle/ConjugateGradients.hpp>
+#include <sgpp/base/tools/SGppStopwatch.hpp>
 
 #include <sgpp/globaldef.hpp>
 
@@ -24,8 +25,17 @@ void ConjugateGradients::solve(sgpp::base::OperationMatrix& SystemMatrix,
                                bool verbose, double max_threshold) {
   this->starting();
 
+  sgpp::base::SGppStopwatch stopwatch;
+  stopwatch.start();
+
   if (verbose == true) {
-    std::cout << "Starting Conjugated Gradients" << std::endl;
+    std::cout << "Starting Conjugated Gradients";
+
+    if (this->preconditioner != nullptr) {
+      std::cout << " (preconditioned)";
+    }
+
+    std::cout << std::endl;
   }
 
   // needed for residuum calculation
@@ -37,12 +47,24 @@ void ConjugateGradients::solve(sgpp::base::OperationMatrix& SystemMatrix,
   sgpp::base::DataVector temp(alpha.getSize());
   sgpp::base::DataVector q(alpha.getSize());
   sgpp::base::DataVector r(b);
+  // preconditioned residual z = M^{-1} r, without preconditioner z is r itself
+  sgpp::base::DataVector zPreconditioned(0);
+  sgpp::base::DataVector* z = &r;
+
+  if (this->preconditioner != nullptr) {
+    this->preconditioner->prepare(SystemMatrix, alpha.getSize());
+    zPreconditioned.resize(alpha.getSize());
+    z = &zPreconditioned;
+  }
 
   double delta_0 = 0.0;
   double delta_old = 0.0;
   double delta_new = 0.0;
   double beta = 0.0;
   double a = 0.0;
+  // r * z, equals delta_new without preconditioner
+  double rho_old = 0.0;
+  double rho_new = 0.0;
 
   if (verbose == true) {
     std::cout << "All temp variables used in CG have been initialized" << std::endl;
@@ -63,10 +85,15 @@ void ConjugateGradients::solve(sgpp::base::OperationMatrix& SystemMatrix,
 
   r.sub(temp);
 
-  sgpp::base::DataVector d(r);
+  if (this->preconditioner != nullptr) {
+    this->preconditioner->apply(r, *z);
+  }
+
+  sgpp::base::DataVector d(*z);
 
   delta_old = 0.0;
   delta_new = r.dotProduct(r);
+  rho_new = r.dotProduct(*z);
 
   if (reuse == false) {
     delta_0 = delta_new * epsilonSquared;
@@ -101,8 +128,8 @@ void ConjugateGradients::solve(sgpp::base::OperationMatrix& SystemMatrix,
       break;
     }
 
-    // a = d_new / d.q
-    a = delta_new / d.dotProduct(q);
+    // a = rho_new / d.q
+    a = rho_new / dq;
 
     // x = x + a*d
     alpha.axpy(a, d);
@@ -118,10 +145,21 @@ void ConjugateGradients::solve(sgpp::base::OperationMatrix& SystemMatrix,
       r.axpy(-a, q);
     }
 
-    // calculate new deltas and determine beta
+    // calculate new deltas and determine beta, the residual norm is the stopping criterion
+    // with and without preconditioner
     delta_old = delta_new;
     delta_new = r.dotProduct(r);
-    beta = delta_new / delta_old;
+
+    if (this->preconditioner != nullptr) {
+      this->preconditioner->apply(r, *z);
+      rho_old = rho_new;
+      rho_new = r.dotProduct(*z);
+    } else {
+      rho_old = delta_old;
+      rho_new = delta_new;
+    }
+
+    beta = rho_new / rho_old;
 
 #ifdef X86_MIC_SYMMETRIC
     MPI_Bcast(&delta_new, 1, MPI_DOUBLE, 0, MPI_COMM_WORLD);
@@ -135,18 +173,20 @@ void ConjugateGradients::solve(sgpp::base::OperationMatrix& SystemMatrix,
     }
 
     d.mult(beta);
-    d.add(r);
+    d.add(*z);
 
     this->nIterations++;
   }
 
   this->residuum = delta_new;
+  this->duration = stopwatch.stop();
   this->complete();
 
   if (verbose == true) {
     std::cout << "Number of iterations: " << this->nIterations << " (max. " << this->nMaxIterations
               << ")" << std::endl;
     std::cout << "Final norm of residuum: " << delta_new << std::endl;
+    std::cout << "Time: " << this->duration << " s" << std::endl;
   }
 }
 
@@ -0,0 +1,253 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#include <sgpp/solver/sle/PipelinedConjugateGradients.hpp>
+#include <sgpp/base/tools/SGppStopwatch.hpp>
+
+#include <sgpp/globaldef.hpp>
+
+#include <cmath>
+#include <iostream>
+
+namespace sgpp {
+namespace solver {
+
+PipelinedConjugateGradients::PipelinedConjugateGradients(size_t imax, double epsilon)
+    : SLESolver(imax, epsilon), gamma(0.0), delta(0.0), residualNorm(0.0) {}
+
+PipelinedConjugateGradients::~PipelinedConjugateGradients() {}
+
+void PipelinedConjugateGradients::restart(sgpp::base::OperationMatrix& SystemMatrix,
+                                          sgpp::base::DataVector& alpha,
+                                          sgpp::base::DataVector& b) {
+  const size_t size = alpha.getSize();
+
+  // r = b - A x
+  SystemMatrix.mult(alpha, r);
+
+  double* ptrR = r.getPointer();
+  const double* ptrB = b.getPointer();
+
+#pragma omp parallel for schedule(static)
+  for (size_t i = 0; i < size; i++) {
+    ptrR[i] = ptrB[i] - ptrR[i];
+  }
+
+  // w = A u
+  sgpp::base::DataVector& uRef = (this->preconditioner != nullptr) ? u : r;
+
+  if (this->preconditioner != nullptr) {
+    this->preconditioner->apply(r, u);
+  }
+
+  SystemMatrix.mult(uRef, w);
+
+  const double* ptrU = uRef.getPointer();
+  const double* ptrW = w.getPointer();
+  double gammaNew = 0.0;
+  double deltaNew = 0.0;
+  double residualNormNew = 0.0;
+
+#pragma omp parallel for schedule(static) reduction(+ : gammaNew, deltaNew, residualNormNew)
+  for (size_t i = 0; i < size; i++) {
+    gammaNew += ptrR[i] * ptrU[i];
+    deltaNew += ptrW[i] * ptrU[i];
+    residualNormNew += ptrR[i] * ptrR[i];
+  }
+
+  gamma = gammaNew;
+  delta = deltaNew;
+  residualNorm = residualNormNew;
+
+  // the directions of the previous iterations are discarded
+  p.setAll(0.0);
+  s.setAll(0.0);
+  z.setAll(0.0);
+
+  if (this->preconditioner != nullptr) {
+    q.setAll(0.0);
+  }
+}
+
+void PipelinedConjugateGradients::solve(sgpp::base::OperationMatrix& SystemMatrix,
+                                        sgpp::base::DataVector& alpha, sgpp::base::DataVector& b,
+                                        bool reuse, bool verbose, double max_threshold) {
+  sgpp::base::SGppStopwatch stopwatch;
+  stopwatch.start();
+
+  if (verbose == true) {
+    std::cout << "Starting Pipelined Conjugated Gradients";
+
+    if (this->preconditioner != nullptr) {
+      std::cout << " (preconditioned)";
+    }
+
+    std::cout << std::endl;
+  }
+
+  const size_t size = alpha.getSize();
+  const bool preconditioned = (this->preconditioner != nullptr);
+  this->nIterations = 0;
+
+  if (reuse == false) {
+    alpha.setAll(0.0);
+  }
+
+  if (preconditioned) {
+    this->preconditioner->prepare(SystemMatrix, size);
+  }
+
+  // the vectors are kept between the solves, resize only allocates if they grow
+  r.resize(size);
+  w.resize(size);
+  n.resize(size);
+  p.resize(size);
+  s.resize(size);
+  z.resize(size);
+
+  if (preconditioned) {
+    u.resize(size);
+    m.resize(size);
+    q.resize(size);
+  }
+
+  // same stopping criterion as ConjugateGradients: |r|^2 <= epsilon^2 |b|^2
+  const double delta_0 = b.dotProduct(b) * this->myEpsilon * this->myEpsilon;
+
+  restart(SystemMatrix, alpha, b);
+
+  if (verbose == true) {
+    std::cout << "Starting norm of residuum: " << residualNorm << std::endl;
+    std::cout << "Target norm:               " << delta_0 << std::endl;
+  }
+
+  double* ptrX = alpha.getPointer();
+  double* ptrR = r.getPointer();
+  double* ptrW = w.getPointer();
+  double* ptrN = n.getPointer();
+  double* ptrP = p.getPointer();
+  double* ptrS = s.getPointer();
+  double* ptrZ = z.getPointer();
+  double* ptrU = preconditioned ? u.getPointer() : nullptr;
+  double* ptrM = preconditioned ? m.getPointer() : nullptr;
+  double* ptrQ = preconditioned ? q.getPointer() : nullptr;
+
+  double a = 0.0;
+  double a_old = 0.0;
+  // true residual of the last restart, restarts stop if it stagnates
+  double restartNorm = residualNorm;
+  double gamma_old = 0.0;
+  // the first iteration after a (re)start has no previous directions
+  bool first = true;
+
+  while (this->nIterations < this->nMaxIterations) {
+    if ((residualNorm <= delta_0) || (residualNorm <= max_threshold)) {
+      if (first) {
+        // the residual of a restart is the true one
+        break;
+      }
+
+      // the recursive residual has converged, check the true one
+      restart(SystemMatrix, alpha, b);
+      first = true;
+
+      if ((residualNorm <= delta_0) || (residualNorm <= max_threshold) ||
+          (residualNorm >= restartNorm)) {
+        break;
+      }
+
+      restartNorm = residualNorm;
+
+      if (verbose == true) {
+        std::cout << "restart, norm of the true residuum: " << residualNorm << std::endl;
+      }
+    }
+
+    // n = A M^{-1} w
+    if (preconditioned) {
+      this->preconditioner->apply(w, m);
+      SystemMatrix.mult(m, n);
+    } else {
+      SystemMatrix.mult(w, n);
+    }
+
+    double beta = 0.0;
+
+    if (first) {
+      a = gamma / delta;
+    } else {
+      beta = gamma / gamma_old;
+      a = gamma / (delta - beta * gamma / a_old);
+    }
+
+    if (!std::isfinite(a)) {
+      break;
+    }
+
+    // fused update of all vectors and the inner products of the next iteration
+    double gammaNew = 0.0;
+    double deltaNew = 0.0;
+    double residualNormNew = 0.0;
+
+    if (preconditioned) {
+#pragma omp parallel for schedule(static) reduction(+ : gammaNew, deltaNew, residualNormNew)
+      for (size_t i = 0; i < size; i++) {
+        ptrZ[i] = ptrN[i] + beta * ptrZ[i];
+        ptrQ[i] = ptrM[i] + beta * ptrQ[i];
+        ptrS[i] = ptrW[i] + beta * ptrS[i];
+        ptrP[i] = ptrU[i] + beta * ptrP[i];
+        ptrX[i] += a * ptrP[i];
+        ptrR[i] -= a * ptrS[i];
+        ptrU[i] -= a * ptrQ[i];
+        ptrW[i] -= a * ptrZ[i];
+        gammaNew += ptrR[i] * ptrU[i];
+        deltaNew += ptrW[i] * ptrU[i];
+        residualNormNew += ptrR[i] * ptrR[i];
+      }
+    } else {
+#pragma omp parallel for schedule(static) reduction(+ : deltaNew, residualNormNew)
+      for (size_t i = 0; i < size; i++) {
+        ptrZ[i] = ptrN[i] + beta * ptrZ[i];
+        ptrS[i] = ptrW[i] + beta * ptrS[i];
+        ptrP[i] = ptrR[i] + beta * ptrP[i];
+        ptrX[i] += a * ptrP[i];
+        ptrR[i] -= a * ptrS[i];
+        ptrW[i] -= a * ptrZ[i];
+        deltaNew += ptrW[i] * ptrR[i];
+        residualNormNew += ptrR[i] * ptrR[i];
+      }
+
+      gammaNew = residualNormNew;
+    }
+
+    gamma_old = gamma;
+    a_old = a;
+    gamma = gammaNew;
+    delta = deltaNew;
+    residualNorm = residualNormNew;
+    first = false;
+
+    this->residuum = residualNorm;
+
+    if (verbose == true) {
+      std::cout << "delta: " << residualNorm << std::endl;
+    }
+
+    this->nIterations++;
+  }
+
+  this->residuum = residualNorm;
+  this->duration = stopwatch.stop();
+
+  if (verbose == true) {
+    std::cout << "Number of iterations: " << this->nIterations << " (max. " << this->nMaxIterations
+              << ")" << std::endl;
+    std::cout << "Final norm of residuum: " << residualNorm << std::endl;
+    std::cout << "Time: " << this->duration << " s" << std::endl;
+  }
+}
+
+}  // namespace solver
+}  // namespace sgpp
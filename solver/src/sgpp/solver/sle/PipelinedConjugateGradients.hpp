@@ -0,0 +1,86 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#ifndef PIPELINEDCONJUGATEGRADIENTS_HPP
+#define PIPELINEDCONJUGATEGRADIENTS_HPP
+
+#include <sgpp/solver/SLESolver.hpp>
+#include <sgpp/base/operation/hash/OperationMatrix.hpp>
+#include <sgpp/base/datatypes/DataVector.hpp>
+
+#include <sgpp/globaldef.hpp>
+
+namespace sgpp {
+namespace solver {
+
+/**
+ * Pipelined conjugate gradients (Ghysels and Vanroose, "Hiding global synchronization latency in
+ * the preconditioned Conjugate Gradient algorithm", 2014).
+ *
+ * The recurrences are rearranged such that every iteration consists of one product with the
+ * system matrix (and one application of the preconditioner, if any) and a single fused pass over
+ * the vectors, which performs all vector updates and computes all inner products of the next
+ * iteration at once. The classic variant needs about six passes per iteration. The vectors are
+ * kept between calls of solve() to avoid reallocations.
+ *
+ * In exact arithmetic the iterates are the same as the ones of ConjugateGradients. The residual
+ * is updated recursively, therefore the true residual is checked once the recursive one meets the
+ * tolerance and the iteration is restarted from the current solution if it does not.
+ */
+class PipelinedConjugateGradients : public SLESolver {
+ public:
+  /**
+   * Std-Constructor
+   *
+   * @param imax number of maximum executed iterations
+   * @param epsilon the final error in the iterative solver
+   */
+  PipelinedConjugateGradients(size_t imax, double epsilon);
+
+  /**
+   * Std-Destructor
+   */
+  ~PipelinedConjugateGradients() override;
+
+  void solve(sgpp::base::OperationMatrix& SystemMatrix, sgpp::base::DataVector& alpha,
+             sgpp::base::DataVector& b, bool reuse = false, bool verbose = false,
+             double max_threshold = -1.0) override;
+
+ private:
+  /**
+   * Computes the residual r = b - A x and the vectors that depend on it (u = M^{-1} r, w = A u)
+   * and their inner products, starts the recurrences
+   */
+  void restart(sgpp::base::OperationMatrix& SystemMatrix, sgpp::base::DataVector& alpha,
+               sgpp::base::DataVector& b);
+
+  /// residual
+  sgpp::base::DataVector r;
+  /// preconditioned residual u = M^{-1} r (only used with preconditioner)
+  sgpp::base::DataVector u;
+  /// w = A u
+  sgpp::base::DataVector w;
+  /// m = M^{-1} w (only used with preconditioner)
+  sgpp::base::DataVector m;
+  /// n = A m
+  sgpp::base::DataVector n;
+  /// search direction p and the auxiliary directions s = A p, q = M^{-1} s, z = A q
+  sgpp::base::DataVector p;
+  sgpp::base::DataVector s;
+  sgpp::base::DataVector q;
+  sgpp::base::DataVector z;
+
+  /// (r, u)
+  double gamma;
+  /// (w, u)
+  double delta;
+  /// (r, r)
+  double residualNorm;
+};
+
+}  // namespace solver
+}  // namespace sgpp
+
+#endif /* PIPELINEDCONJUGATEGRADIENTS_HPP */
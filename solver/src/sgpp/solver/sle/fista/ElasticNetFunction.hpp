@@ -7,9 +7,9 @@
 #define ELASTICNETFUNCTION_HPP
 
 #include <sgpp/base/datatypes/DataVector.hpp>
-#include <sgpp/solver/sle/fista/LassoFunction.hpp>
 #include <sgpp/solver/sle/fista/RegularizationFunction.hpp>
 
+#include <algorithm>
 #include <cmath>
 
 namespace sgpp {
@@ -31,7 +31,7 @@ class ElasticNetFunction : public RegularizationFunction {
    * A value of one corresponds to the lasso, and a value of zero to the ridge regularization.
    */
   ElasticNetFunction(double lambda, double l1Ratio)
-      : lambda(lambda * l1Ratio), gamma(lambda * (1 - l1Ratio)), lasso(this->lambda) {}
+      : lambda(lambda * l1Ratio), gamma(lambda * (1 - l1Ratio)) {}
 
   ~ElasticNetFunction() override {}
 
@@ -50,16 +50,29 @@ class ElasticNetFunction : public RegularizationFunction {
   }
 
   base::DataVector prox(const sgpp::base::DataVector& weights, double stepsize) override {
-    base::DataVector proxVec = lasso.prox(weights, stepsize);
-    const double multiplicator = 1 / (1 + 2 * stepsize * gamma);
-    proxVec.mult(multiplicator);
+    auto proxVec = base::DataVector(weights.getSize());
+    applyProx(weights, stepsize, proxVec);
     return proxVec;
   }
 
+  // shrinkage of the lasso followed by the scaling of the ridge in one pass
+  void applyProx(const sgpp::base::DataVector& weights, double stepsize,
+                 sgpp::base::DataVector& result) override {
+    const double threshold = lambda * stepsize;
+    const double multiplicator = 1 / (1 + 2 * stepsize * gamma);
+    const double* ptrWeights = weights.data();
+    double* ptrResult = result.data();
+#pragma omp parallel for schedule(static)
+    for (size_t i = 0; i < weights.getSize(); ++i) {
+      const double left = std::max(ptrWeights[i] - threshold, 0.0);
+      const double right = std::max(-ptrWeights[i] - threshold, 0.0);
+      ptrResult[i] = multiplicator * (left - right);
+    }
+  }
+
  private:
   const double lambda;
   const double gamma;
-  LassoFunction lasso;
 };
 
 }  //  namespace solver
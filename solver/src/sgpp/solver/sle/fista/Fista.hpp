@@ -15,6 +15,7 @@
 #include <cmath>
 #include <limits>
 #include <type_traits>
+#include <vector>
 
 namespace sgpp {
 namespace solver {
@@ -41,6 +42,11 @@ class Fista : public FistaBase {
   ~Fista() override {}
   /**
    * @brief solve solves the problem.
+   * @details The products with the system matrix dominate the costs. Each iteration needs one
+   * product with A for every trial point of the linesearch and one with A^T for the gradient.
+   * As A is linear, the errors of the extrapolated point are the extrapolation of the errors of
+   * the last two iterates and need no product with A, the errors and the gradient of the
+   * extrapolated point are reused in all steps of the linesearch.
    * @param op
    * @param weights is the first guess for the solution
    * @param classes is the target vector
@@ -53,6 +59,48 @@ class Fista : public FistaBase {
   void solve(base::OperationMultipleEval& op, base::DataVector& weights,
              const base::DataVector& classes, size_t maxIt, double threshold,
              double L = 0.5) override {
+    numIterations = 0;
+    solveWithFunction(g, op, weights, classes, maxIt, threshold, L);
+  }
+
+  /**
+   * @brief solvePath solves the problem for a sequence of regularization functions, e.g. for a
+   * decreasing sequence of regularization strengths lambda.
+   * @details Every solve starts from the solution and the Lipschitz estimate of the previous one
+   * (warm start). Neighboring problems of a path have similar solutions, so each of them only
+   * needs a few iterations and the whole path costs little more than a single solve.
+   * @param op
+   * @param weights is the first guess for the solution of the first function, contains the
+   * solution of the last function afterwards
+   * @param classes is the target vector
+   * @param functions are the regularization functions of the path
+   * @param solutions receives the solution for every function
+   * @param maxIt is the maximum number of iterations per function
+   * @param threshold is the desired accuracy
+   * @param L is a guess for the Lipschitz number of the gradient of the least squares part
+   */
+  void solvePath(base::OperationMultipleEval& op, base::DataVector& weights,
+                 const base::DataVector& classes, std::vector<F>& functions,
+                 std::vector<base::DataVector>& solutions, size_t maxIt, double threshold,
+                 double L = 0.5) {
+    numIterations = 0;
+    solutions.clear();
+
+    for (F& function : functions) {
+      solveWithFunction(function, op, weights, classes, maxIt, threshold, L);
+      L = this->L;
+      solutions.push_back(weights);
+    }
+  }
+
+ private:
+  F g;
+
+  // solves the problem with the regularization function function, adds the iterations to
+  // numIterations and stores the final Lipschitz estimate in this->L
+  void solveWithFunction(F& function, base::OperationMultipleEval& op,
+                         base::DataVector& weights, const base::DataVector& classes, size_t maxIt,
+                         double threshold, double L) {
     // Parameters for linesearch
     // The choices made here correspond to values that work well in practice, other
     // values work as well, as long as the constraints given below still hold.
@@ -71,44 +119,53 @@ class Fista : public FistaBase {
     // Variables that are reused in each iteration
     double momentumBefore = momentum;
     base::DataVector weightsBefore = base::DataVector(weights.getSize());
-    auto errors = base::DataVector(classes.getSize());
+    base::DataVector point = base::DataVector(weights.getSize());
     auto gradient = base::DataVector(weights.getSize());
+    // Ay - b, Ax - b of the current and of the last iterate
+    auto errors = base::DataVector(classes.getSize());
+    evalErrors(op, weights, classes, errors);
+    auto errorsWeights = errors;
+    auto errorsBefore = base::DataVector(classes.getSize());
 
     while (isNotConverged(curIt, maxIt, priorMSE, curMSE, threshold)) {
       priorMSE = curMSE;
       momentumBefore = momentum;
-      weightsBefore = weights;
+      weightsBefore.swap(weights);
+      errorsBefore.swap(errorsWeights);
 
       L = L / eta;
       // Try to find the smallest L(ipschitz constant) for which our approximation works
       // First iteration is L, then L*eta.
       // Mathematically speaking, we try to find the smallest integer i \elem {1,2,...}
       // for which L*eta^i gives rise to a reasonable Lipschitz constant.
-      evalErrors(op, y, classes, errors);
       evalGradient(op, errors, gradient);
       curMSE = evalResidual(errors);
       do {
         L *= eta;
-        weights = evalProxGrad(y, gradient, L);              // do the step!
-      } while (isNotLipschitz(weights, y, op, classes, L));  // F(prox) < Q_L(prox, weights)
+        evalProxGrad(function, y, gradient, L, point, weights);  // do the step!
+        evalErrors(op, weights, classes, errorsWeights);
+      } while (isNotLipschitz(weights, y, errorsWeights, errors, L));  // F(prox) > Q_L(prox, y)
 
       momentum = 0.5 * (1 + std::sqrt(1 + 4 * momentum * momentum));
-      auto weightsDifference = weights;
-      weightsDifference.sub(weightsBefore);
-      const double multiplicator = (momentumBefore - 1) / momentum;
-      weightsDifference.mult(multiplicator);
-      y = weights;
-      y.add(weightsDifference);
+      double multiplicator = (momentumBefore - 1) / momentum;
+
+      if (adaptiveRestart && isMomentumAscent(y, weights, weightsBefore)) {
+        momentum = 1;
+        multiplicator = 0.0;
+      }
+
+      extrapolate(weights, weightsBefore, multiplicator, y);
+      extrapolate(errorsWeights, errorsBefore, multiplicator, errors);
 
       ++curIt;
     }
-  }
 
- private:
-  F g;
+    this->L = L;
+    numIterations += curIt;
+  }
 
   // Ax - b
-  void evalErrors(base::OperationMultipleEval& op, base::DataVector weights,
+  void evalErrors(base::OperationMultipleEval& op, base::DataVector& weights,
                   const base::DataVector& b, base::DataVector& resultErrors) {
     op.mult(weights, resultErrors);
     resultErrors.sub(b);
@@ -121,38 +178,29 @@ class Fista : public FistaBase {
   }
 
   // 0.5 * || Ax -b ||^2
-  double evalResidual(base::DataVector errors) {
-    errors.sqr();
-    return 0.5 * errors.sum();
+  double evalResidual(const base::DataVector& errors) {
+    return 0.5 * errors.dotProduct(errors);
   }
 
   // prox(weights - L^-1 gradf(a), lambda L^-1
-  base::DataVector evalProxGrad(base::DataVector weights, base::DataVector gradient, double L) {
+  void evalProxGrad(F& function, const base::DataVector& weights,
+                    const base::DataVector& gradient, double L, base::DataVector& point,
+                    base::DataVector& result) {
     const double stepsize = 1.0 / L;
-    gradient.mult(stepsize);
-    weights.sub(gradient);
-    return g.prox(weights, stepsize);
-  }
-
-  // F(x) = f(x) + g(x)
-  double evalGoal(double residual, const base::DataVector& weights) {
-    const double gEval = g.eval(weights);
-    return residual + gEval;
+#pragma omp parallel for schedule(static)
+    for (size_t i = 0; i < weights.getSize(); ++i) {
+      point[i] = weights[i] - stepsize * gradient[i];
+    }
+    function.applyProx(point, stepsize, result);
   }
 
-  double evalUpperBound(base::OperationMultipleEval& op, const base::DataVector& x,
-                        const base::DataVector& y, const base::DataVector& b, double L) {
-    base::DataVector errors = base::DataVector(b.getSize());
-    evalErrors(op, y, b, errors);
-    const double fEval = evalResidual(errors);
-    const double gEval = g.eval(x);
-    auto gradient = base::DataVector(x.getSize());
-    evalGradient(op, errors, gradient);
-    auto x_min_y = x;
-    x_min_y.sub(y);
-    const double innerProd = gradient.dotProduct(x_min_y);
-    const double x_min_y_l2 = (L / 2.0) * x_min_y.dotProduct(x_min_y);
-    return fEval + innerProd + x_min_y_l2 + gEval;
+  // result = x + multiplicator * (x - xBefore)
+  void extrapolate(const base::DataVector& x, const base::DataVector& xBefore,
+                   double multiplicator, base::DataVector& result) {
+#pragma omp parallel for schedule(static)
+    for (size_t i = 0; i < x.getSize(); ++i) {
+      result[i] = x[i] + multiplicator * (x[i] - xBefore[i]);
+    }
   }
 
   bool isNotConverged(size_t curIteration, size_t maxIterations, double priorMSE, double curMSE,
@@ -162,14 +210,38 @@ class Fista : public FistaBase {
     return !(isGoodEnough || isFinalStep);
   }
 
+  // F(x) > Q_L(x, y), i.e. f(x) - f(y) - <gradf(y), x - y> > L/2 ||x - y||^2 (the regularization
+  // function is part of both sides). For the least squares part, the left hand side is
+  // 0.5 * ||A(x - y)||^2 = 0.5 * ||errors(x) - errors(y)||^2, which is free of cancellation, so
+  // the linesearch does not increase L because of rounding errors once the iterates converge.
   bool isNotLipschitz(const base::DataVector& weights, const base::DataVector& y,
-                      base::OperationMultipleEval& op, const base::DataVector& b, double L) {
-    base::DataVector errors = base::DataVector(b.getSize());
-    evalErrors(op, weights, b, errors);
-    const double residual = evalResidual(errors);
-    const double goalResult = evalGoal(residual, weights);
-    const double upperBoundResult = evalUpperBound(op, weights, y, b, L);
-    return goalResult > upperBoundResult;
+                      const base::DataVector& errorsWeights, const base::DataVector& errors,
+                      double L) {
+    double errorsDiff_l2 = 0.0;
+#pragma omp parallel for schedule(static) reduction(+ : errorsDiff_l2)
+    for (size_t i = 0; i < errors.getSize(); ++i) {
+      const double errorsDiff = errorsWeights[i] - errors[i];
+      errorsDiff_l2 += errorsDiff * errorsDiff;
+    }
+    double x_min_y_l2 = 0.0;
+#pragma omp parallel for schedule(static) reduction(+ : x_min_y_l2)
+    for (size_t i = 0; i < weights.getSize(); ++i) {
+      const double x_min_y = weights[i] - y[i];
+      x_min_y_l2 += x_min_y * x_min_y;
+    }
+    return errorsDiff_l2 > L * x_min_y_l2;
+  }
+
+  // (y - x) * (x - xBefore) > 0, i.e. the step of the proximal gradient points against the
+  // momentum
+  bool isMomentumAscent(const base::DataVector& y, const base::DataVector& weights,
+                        const base::DataVector& weightsBefore) {
+    double innerProd = 0.0;
+#pragma omp parallel for schedule(static) reduction(+ : innerProd)
+    for (size_t i = 0; i < weights.getSize(); ++i) {
+      innerProd += (y[i] - weights[i]) * (weights[i] - weightsBefore[i]);
+    }
+    return innerProd > 0.0;
   }
 };
 
@@ -18,10 +18,30 @@ class FistaBase {
   virtual void solve(base::OperationMultipleEval& op, base::DataVector& weights,
                      const base::DataVector& classes, size_t maxIt, double treshold,
                      double L = 0.5) = 0;
+  /**
+   * @brief getL
+   * @return the estimate of the Lipschitz constant at the end of the last solve, a good guess for
+   * the next solve of a similar problem
+   */
   double getL() { return L; }
+  /**
+   * @brief getNumberIterations
+   * @return the number of iterations of the last solve (of all solves of the last path)
+   */
+  size_t getNumberIterations() { return numIterations; }
+  /**
+   * @brief setAdaptiveRestart switches the adaptive restart of the momentum on or off.
+   * @details With the restart, the momentum is reset whenever it points away from the descent
+   * direction of the last step (gradient scheme of O'Donoghue and Candes). This removes the
+   * oscillations of the accelerated iterates, in particular for strongly convex problems.
+   * @param adaptiveRestart true to restart (default)
+   */
+  void setAdaptiveRestart(bool adaptiveRestart) { this->adaptiveRestart = adaptiveRestart; }
 
  protected:
   double L = 0.5;
+  size_t numIterations = 0;
+  bool adaptiveRestart = true;
 };
 
 }  // namespace solver
@@ -13,7 +13,6 @@
 #include <cmath>
 #include <algorithm>
 #include <numeric>
-#include <tuple>
 #include <unordered_map>
 #include <utility>
 #include <vector>
@@ -50,9 +49,7 @@ class GroupLassoFunction : public RegularizationFunction {
       calculateGroupIndices(weights);
       lastWeightSize = weights.getSize();
     }
-    std::vector<double> norms;
-    std::vector<size_t> groupSizes;
-    std::tie(norms, groupSizes) = calculateNorms(weights);
+    const std::vector<double> norms = calculateNorms(weights);
 
     double penalty = 0.0;
     for (size_t i = 0; i < norms.size(); ++i) {
@@ -62,28 +59,32 @@ class GroupLassoFunction : public RegularizationFunction {
   }
 
   base::DataVector prox(const sgpp::base::DataVector& weights, double stepsize) override {
+    base::DataVector proxVec = sgpp::base::DataVector(weights.getSize());
+    applyProx(weights, stepsize, proxVec);
+    return proxVec;
+  }
+
+  void applyProx(const sgpp::base::DataVector& weights, double stepsize,
+                 sgpp::base::DataVector& result) override {
     if (lastWeightSize != weights.getSize()) {
       calculateGroupIndices(weights);
       lastWeightSize = weights.getSize();
     }
-    std::vector<double> norms;
-    std::vector<size_t> groupSizes;
-    std::tie(norms, groupSizes) = calculateNorms(weights);
+    const std::vector<double> norms = calculateNorms(weights);
 
-    base::DataVector proxVec = sgpp::base::DataVector(weights.getSize());
-    for (size_t i = 0; i < proxVec.getSize(); ++i) {
-      const auto curGroup = groupsVec[i];
-      const auto curNorm = norms[curGroup];
-      const auto curSize = groupSizes[curGroup];
-
-      // Here we normalize with the root of the groupSize.
-      // If we would not do that, we would drop larger groups with a higher probability than smaller
-      // ones!
-      const double ss = lambda * stepsize * std::sqrt(curSize);
-      const double multiplicator = std::max(1 - (ss) / curNorm, 0.0);
-      proxVec[i] = multiplicator * weights[i];
+    // Here we normalize with the root of the groupSize.
+    // If we would not do that, we would drop larger groups with a higher probability than smaller
+    // ones!
+    auto multiplicators = std::vector<double>(norms.size());
+    for (size_t i = 0; i < norms.size(); ++i) {
+      const double ss = lambda * stepsize * std::sqrt(groupSizes[i]);
+      multiplicators[i] = std::max(1 - (ss) / norms[i], 0.0);
+    }
+
+#pragma omp parallel for schedule(static)
+    for (size_t i = 0; i < weights.getSize(); ++i) {
+      result[i] = multiplicators[groupsVec[i]] * weights[i];
     }
-    return proxVec;
   }
 
  private:
@@ -91,25 +92,30 @@ class GroupLassoFunction : public RegularizationFunction {
   sgpp::base::GridStorage* gridStorage;
   std::unordered_map<std::vector<bool>, size_t> groups;
   std::vector<size_t> groupsVec;
+  std::vector<size_t> groupSizes;
   size_t lastWeightSize = 0;
 
-  std::pair<std::vector<double>, std::vector<size_t>> calculateNorms(
-      const sgpp::base::DataVector& weights) {
-    auto groupSizes = std::vector<size_t>(groups.size());
+  std::vector<double> calculateNorms(const sgpp::base::DataVector& weights) {
     auto norms = std::vector<double>(groups.size());
-    // First sum up the values.
-    for (size_t i = 0; i < weights.getSize(); ++i) {
-      const auto curGroup = groupsVec[i];
-      groupSizes[curGroup]++;
-      norms[curGroup] += weights[i] * weights[i];
+#pragma omp parallel
+    {
+      // First sum up the values of the own part of the weights.
+      auto localNorms = std::vector<double>(groups.size());
+#pragma omp for schedule(static) nowait
+      for (size_t i = 0; i < weights.getSize(); ++i) {
+        localNorms[groupsVec[i]] += weights[i] * weights[i];
+      }
+#pragma omp critical
+      for (size_t i = 0; i < norms.size(); ++i) {
+        norms[i] += localNorms[i];
+      }
     }
     // Then normalize.
     for (size_t i = 0; i < norms.size(); ++i) {
       norms[i] = std::sqrt(norms[i]);
     }
 
-    return std::pair<std::vector<double>, std::vector<size_t>>(std::move(norms),
-                                                                    std::move(groupSizes));
+    return norms;
   }
 
   void calculateGroupIndices(const sgpp::base::DataVector& weights) {
@@ -140,6 +146,11 @@ class GroupLassoFunction : public RegularizationFunction {
         groupsVec[i] = groups[dimsUsed];
       }
     }
+    // The sizes of the groups do not depend on the weights.
+    groupSizes = std::vector<size_t>(groups.size());
+    for (size_t i = 0; i < groupsVec.size(); ++i) {
+      groupSizes[groupsVec[i]]++;
+    }
   }
 };
 
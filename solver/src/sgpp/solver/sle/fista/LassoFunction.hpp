@@ -35,15 +35,22 @@ class LassoFunction : public RegularizationFunction {
   }
 
   base::DataVector prox(const base::DataVector& weights, double stepsize) override {
-    stepsize = lambda * stepsize;
     auto proxVec = base::DataVector(weights.getSize());
-#pragma omp parallel for
+    applyProx(weights, stepsize, proxVec);
+    return proxVec;
+  }
+
+  void applyProx(const base::DataVector& weights, double stepsize,
+                 base::DataVector& result) override {
+    stepsize = lambda * stepsize;
+    const double* ptrWeights = weights.data();
+    double* ptrResult = result.data();
+#pragma omp parallel for schedule(static)
     for (size_t i = 0; i < weights.getSize(); ++i) {
-      const double left = std::max(weights[i] - stepsize, 0.0);
-      const double right = std::max(-weights[i] - stepsize, 0.0);
-      proxVec[i] = left - right;
+      const double left = std::max(ptrWeights[i] - stepsize, 0.0);
+      const double right = std::max(-ptrWeights[i] - stepsize, 0.0);
+      ptrResult[i] = left - right;
     }
-    return proxVec;
   }
 
  private:
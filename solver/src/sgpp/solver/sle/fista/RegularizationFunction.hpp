@@ -30,6 +30,18 @@ class RegularizationFunction {
    * @param stepsize is the stepsize used for the proximal step
    */
   virtual base::DataVector prox(const base::DataVector& weights, double stepsize) = 0;
+  /**
+   * @brief applyProx evaluates the proximal operator for the function for weights into a
+   * preallocated vector. This is what the solver calls in every step, implementations should
+   * override it with a single parallel pass over the weights without temporaries.
+   * @param weights
+   * @param stepsize is the stepsize used for the proximal step
+   * @param result is the result, has the size of weights
+   */
+  virtual void applyProx(const base::DataVector& weights, double stepsize,
+                         base::DataVector& result) {
+    result = prox(weights, stepsize);
+  }
 };
 
 }  // namespace solver
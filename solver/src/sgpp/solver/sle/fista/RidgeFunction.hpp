@@ -33,12 +33,19 @@ class RidgeFunction : public RegularizationFunction {
 
   base::DataVector prox(const sgpp::base::DataVector& weights, double stepsize) override {
     auto proxVec = base::DataVector(weights.getSize());
-#pragma omp parallel for
+    applyProx(weights, stepsize, proxVec);
+    return proxVec;
+  }
+
+  void applyProx(const sgpp::base::DataVector& weights, double stepsize,
+                 sgpp::base::DataVector& result) override {
+    const double scale = 1 / (1 + 2 * stepsize * lambda);
+    const double* ptrWeights = weights.data();
+    double* ptrResult = result.data();
+#pragma omp parallel for schedule(static)
     for (size_t i = 0; i < weights.getSize(); ++i) {
-      double scale = 1 + 2 * stepsize * lambda;
-      proxVec[i] = weights[i] / scale;
+      ptrResult[i] = ptrWeights[i] * scale;
     }
-    return proxVec;
   }
 
  private:
@@ -24,6 +24,11 @@ class ZeroFunction : public RegularizationFunction {
   base::DataVector prox(const base::DataVector& weights, double stepsize) override {
     return weights;
   }
+
+  void applyProx(const base::DataVector& weights, double stepsize,
+                 base::DataVector& result) override {
+    result = weights;
+  }
 };
 
 }  //  namespace solver
@@ -0,0 +1,59 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#include <sgpp/solver/sle/preconditioner/JacobiPreconditioner.hpp>
+#include <sgpp/base/exception/solver_exception.hpp>
+
+#include <sgpp/globaldef.hpp>
+
+namespace sgpp {
+namespace solver {
+
+JacobiPreconditioner::JacobiPreconditioner(const sgpp::base::DataVector& diagonal)
+    : diagonalOperator(nullptr), scale(1.0), shift(0.0), diagonal(diagonal) {}
+
+JacobiPreconditioner::JacobiPreconditioner(sgpp::base::OperationMatrix& diagonalOperator,
+                                           double scale, double shift)
+    : diagonalOperator(&diagonalOperator), scale(scale), shift(shift), diagonal(0) {}
+
+JacobiPreconditioner::~JacobiPreconditioner() {}
+
+void JacobiPreconditioner::prepare(sgpp::base::OperationMatrix& SystemMatrix, size_t size) {
+  if (inverseDiagonal.getSize() == size) {
+    return;
+  }
+
+  if (diagonalOperator != nullptr) {
+    // the operator is diagonal, its diagonal is the product with the vector of ones
+    sgpp::base::DataVector ones(size, 1.0);
+    diagonal.resize(size);
+    diagonalOperator->mult(ones, diagonal);
+    diagonal.mult(scale);
+    diagonal.add(sgpp::base::DataVector(size, shift));
+  } else if (diagonal.getSize() != size) {
+    throw sgpp::base::solver_exception(
+        "JacobiPreconditioner::prepare : size of the diagonal does not match the system");
+  }
+
+  inverseDiagonal.resize(size);
+
+  for (size_t i = 0; i < size; i++) {
+    inverseDiagonal[i] = (diagonal[i] > 0.0) ? (1.0 / diagonal[i]) : 1.0;
+  }
+}
+
+void JacobiPreconditioner::apply(sgpp::base::DataVector& r, sgpp::base::DataVector& result) {
+  result.resize(r.getSize());
+
+#pragma omp parallel for
+  for (size_t i = 0; i < r.getSize(); i++) {
+    result[i] = inverseDiagonal[i] * r[i];
+  }
+}
+
+void JacobiPreconditioner::reset() { inverseDiagonal.resize(0); }
+
+}  // namespace solver
+}  // namespace sgpp
@@ -0,0 +1,71 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#ifndef JACOBIPRECONDITIONER_HPP
+#define JACOBIPRECONDITIONER_HPP
+
+#include <sgpp/solver/sle/preconditioner/Preconditioner.hpp>
+
+#include <sgpp/globaldef.hpp>
+
+namespace sgpp {
+namespace solver {
+
+/**
+ * Jacobi (diagonal) preconditioner. The diagonal is either given explicitly or taken from a
+ * diagonal operator like base::OperationDiagonal or datadriven::OperationRegularizationDiagonal,
+ * e.g. for the regularized system B^T B + lambda * C, the diagonal lambda * C + shift can be
+ * used, where shift approximates the diagonal of B^T B.
+ * Diagonal entries that are not positive are replaced by one.
+ */
+class JacobiPreconditioner : public Preconditioner {
+ public:
+  /**
+   * Constructor for a given diagonal
+   *
+   * @param diagonal the diagonal of the system matrix
+   */
+  explicit JacobiPreconditioner(const sgpp::base::DataVector& diagonal);
+
+  /**
+   * Constructor for a diagonal operator, the diagonal is scale * diagonalOperator + shift
+   *
+   * @param diagonalOperator operator that multiplies with a diagonal matrix
+   * @param scale factor of the diagonal operator
+   * @param shift constant that is added to the diagonal
+   */
+  explicit JacobiPreconditioner(sgpp::base::OperationMatrix& diagonalOperator, double scale = 1.0,
+                                double shift = 0.0);
+
+  /**
+   * Std-Destructor
+   */
+  ~JacobiPreconditioner() override;
+
+  void prepare(sgpp::base::OperationMatrix& SystemMatrix, size_t size) override;
+
+  void apply(sgpp::base::DataVector& r, sgpp::base::DataVector& result) override;
+
+  void reset() override;
+
+  /**
+   * @return the diagonal of the last prepare()
+   */
+  const sgpp::base::DataVector& getDiagonal() const { return diagonal; }
+
+ private:
+  /// diagonal operator, nullptr if the diagonal is given explicitly
+  sgpp::base::OperationMatrix* diagonalOperator;
+  double scale;
+  double shift;
+  sgpp::base::DataVector diagonal;
+  /// inverse of the diagonal
+  sgpp::base::DataVector inverseDiagonal;
+};
+
+}  // namespace solver
+}  // namespace sgpp
+
+#endif /* JACOBIPRECONDITIONER_HPP */
@@ -0,0 +1,66 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#include <sgpp/solver/sle/preconditioner/LevelScaledPreconditioner.hpp>
+#include <sgpp/base/exception/solver_exception.hpp>
+
+#include <sgpp/globaldef.hpp>
+
+#include <cmath>
+
+namespace sgpp {
+namespace solver {
+
+LevelScaledPreconditioner::LevelScaledPreconditioner(sgpp::base::GridStorage& storage,
+                                                     double massWeight, double stiffnessWeight)
+    : storage(storage), massWeight(massWeight), stiffnessWeight(stiffnessWeight) {}
+
+LevelScaledPreconditioner::~LevelScaledPreconditioner() {}
+
+void LevelScaledPreconditioner::prepare(sgpp::base::OperationMatrix& SystemMatrix, size_t size) {
+  if (inverseDiagonal.getSize() == size) {
+    return;
+  }
+
+  if (storage.getSize() != size) {
+    throw sgpp::base::solver_exception(
+        "LevelScaledPreconditioner::prepare : size of the grid does not match the system");
+  }
+
+  const size_t dim = storage.getDimension();
+  inverseDiagonal.resize(size);
+
+#pragma omp parallel for schedule(static)
+  for (size_t i = 0; i < size; i++) {
+    sgpp::base::GridPoint& gp = storage.getPoint(i);
+    double mass = 1.0;
+    double stiffnessOverMass = 0.0;
+
+    for (size_t d = 0; d < dim; d++) {
+      const int level = static_cast<int>(gp.getLevel(d));
+      const double m1d = (level == 0) ? (1.0 / 3.0) : (2.0 / 3.0) * std::ldexp(1.0, -level);
+      const double s1d = (level == 0) ? 1.0 : 2.0 * std::ldexp(1.0, level);
+      mass *= m1d;
+      stiffnessOverMass += s1d / m1d;
+    }
+
+    const double diagonal = massWeight * mass + stiffnessWeight * mass * stiffnessOverMass;
+    inverseDiagonal[i] = (diagonal > 0.0) ? (1.0 / diagonal) : 1.0;
+  }
+}
+
+void LevelScaledPreconditioner::apply(sgpp::base::DataVector& r, sgpp::base::DataVector& result) {
+  result.resize(r.getSize());
+
+#pragma omp parallel for
+  for (size_t i = 0; i < r.getSize(); i++) {
+    result[i] = inverseDiagonal[i] * r[i];
+  }
+}
+
+void LevelScaledPreconditioner::reset() { inverseDiagonal.resize(0); }
+
+}  // namespace solver
+}  // namespace sgpp
@@ -0,0 +1,61 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#ifndef LEVELSCALEDPRECONDITIONER_HPP
+#define LEVELSCALEDPRECONDITIONER_HPP
+
+#include <sgpp/base/grid/GridStorage.hpp>
+#include <sgpp/solver/sle/preconditioner/Preconditioner.hpp>
+
+#include <sgpp/globaldef.hpp>
+
+namespace sgpp {
+namespace solver {
+
+/**
+ * Diagonal preconditioner for hierarchical bases that only depends on the levels of the grid
+ * points. The diagonal entry of the grid point with level l is
+ * @f$m \prod_d M_{l_d} + s \sum_d S_{l_d} \prod_{k \neq d} M_{l_k}@f$,
+ * where @f$M_l@f$ and @f$S_l@f$ are the 1D mass and stiffness integrals of the linear hat
+ * function of level l on the unit interval (@f$M_l = \frac{2}{3} 2^{-l}@f$,
+ * @f$S_l = 2 \cdot 2^l@f$ and @f$M_0 = \frac{1}{3}@f$, @f$S_0 = 1@f$ for the boundary functions).
+ * This is the exact diagonal of m * mass matrix + s * Laplacian for linear grids and a
+ * level-dependent scaling for other hierarchical bases. No system matrix product is needed.
+ */
+class LevelScaledPreconditioner : public Preconditioner {
+ public:
+  /**
+   * Constructor
+   *
+   * @param storage the grid storage, the order of the unknowns is the order of the grid points
+   * @param massWeight weight m of the mass matrix
+   * @param stiffnessWeight weight s of the Laplacian
+   */
+  LevelScaledPreconditioner(sgpp::base::GridStorage& storage, double massWeight,
+                            double stiffnessWeight);
+
+  /**
+   * Std-Destructor
+   */
+  ~LevelScaledPreconditioner() override;
+
+  void prepare(sgpp::base::OperationMatrix& SystemMatrix, size_t size) override;
+
+  void apply(sgpp::base::DataVector& r, sgpp::base::DataVector& result) override;
+
+  void reset() override;
+
+ private:
+  sgpp::base::GridStorage& storage;
+  double massWeight;
+  double stiffnessWeight;
+  /// inverse of the diagonal
+  sgpp::base::DataVector inverseDiagonal;
+};
+
+}  // namespace solver
+}  // namespace sgpp
+
+#endif /* LEVELSCALEDPRECONDITIONER_HPP */
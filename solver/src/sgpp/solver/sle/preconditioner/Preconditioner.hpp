@@ -0,0 +1,56 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#ifndef PRECONDITIONER_HPP
+#define PRECONDITIONER_HPP
+
+#include <sgpp/base/datatypes/DataVector.hpp>
+#include <sgpp/base/operation/hash/OperationMatrix.hpp>
+
+#include <sgpp/globaldef.hpp>
+
+namespace sgpp {
+namespace solver {
+
+/**
+ * Abstract preconditioner M for the iterative solvers of systems of linear equations, i.e. an
+ * approximation of the system matrix whose inverse can be applied cheaply.
+ * A preconditioner is attached to a solver with SLESolver::setPreconditioner.
+ */
+class Preconditioner {
+ public:
+  /**
+   * Std-Destructor
+   */
+  virtual ~Preconditioner() {}
+
+  /**
+   * Called by the solver before the iteration starts, computes whatever the preconditioner
+   * needs from the system matrix. Implementations keep their data as long as the size of the
+   * system does not change, call reset() after other changes of the system matrix.
+   *
+   * @param SystemMatrix the system matrix
+   * @param size number of unknowns
+   */
+  virtual void prepare(sgpp::base::OperationMatrix& SystemMatrix, size_t size) = 0;
+
+  /**
+   * Applies the inverse of the preconditioner: result = M^{-1} * r
+   *
+   * @param r the residual
+   * @param result the preconditioned residual
+   */
+  virtual void apply(sgpp::base::DataVector& r, sgpp::base::DataVector& result) = 0;
+
+  /**
+   * Discards the data computed by prepare(), the next solve recomputes it
+   */
+  virtual void reset() {}
+};
+
+}  // namespace solver
+}  // namespace sgpp
+
+#endif /* PRECONDITIONER_HPP */
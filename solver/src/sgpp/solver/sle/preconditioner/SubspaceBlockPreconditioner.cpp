@@ -0,0 +1,84 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#include <sgpp/solver/sle/preconditioner/SubspaceBlockPreconditioner.hpp>
+#include <sgpp/base/exception/solver_exception.hpp>
+
+#include <sgpp/globaldef.hpp>
+
+#include <map>
+#include <vector>
+
+namespace sgpp {
+namespace solver {
+
+SubspaceBlockPreconditioner::SubspaceBlockPreconditioner(sgpp::base::GridStorage& storage)
+    : storage(storage), numSubspaces(0) {}
+
+SubspaceBlockPreconditioner::~SubspaceBlockPreconditioner() {}
+
+void SubspaceBlockPreconditioner::prepare(sgpp::base::OperationMatrix& SystemMatrix,
+                                          size_t size) {
+  if (inverseDiagonal.getSize() == size) {
+    return;
+  }
+
+  if (storage.getSize() != size) {
+    throw sgpp::base::solver_exception(
+        "SubspaceBlockPreconditioner::prepare : size of the grid does not match the system");
+  }
+
+  // group the grid points by their level vectors
+  const size_t dim = storage.getDimension();
+  std::map<std::vector<sgpp::base::GridPoint::level_type>, std::vector<size_t>> subspaces;
+  std::vector<sgpp::base::GridPoint::level_type> level(dim);
+
+  for (size_t i = 0; i < size; i++) {
+    sgpp::base::GridPoint& gp = storage.getPoint(i);
+
+    for (size_t d = 0; d < dim; d++) {
+      level[d] = gp.getLevel(d);
+    }
+
+    subspaces[level].push_back(i);
+  }
+
+  numSubspaces = subspaces.size();
+  inverseDiagonal.resize(size);
+
+  sgpp::base::DataVector indicator(size, 0.0);
+  sgpp::base::DataVector rowSums(size);
+
+  for (auto& subspace : subspaces) {
+    for (size_t i : subspace.second) {
+      indicator[i] = 1.0;
+    }
+
+    SystemMatrix.mult(indicator, rowSums);
+
+    for (size_t i : subspace.second) {
+      indicator[i] = 0.0;
+      inverseDiagonal[i] = (rowSums[i] > 0.0) ? (1.0 / rowSums[i]) : 1.0;
+    }
+  }
+}
+
+void SubspaceBlockPreconditioner::apply(sgpp::base::DataVector& r,
+                                        sgpp::base::DataVector& result) {
+  result.resize(r.getSize());
+
+#pragma omp parallel for
+  for (size_t i = 0; i < r.getSize(); i++) {
+    result[i] = inverseDiagonal[i] * r[i];
+  }
+}
+
+void SubspaceBlockPreconditioner::reset() {
+  inverseDiagonal.resize(0);
+  numSubspaces = 0;
+}
+
+}  // namespace solver
+}  // namespace sgpp
@@ -0,0 +1,65 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#ifndef SUBSPACEBLOCKPRECONDITIONER_HPP
+#define SUBSPACEBLOCKPRECONDITIONER_HPP
+
+#include <sgpp/base/grid/GridStorage.hpp>
+#include <sgpp/solver/sle/preconditioner/Preconditioner.hpp>
+
+#include <sgpp/globaldef.hpp>
+
+#include <vector>
+
+namespace sgpp {
+namespace solver {
+
+/**
+ * Block diagonal preconditioner with one block per hierarchical subspace (grid points with the
+ * same level vector). The blocks are computed from the system matrix itself: the product of the
+ * system matrix with the indicator vector of a subspace yields the row sums of its block.
+ * If the basis functions of a subspace have disjoint supports (e.g. linear and modified linear
+ * grids), the block of the subspace is diagonal for mass, stiffness and regression (B^T B)
+ * matrices and the preconditioner is the exact block Jacobi preconditioner. Otherwise the blocks
+ * are approximated by their row sums (lumping).
+ *
+ * prepare() needs one product with the system matrix per subspace.
+ */
+class SubspaceBlockPreconditioner : public Preconditioner {
+ public:
+  /**
+   * Constructor
+   *
+   * @param storage the grid storage, the order of the unknowns is the order of the grid points
+   */
+  explicit SubspaceBlockPreconditioner(sgpp::base::GridStorage& storage);
+
+  /**
+   * Std-Destructor
+   */
+  ~SubspaceBlockPreconditioner() override;
+
+  void prepare(sgpp::base::OperationMatrix& SystemMatrix, size_t size) override;
+
+  void apply(sgpp::base::DataVector& r, sgpp::base::DataVector& result) override;
+
+  void reset() override;
+
+  /**
+   * @return number of subspaces of the last prepare()
+   */
+  size_t getNumberSubspaces() const { return numSubspaces; }
+
+ private:
+  sgpp::base::GridStorage& storage;
+  size_t numSubspaces;
+  /// inverse of the (lumped) blocks
+  sgpp::base::DataVector inverseDiagonal;
+};
+
+}  // namespace solver
+}  // namespace sgpp
+
+#endif /* SUBSPACEBLOCKPRECONDITIONER_HPP */
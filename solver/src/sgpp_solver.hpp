@@ -8,6 +8,12 @@
 
 #include <sgpp/solver/sle/ConjugateGradients.hpp>
 #include <sgpp/solver/sle/BiCGStab.hpp>
+#include <sgpp/solver/sle/PipelinedConjugateGradients.hpp>
+#include <sgpp/solver/sle/BlockConjugateGradients.hpp>
+#include <sgpp/solver/sle/preconditioner/Preconditioner.hpp>
+#include <sgpp/solver/sle/preconditioner/JacobiPreconditioner.hpp>
+#include <sgpp/solver/sle/preconditioner/LevelScaledPreconditioner.hpp>
+#include <sgpp/solver/sle/preconditioner/SubspaceBlockPreconditioner.hpp>
 #include <sgpp/solver/ode/Euler.hpp>
 #include <sgpp/solver/ode/CrankNicolson.hpp>
 #include <sgpp/solver/ode/AdamsBashforth.hpp>
@@ -17,6 +23,7 @@
 #include <sgpp/solver/ode/StepsizeControlH.hpp>
 #include <sgpp/solver/ode/StepsizeControlMC.hpp>
 #include <sgpp/solver/ode/StepsizeControlBDF.hpp>
+#include <sgpp/solver/ode/TimestepStatistics.hpp>
 #include <sgpp/solver/TypesSolver.hpp>
 #include <sgpp/solver/SLESolverTypeParser.hpp>
 #include <sgpp/solver/operation/hash/OperationParabolicPDESolverSystem.hpp>
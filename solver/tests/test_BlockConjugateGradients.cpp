@@ -0,0 +1,143 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#define BOOST_TEST_DYN_LINK
+
+#include <boost/test/unit_test.hpp>
+
+#include <sgpp/base/datatypes/DataMatrix.hpp>
+#include <sgpp/base/datatypes/DataVector.hpp>
+#include <sgpp/base/operation/hash/OperationMatrix.hpp>
+#include <sgpp/solver/sle/BlockConjugateGradients.hpp>
+#include <sgpp/solver/sle/ConjugateGradients.hpp>
+#include <sgpp/solver/sle/preconditioner/JacobiPreconditioner.hpp>
+
+#include <cmath>
+
+using sgpp::base::DataMatrix;
+using sgpp::base::DataVector;
+
+namespace {
+
+/**
+ * Badly scaled SPD matrix D^{1/2} (tridiag(-1, 2, -1) + I) D^{1/2} with d_i = 1 + i,
+ * counts the products with single vectors and with matrices
+ */
+class ScaledLaplace : public sgpp::base::OperationMatrix {
+ public:
+  void mult(DataVector& alpha, DataVector& result) override {
+    const size_t size = alpha.getSize();
+    result.resize(size);
+    vectorProducts++;
+
+    for (size_t i = 0; i < size; i++) {
+      const double left = (i > 0) ? (-scale(i - 1) * alpha[i - 1]) : 0.0;
+      const double right = (i + 1 < size) ? (-scale(i + 1) * alpha[i + 1]) : 0.0;
+      result[i] = scale(i) * (3.0 * scale(i) * alpha[i] + left + right);
+    }
+  }
+
+  void multMatrix(DataMatrix& alphas, DataMatrix& result) override {
+    matrixProducts++;
+    // the column-wise fallback of the base class, without counting its vector products
+    sgpp::base::OperationMatrix::multMatrix(alphas, result);
+    vectorProducts -= alphas.getNcols();
+  }
+
+  double diagonal(size_t i) { return 3.0 * scale(i) * scale(i); }
+
+  size_t vectorProducts = 0;
+  size_t matrixProducts = 0;
+
+ private:
+  double scale(size_t i) { return std::sqrt(1.0 + static_cast<double>(i)); }
+};
+
+}  // namespace
+
+BOOST_AUTO_TEST_SUITE(TestBlockConjugateGradients)
+
+BOOST_AUTO_TEST_CASE(testBlockConjugateGradients) {
+  const size_t size = 200;
+  const size_t numColumns = 4;
+  ScaledLaplace system;
+  sgpp::solver::ConjugateGradients cg(1000, 1e-10);
+  sgpp::solver::BlockConjugateGradients blockCG(1000, 1e-10);
+
+  DataVector diagonal(size);
+
+  for (size_t i = 0; i < size; i++) {
+    diagonal[i] = system.diagonal(i);
+  }
+
+  sgpp::solver::JacobiPreconditioner jacobi(diagonal);
+
+  // right hand sides of different difficulty, the last one is already solved by zero
+  DataMatrix b(size, numColumns, 0.0);
+
+  for (size_t i = 0; i < size; i++) {
+    b.set(i, 0, std::sin(static_cast<double>(i)));
+    b.set(i, 1, 1.0);
+    b.set(i, 2, (i == size / 2) ? 1.0 : 0.0);
+  }
+
+  for (bool preconditioned : {false, true}) {
+    cg.setPreconditioner(preconditioned ? &jacobi : nullptr);
+    blockCG.setPreconditioner(preconditioned ? &jacobi : nullptr);
+
+    system.vectorProducts = 0;
+    system.matrixProducts = 0;
+    DataMatrix alphas;
+    blockCG.solve(system, alphas, b, false, false, -1.0);
+
+    // all right hand sides share one batched product per iteration
+    BOOST_CHECK_EQUAL(system.vectorProducts, 0);
+    BOOST_CHECK_LE(system.matrixProducts, blockCG.getNumberIterations() + 1 +
+                                              blockCG.getNumberIterations() / 50);
+    BOOST_CHECK_EQUAL(blockCG.getColumnIterations()[numColumns - 1], 0);
+
+    // every column is the same as the solution of ConjugateGradients
+    size_t maxIterations = 0;
+
+    for (size_t k = 0; k < numColumns; k++) {
+      DataVector column(size);
+      DataVector alpha(size);
+      b.getColumn(k, column);
+      cg.solve(system, alpha, column, false, false, -1.0);
+
+      BOOST_CHECK_EQUAL(blockCG.getColumnIterations()[k], cg.getNumberIterations());
+      maxIterations = std::max(maxIterations, cg.getNumberIterations());
+
+      for (size_t i = 0; i < size; i++) {
+        BOOST_CHECK_SMALL(alphas.get(i, k) - alpha[i], 1e-8);
+      }
+
+      // and solves the system
+      DataVector result(size);
+      system.mult(alpha, result);
+
+      for (size_t i = 0; i < size; i++) {
+        BOOST_CHECK_SMALL(result[i] - column[i], 1e-6);
+      }
+    }
+
+    BOOST_CHECK_EQUAL(blockCG.getNumberIterations(), maxIterations);
+  }
+
+  // solving with a single vector
+  blockCG.setPreconditioner(nullptr);
+  DataVector alpha(size, 0.0);
+  DataVector column(size);
+  b.getColumn(1, column);
+  blockCG.solve(system, alpha, column, false, false, -1.0);
+  DataVector result(size);
+  system.mult(alpha, result);
+
+  for (size_t i = 0; i < size; i++) {
+    BOOST_CHECK_SMALL(result[i] - column[i], 1e-6);
+  }
+}
+
+BOOST_AUTO_TEST_SUITE_END()
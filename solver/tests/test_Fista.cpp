@@ -11,6 +11,7 @@
 #include <sgpp/base/grid/Grid.hpp>
 #include <sgpp/base/operation/BaseOpFactory.hpp>
 #include <sgpp/solver/sle/ConjugateGradients.hpp>
+#include <sgpp/solver/sle/fista/ElasticNetFunction.hpp>
 #include <sgpp/solver/sle/fista/Fista.hpp>
 #include <sgpp/solver/sle/fista/RidgeFunction.hpp>
 
@@ -75,4 +76,77 @@ BOOST_AUTO_TEST_CASE(testFista) {
   }
 }
 
+BOOST_AUTO_TEST_CASE(testFistaRestartAndPath) {
+  const size_t dim = 2;
+  const size_t level = 4;
+  const auto numExamplesTrain = 1470;
+
+  auto yTrain = DataVector(numExamplesTrain);
+  auto datasetTrain = DataMatrix(numExamplesTrain, dim);
+  for (auto i = 0; i < numExamplesTrain; ++i) {
+    const double x1 = std::abs(std::sin(i));
+    const double x2 = std::abs(std::sin(i * x1));
+    const auto row = DataVector(std::vector<double>({x1, x2}));
+    datasetTrain.setRow(i, row);
+    yTrain.set(i, std::sinh(x1) + std::sinh(x2));
+  }
+
+  auto grid = sgpp::base::Grid::createModLinearGrid(dim);
+  grid->getGenerator().regular(level);
+  auto op = sgpp::op_factory::createOperationMultipleEval(*grid, datasetTrain);
+
+  const size_t maxIt = 5000;
+  const double treshold = 1e-10;
+  const std::vector<double> lambdas = {10.0, 3.0, 1.0, 0.3, 0.1};
+
+  // 0.5 * ||Ax - b||^2 + g(x)
+  auto objective = [&](sgpp::solver::ElasticNetFunction& g, DataVector& weights) {
+    auto errors = DataVector(numExamplesTrain);
+    op->mult(weights, errors);
+    errors.sub(yTrain);
+    return 0.5 * errors.dotProduct(errors) + g.eval(weights);
+  };
+
+  // the restart reaches the same minimum
+  auto elasticNet = sgpp::solver::ElasticNetFunction(lambdas.back(), 0.5);
+  auto weightsRestart = DataVector(grid->getSize(), 0.0);
+  auto solverRestart = sgpp::solver::Fista<decltype(elasticNet)>(elasticNet);
+  solverRestart.solve(*op, weightsRestart, yTrain, maxIt, treshold);
+
+  auto weightsNoRestart = DataVector(grid->getSize(), 0.0);
+  auto solverNoRestart = sgpp::solver::Fista<decltype(elasticNet)>(elasticNet);
+  solverNoRestart.setAdaptiveRestart(false);
+  solverNoRestart.solve(*op, weightsNoRestart, yTrain, maxIt, treshold);
+
+  const double objectiveRestart = objective(elasticNet, weightsRestart);
+  BOOST_CHECK_CLOSE(objectiveRestart, objective(elasticNet, weightsNoRestart), 0.1);
+  BOOST_CHECK_LE(solverRestart.getNumberIterations(), solverNoRestart.getNumberIterations());
+  BOOST_CHECK_GT(solverRestart.getL(), 0.0);
+
+  // the warm started path reaches the minima of the cold started solves
+  std::vector<sgpp::solver::ElasticNetFunction> functions;
+  for (double lambda : lambdas) {
+    functions.push_back(sgpp::solver::ElasticNetFunction(lambda, 0.5));
+  }
+
+  auto weightsPath = DataVector(grid->getSize(), 0.0);
+  std::vector<DataVector> solutions;
+  auto solverPath = sgpp::solver::Fista<decltype(elasticNet)>(functions.front());
+  solverPath.solvePath(*op, weightsPath, yTrain, functions, solutions, maxIt, treshold);
+  BOOST_CHECK_EQUAL(solutions.size(), lambdas.size());
+  BOOST_CHECK_CLOSE(objective(elasticNet, solutions.back()), objectiveRestart, 0.1);
+
+  size_t numIterationsCold = 0;
+  for (size_t i = 0; i < lambdas.size(); ++i) {
+    auto weights = DataVector(grid->getSize(), 0.0);
+    auto solver = sgpp::solver::Fista<decltype(elasticNet)>(functions[i]);
+    solver.solve(*op, weights, yTrain, maxIt, treshold);
+    numIterationsCold += solver.getNumberIterations();
+    BOOST_CHECK_CLOSE(objective(functions[i], solutions[i]), objective(functions[i], weights),
+                      0.1);
+  }
+
+  BOOST_CHECK_LT(solverPath.getNumberIterations(), numIterationsCold);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,106 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#define BOOST_TEST_DYN_LINK
+
+#include <boost/test/unit_test.hpp>
+
+#include <sgpp/base/datatypes/DataVector.hpp>
+#include <sgpp/base/operation/hash/OperationMatrix.hpp>
+#include <sgpp/solver/sle/ConjugateGradients.hpp>
+#include <sgpp/solver/sle/PipelinedConjugateGradients.hpp>
+#include <sgpp/solver/sle/preconditioner/JacobiPreconditioner.hpp>
+
+#include <cmath>
+
+using sgpp::base::DataVector;
+
+namespace {
+
+/**
+ * Badly scaled SPD matrix D^{1/2} (tridiag(-1, 2, -1) + I) D^{1/2} with d_i = 1 + i
+ */
+class ScaledLaplace : public sgpp::base::OperationMatrix {
+ public:
+  void mult(DataVector& alpha, DataVector& result) override {
+    const size_t size = alpha.getSize();
+    result.resize(size);
+
+    for (size_t i = 0; i < size; i++) {
+      const double left = (i > 0) ? (-scale(i - 1) * alpha[i - 1]) : 0.0;
+      const double right = (i + 1 < size) ? (-scale(i + 1) * alpha[i + 1]) : 0.0;
+      result[i] = scale(i) * (3.0 * scale(i) * alpha[i] + left + right);
+    }
+  }
+
+  double diagonal(size_t i) { return 3.0 * scale(i) * scale(i); }
+
+ private:
+  double scale(size_t i) { return std::sqrt(1.0 + static_cast<double>(i)); }
+};
+
+}  // namespace
+
+BOOST_AUTO_TEST_SUITE(TestPipelinedConjugateGradients)
+
+BOOST_AUTO_TEST_CASE(testPipelinedConjugateGradients) {
+  ScaledLaplace system;
+  sgpp::solver::ConjugateGradients cg(1000, 1e-10);
+  sgpp::solver::PipelinedConjugateGradients pipelined(1000, 1e-10);
+
+  // the workspace of the pipelined solver is reused for different sizes
+  for (size_t size : {200, 50, 300}) {
+    DataVector reference(size);
+
+    for (size_t i = 0; i < size; i++) {
+      reference[i] = std::sin(static_cast<double>(i));
+    }
+
+    DataVector b(size);
+    system.mult(reference, b);
+
+    DataVector alpha(size);
+    DataVector alphaPipelined(size);
+    cg.solve(system, alpha, b, false, false, 0.0);
+    pipelined.solve(system, alphaPipelined, b, false, false, 0.0);
+
+    // same iterates in exact arithmetic
+    BOOST_CHECK_LE(pipelined.getNumberIterations(), cg.getNumberIterations() + 5);
+    BOOST_CHECK_GE(pipelined.getNumberIterations() + 5, cg.getNumberIterations());
+
+    for (size_t i = 0; i < size; i++) {
+      BOOST_CHECK_SMALL(alphaPipelined[i] - reference[i], 1e-6);
+    }
+
+    // preconditioned
+    DataVector diagonal(size);
+
+    for (size_t i = 0; i < size; i++) {
+      diagonal[i] = system.diagonal(i);
+    }
+
+    sgpp::solver::JacobiPreconditioner jacobi(diagonal);
+    cg.setPreconditioner(&jacobi);
+    pipelined.setPreconditioner(&jacobi);
+    cg.solve(system, alpha, b, false, false, 0.0);
+    pipelined.solve(system, alphaPipelined, b, false, false, 0.0);
+    BOOST_CHECK_LE(pipelined.getNumberIterations(), cg.getNumberIterations() + 5);
+
+    for (size_t i = 0; i < size; i++) {
+      BOOST_CHECK_SMALL(alphaPipelined[i] - reference[i], 1e-6);
+    }
+
+    cg.setPreconditioner(nullptr);
+    pipelined.setPreconditioner(nullptr);
+  }
+
+  // the solution is kept if the system is already solved
+  DataVector b(10, 0.0);
+  DataVector alpha(10, 0.0);
+  pipelined.solve(system, alpha, b, true, false, 0.0);
+  BOOST_CHECK_EQUAL(pipelined.getNumberIterations(), 0);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,183 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#define BOOST_TEST_DYN_LINK
+
+#include <boost/test/unit_test.hpp>
+
+#include <sgpp/base/datatypes/DataMatrix.hpp>
+#include <sgpp/base/datatypes/DataVector.hpp>
+#include <sgpp/base/grid/Grid.hpp>
+#include <sgpp/base/operation/BaseOpFactory.hpp>
+#include <sgpp/base/operation/hash/OperationMatrix.hpp>
+#include <sgpp/solver/sle/BiCGStab.hpp>
+#include <sgpp/solver/sle/ConjugateGradients.hpp>
+#include <sgpp/solver/sle/preconditioner/JacobiPreconditioner.hpp>
+#include <sgpp/solver/sle/preconditioner/LevelScaledPreconditioner.hpp>
+#include <sgpp/solver/sle/preconditioner/SubspaceBlockPreconditioner.hpp>
+
+#include <cmath>
+#include <memory>
+#include <random>
+
+using sgpp::base::DataMatrix;
+using sgpp::base::DataVector;
+
+namespace {
+
+/**
+ * Regularized least squares system B^T B / M + lambda * C with the level-dependent diagonal
+ * regularization operator C
+ */
+class RegressionSystem : public sgpp::base::OperationMatrix {
+ public:
+  RegressionSystem(sgpp::base::Grid& grid, DataMatrix& dataset, double lambda)
+      : op(sgpp::op_factory::createOperationMultipleEval(grid, dataset)),
+        regularization(sgpp::op_factory::createOperationDiagonal(grid)),
+        numData(dataset.getNrows()),
+        lambda(lambda) {}
+
+  void mult(DataVector& alpha, DataVector& result) override {
+    DataVector temp(numData);
+    op->mult(alpha, temp);
+    op->multTranspose(temp, result);
+    result.mult(1.0 / static_cast<double>(numData));
+    DataVector temp2(alpha.getSize());
+    regularization->mult(alpha, temp2);
+    result.axpy(lambda, temp2);
+  }
+
+  std::unique_ptr<sgpp::base::OperationMultipleEval> op;
+  std::unique_ptr<sgpp::base::OperationMatrix> regularization;
+
+ private:
+  size_t numData;
+  double lambda;
+};
+
+class IdentityMatrix : public sgpp::base::OperationMatrix {
+ public:
+  void mult(DataVector& alpha, DataVector& result) override { result = alpha; }
+};
+
+}  // namespace
+
+BOOST_AUTO_TEST_SUITE(TestPreconditioner)
+
+BOOST_AUTO_TEST_CASE(testPreconditionedSolvers) {
+  const size_t dim = 2;
+  const double lambda = 1e-2;
+  std::mt19937 generator(7);
+  std::uniform_real_distribution<double> distribution(0.0, 1.0);
+
+  DataMatrix dataset(1000, dim);
+
+  for (size_t i = 0; i < dataset.getSize(); i++) {
+    dataset[i] = distribution(generator);
+  }
+
+  std::unique_ptr<sgpp::base::Grid> grid(sgpp::base::Grid::createLinearGrid(dim));
+  grid->getGenerator().regular(5);
+  const size_t size = grid->getSize();
+  RegressionSystem system(*grid, dataset, lambda);
+
+  DataVector reference(size);
+
+  for (size_t i = 0; i < size; i++) {
+    reference[i] = distribution(generator) - 0.5;
+  }
+
+  DataVector b(size);
+  system.mult(reference, b);
+
+  // exact diagonal for the Jacobi preconditioner
+  DataVector diagonal(size);
+  DataVector unit(size, 0.0);
+  DataVector column(size);
+
+  for (size_t i = 0; i < size; i++) {
+    unit[i] = 1.0;
+    system.mult(unit, column);
+    diagonal[i] = column[i];
+    unit[i] = 0.0;
+  }
+
+  sgpp::solver::SubspaceBlockPreconditioner subspaceBlock(grid->getStorage());
+  sgpp::solver::JacobiPreconditioner jacobi(diagonal);
+  sgpp::solver::JacobiPreconditioner jacobiRegularization(*system.regularization, lambda);
+
+  sgpp::solver::ConjugateGradients cg(5000, 1e-10);
+  DataVector alpha(size);
+  cg.solve(system, alpha, b, false, false, 0.0);
+  const size_t iterationsUnpreconditioned = cg.getNumberIterations();
+  BOOST_CHECK_GE(cg.getDuration(), 0.0);
+
+  for (sgpp::solver::Preconditioner* preconditioner :
+       {static_cast<sgpp::solver::Preconditioner*>(&subspaceBlock),
+        static_cast<sgpp::solver::Preconditioner*>(&jacobi),
+        static_cast<sgpp::solver::Preconditioner*>(&jacobiRegularization)}) {
+    cg.setPreconditioner(preconditioner);
+    cg.solve(system, alpha, b, false, false, 0.0);
+    BOOST_CHECK_LT(cg.getNumberIterations(), iterationsUnpreconditioned);
+
+    for (size_t i = 0; i < size; i++) {
+      BOOST_CHECK_SMALL(alpha[i] - reference[i], 1e-4);
+    }
+  }
+
+  // the blocks of the subspaces of a linear grid are diagonal
+  BOOST_CHECK_EQUAL(subspaceBlock.getNumberSubspaces(), 15);
+  DataVector r(size, 1.0);
+  DataVector zSubspace(size);
+  DataVector zJacobi(size);
+  subspaceBlock.apply(r, zSubspace);
+  jacobi.apply(r, zJacobi);
+
+  for (size_t i = 0; i < size; i++) {
+    BOOST_CHECK_CLOSE(zSubspace[i], zJacobi[i], 1e-8);
+  }
+
+  sgpp::solver::BiCGStab bicgstab(5000, 1e-10);
+  bicgstab.solve(system, alpha, b, false, false, 0.0);
+  const size_t iterationsBiCGStab = bicgstab.getNumberIterations();
+  bicgstab.setPreconditioner(&subspaceBlock);
+  bicgstab.solve(system, alpha, b, false, false, 0.0);
+  BOOST_CHECK_LT(bicgstab.getNumberIterations(), iterationsBiCGStab);
+
+  for (size_t i = 0; i < size; i++) {
+    BOOST_CHECK_SMALL(alpha[i] - reference[i], 1e-4);
+  }
+}
+
+BOOST_AUTO_TEST_CASE(testLevelScaledPreconditioner) {
+  std::unique_ptr<sgpp::base::Grid> grid(sgpp::base::Grid::createLinearGrid(2));
+  grid->getGenerator().regular(3);
+  sgpp::base::GridStorage& storage = grid->getStorage();
+  const size_t size = grid->getSize();
+  // the level-scaled diagonal does not use the system matrix
+  IdentityMatrix identity;
+  DataVector ones(size, 1.0);
+  DataVector massResult(size);
+  DataVector laplaceResult(size);
+
+  sgpp::solver::LevelScaledPreconditioner mass(storage, 1.0, 0.0);
+  sgpp::solver::LevelScaledPreconditioner laplace(storage, 0.0, 1.0);
+  mass.prepare(identity, size);
+  laplace.prepare(identity, size);
+  mass.apply(ones, massResult);
+  laplace.apply(ones, laplaceResult);
+
+  // diagonal of the mass matrix and of the Laplacian of the linear basis for level (l_1, l_2):
+  // (2/3)^2 2^(-l_1-l_2) and (4/3) (2^(l_1-l_2) + 2^(l_2-l_1))
+  for (size_t i = 0; i < size; i++) {
+    const double l1 = static_cast<double>(storage.getPoint(i).getLevel(0));
+    const double l2 = static_cast<double>(storage.getPoint(i).getLevel(1));
+    BOOST_CHECK_CLOSE(1.0 / massResult[i], 4.0 / 9.0 * std::pow(2.0, -l1 - l2), 1e-12);
+    BOOST_CHECK_CLOSE(1.0 / laplaceResult[i],
+                      4.0 / 3.0 * (std::pow(2.0, l1 - l2) + std::pow(2.0, l2 - l1)), 1e-12);
+  }
+}
+
+BOOST_AUTO_TEST_SUITE_END()